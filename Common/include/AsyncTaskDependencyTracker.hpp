@@ -0,0 +1,121 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declares Diligent::AsyncTaskDependencyTracker class.
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+/// Implements event-driven task prerequisites for the thread pools.
+///
+/// A task whose prerequisites are not finished is not put into the thread pool queue.
+/// Instead, the tracker registers a completion callback with every prerequisite that is
+/// derived from AsyncTaskBase and keeps the number of outstanding prerequisites.
+/// When the last prerequisite finishes, the task is handed back to the thread pool
+/// through the OnTaskReady callback, so that pending tasks cost no CPU time.
+///
+/// Prerequisites that are not derived from AsyncTaskBase cannot notify the tracker.
+/// They are kept in the TaskInfo::Prerequisites list, and the thread pool must poll them.
+class AsyncTaskDependencyTracker
+{
+public:
+    /// Queued task information
+    struct TaskInfo
+    {
+        RefCntAutoPtr<IAsyncTask> pTask;
+
+        /// Prerequisites that must be polled by the thread pool.
+        std::vector<RefCntWeakPtr<IAsyncTask>> Prerequisites;
+
+        /// The time the task was put into the queue, see ThreadPoolProfiler::GetTimestamp().
+        /// Only set when the thread pool profiler is enabled.
+        Int64 EnqueueTime = 0;
+    };
+
+    /// The function that is called when all prerequisites of a pending task are finished.
+    ///
+    /// The function must put the task into the thread pool queue and then call OnReadyTaskQueued(),
+    /// so that the task is always counted either as pending or as queued.
+    /// It is called while the internal mutex is locked, and must not call any other tracker method.
+    using OnTaskReadyType = std::function<void(TaskInfo&&)>;
+
+    explicit AsyncTaskDependencyTracker(OnTaskReadyType OnTaskReady);
+    ~AsyncTaskDependencyTracker();
+
+    // clang-format off
+    AsyncTaskDependencyTracker           (const AsyncTaskDependencyTracker&)  = delete;
+    AsyncTaskDependencyTracker& operator=(const AsyncTaskDependencyTracker&)  = delete;
+    AsyncTaskDependencyTracker           (      AsyncTaskDependencyTracker&&) = delete;
+    AsyncTaskDependencyTracker& operator=(      AsyncTaskDependencyTracker&&) = delete;
+    // clang-format on
+
+    /// Adds the task with its prerequisites.
+
+    /// \param [in]  pTask            - The task.
+    /// \param [in]  ppPrerequisites  - Task prerequisites.
+    /// \param [in]  NumPrerequisites - The number of prerequisites.
+    /// \param [out] ReadyTask        - If the task can be queued right away, receives the task information.
+    ///
+    /// \return     true if the task is ready to be queued, and false if the task is pending.
+    ///
+    /// If the task priority is higher than the minimum priority of its unfinished prerequisites,
+    /// the task priority is lowered to that value.
+    bool AddTask(IAsyncTask* pTask, IAsyncTask** ppPrerequisites, Uint32 NumPrerequisites, TaskInfo& ReadyTask);
+
+    /// Removes the pending task. Returns true if the task was found.
+    bool RemoveTask(IAsyncTask* pTask);
+
+    /// Checks if the task is pending.
+    bool IsTaskPending(IAsyncTask* pTask) const;
+
+    /// Returns the number of pending tasks.
+    Uint32 GetNumPendingTasks() const;
+
+    /// Must be called by the OnTaskReady function after the task has been put into the queue.
+    /// Returns the number of remaining pending tasks.
+    Uint32 OnReadyTaskQueued();
+
+private:
+    struct PendingTask;
+    struct State;
+
+    static void OnPrerequisiteFinished(const std::weak_ptr<State>& wpState, const std::shared_ptr<PendingTask>& pPendingTask);
+
+private:
+    std::shared_ptr<State> m_pState;
+};
+
+} // namespace Diligent
@@ -0,0 +1,166 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Implementation of the IDataBlob interface with aligned, uninitialized storage
+
+#include <functional>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/DataBlob.h"
+#include "../../Primitives/interface/MemoryAllocator.h"
+#include "RefCntAutoPtr.hpp"
+#include "ObjectBase.hpp"
+
+namespace Diligent
+{
+
+/// Data blob with a configurable alignment that does not initialize its memory.
+
+/// Unlike DataBlobImpl, which keeps the data in a std::vector, the blob never zero-fills
+/// the memory: new bytes added by Create() or Resize() have undefined values. This avoids
+/// touching every page of large blobs that are about to be overwritten anyway, e.g. when
+/// serializing archives.
+///
+/// The alignment may range from the pointer size up to the page or huge page size.
+/// On Linux, allocations aligned to HugePageAlignment or more are marked as eligible for
+/// transparent huge pages, which greatly reduces the number of page faults when a large
+/// blob is written for the first time.
+///
+/// The blob can also adopt memory allocated elsewhere, in which case the memory is released
+/// by a user-provided deleter.
+class AlignedDataBlob final : public ObjectBase<IDataBlob>
+{
+public:
+    using TBase = ObjectBase<IDataBlob>;
+
+    /// Function that releases adopted memory.
+    using DeleterType = std::function<void(void* pData)>;
+
+    static constexpr size_t DefaultAlignment = 64;
+
+    /// Alignment that makes the allocation eligible for transparent huge pages on Linux.
+    static constexpr size_t HugePageAlignment = size_t{2} << 20;
+
+    /// Creates a new data blob.
+
+    /// \param [in] InitialSize - Initial size of the blob, in bytes.
+    /// \param [in] pData       - Optional data to copy to the blob. If null, the contents are not initialized.
+    /// \param [in] Alignment   - Data alignment. Must be a power of two.
+    /// \param [in] pAllocator  - Memory allocator. If null, the default raw memory allocator is used.
+    static RefCntAutoPtr<AlignedDataBlob> Create(size_t            InitialSize = 0,
+                                                 const void*       pData       = nullptr,
+                                                 size_t            Alignment   = DefaultAlignment,
+                                                 IMemoryAllocator* pAllocator  = nullptr);
+
+    /// Creates a data blob that takes ownership of externally allocated memory.
+
+    /// \param [in] pData     - Pointer to the memory.
+    /// \param [in] Size      - Data size, in bytes.
+    /// \param [in] Deleter   - Function that releases the memory when the blob is destroyed
+    ///                         or reallocates the data. May be null if the memory does not
+    ///                         need to be released.
+    /// \param [in] Capacity  - Size of the memory block. The blob can grow up to this size
+    ///                         without reallocation. If zero, Size is used.
+    /// \param [in] Alignment - Alignment of pData, which is also used if the data is reallocated.
+    static RefCntAutoPtr<AlignedDataBlob> Adopt(void*         pData,
+                                                size_t        Size,
+                                                DeleterType&& Deleter,
+                                                size_t        Capacity  = 0,
+                                                size_t        Alignment = DefaultAlignment);
+
+    /// Creates a copy of the data blob.
+    static RefCntAutoPtr<AlignedDataBlob> MakeCopy(const IDataBlob* pDataBlob, size_t Alignment = DefaultAlignment);
+
+    ~AlignedDataBlob() override;
+
+    virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override;
+
+    /// Sets the size of the blob. New bytes are not initialized.
+
+    /// If the new size exceeds the capacity, the data is moved to a new memory block.
+    /// When a non-empty blob grows, the capacity grows geometrically so that a sequence of
+    /// small Resize() calls takes amortized linear time.
+    virtual void DILIGENT_CALL_TYPE Resize(size_t NewSize) override;
+
+    /// Returns the size of the blob
+    virtual size_t DILIGENT_CALL_TYPE GetSize() const override;
+
+    /// Returns the pointer to the data
+    virtual void* DILIGENT_CALL_TYPE GetDataPtr(size_t Offset = 0) override;
+
+    /// Returns the const pointer to the data
+    virtual const void* DILIGENT_CALL_TYPE GetConstDataPtr(size_t Offset = 0) const override;
+
+    template <typename T>
+    T* GetDataPtr(size_t Offset = 0)
+    {
+        return reinterpret_cast<T*>(GetDataPtr(Offset));
+    }
+
+    template <typename T>
+    const T* GetConstDataPtr(size_t Offset = 0) const
+    {
+        return reinterpret_cast<const T*>(GetConstDataPtr(Offset));
+    }
+
+    /// Makes sure that the blob can grow up to Capacity bytes without reallocation.
+    void Reserve(size_t Capacity);
+
+    /// Returns the size of the memory block, in bytes.
+    size_t GetCapacity() const { return m_Capacity; }
+
+    /// Returns the data alignment.
+    size_t GetAlignment() const { return m_Alignment; }
+
+private:
+    template <typename AllocatorType, typename ObjectType>
+    friend class MakeNewRCObj;
+
+    AlignedDataBlob(IReferenceCounters* pRefCounters,
+                    IMemoryAllocator&   Allocator,
+                    size_t              Alignment);
+
+    void Reallocate(size_t NewCapacity);
+    void ReleaseMemory();
+
+private:
+    IMemoryAllocator& m_Allocator;
+    const size_t      m_Alignment;
+
+    Uint8* m_pData    = nullptr;
+    size_t m_Size     = 0;
+    size_t m_Capacity = 0;
+
+    // Deleter of the adopted memory. Memory allocated by the blob itself is released with m_Allocator.
+    DeleterType m_Deleter;
+    bool        m_IsAdopted = false;
+};
+
+} // namespace Diligent
@@ -30,6 +30,7 @@
 /// 2D array processing utilities.
 
 #include "../../Primitives/interface/BasicTypes.h"
+#include "../../Graphics/GraphicsEngine/interface/GraphicsTypes.h"
 
 namespace Diligent
 {
@@ -49,4 +50,96 @@ void GetArray2DMinMaxValue(const float* pData,
                            float&       MinValue,
                            float&       MaxValue);
 
+/// Describes a 2D array processed by the Array2DTools reduction functions.
+///
+/// The reductions are vectorized for the CPU they run on: the instruction set is selected
+/// at run time rather than at compile time. Float, half and 8/16-bit integer elements are
+/// processed as 32-bit floats, which represent them exactly; 32-bit integers are processed
+/// with their native type. NaN values are not supported.
+///
+/// Every reduction optionally splits the rows between the threads of a thread pool.
+struct Array2DDesc
+{
+    /// A pointer to the array data. Must be aligned to the element size.
+    const void* pData = nullptr;
+
+    /// Row stride, in bytes. Must be a multiple of the element size.
+    size_t Stride = 0;
+
+    /// 2D array width.
+    Uint32 Width = 0;
+
+    /// 2D array height.
+    Uint32 Height = 0;
+
+    /// Element type: VT_FLOAT32, VT_FLOAT16, VT_INT8, VT_UINT8, VT_INT16, VT_UINT16, VT_INT32 or VT_UINT32.
+    VALUE_TYPE ElementType = VT_FLOAT32;
+};
+
+/// The minimum and the maximum value in a 2D array and their locations.
+struct Array2DMinMax
+{
+    /// Minimum value.
+    double MinValue = 0;
+
+    /// Maximum value.
+    double MaxValue = 0;
+
+    /// Column and row of the first minimum value in the row-major order.
+    Uint32 MinX = 0;
+    Uint32 MinY = 0;
+
+    /// Column and row of the first maximum value in the row-major order.
+    Uint32 MaxX = 0;
+    Uint32 MaxY = 0;
+};
+
+/// Computes the minimum and the maximum value in a 2D array and their locations.
+
+/// \param[in]  Desc        - 2D array description.
+/// \param[in]  pThreadPool - An optional thread pool to process the rows in parallel.
+/// \return     The minimum and maximum values and their locations.
+///             If the array is empty, all members are zero.
+Array2DMinMax GetArray2DMinMax(const Array2DDesc& Desc, IThreadPool* pThreadPool = nullptr);
+
+/// Computes the sum of all values in a 2D array.
+
+/// \param[in]  Desc        - 2D array description.
+/// \param[in]  pThreadPool - An optional thread pool to process the rows in parallel.
+/// \return     The sum of all values, accumulated with double precision.
+double GetArray2DSum(const Array2DDesc& Desc, IThreadPool* pThreadPool = nullptr);
+
+/// Computes the mean value of a 2D array.
+
+/// \param[in]  Desc        - 2D array description.
+/// \param[in]  pThreadPool - An optional thread pool to process the rows in parallel.
+/// \return     The mean value, or zero if the array is empty.
+double GetArray2DMean(const Array2DDesc& Desc, IThreadPool* pThreadPool = nullptr);
+
+/// Counts the values in a 2D array that are greater than the threshold.
+
+/// \param[in]  Desc        - 2D array description.
+/// \param[in]  Threshold   - Threshold value.
+/// \param[in]  pThreadPool - An optional thread pool to process the rows in parallel.
+/// \return     The number of values that are strictly greater than Threshold.
+Uint64 GetArray2DCountAbove(const Array2DDesc& Desc, double Threshold, IThreadPool* pThreadPool = nullptr);
+
+/// Computes the histogram of a 2D array.
+
+/// \param[in]  Desc        - 2D array description.
+/// \param[in]  MinValue    - The lower bound of the first bin.
+/// \param[in]  MaxValue    - The upper bound of the last bin. Must be greater than MinValue.
+/// \param[in]  NumBins     - The number of bins of equal width.
+/// \param[out] pBins       - An array of NumBins counters. The counters are overwritten.
+/// \param[in]  pThreadPool - An optional thread pool to process the rows in parallel.
+///
+/// Values below MinValue are counted in the first bin, and values at or above
+/// MaxValue are counted in the last bin.
+void ComputeArray2DHistogram(const Array2DDesc& Desc,
+                             double             MinValue,
+                             double             MaxValue,
+                             Uint32             NumBins,
+                             Uint64*            pBins,
+                             IThreadPool*       pThreadPool = nullptr);
+
 } // namespace Diligent
@@ -0,0 +1,142 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Asynchronous file reader
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "../../Primitives/interface/DataBlob.h"
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+/// Asynchronous task that reads an entire file into a data blob, see Diligent::AsyncFileReader.
+class AsyncFileReadTask final : public AsyncTaskBase
+{
+public:
+    AsyncFileReadTask(IReferenceCounters* pRefCounters,
+                      const Char*         Path,
+                      float               fPriority);
+
+    virtual ASYNC_TASK_STATUS DILIGENT_CALL_TYPE Run(Uint32 ThreadId) override final;
+
+    /// Returns the path of the file.
+    const std::string& GetPath() const { return m_Path; }
+
+    /// Returns the file data, or null if the task is not complete or the file could not be read.
+    IDataBlob* GetData() const
+    {
+        return GetStatus() == ASYNC_TASK_STATUS_COMPLETE ? m_pData.RawPtr() : nullptr;
+    }
+
+private:
+    const std::string        m_Path;
+    RefCntAutoPtr<IDataBlob> m_pData;
+};
+
+
+/// Asynchronous file reader create information
+struct AsyncFileReaderCreateInfo
+{
+    /// The number of I/O threads.
+
+    /// The threads spend most of their time blocked in the kernel, so a small
+    /// number of threads is usually enough to keep the storage device busy.
+    Uint32 NumThreads = 2;
+};
+
+/// Reads files on dedicated I/O threads.
+
+/// Read requests are put into a priority queue serviced by the I/O threads of an
+/// internal thread pool. Every request returns an IAsyncTask that completes into
+/// an IDataBlob with the file contents.
+///
+/// Files that will be needed soon can be prefetched: their data is read in the
+/// background at a lower priority and is kept by the reader until it is requested
+/// with ReadFile(), which then returns the prefetch task instead of reading the file again.
+///
+/// All methods are thread-safe.
+class AsyncFileReader
+{
+public:
+    explicit AsyncFileReader(const AsyncFileReaderCreateInfo& CI = {});
+
+    /// Cancels prefetch requests that have not started yet and waits for the running ones.
+    ~AsyncFileReader();
+
+    // clang-format off
+    AsyncFileReader           (const AsyncFileReader&)  = delete;
+    AsyncFileReader           (      AsyncFileReader&&) = delete;
+    AsyncFileReader& operator=(const AsyncFileReader&)  = delete;
+    AsyncFileReader& operator=(      AsyncFileReader&&) = delete;
+    // clang-format on
+
+    /// Enqueues an asynchronous read of the entire file.
+
+    /// \param [in] Path      - File path.
+    /// \param [in] fPriority - Request priority. Requests with higher priority are started first.
+    ///
+    /// \return     The read task. When the task is complete, AsyncFileReadTask::GetData()
+    ///             returns the file contents, or null if the file could not be read.
+    ///
+    /// If the file has been prefetched, the prefetch task is returned and removed from
+    /// the prefetch cache. If the task has not started yet, its priority is raised to fPriority.
+    RefCntAutoPtr<AsyncFileReadTask> ReadFile(const Char* Path, float fPriority = 0);
+
+    /// Starts reading the files in the background.
+
+    /// \param [in] ppPaths   - An array of file paths.
+    /// \param [in] NumPaths  - The number of paths in the array.
+    /// \param [in] fPriority - Prefetch priority, which should normally be lower than
+    ///                         the priority of the requests that are needed right away.
+    ///
+    /// Files that are already being prefetched are skipped.
+    void Prefetch(const Char* const* ppPaths, Uint32 NumPaths, float fPriority = -1);
+
+    /// Cancels and releases the prefetch requests that have not been claimed by ReadFile().
+    void ClearPrefetchCache();
+
+    /// Returns the number of prefetched files that have not been claimed by ReadFile().
+    size_t GetPrefetchCacheSize() const;
+
+    /// Waits until all requests are finished.
+    void WaitForAllReads();
+
+private:
+    RefCntAutoPtr<IThreadPool> m_pThreadPool;
+
+    mutable std::mutex                                                    m_PrefetchCacheMtx;
+    std::unordered_map<std::string, RefCntAutoPtr<AsyncFileReadTask>> m_PrefetchCache;
+};
+
+} // namespace Diligent
@@ -0,0 +1,468 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::BoundingVolumeHierarchy class
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <utility>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "AdvancedMath.hpp"
+#include "ThreadPool.h"
+
+namespace Diligent
+{
+
+/// Diligent::BoundingVolumeHierarchy build attributes
+struct BVHBuildAttribs
+{
+    /// The maximum number of primitives in a leaf, unless the primitives
+    /// can't be split (e.g. all have the same center).
+    Uint32 MaxPrimsInLeaf = 4;
+
+    /// The number of bins used to evaluate the SAH split candidates along each axis (2 to 64).
+    Uint32 NumBins = 16;
+
+    /// An optional thread pool to build the hierarchy in parallel.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+/// Bounding volume hierarchy (BVH) of axis-aligned bounding boxes.
+
+/// The hierarchy is a binary tree built with the surface area heuristic (SAH). The nodes are
+/// stored in one array, the two children of every node are adjacent, and every subtree covers
+/// a contiguous range of primitives.
+///
+/// The hierarchy only stores the primitive bounding boxes. Ray queries take a function
+/// that intersects the ray with the primitive, for example:
+///
+///     float HitDist = 0;
+///     Uint32 Tri = BVH.CastRay(RayOrigin, RayDir, [&](Uint32 TriIdx) {
+///         return IntersectRayTriangle(V[TriIdx * 3], V[TriIdx * 3 + 1], V[TriIdx * 3 + 2], RayOrigin, RayDir);
+///     }, HitDist);
+///
+/// The queries are const and may be executed by multiple threads simultaneously.
+class BoundingVolumeHierarchy
+{
+public:
+    /// Index returned by the queries when no primitive is found.
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    /// Maximum depth of the tree. Nodes at this depth become leaves regardless of the number of primitives.
+    static constexpr Uint32 MaxDepth = 64;
+
+    /// BVH node
+    struct Node
+    {
+        /// Bounding box minimum corner.
+        float3 Min;
+
+        /// Index of the first child for inner nodes (the second child is FirstChildOrPrim + 1),
+        /// or index of the first primitive in the primitive index array for leaves.
+        Uint32 FirstChildOrPrim = 0;
+
+        /// Bounding box maximum corner.
+        float3 Max;
+
+        /// The number of primitives in the leaf, or zero for inner nodes.
+        Uint32 NumPrims = 0;
+
+        bool IsLeaf() const
+        {
+            return NumPrims != 0;
+        }
+
+        BoundBox GetBox() const
+        {
+            return BoundBox{Min, Max};
+        }
+    };
+    static_assert(sizeof(Node) == 32, "Two sibling nodes are expected to fit into one cache line");
+
+    BoundingVolumeHierarchy() noexcept {}
+
+    /// Builds the hierarchy, see Build().
+    BoundingVolumeHierarchy(const BoundBox* pBoxes, Uint32 NumBoxes, const BVHBuildAttribs& Attribs = BVHBuildAttribs{})
+    {
+        Build(pBoxes, NumBoxes, Attribs);
+    }
+
+    /// Builds the hierarchy for the primitives with the given bounding boxes.
+
+    /// \param[in] pBoxes   - Primitive bounding boxes. The primitive index in all queries is the index in this array.
+    /// \param[in] NumBoxes - The number of primitives.
+    /// \param[in] Attribs  - Build attributes.
+    void Build(const BoundBox* pBoxes, Uint32 NumBoxes, const BVHBuildAttribs& Attribs = BVHBuildAttribs{});
+
+    /// Updates the bounding boxes of all nodes without changing the tree topology.
+
+    /// \param[in] pBoxes - New primitive bounding boxes. The array must contain the same number of
+    ///                     boxes as the array used to build the hierarchy.
+    ///
+    /// \remarks    Refitting is much faster than rebuilding, but the tree quality degrades when
+    ///             the primitives move significantly relative to each other.
+    void Refit(const BoundBox* pBoxes);
+
+    /// Releases all nodes.
+    void Clear();
+
+    /// Finds the closest primitive hit by the ray.
+
+    /// \param[in]  RayOrigin          - Ray origin.
+    /// \param[in]  RayDirection       - Ray direction.
+    /// \param[in]  IntersectPrimitive - Function that is called with the primitive index and returns the distance
+    ///                                  along the ray to the intersection point, or a negative value or +FLT_MAX
+    ///                                  if the ray misses the primitive (see IntersectRayTriangle).
+    /// \param[out] HitDistance        - Distance to the closest hit, or MaxDistance if no primitive was hit.
+    /// \param[in]  MaxDistance        - Only hits closer than this distance are considered.
+    /// \return     The index of the closest primitive, or InvalidIndex if no primitive was hit.
+    template <typename IntersectPrimitiveType>
+    Uint32 CastRay(const float3&            RayOrigin,
+                   const float3&            RayDirection,
+                   IntersectPrimitiveType&& IntersectPrimitive,
+                   float&                   HitDistance,
+                   float                    MaxDistance = +FLT_MAX) const;
+
+    /// Tests if the ray hits any primitive closer than MaxDistance.
+
+    /// The function stops the traversal at the first hit, see CastRay() for the parameters.
+    /// \return     The index of the hit primitive (not necessarily the closest), or InvalidIndex.
+    template <typename IntersectPrimitiveType>
+    Uint32 CastRayAnyHit(const float3&            RayOrigin,
+                         const float3&            RayDirection,
+                         IntersectPrimitiveType&& IntersectPrimitive,
+                         float                    MaxDistance = +FLT_MAX) const;
+
+    /// Enumerates the primitives whose bounding boxes are visible in the frustum.
+
+    /// \param[in] Frustum    - View frustum (ViewFrustum or ViewFrustumExt).
+    /// \param[in] Callback   - Function that is called for every visible primitive with the
+    ///                         primitive index and its BoxVisibility (Intersecting or FullyVisible).
+    /// \param[in] PlaneFlags - Frustum planes to test the boxes against.
+    ///
+    /// \remarks    The boxes of the primitives in the subtrees that are fully visible are not tested.
+    template <typename FrustumType, typename CallbackType>
+    void QueryFrustum(const FrustumType&  Frustum,
+                      CallbackType&&      Callback,
+                      FRUSTUM_PLANE_FLAGS PlaneFlags = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM) const;
+
+    /// Finds the primitive whose bounding box is the nearest to the point.
+
+    /// \param[in]  Pos         - Point position.
+    /// \param[out] Distance    - Distance to the nearest box (zero if the point is inside the box),
+    ///                           or MaxDistance if no box was found.
+    /// \param[in]  MaxDistance - Only boxes closer than this distance are considered.
+    /// \return     The index of the primitive with the nearest box, or InvalidIndex.
+    Uint32 FindNearestBox(const float3& Pos, float& Distance, float MaxDistance = +FLT_MAX) const;
+
+    bool IsEmpty() const
+    {
+        return m_Nodes.empty();
+    }
+
+    Uint32 GetNumPrims() const
+    {
+        return static_cast<Uint32>(m_PrimIndices.size());
+    }
+
+    /// Returns the bounding box of all primitives.
+    BoundBox GetBoundBox() const
+    {
+        return !m_Nodes.empty() ? m_Nodes[0].GetBox() : BoundBox{};
+    }
+
+    /// Returns the nodes. The root node is the first one.
+    const std::vector<Node>& GetNodes() const
+    {
+        return m_Nodes;
+    }
+
+    /// Returns the primitive indices in the order of the leaves.
+    const std::vector<Uint32>& GetPrimIndices() const
+    {
+        return m_PrimIndices;
+    }
+
+private:
+    // Precomputed ray data for the ray-node tests
+    struct RayInfo
+    {
+        RayInfo(const float3& _Origin, const float3& Direction);
+
+        // Same as IntersectRayBox3D, but with precomputed reciprocal direction.
+        // EnterDist is clamped to zero when the origin is inside the box.
+        bool IntersectNode(const Node& N, float MaxDistance, float& EnterDist) const;
+
+        float3 Origin;
+        float3 InvDir;
+        bool   IsParallel[3] = {};
+    };
+
+    struct StackEntry
+    {
+        Uint32 NodeIdx;
+        float  Distance;
+    };
+
+    // Returns the range of primitives covered by the subtree
+    void GetSubtreePrimRange(Uint32 NodeIdx, Uint32& First, Uint32& End) const;
+
+    std::vector<Node>     m_Nodes;
+    std::vector<Uint32>   m_PrimIndices;
+    std::vector<BoundBox> m_PrimBoxes; // Primitive boxes in the order of m_PrimIndices
+};
+
+
+inline BoundingVolumeHierarchy::RayInfo::RayInfo(const float3& _Origin, const float3& Direction) :
+    Origin{_Origin}
+{
+    VERIFY_EXPR(Direction != float3(0, 0, 0));
+    for (int i = 0; i < 3; ++i)
+    {
+        // Same epsilon as in IntersectRayBox3D: the box does not limit the ray along this axis
+        IsParallel[i] = std::abs(Direction[i]) <= 1e-20f;
+        InvDir[i]     = IsParallel[i] ? 0.f : 1.f / Direction[i];
+    }
+}
+
+inline bool BoundingVolumeHierarchy::RayInfo::IntersectNode(const Node& N, float MaxDistance, float& EnterDist) const
+{
+    // Multiplying the exit distance by 1 + 2 * gamma(3) makes the test conservative
+    // with respect to rounding errors (see Ize, "Robust BVH Ray Traversal", 2013).
+    static constexpr float RobustFactor = 1.00000072f;
+
+    float Enter = 0;
+    float Exit  = MaxDistance;
+    for (int i = 0; i < 3; ++i)
+    {
+        if (IsParallel[i])
+            continue;
+
+        float t0 = (N.Min[i] - Origin[i]) * InvDir[i];
+        float t1 = (N.Max[i] - Origin[i]) * InvDir[i];
+        if (InvDir[i] < 0)
+            std::swap(t0, t1);
+
+        Enter = (std::max)(Enter, t0);
+        Exit  = (std::min)(Exit, t1 * RobustFactor);
+    }
+
+    EnterDist = Enter;
+    return Enter <= Exit;
+}
+
+inline void BoundingVolumeHierarchy::GetSubtreePrimRange(Uint32 NodeIdx, Uint32& First, Uint32& End) const
+{
+    Uint32 LeftIdx = NodeIdx;
+    while (!m_Nodes[LeftIdx].IsLeaf())
+        LeftIdx = m_Nodes[LeftIdx].FirstChildOrPrim;
+
+    Uint32 RightIdx = NodeIdx;
+    while (!m_Nodes[RightIdx].IsLeaf())
+        RightIdx = m_Nodes[RightIdx].FirstChildOrPrim + 1;
+
+    First = m_Nodes[LeftIdx].FirstChildOrPrim;
+    End   = m_Nodes[RightIdx].FirstChildOrPrim + m_Nodes[RightIdx].NumPrims;
+}
+
+template <typename IntersectPrimitiveType>
+Uint32 BoundingVolumeHierarchy::CastRay(const float3&            RayOrigin,
+                                        const float3&            RayDirection,
+                                        IntersectPrimitiveType&& IntersectPrimitive,
+                                        float&                   HitDistance,
+                                        float                    MaxDistance) const
+{
+    HitDistance = MaxDistance;
+    if (m_Nodes.empty())
+        return InvalidIndex;
+
+    const RayInfo Ray{RayOrigin, RayDirection};
+
+    float RootDist = 0;
+    if (!Ray.IntersectNode(m_Nodes[0], MaxDistance, RootDist))
+        return InvalidIndex;
+
+    Uint32 HitPrim = InvalidIndex;
+
+    StackEntry StackBuffer[MaxDepth + 1];
+    Uint32     StackSize = 0;
+
+    StackBuffer[StackSize++] = {0, RootDist};
+    while (StackSize > 0)
+    {
+        const StackEntry Entry = StackBuffer[--StackSize];
+        // Skip the nodes that are farther than the closest hit found after they were pushed
+        if (Entry.Distance >= HitDistance)
+            continue;
+
+        Uint32 NodeIdx = Entry.NodeIdx;
+        while (true)
+        {
+            const Node& N = m_Nodes[NodeIdx];
+            if (N.IsLeaf())
+            {
+                for (Uint32 i = N.FirstChildOrPrim; i < N.FirstChildOrPrim + N.NumPrims; ++i)
+                {
+                    const Uint32 PrimIdx = m_PrimIndices[i];
+                    const float  Dist    = IntersectPrimitive(PrimIdx);
+                    if (Dist >= 0 && Dist < HitDistance)
+                    {
+                        HitDistance = Dist;
+                        HitPrim     = PrimIdx;
+                    }
+                }
+                break;
+            }
+
+            // Visit the closer child first, and push the other one to the stack
+            Uint32 Child0 = N.FirstChildOrPrim;
+            Uint32 Child1 = N.FirstChildOrPrim + 1;
+            float  Dist0 = 0, Dist1 = 0;
+
+            const bool Hit0 = Ray.IntersectNode(m_Nodes[Child0], HitDistance, Dist0);
+            const bool Hit1 = Ray.IntersectNode(m_Nodes[Child1], HitDistance, Dist1);
+            if (Hit0 && Hit1)
+            {
+                if (Dist1 < Dist0)
+                {
+                    std::swap(Child0, Child1);
+                    std::swap(Dist0, Dist1);
+                }
+                VERIFY_EXPR(StackSize <= MaxDepth);
+                StackBuffer[StackSize++] = {Child1, Dist1};
+                NodeIdx                  = Child0;
+            }
+            else if (Hit0 || Hit1)
+            {
+                NodeIdx = Hit0 ? Child0 : Child1;
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    return HitPrim;
+}
+
+template <typename IntersectPrimitiveType>
+Uint32 BoundingVolumeHierarchy::CastRayAnyHit(const float3&            RayOrigin,
+                                              const float3&            RayDirection,
+                                              IntersectPrimitiveType&& IntersectPrimitive,
+                                              float                    MaxDistance) const
+{
+    if (m_Nodes.empty())
+        return InvalidIndex;
+
+    const RayInfo Ray{RayOrigin, RayDirection};
+
+    Uint32 StackBuffer[MaxDepth + 1];
+    Uint32 StackSize = 0;
+
+    StackBuffer[StackSize++] = 0;
+    while (StackSize > 0)
+    {
+        const Node& N = m_Nodes[StackBuffer[--StackSize]];
+
+        float EnterDist = 0;
+        if (!Ray.IntersectNode(N, MaxDistance, EnterDist))
+            continue;
+
+        if (N.IsLeaf())
+        {
+            for (Uint32 i = N.FirstChildOrPrim; i < N.FirstChildOrPrim + N.NumPrims; ++i)
+            {
+                const float Dist = IntersectPrimitive(m_PrimIndices[i]);
+                if (Dist >= 0 && Dist < MaxDistance)
+                    return m_PrimIndices[i];
+            }
+        }
+        else
+        {
+            VERIFY_EXPR(StackSize + 2 <= MaxDepth + 1);
+            StackBuffer[StackSize++] = N.FirstChildOrPrim + 1;
+            StackBuffer[StackSize++] = N.FirstChildOrPrim;
+        }
+    }
+
+    return InvalidIndex;
+}
+
+template <typename FrustumType, typename CallbackType>
+void BoundingVolumeHierarchy::QueryFrustum(const FrustumType&  Frustum,
+                                           CallbackType&&      Callback,
+                                           FRUSTUM_PLANE_FLAGS PlaneFlags) const
+{
+    if (m_Nodes.empty())
+        return;
+
+    Uint32 StackBuffer[MaxDepth + 1];
+    Uint32 StackSize = 0;
+
+    StackBuffer[StackSize++] = 0;
+    while (StackSize > 0)
+    {
+        const Uint32 NodeIdx = StackBuffer[--StackSize];
+        const Node&  N       = m_Nodes[NodeIdx];
+
+        const BoxVisibility Visibility = GetBoxVisibility(Frustum, N.GetBox(), PlaneFlags);
+        if (Visibility == BoxVisibility::Invisible)
+            continue;
+
+        if (Visibility == BoxVisibility::FullyVisible)
+        {
+            // All primitives in the subtree are fully visible
+            Uint32 First = 0, End = 0;
+            GetSubtreePrimRange(NodeIdx, First, End);
+            for (Uint32 i = First; i < End; ++i)
+                Callback(m_PrimIndices[i], BoxVisibility::FullyVisible);
+        }
+        else if (N.IsLeaf())
+        {
+            for (Uint32 i = N.FirstChildOrPrim; i < N.FirstChildOrPrim + N.NumPrims; ++i)
+            {
+                const BoxVisibility PrimVisibility = GetBoxVisibility(Frustum, m_PrimBoxes[i], PlaneFlags);
+                if (PrimVisibility != BoxVisibility::Invisible)
+                    Callback(m_PrimIndices[i], PrimVisibility);
+            }
+        }
+        else
+        {
+            VERIFY_EXPR(StackSize + 2 <= MaxDepth + 1);
+            StackBuffer[StackSize++] = N.FirstChildOrPrim + 1;
+            StackBuffer[StackSize++] = N.FirstChildOrPrim;
+        }
+    }
+}
+
+} // namespace Diligent
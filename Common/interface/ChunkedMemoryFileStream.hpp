@@ -0,0 +1,138 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Implementation of the ChunkedMemoryFileStream class
+
+#include <vector>
+
+#include "../../Primitives/interface/FileStream.h"
+#include "../../Primitives/interface/DataBlob.h"
+#include "../../Primitives/interface/MemoryAllocator.h"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "AlignedDataBlob.hpp"
+
+namespace Diligent
+{
+
+/// Growable memory file stream that keeps the data in a list of chunks.
+
+/// Unlike MemoryFileStream, which stores the data in a single blob, the stream never
+/// moves the data that has already been written: when the last chunk is full, a new chunk
+/// is added. Chunk sizes grow geometrically from InitialChunkSize up to MaxChunkSize, so
+/// the number of allocations is logarithmic in the stream size until the maximum chunk
+/// size is reached, and every byte is copied exactly once on write.
+///
+/// The data can be consumed without copying via GetChunkCount()/GetChunk() or WriteTo(),
+/// or moved out of the stream as a single contiguous blob with DetachData().
+class ChunkedMemoryFileStream final : public ObjectBase<IFileStream>
+{
+public:
+    typedef ObjectBase<IFileStream> TBase;
+
+    static constexpr size_t DefaultInitialChunkSize = size_t{64} << 10;
+    static constexpr size_t DefaultMaxChunkSize     = size_t{64} << 20;
+
+    ChunkedMemoryFileStream(IReferenceCounters* pRefCounters,
+                            size_t              InitialChunkSize = DefaultInitialChunkSize,
+                            size_t              MaxChunkSize     = DefaultMaxChunkSize,
+                            IMemoryAllocator*   pAllocator       = nullptr);
+
+    static RefCntAutoPtr<ChunkedMemoryFileStream> Create(size_t            InitialChunkSize = DefaultInitialChunkSize,
+                                                         size_t            MaxChunkSize     = DefaultMaxChunkSize,
+                                                         IMemoryAllocator* pAllocator       = nullptr);
+
+    virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override final;
+
+    /// Reads the data from the current position to the end of the stream
+    virtual void DILIGENT_CALL_TYPE ReadBlob(IDataBlob* pData) override final;
+
+    /// Reads data from the stream
+    virtual bool DILIGENT_CALL_TYPE Read(void* Data, size_t Size) override final;
+
+    /// Writes data to the stream, overwriting the existing data and extending the stream as needed
+    virtual bool DILIGENT_CALL_TYPE Write(const void* Data, size_t Size) override final;
+
+    virtual size_t DILIGENT_CALL_TYPE GetSize() override final;
+
+    virtual size_t DILIGENT_CALL_TYPE GetPos() override final;
+
+    /// Sets the current position. The position must not exceed the stream size.
+    virtual bool DILIGENT_CALL_TYPE SetPos(size_t Offset, int Origin) override final;
+
+    virtual bool DILIGENT_CALL_TYPE IsValid() override final;
+
+    /// Contiguous range of the stream data
+    struct Chunk
+    {
+        const void* pData = nullptr;
+        size_t      Size  = 0;
+    };
+
+    /// Returns the number of chunks.
+    Uint32 GetChunkCount() const { return static_cast<Uint32>(m_Chunks.size()); }
+
+    /// Returns the data of the chunk with the given index.
+
+    /// The pointer remains valid until the data is detached, or the stream is reset or destroyed.
+    Chunk GetChunk(Uint32 Index) const;
+
+    /// Writes the entire stream contents to another stream, chunk by chunk.
+    bool WriteTo(IFileStream* pDstStream) const;
+
+    /// Moves the stream data into a single contiguous blob owned by the caller.
+
+    /// \warning  The stream is left empty, as after Reset().
+    ///
+    /// If the stream consists of one chunk, that chunk is returned and no data is copied.
+    /// Otherwise, the chunks are merged into a new blob and released.
+    RefCntAutoPtr<IDataBlob> DetachData();
+
+    /// Releases all chunks and resets the stream to the empty state.
+    void Reset();
+
+private:
+    void   AddChunk(size_t MinSize);
+    Uint32 FindChunk(size_t Offset) const;
+
+private:
+    IMemoryAllocator& m_Allocator;
+    const size_t      m_InitialChunkSize;
+    const size_t      m_MaxChunkSize;
+
+    std::vector<RefCntAutoPtr<AlignedDataBlob>> m_Chunks;
+    // Stream offset of every chunk
+    std::vector<size_t> m_ChunkOffsets;
+
+    size_t m_Size = 0;
+    size_t m_Pos  = 0;
+};
+
+} // namespace Diligent
@@ -0,0 +1,550 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::ConcurrentObjectsRegistry class.
+
+#include <unordered_map>
+#include <mutex>
+#include <memory>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+#include <thread>
+
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "ObjectsRegistry.hpp"
+
+namespace Diligent
+{
+
+/// A thread-safe object registry that is optimized for frequent concurrent lookups.
+///
+/// The registry has the same interface and semantics as ObjectsRegistry, and works with std::shared_ptr
+/// or RefCntAutoPtr. The difference is how the table is synchronized:
+///
+/// - The keys are distributed between independent shards by their hash.
+/// - Each shard keeps an immutable snapshot of its table that is read without taking any lock.
+///   A reader protects the snapshot it accesses with a hazard slot. Every slot occupies its own
+///   cache line, and a thread picks the slot by its id, so concurrent readers do not write to
+///   shared memory.
+/// - New entries are added to a small pending table protected by the shard mutex. When the pending
+///   table grows large enough, it is merged with the snapshot into a new snapshot that replaces
+///   the old one. An old snapshot is released as soon as no hazard slot refers to it. Since every
+///   slot protects at most one snapshot, the number of retired snapshots that are kept alive
+///   never exceeds the number of slots.
+/// - Creation is single-flight per key: each key has exactly one live wrapper, and the wrapper
+///   serializes the calls to the initializer function.
+/// - Expired entries are purged incrementally: every NumRequestsToPurge requests that miss the snapshot,
+///   one shard is rebuilt without its expired entries.
+///
+/// The registry is best suited for caches that are read by many threads every frame and are rarely
+/// modified. Adding a new key costs amortized O(1), but a snapshot rebuild copies the shard's table.
+template <typename KeyType,
+          typename StrongPtrType,
+          typename KeyHasher = std::hash<KeyType>,
+          typename KeyEqual  = std::equal_to<KeyType>>
+class ConcurrentObjectsRegistry
+{
+public:
+    using WeakPtrType = typename _StrongPtrHelper<StrongPtrType>::WeakPtrType;
+
+    /// \param [in] NumRequestsToPurge - The number of requests that miss the snapshot after which
+    ///                                  one shard is purged of expired entries.
+    /// \param [in] NumShards          - The number of independent shards.
+    explicit ConcurrentObjectsRegistry(Uint32 NumRequestsToPurge = 1024, Uint32 NumShards = 16) :
+        m_NumRequestsToPurge{NumRequestsToPurge},
+        m_NumShards{(std::max)(NumShards, 1u)},
+        m_HazardSlots{(std::max)(2 * std::thread::hardware_concurrency(), Uint32{MinHazardSlots})},
+        m_Shards{new Shard[m_NumShards]}
+    {
+        for (Uint32 i = 0; i < m_NumShards; ++i)
+            m_Shards[i].SetHazardSlots(m_HazardSlots);
+    }
+
+    // clang-format off
+    ConcurrentObjectsRegistry           (const ConcurrentObjectsRegistry&)  = delete;
+    ConcurrentObjectsRegistry           (      ConcurrentObjectsRegistry&&) = delete;
+    ConcurrentObjectsRegistry& operator=(const ConcurrentObjectsRegistry&)  = delete;
+    ConcurrentObjectsRegistry& operator=(      ConcurrentObjectsRegistry&&) = delete;
+    // clang-format on
+
+    /// Finds the object in the registry and returns strong pointer to it (std::shared_ptr or RefCntAutoPtr).
+    /// If the object is not found, it is atomically created using the provided initializer.
+    ///
+    /// \param [in] Key          - The object key.
+    /// \param [in] CreateObject - Initializer function that is called if the object is not found in the registry.
+    ///
+    /// \return     Strong pointer to the object with the specified key, either retrieved from the registry or initialized
+    ///             with the CreateObject function.
+    ///
+    /// CreateObject function may throw in case of an error.
+    ///
+    /// It is guaranteed, that the Object will only be initialized once, even if multiple threads call Get() simultaneously.
+    template <typename CreateObjectType>
+    StrongPtrType Get(const KeyType&     Key,
+                      CreateObjectType&& CreateObject // May throw
+                      ) noexcept(false)
+    {
+        Shard& KeyShard = GetShard(Key);
+
+        // Fast path: the object is alive and is found in the snapshot.
+        if (StrongPtrType pObject = KeyShard.Find(Key))
+            return pObject;
+
+        while (true)
+        {
+            // Get the wrapper under the shard mutex. Since this is a shared pointer, it may not be destroyed
+            // while we keep one, even if it is removed from the registry by another thread.
+            std::shared_ptr<ObjectWrapper> pObjectWrpr = KeyShard.GetWrapper(Key, /*AddIfNotFound = */ true);
+            VERIFY_EXPR(pObjectWrpr);
+
+            OnSlowPathRequest();
+
+            // Only one thread may run the initializer for this wrapper at a time.
+            // If the initializer throws, the wrapper remains uninitialized and the next
+            // thread will attempt to create the object again.
+            bool          IsExpired = false;
+            StrongPtrType pObject   = pObjectWrpr->Get(std::forward<CreateObjectType>(CreateObject), IsExpired); // May throw
+            if (!IsExpired)
+                return pObject;
+
+            // The object was created by another thread, but expired before we could obtain a strong
+            // reference. The wrapper will be replaced by a new one on the next iteration.
+        }
+    }
+
+    /// Finds the object in the registry and returns a strong pointer to it (std::shared_ptr or RefCntAutoPtr).
+    /// If the object is not found, returns empty pointer.
+    ///
+    /// \param [in] Key - The object key.
+    ///
+    /// Strong pointer to the object with the specified key, if the object is found in the registry,
+    /// or empty pointer otherwise.
+    StrongPtrType Get(const KeyType& Key)
+    {
+        Shard& KeyShard = GetShard(Key);
+
+        if (StrongPtrType pObject = KeyShard.Find(Key))
+            return pObject;
+
+        StrongPtrType pObject;
+        if (std::shared_ptr<ObjectWrapper> pObjectWrpr = KeyShard.GetWrapper(Key, /*AddIfNotFound = */ false))
+            pObject = pObjectWrpr->Lock();
+
+        OnSlowPathRequest();
+
+        return pObject;
+    }
+
+    /// Removes all expired pointers from the registry.
+    void Purge()
+    {
+        for (Uint32 i = 0; i < m_NumShards; ++i)
+            m_Shards[i].Rebuild();
+    }
+
+    /// Processes each element in the registry with the specified handler.
+    template <typename HandlerType>
+    void ProcessElements(HandlerType&& Handler)
+    {
+        for (Uint32 i = 0; i < m_NumShards; ++i)
+            m_Shards[i].ProcessElements(Handler);
+    }
+
+    /// Removes all objects from the registry.
+    void Clear()
+    {
+        for (Uint32 i = 0; i < m_NumShards; ++i)
+            m_Shards[i].Clear();
+        m_NumRequestsSinceLastPurge.store(0);
+    }
+
+    /// Returns the number of replaced snapshots that are kept alive because readers may still access them.
+    ///
+    /// The number never exceeds the number of hazard slots. This method is intended for diagnostics.
+    size_t GetNumRetiredSnapshots()
+    {
+        size_t NumRetiredSnapshots = 0;
+        for (Uint32 i = 0; i < m_NumShards; ++i)
+            NumRetiredSnapshots += m_Shards[i].GetNumRetiredSnapshots();
+        return NumRetiredSnapshots;
+    }
+
+private:
+    // The wrapper is initialized at most once. After the object has been created, the weak pointer
+    // is never modified, so it can be safely read by any number of threads without a lock.
+    // When the object expires, the wrapper is replaced with a new one.
+    class ObjectWrapper
+    {
+    public:
+        template <typename CreateObjectType>
+        StrongPtrType Get(CreateObjectType&& CreateObject, bool& IsExpired) noexcept(false)
+        {
+            std::lock_guard<std::mutex> Guard{m_CreateObjectMtx};
+            if (m_IsInitialized.load(std::memory_order_relaxed))
+            {
+                StrongPtrType pObject = _LockWeakPtr(m_wpObject);
+                IsExpired             = !pObject;
+                return pObject;
+            }
+
+            StrongPtrType pObject = CreateObject(); // May throw
+            if (pObject)
+            {
+                m_wpObject = pObject;
+                m_IsInitialized.store(true, std::memory_order_release);
+            }
+
+            return pObject;
+        }
+
+        StrongPtrType Lock()
+        {
+            return m_IsInitialized.load(std::memory_order_acquire) ?
+                _LockWeakPtr(m_wpObject) :
+                StrongPtrType{};
+        }
+
+        // Returns true if the object has been created and has been destroyed since.
+        bool IsExpired()
+        {
+            return m_IsInitialized.load(std::memory_order_acquire) && _IsWeakPtrExpired(m_wpObject);
+        }
+
+    private:
+        std::mutex        m_CreateObjectMtx;
+        std::atomic<bool> m_IsInitialized{false};
+        WeakPtrType       m_wpObject;
+    };
+
+    using TableType = std::unordered_map<KeyType, std::shared_ptr<ObjectWrapper>, KeyHasher, KeyEqual>;
+
+    static StrongPtrType FindInTable(const TableType* pTable, const KeyType& Key)
+    {
+        if (pTable != nullptr)
+        {
+            auto it = pTable->find(Key);
+            if (it != pTable->end())
+                return it->second->Lock();
+        }
+        return StrongPtrType{};
+    }
+
+    // Hazard slots shared by all shards. A reader stores the pointer to the snapshot it accesses
+    // in a slot, and a retired snapshot may only be released when no slot refers to it.
+    class HazardSlots
+    {
+    public:
+        // Slots are padded rather than over-aligned so that the array can be allocated
+        // with plain new[] in C++14.
+        struct Slot
+        {
+            std::atomic<bool>             InUse{false};
+            std::atomic<const TableType*> pSnapshot{nullptr};
+
+            Uint8 Padding[64 - 2 * sizeof(void*)] = {};
+        };
+        static_assert(sizeof(Slot) == 64, "Hazard slot must occupy exactly one cache line");
+
+        explicit HazardSlots(Uint32 NumSlots) :
+            m_NumSlots{NumSlots},
+            m_Slots{new Slot[NumSlots]}
+        {}
+
+        ~HazardSlots()
+        {
+#ifdef DILIGENT_DEBUG
+            for (Uint32 i = 0; i < m_NumSlots; ++i)
+                VERIFY(!m_Slots[i].InUse.load(), "Destroying the registry while it is being accessed by other threads");
+#endif
+        }
+
+        // Returns a free slot, or null if all slots are in use.
+        Slot* Acquire()
+        {
+            // Start from the slot that is determined by the thread id, so that a thread
+            // usually finds its slot free on the first attempt.
+            static thread_local const size_t ThreadHash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+            const Uint32 FirstSlot = static_cast<Uint32>(ThreadHash % m_NumSlots);
+            for (Uint32 i = 0; i < m_NumSlots; ++i)
+            {
+                Slot& S = m_Slots[(FirstSlot + i) % m_NumSlots];
+
+                bool InUse = false;
+                if (!S.InUse.load(std::memory_order_relaxed) && S.InUse.compare_exchange_strong(InUse, true, std::memory_order_acquire))
+                    return &S;
+            }
+            return nullptr;
+        }
+
+        void Release(Slot& S)
+        {
+            S.pSnapshot.store(nullptr, std::memory_order_release);
+            S.InUse.store(false, std::memory_order_release);
+        }
+
+        bool IsProtected(const TableType* pSnapshot) const
+        {
+            for (Uint32 i = 0; i < m_NumSlots; ++i)
+            {
+                if (m_Slots[i].pSnapshot.load() == pSnapshot)
+                    return true;
+            }
+            return false;
+        }
+
+    private:
+        const Uint32            m_NumSlots;
+        std::unique_ptr<Slot[]> m_Slots;
+    };
+
+    class Shard
+    {
+    public:
+        void SetHazardSlots(HazardSlots& Slots)
+        {
+            m_pHazardSlots = &Slots;
+        }
+
+        // Looks up the object in the snapshot without taking the lock.
+        StrongPtrType Find(const KeyType& Key)
+        {
+            typename HazardSlots::Slot* pSlot = m_pHazardSlots->Acquire();
+            if (pSlot == nullptr)
+            {
+                // There are more concurrent readers than slots
+                std::lock_guard<std::mutex> Guard{m_Mtx};
+                return FindInTable(m_pSnapshotOwner.get(), Key);
+            }
+
+            // Protect the snapshot, and then make sure that it has not been replaced in the meantime.
+            // If it has not, Publish() will see the slot when it decides whether to release the snapshot.
+            const TableType* pSnapshot = m_pSnapshot.load();
+            while (true)
+            {
+                pSlot->pSnapshot.store(pSnapshot);
+                const TableType* pCurrSnapshot = m_pSnapshot.load();
+                if (pCurrSnapshot == pSnapshot)
+                    break;
+                pSnapshot = pCurrSnapshot;
+            }
+
+            StrongPtrType pObject = FindInTable(pSnapshot, Key);
+
+            m_pHazardSlots->Release(*pSlot);
+
+            return pObject;
+        }
+
+        std::shared_ptr<ObjectWrapper> GetWrapper(const KeyType& Key, bool AddIfNotFound)
+        {
+            std::lock_guard<std::mutex> Guard{m_Mtx};
+
+            if (!m_RetiredSnapshots.empty())
+                ReleaseRetiredSnapshotsUnguarded();
+
+            // Entries in the pending table override the snapshot entries
+            auto pending_it = m_Pending.find(Key);
+            if (pending_it != m_Pending.end())
+            {
+                if (!pending_it->second->IsExpired())
+                    return pending_it->second;
+
+                if (!AddIfNotFound)
+                {
+                    m_Pending.erase(pending_it);
+                    return {};
+                }
+
+                // Replace the expired wrapper
+                pending_it->second = std::make_shared<ObjectWrapper>();
+                return pending_it->second;
+            }
+
+            if (m_pSnapshotOwner)
+            {
+                auto it = m_pSnapshotOwner->find(Key);
+                if (it != m_pSnapshotOwner->end() && !it->second->IsExpired())
+                    return it->second;
+                // Expired snapshot entries are shadowed by the pending table and removed on the next rebuild.
+            }
+
+            if (!AddIfNotFound)
+                return {};
+
+            std::shared_ptr<ObjectWrapper> pObjectWrpr = std::make_shared<ObjectWrapper>();
+            m_Pending.emplace(Key, pObjectWrpr);
+
+            const size_t SnapshotSize = m_pSnapshotOwner ? m_pSnapshotOwner->size() : 0;
+            if (m_Pending.size() >= (std::max)(SnapshotSize / 4, size_t{MinPendingSizeToMerge}))
+                RebuildUnguarded();
+
+            return pObjectWrpr;
+        }
+
+        // Merges the pending table into a new snapshot and removes expired entries.
+        void Rebuild()
+        {
+            std::lock_guard<std::mutex> Guard{m_Mtx};
+            RebuildUnguarded();
+        }
+
+        template <typename HandlerType>
+        void ProcessElements(HandlerType& Handler)
+        {
+            std::lock_guard<std::mutex> Guard{m_Mtx};
+            if (m_pSnapshotOwner)
+            {
+                for (auto& Entry : *m_pSnapshotOwner)
+                {
+                    if (m_Pending.find(Entry.first) != m_Pending.end())
+                        continue;
+                    if (auto pObject = Entry.second->Lock())
+                        Handler(Entry.first, *pObject);
+                }
+            }
+            for (auto& Entry : m_Pending)
+            {
+                if (auto pObject = Entry.second->Lock())
+                    Handler(Entry.first, *pObject);
+            }
+        }
+
+        void Clear()
+        {
+            std::lock_guard<std::mutex> Guard{m_Mtx};
+            m_Pending.clear();
+            Publish(nullptr);
+        }
+
+        size_t GetNumRetiredSnapshots()
+        {
+            std::lock_guard<std::mutex> Guard{m_Mtx};
+            return m_RetiredSnapshots.size();
+        }
+
+    private:
+        void RebuildUnguarded()
+        {
+            std::unique_ptr<TableType> pNewSnapshot{new TableType};
+            pNewSnapshot->reserve((m_pSnapshotOwner ? m_pSnapshotOwner->size() : 0) + m_Pending.size());
+            for (auto& Entry : m_Pending)
+            {
+                if (!Entry.second->IsExpired())
+                    pNewSnapshot->emplace(Entry.first, Entry.second);
+            }
+            if (m_pSnapshotOwner)
+            {
+                for (auto& Entry : *m_pSnapshotOwner)
+                {
+                    // Entries that are already in the new snapshot came from the pending table and are newer
+                    if (!Entry.second->IsExpired())
+                        pNewSnapshot->emplace(Entry.first, Entry.second);
+                }
+            }
+            m_Pending.clear();
+
+            Publish(!pNewSnapshot->empty() ? std::move(pNewSnapshot) : nullptr);
+        }
+
+        // Replaces the snapshot and releases the retired snapshots that can no longer be accessed.
+        void Publish(std::unique_ptr<TableType> pNewSnapshot)
+        {
+            m_pSnapshot.store(pNewSnapshot.get());
+            if (m_pSnapshotOwner)
+                m_RetiredSnapshots.emplace_back(std::move(m_pSnapshotOwner));
+            m_pSnapshotOwner = std::move(pNewSnapshot);
+
+            ReleaseRetiredSnapshotsUnguarded();
+        }
+
+        void ReleaseRetiredSnapshotsUnguarded()
+        {
+            // The new snapshot pointer has been stored before the slots are checked. A reader that stores
+            // a retired pointer in its slot after the check will see the new pointer when it validates
+            // the slot in Find() and will not access the retired snapshot.
+            m_RetiredSnapshots.erase(
+                std::remove_if(m_RetiredSnapshots.begin(), m_RetiredSnapshots.end(),
+                               [this](const std::unique_ptr<TableType>& pSnapshot) {
+                                   return !m_pHazardSlots->IsProtected(pSnapshot.get());
+                               }),
+                m_RetiredSnapshots.end());
+        }
+
+    private:
+        static constexpr size_t MinPendingSizeToMerge = 8;
+
+        HazardSlots* m_pHazardSlots = nullptr;
+
+        std::atomic<const TableType*> m_pSnapshot{nullptr};
+
+        std::mutex m_Mtx;
+
+        std::unique_ptr<TableType>              m_pSnapshotOwner;
+        std::vector<std::unique_ptr<TableType>> m_RetiredSnapshots;
+        TableType                               m_Pending;
+    };
+
+    Shard& GetShard(const KeyType& Key)
+    {
+        if (m_NumShards == 1)
+            return m_Shards[0];
+
+        // Mix the hash so that the shard index does not correlate with the
+        // bucket index in the shard's tables.
+        const Uint64 Hash = static_cast<Uint64>(KeyHasher{}(Key)) * Uint64{0x9E3779B97F4A7C15};
+        return m_Shards[static_cast<size_t>((Hash >> 32) % m_NumShards)];
+    }
+
+    void OnSlowPathRequest()
+    {
+        if (m_NumRequestsSinceLastPurge.fetch_add(1) + 1 >= m_NumRequestsToPurge)
+        {
+            m_NumRequestsSinceLastPurge.store(0);
+            // Purge one shard at a time to bound the cost of a single request
+            const Uint32 ShardIdx = m_NextShardToPurge.fetch_add(1) % m_NumShards;
+            m_Shards[ShardIdx].Rebuild();
+        }
+    }
+
+private:
+    static constexpr Uint32 MinHazardSlots = 16;
+
+    const Uint32 m_NumRequestsToPurge;
+    const Uint32 m_NumShards;
+
+    HazardSlots              m_HazardSlots;
+    std::unique_ptr<Shard[]> m_Shards;
+
+    std::atomic<Uint32> m_NumRequestsSinceLastPurge{0};
+    std::atomic<Uint32> m_NextShardToPurge{0};
+};
+
+} // namespace Diligent
@@ -72,6 +72,7 @@ public:
             m_pAllocator->Free(block.Data);
         }
         m_Blocks.clear();
+        m_CurrBlockIdx = 0;
 
         m_pAllocator = nullptr;
     }
@@ -82,6 +83,42 @@ public:
         {
             block.CurrPtr = block.Data;
         }
+        m_CurrBlockIdx = 0;
+    }
+
+    /// Allocator position that can be restored with Rewind().
+    struct Marker
+    {
+        size_t BlockIdx = 0;
+        size_t Offset   = 0;
+    };
+
+    /// Returns the current allocator position.
+    Marker GetMarker() const
+    {
+        Marker M;
+        M.BlockIdx = m_CurrBlockIdx;
+        M.Offset   = m_CurrBlockIdx < m_Blocks.size() ? static_cast<size_t>(m_Blocks[m_CurrBlockIdx].CurrPtr - m_Blocks[m_CurrBlockIdx].Data) : 0;
+        return M;
+    }
+
+    /// Releases all allocations made after the marker was obtained.
+    /// The memory blocks are kept and reused by subsequent allocations.
+    void Rewind(const Marker& M)
+    {
+        VERIFY(M.BlockIdx < m_CurrBlockIdx || (M.BlockIdx == m_CurrBlockIdx && M.Offset <= GetMarker().Offset),
+               "The marker is ahead of the current allocator position");
+        for (size_t i = M.BlockIdx + 1; i <= m_CurrBlockIdx && i < m_Blocks.size(); ++i)
+        {
+            m_Blocks[i].CurrPtr = m_Blocks[i].Data;
+        }
+        if (M.BlockIdx < m_Blocks.size())
+        {
+            Block& block = m_Blocks[M.BlockIdx];
+            VERIFY_EXPR(M.Offset <= block.Size);
+            block.CurrPtr = block.Data + M.Offset;
+        }
+        m_CurrBlockIdx = M.BlockIdx;
     }
 
     NODISCARD void* Allocate(size_t size, size_t align)
@@ -89,12 +126,15 @@ public:
         if (size == 0)
             return nullptr;
 
-        for (Block& block : m_Blocks)
+        // Blocks are filled in order, so that allocations can be rewound to a marker.
+        for (size_t i = m_CurrBlockIdx; i < m_Blocks.size(); ++i)
         {
-            uint8_t* Ptr = AlignUp(block.CurrPtr, align);
+            Block&   block = m_Blocks[i];
+            uint8_t* Ptr   = AlignUp(block.CurrPtr, align);
             if (Ptr + size <= block.Data + block.Size)
             {
-                block.CurrPtr = Ptr + size;
+                block.CurrPtr  = Ptr + size;
+                m_CurrBlockIdx = i;
                 return Ptr;
             }
         }
@@ -104,6 +144,7 @@ public:
         while (BlockSize < size + align - 1)
             BlockSize *= 2;
         m_Blocks.emplace_back(m_pAllocator->Allocate(BlockSize, "dynamic linear allocator page", __FILE__, __LINE__), BlockSize);
+        m_CurrBlockIdx = m_Blocks.size() - 1;
 
         Block&   block = m_Blocks.back();
         uint8_t* Ptr   = AlignUp(block.Data, align);
@@ -198,6 +239,24 @@ public:
         return m_Blocks.size();
     }
 
+    /// Returns the number of bytes allocated from all blocks, including the alignment padding.
+    size_t GetUsedSize() const
+    {
+        size_t UsedSize = 0;
+        for (const Block& block : m_Blocks)
+            UsedSize += block.CurrPtr - block.Data;
+        return UsedSize;
+    }
+
+    /// Returns the total size of all blocks.
+    size_t GetReservedSize() const
+    {
+        size_t ReservedSize = 0;
+        for (const Block& block : m_Blocks)
+            ReservedSize += block.Size;
+        return ReservedSize;
+    }
+
     template <typename HandlerType>
     void ProcessBlocks(HandlerType&& Handler) const
     {
@@ -217,8 +276,9 @@ private:
     };
 
     std::vector<Block> m_Blocks;
-    const Uint32       m_BlockSize  = 4 << 10;
-    IMemoryAllocator*  m_pAllocator = nullptr;
+    size_t             m_CurrBlockIdx = 0;
+    const Uint32       m_BlockSize    = 4 << 10;
+    IMemoryAllocator*  m_pAllocator   = nullptr;
 };
 
 } // namespace Diligent
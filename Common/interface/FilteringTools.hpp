@@ -91,6 +91,26 @@ struct LinearTexFilterSampleInfo
     }
 };
 
+/// Wraps the texture coordinate index to the range [0, Width - 1] (TEXTURE_ADDRESS_WRAP mode).
+inline Int32 WrapTexCoordIndex(Int32 i, Uint32 Width)
+{
+    Int32 w = static_cast<Int32>(Width);
+
+    // Note that the sign of a%b is implementation-dependent when one of the operands is negative.
+    // a/b, to the contrary, is always well-defined.
+    i = i - (i / w) * w;
+    return i < 0 ? i + w : i;
+}
+
+/// Mirrors the texture coordinate index to the range [0, Width - 1] (TEXTURE_ADDRESS_MIRROR mode).
+inline Int32 MirrorTexCoordIndex(Int32 i, Uint32 Width)
+{
+    i = WrapTexCoordIndex(i, Width * 2);
+
+    Int32 w = static_cast<Int32>(Width);
+    return i >= w ? (w * 2 - 1) - i : i;
+}
+
 /// Returns linear texture filter sample info, see Diligent::LinearTexFilterSampleInfo.
 ///
 /// \tparam AddressMode       - Texture addressing mode, see Diligent::TEXTURE_ADDRESS_MODE.
@@ -114,24 +134,6 @@ LinearTexFilterSampleInfo GetLinearTexFilterSampleInfo(Uint32 Width, float u)
     };
     // clang-format on
 
-    auto WrapCoord = [](Int32 i, Uint32 Width) //
-    {
-        Int32 w = static_cast<Int32>(Width);
-
-        // Note that the sign of a%b is implementation-dependent when one of the operands is negative.
-        // a/b, to the contrary, is always well-defined.
-        i = i - (i / w) * w;
-        return i < 0 ? i + w : i;
-    };
-
-    auto MirrorCoord = [WrapCoord](Int32 i, Uint32 Width) //
-    {
-        i = WrapCoord(i, Width * 2);
-
-        Int32 w = static_cast<Int32>(Width);
-        return i >= w ? (w * 2 - 1) - i : i;
-    };
-
     switch (AddressMode)
     {
         case TEXTURE_ADDRESS_UNKNOWN:
@@ -139,13 +141,13 @@ LinearTexFilterSampleInfo GetLinearTexFilterSampleInfo(Uint32 Width, float u)
             break;
 
         case TEXTURE_ADDRESS_WRAP:
-            SampleInfo.i0 = WrapCoord(SampleInfo.i0, Width);
-            SampleInfo.i1 = WrapCoord(SampleInfo.i1, Width);
+            SampleInfo.i0 = WrapTexCoordIndex(SampleInfo.i0, Width);
+            SampleInfo.i1 = WrapTexCoordIndex(SampleInfo.i1, Width);
             break;
 
         case TEXTURE_ADDRESS_MIRROR:
-            SampleInfo.i0 = MirrorCoord(SampleInfo.i0, Width);
-            SampleInfo.i1 = MirrorCoord(SampleInfo.i1, Width);
+            SampleInfo.i0 = MirrorTexCoordIndex(SampleInfo.i0, Width);
+            SampleInfo.i1 = MirrorTexCoordIndex(SampleInfo.i1, Width);
             break;
 
         case TEXTURE_ADDRESS_CLAMP:
@@ -176,6 +178,76 @@ inline void _DbgVerifyFilterInfo<TEXTURE_ADDRESS_UNKNOWN>(const LinearTexFilterS
 }
 #endif
 
+/// Linear texture filter sample info for a batch of coordinates in the structure-of-arrays layout,
+/// see Diligent::LinearTexFilterSampleInfo.
+struct LinearTexFilterSampleInfoSoA
+{
+    /// First sample indices
+    Int32* pI0 = nullptr;
+
+    /// Second sample indices
+    Int32* pI1 = nullptr;
+
+    /// Blend weights
+    float* pW = nullptr;
+};
+
+/// Computes linear texture filter sample info for a batch of coordinates.
+///
+/// The results are the same as those of GetLinearTexFilterSampleInfo for every coordinate,
+/// but the weights and indices are computed with the SIMD instructions supported by the CPU.
+///
+/// \param [in]  AddressMode       - Texture addressing mode, see Diligent::TEXTURE_ADDRESS_MODE.
+/// \param [in]  IsNormalizedCoord - Whether sample coordinates are normalized.
+/// \param [in]  Width             - Texture width.
+/// \param [in]  pCoords           - Texture sample coordinates.
+/// \param [in]  NumSamples        - The number of coordinates.
+/// \param [out] SampleInfo        - Arrays of NumSamples elements that receive the sample info.
+void GetLinearTexFilterSampleInfoBatch(TEXTURE_ADDRESS_MODE                AddressMode,
+                                       bool                                IsNormalizedCoord,
+                                       Uint32                              Width,
+                                       const float*                        pCoords,
+                                       size_t                              NumSamples,
+                                       const LinearTexFilterSampleInfoSoA& SampleInfo);
+
+/// Blends bilinear samples of a 2D texture for a batch of sample infos.
+///
+/// \param [in]  pData       - Pointer to the texture data.
+/// \param [in]  Stride      - Data stride, in pixels.
+/// \param [in]  UFilterInfo - Horizontal filter info, see Diligent::GetLinearTexFilterSampleInfoBatch.
+/// \param [in]  VFilterInfo - Vertical filter info, see Diligent::GetLinearTexFilterSampleInfoBatch.
+/// \param [in]  NumSamples  - The number of samples.
+/// \param [out] pDst        - Filtered texture samples.
+template <typename SrcType, typename DstType>
+void FilterTexture2DBilinearSamples(const SrcType*                      pData,
+                                    size_t                              Stride,
+                                    const LinearTexFilterSampleInfoSoA& UFilterInfo,
+                                    const LinearTexFilterSampleInfoSoA& VFilterInfo,
+                                    size_t                              NumSamples,
+                                    DstType*                            pDst)
+{
+    for (size_t i = 0; i < NumSamples; ++i)
+    {
+        const size_t Row0 = static_cast<size_t>(VFilterInfo.pI0[i]) * Stride;
+        const size_t Row1 = static_cast<size_t>(VFilterInfo.pI1[i]) * Stride;
+
+        DstType S00 = static_cast<DstType>(pData[UFilterInfo.pI0[i] + Row0]);
+        DstType S10 = static_cast<DstType>(pData[UFilterInfo.pI1[i] + Row0]);
+        DstType S01 = static_cast<DstType>(pData[UFilterInfo.pI0[i] + Row1]);
+        DstType S11 = static_cast<DstType>(pData[UFilterInfo.pI1[i] + Row1]);
+        pDst[i]     = lerp(lerp(S00, S10, UFilterInfo.pW[i]), lerp(S01, S11, UFilterInfo.pW[i]), VFilterInfo.pW[i]);
+    }
+}
+
+/// Overload of FilterTexture2DBilinearSamples for 32-bit float textures that
+/// uses SIMD gather instructions when they are supported by the CPU.
+void FilterTexture2DBilinearSamples(const float*                        pData,
+                                    size_t                              Stride,
+                                    const LinearTexFilterSampleInfoSoA& UFilterInfo,
+                                    const LinearTexFilterSampleInfoSoA& VFilterInfo,
+                                    size_t                              NumSamples,
+                                    float*                              pDst);
+
 /// Samples 2D texture using bilinear filter.
 ///
 /// \tparam SrcType           - Source pixel type.
@@ -220,6 +292,67 @@ DstType FilterTexture2DBilinear(Uint32         Width,
     return lerp(lerp(S00, S10, UFilterInfo.w), lerp(S01, S11, UFilterInfo.w), VFilterInfo.w);
 }
 
+/// Samples 2D texture using bilinear filter at a batch of coordinates.
+///
+/// This is the batch version of FilterTexture2DBilinear. The filter weights for a block of
+/// coordinates are computed at once with SIMD instructions, after which the samples are gathered
+/// and blended. This is considerably faster than calling FilterTexture2DBilinear for every sample.
+///
+/// \tparam SrcType           - Source pixel type.
+/// \tparam DstType           - Destination type.
+/// \tparam AddressModeU      - U coordinate address mode.
+/// \tparam AddressModeV      - V coordinate address mode.
+/// \tparam IsNormalizedCoord - Whether sample coordinates are normalized.
+///
+/// \param [in]  Width        - Texture width.
+/// \param [in]  Height       - Texture height.
+/// \param [in]  pData        - Pointer to the texture data.
+/// \param [in]  Stride       - Data stride, in pixels.
+/// \param [in]  pU           - Sample u coordinates.
+/// \param [in]  pV           - Sample v coordinates.
+/// \param [in]  NumSamples   - The number of samples.
+/// \param [out] pDst         - Filtered texture samples.
+template <typename SrcType,
+          typename DstType,
+          TEXTURE_ADDRESS_MODE AddressModeU,
+          TEXTURE_ADDRESS_MODE AddressModeV,
+          bool                 IsNormalizedCoord>
+void FilterTexture2DBilinearBatch(Uint32         Width,
+                                  Uint32         Height,
+                                  const SrcType* pData,
+                                  size_t         Stride,
+                                  const float*   pU,
+                                  const float*   pV,
+                                  size_t         NumSamples,
+                                  DstType*       pDst)
+{
+    constexpr size_t BlockSize = 256;
+
+    Int32 Indices[4][BlockSize];
+    float Weights[2][BlockSize];
+
+    const LinearTexFilterSampleInfoSoA UFilterInfo{Indices[0], Indices[1], Weights[0]};
+    const LinearTexFilterSampleInfoSoA VFilterInfo{Indices[2], Indices[3], Weights[1]};
+
+    for (size_t Start = 0; Start < NumSamples; Start += BlockSize)
+    {
+        const size_t Count = (NumSamples - Start) < BlockSize ? (NumSamples - Start) : BlockSize;
+
+        GetLinearTexFilterSampleInfoBatch(AddressModeU, IsNormalizedCoord, Width, pU + Start, Count, UFilterInfo);
+        GetLinearTexFilterSampleInfoBatch(AddressModeV, IsNormalizedCoord, Height, pV + Start, Count, VFilterInfo);
+
+#ifdef DILIGENT_DEBUG
+        for (size_t i = 0; i < Count; ++i)
+        {
+            _DbgVerifyFilterInfo<AddressModeU>({UFilterInfo.pI0[i], UFilterInfo.pI1[i], UFilterInfo.pW[i]}, Width, "horizontal", pU[Start + i]);
+            _DbgVerifyFilterInfo<AddressModeV>({VFilterInfo.pI0[i], VFilterInfo.pI1[i], VFilterInfo.pW[i]}, Height, "vertical", pV[Start + i]);
+        }
+#endif
+
+        FilterTexture2DBilinearSamples(pData, Stride, UFilterInfo, VFilterInfo, Count, pDst + Start);
+    }
+}
+
 /// Specialization of FilterTexture2DBilinear function that uses CLAMP texture address mode
 /// and takes normalized texture coordinates.
 template <typename SrcType, typename DstType>
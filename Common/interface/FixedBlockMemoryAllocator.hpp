@@ -30,7 +30,8 @@
 /// \file
 /// Declaration of Diligent::FixedBlockMemoryAllocator class
 
-#include <unordered_map>
+#include <array>
+#include <atomic>
 #include <mutex>
 #include <unordered_set>
 #include <vector>
@@ -39,11 +40,17 @@
 #include "../../Primitives/interface/Errors.hpp"
 #include "../../Primitives/interface/MemoryAllocator.h"
 #include "STDAllocator.hpp"
+#include "SpinLock.hpp"
 
 namespace Diligent
 {
 
 /// Memory allocator that allocates memory in a fixed-size chunks
+///
+/// Every thread allocates and releases blocks through its own cache of free blocks
+/// (threads are mapped to a fixed number of caches, so the cache may occasionally be
+/// shared). The cache is refilled from the memory pages and flushed back to them in batches,
+/// so that the allocator-wide mutex is only taken once per batch.
 class FixedBlockMemoryAllocator final : public IMemoryAllocator
 {
 public:
@@ -72,6 +79,15 @@ private:
 
     void CreateNewPage();
 
+    struct PageDesc;
+    const PageDesc* FindPage(const void* Ptr) const;
+
+    struct ThreadCache;
+    void RefillCache(ThreadCache& Cache);
+    void FlushCache(ThreadCache& Cache, Uint32 NumBlocks);
+
+    ThreadCache& GetThreadCache();
+
     // Memory page class is based on the fixed-size memory pool described in "Fast Efficient Fixed-Size Memory Pool"
     // by Ben Kenwright
     class MemoryPage
@@ -114,14 +130,60 @@ private:
     std::vector<MemoryPage, STDAllocatorRawMem<MemoryPage>>                                          m_PagePool;
     std::unordered_set<size_t, std::hash<size_t>, std::equal_to<size_t>, STDAllocatorRawMem<size_t>> m_AvailablePages;
 
-    using AddrToPageIdMapElem = std::pair<void* const, size_t>;
-    std::unordered_map<void*, size_t, std::hash<void*>, std::equal_to<void*>, STDAllocatorRawMem<AddrToPageIdMapElem>> m_AddrToPageId;
+    // Page descriptor used to validate the released blocks without taking the mutex.
+    // Descriptors are never moved and are only released by the destructor.
+    struct PageDesc
+    {
+        const Uint8* pStart = nullptr;
+        size_t       PageId = 0;
+
+        // One bit per block that is set while the block is owned by the user.
+        // It detects double freeing before the block gets into a thread cache.
+        std::atomic<Uint32>* pBlockStates = nullptr;
+    };
+    // Indexed by page id
+    std::vector<PageDesc*, STDAllocatorRawMem<PageDesc*>> m_PageDescs;
+
+    // Page descriptors sorted by the page start address. The page that contains a block is found
+    // with a binary search that does not take the mutex: the writer makes m_PageDirVersion odd while
+    // it modifies the directory, and the reader retries the search if the version has changed.
+    // Directories that were replaced by larger ones are kept in m_PageDirs until the allocator is
+    // destroyed as readers may still access them.
+    using PageDirEntry = std::atomic<const PageDesc*>;
+    std::atomic<PageDirEntry*>                                    m_pPageDir{nullptr};
+    std::atomic<size_t>                                           m_PageDirSize{0};
+    std::atomic<Uint32>                                           m_PageDirVersion{0};
+    size_t                                                        m_PageDirCapacity = 0;
+    std::vector<PageDirEntry*, STDAllocatorRawMem<PageDirEntry*>> m_PageDirs;
 
     std::mutex m_Mutex;
 
     IMemoryAllocator& m_RawMemoryAllocator;
     const size_t      m_BlockSize;
     const Uint32      m_NumBlocksInPage;
+
+    // The number of blocks moved between a thread cache and the pages at a time
+    const Uint32 m_CacheBatchSize;
+
+    static constexpr Uint32 NumThreadCaches   = 16;
+    static constexpr Uint32 MaxCacheBatchSize = 16;
+
+    struct CachedBlock
+    {
+        void*           Ptr      = nullptr;
+        const PageDesc* pPage    = nullptr;
+        size_t          BlockIdx = 0;
+    };
+
+    struct alignas(64) ThreadCache
+    {
+        Threading::SpinLock Lock;
+
+        // Free blocks. The most recently released block is at the end.
+        Uint32                                        NumBlocks = 0;
+        std::array<CachedBlock, MaxCacheBatchSize* 2> Blocks    = {};
+    };
+    std::array<ThreadCache, NumThreadCaches> m_ThreadCaches;
 };
 
 IMemoryAllocator& GetRawAllocator();
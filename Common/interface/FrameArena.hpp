@@ -0,0 +1,187 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::FrameArena class
+
+#include <atomic>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/MemoryAllocator.h"
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "DynamicLinearAllocator.hpp"
+
+namespace Diligent
+{
+
+/// Frame arena statistics.
+struct FrameArenaStats
+{
+    /// The largest number of bytes that was in use at the same time during the last completed frame.
+    size_t LastFramePeakSize = 0;
+
+    /// The largest number of bytes that was in use at the same time since the arena was created (high-water mark).
+    size_t PeakSize = 0;
+
+    /// The total size of the memory blocks owned by the arena.
+    size_t ReservedSize = 0;
+
+    /// The number of frames completed by EndFrame().
+    Uint64 NumFrames = 0;
+
+    FrameArenaStats& operator+=(const FrameArenaStats& RHS)
+    {
+        LastFramePeakSize += RHS.LastFramePeakSize;
+        PeakSize += RHS.PeakSize;
+        ReservedSize += RHS.ReservedSize;
+        NumFrames += RHS.NumFrames;
+        return *this;
+    }
+};
+
+/// Scratch memory arena for temporary allocations that do not outlive the current frame.
+///
+/// The arena is a DynamicLinearAllocator whose memory blocks are reused from frame to frame.
+/// Temporary allocations are made within a checkpoint scope that releases them when it ends:
+///
+///     FrameArena& Arena = FrameArena::GetThreadArena();
+///     {
+///         FrameArena::Checkpoint Scope{Arena};
+///         VkCommandBuffer* vkCmdBuffs = Arena.Allocate<VkCommandBuffer>(NumCmdBuffs);
+///         ...
+///     } // All allocations made in the scope are released
+///
+/// Every thread has its own arena returned by GetThreadArena(), so no synchronization is needed.
+/// Objects constructed in the arena are never destroyed, so it should only be used for
+/// trivially destructible types.
+///
+/// \note   An arena must only be accessed by the thread that owns it. Statistics may be queried
+///         from any thread.
+class FrameArena
+{
+public:
+    explicit FrameArena(IMemoryAllocator& Allocator, Uint32 BlockSize = 64 << 10);
+    ~FrameArena();
+
+    // clang-format off
+    FrameArena           (const FrameArena&) = delete;
+    FrameArena           (FrameArena&&)      = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+    FrameArena& operator=(FrameArena&&)      = delete;
+    // clang-format on
+
+    /// Scope guard that rewinds the arena to the position it had when the guard was created.
+    ///
+    /// Checkpoints must be released in the reverse order of their creation.
+    class Checkpoint
+    {
+    public:
+        explicit Checkpoint(FrameArena& Arena) :
+            m_Arena{Arena},
+            m_Marker{Arena.m_Allocator.GetMarker()}
+        {
+            ++m_Arena.m_NumActiveCheckpoints;
+        }
+
+        ~Checkpoint()
+        {
+            m_Arena.Rewind(m_Marker);
+        }
+
+        // clang-format off
+        Checkpoint           (const Checkpoint&) = delete;
+        Checkpoint           (Checkpoint&&)      = delete;
+        Checkpoint& operator=(const Checkpoint&) = delete;
+        Checkpoint& operator=(Checkpoint&&)      = delete;
+        // clang-format on
+
+    private:
+        FrameArena&                          m_Arena;
+        const DynamicLinearAllocator::Marker m_Marker;
+    };
+
+    NODISCARD void* Allocate(size_t Size, size_t Align)
+    {
+        return m_Allocator.Allocate(Size, Align);
+    }
+
+    template <typename T>
+    NODISCARD T* Allocate(size_t Count = 1)
+    {
+        return m_Allocator.Allocate<T>(Count);
+    }
+
+    template <typename T, typename... Args>
+    NODISCARD T* ConstructArray(size_t Count, const Args&... args)
+    {
+        return m_Allocator.ConstructArray<T>(Count, args...);
+    }
+
+    template <typename T>
+    NODISCARD T* CopyArray(const T* Src, size_t Count)
+    {
+        return m_Allocator.CopyArray<T>(Src, Count);
+    }
+
+    /// Finishes the frame: updates the statistics and, if there are no active checkpoints,
+    /// releases all allocations. The memory blocks are kept for the next frame.
+    void EndFrame();
+
+    /// Returns the number of bytes currently allocated from the arena.
+    size_t GetUsedSize() const
+    {
+        return m_Allocator.GetUsedSize();
+    }
+
+    /// Returns the arena statistics.
+    FrameArenaStats GetStats() const;
+
+    /// Returns the calling thread's arena. The arena is created on the first call
+    /// and is destroyed when the thread exits.
+    static FrameArena& GetThreadArena();
+
+    /// Returns the sum of the statistics of all live thread arenas.
+    static FrameArenaStats GetThreadArenasStats();
+
+private:
+    void Rewind(const DynamicLinearAllocator::Marker& Marker);
+    void UpdateStats();
+
+private:
+    DynamicLinearAllocator m_Allocator;
+
+    Uint32 m_NumActiveCheckpoints = 0;
+    size_t m_FramePeakSize        = 0;
+
+    std::atomic<size_t> m_LastFramePeakSize{0};
+    std::atomic<size_t> m_PeakSize{0};
+    std::atomic<size_t> m_ReservedSize{0};
+    std::atomic<Uint64> m_NumFrames{0};
+};
+
+} // namespace Diligent
@@ -0,0 +1,130 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Batch frustum culling of bounding boxes.
+///
+/// The functions in this file test many boxes stored in the structure-of-arrays layout
+/// against a view frustum. The boxes are processed 8 at a time with AVX2 or 4 at a time
+/// with SSE2/NEON; the instruction set is selected at run time. The results are identical
+/// to the results of GetBoxVisibility() for every box, as long as the compiler does not
+/// fuse the scalar multiplications and additions into FMA instructions.
+///
+/// The visibility of box i is written to bit (i % 32) of element (i / 32) of the output
+/// bit masks, so the masks must have at least (NumBoxes + 31) / 32 elements. The bits past
+/// the last box are set to zero.
+
+#include "AdvancedMath.hpp"
+#include "ThreadPool.h"
+
+namespace Diligent
+{
+
+/// Axis-aligned bounding boxes in the structure-of-arrays layout.
+///
+/// Every array must contain NumBoxes elements. The arrays do not need to be aligned.
+struct BoundBoxesSoA
+{
+    /// Minimum corner coordinates.
+    const float* pMinX = nullptr;
+    const float* pMinY = nullptr;
+    const float* pMinZ = nullptr;
+
+    /// Maximum corner coordinates.
+    const float* pMaxX = nullptr;
+    const float* pMaxY = nullptr;
+    const float* pMaxZ = nullptr;
+
+    /// The number of boxes.
+    size_t NumBoxes = 0;
+};
+
+/// Oriented bounding boxes in the structure-of-arrays layout.
+///
+/// Every array must contain NumBoxes elements. The arrays do not need to be aligned.
+struct OrientedBoundingBoxesSoA
+{
+    /// Box center coordinates.
+    const float* pCenterX = nullptr;
+    const float* pCenterY = nullptr;
+    const float* pCenterZ = nullptr;
+
+    /// Box axes: pAxes[i][c] is component c (x, y, z) of axis i, see OrientedBoundingBox::Axes.
+    const float* pAxes[3][3] = {};
+
+    /// Half extents along each axis.
+    const float* pHalfExtents[3] = {};
+
+    /// The number of boxes.
+    size_t NumBoxes = 0;
+};
+
+/// Tests axis-aligned bounding boxes against the view frustum.
+
+/// \param[in]  Frustum           - View frustum.
+/// \param[in]  Boxes             - Bounding boxes to test.
+/// \param[out] pVisibleMask      - Bit mask of the boxes that are not BoxVisibility::Invisible.
+/// \param[out] pFullyVisibleMask - An optional bit mask of the boxes that are BoxVisibility::FullyVisible.
+/// \param[in]  PlaneFlags        - Frustum planes to test the boxes against.
+/// \param[in]  pThreadPool       - An optional thread pool to split the boxes between the threads.
+///
+/// \remarks    The results are the same as returned by GetBoxVisibility(Frustum, Box, PlaneFlags).
+void GetBoxesVisibility(const ViewFrustum&   Frustum,
+                        const BoundBoxesSoA& Boxes,
+                        Uint32*              pVisibleMask,
+                        Uint32*              pFullyVisibleMask = nullptr,
+                        FRUSTUM_PLANE_FLAGS  PlaneFlags        = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                        IThreadPool*         pThreadPool       = nullptr);
+
+/// Tests axis-aligned bounding boxes against the view frustum and additionally tests
+/// the intersecting boxes against the frustum corners, see GetBoxVisibility(const ViewFrustumExt&, ...).
+void GetBoxesVisibility(const ViewFrustumExt& Frustum,
+                        const BoundBoxesSoA&  Boxes,
+                        Uint32*               pVisibleMask,
+                        Uint32*               pFullyVisibleMask = nullptr,
+                        FRUSTUM_PLANE_FLAGS   PlaneFlags        = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                        IThreadPool*          pThreadPool       = nullptr);
+
+/// Tests oriented bounding boxes against the view frustum, see GetBoxesVisibility(const ViewFrustum&, const BoundBoxesSoA&, ...).
+void GetBoxesVisibility(const ViewFrustum&              Frustum,
+                        const OrientedBoundingBoxesSoA& Boxes,
+                        Uint32*                         pVisibleMask,
+                        Uint32*                         pFullyVisibleMask = nullptr,
+                        FRUSTUM_PLANE_FLAGS             PlaneFlags        = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                        IThreadPool*                    pThreadPool       = nullptr);
+
+/// Tests oriented bounding boxes against the view frustum and additionally tests
+/// the intersecting boxes against the frustum corners, see GetBoxVisibility(const ViewFrustumExt&, ...).
+void GetBoxesVisibility(const ViewFrustumExt&           Frustum,
+                        const OrientedBoundingBoxesSoA& Boxes,
+                        Uint32*                         pVisibleMask,
+                        Uint32*                         pFullyVisibleMask = nullptr,
+                        FRUSTUM_PLANE_FLAGS             PlaneFlags        = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                        IThreadPool*                    pThreadPool       = nullptr);
+
+} // namespace Diligent
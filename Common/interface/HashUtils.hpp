@@ -139,49 +139,42 @@ std::size_t ComputeHash(const FirstArgType& FirstArg, const RestArgsType&... Res
     return Seed;
 }
 
+/// Computes a 64-bit hash of raw memory using the XXH3 algorithm.
+///
+/// The hash is computed by the xxHash library, which uses SSE2 or NEON when
+/// they are available. The hash is not meant to be persisted.
+Uint64 ComputeHashRaw64(const void* pData, size_t Size, Uint64 Seed = 0) noexcept;
+
+/// Computes 64-bit hashes of many keys in one call.
+
+/// \param [in]  ppKeys  - Pointers to the keys.
+/// \param [in]  pSizes  - Key sizes, in bytes.
+/// \param [in]  Count   - The number of keys.
+/// \param [out] pHashes - Hashes of the keys. pHashes[i] is equal to ComputeHashRaw64(ppKeys[i], pSizes[i], Seed).
+/// \param [in]  Seed    - Hash seed.
+///
+/// For small keys, the batch avoids the per-key function call: the XXH3 code is inlined
+/// into the loop.
+void ComputeHashRawBatch(const void* const* ppKeys, const size_t* pSizes, size_t Count, Uint64* pHashes, Uint64 Seed = 0) noexcept;
+
+/// Computes 64-bit hashes of fixed-size keys stored with a constant stride, e.g. an array of structures.
+
+/// \param [in]  pKeys   - Pointer to the first key.
+/// \param [in]  KeySize - The size of every key, in bytes.
+/// \param [in]  Stride  - The distance between the beginnings of consecutive keys, in bytes.
+/// \param [in]  Count   - The number of keys.
+/// \param [out] pHashes - Hashes of the keys. pHashes[i] is equal to ComputeHashRaw64(pKeys + i * Stride, KeySize, Seed).
+/// \param [in]  Seed    - Hash seed.
+///
+/// Common key sizes (4, 8, 12, 16, 32 and 64 bytes) use the XXH3 code specialized for that size.
+void ComputeHashRawBatch(const void* pKeys, size_t KeySize, size_t Stride, size_t Count, Uint64* pHashes, Uint64 Seed = 0) noexcept;
+
 inline std::size_t ComputeHashRaw(const void* pData, size_t Size) noexcept
 {
-    size_t Hash = 0;
-
-    const Uint8*  BytePtr  = static_cast<const Uint8*>(pData);
-    const Uint8*  EndPtr   = BytePtr + Size;
-    const Uint32* DwordPtr = static_cast<const Uint32*>(AlignUp(pData, alignof(Uint32)));
-
-    // Process initial bytes before we get to the 32-bit aligned pointer
-    Uint64 Buffer = 0;
-    Uint64 Shift  = 0;
-    while (BytePtr < EndPtr && BytePtr < reinterpret_cast<const Uint8*>(DwordPtr))
-    {
-        Buffer |= Uint64{*(BytePtr++)} << Shift;
-        Shift += 8;
-    }
-    VERIFY_EXPR(Shift <= 24);
-
-    // Process dwords
-    while (DwordPtr + 1 <= reinterpret_cast<const Uint32*>(EndPtr))
-    {
-        Buffer |= Uint64{*(DwordPtr++)} << Shift;
-        HashCombine(Hash, static_cast<Uint32>(Buffer & ~Uint32{0}));
-        Buffer = Buffer >> Uint64{32};
-    }
-
-    // Process the remaining bytes
-    BytePtr = reinterpret_cast<const Uint8*>(DwordPtr);
-    while (BytePtr < EndPtr)
-    {
-        Buffer |= Uint64{*(BytePtr++)} << Shift;
-        Shift += 8;
-    }
-    VERIFY_EXPR(Shift <= (3 + 3) * 8);
-
-    while (Shift != 0)
-    {
-        HashCombine(Hash, static_cast<Uint32>(Buffer & ~Uint32{0}));
-        Buffer = Buffer >> Uint64{32};
-        Shift -= (std::min)(Shift, Uint64{32});
-    }
-
-    return Hash;
+    const Uint64 Hash = ComputeHashRaw64(pData, Size);
+    return sizeof(size_t) >= sizeof(Uint64) ?
+        static_cast<size_t>(Hash) :
+        static_cast<size_t>(Hash ^ (Hash >> 32));
 }
 
 template <typename CharType>
@@ -198,6 +191,16 @@ struct CStringHash
             Seed = Seed * 65599 + Ch;
         return Seed;
     }
+
+    // Hashes the string of the given length that does not need to be null-terminated.
+    // For a string without null characters, the hash is the same as above.
+    size_t operator()(const CharType* str, size_t Length) const noexcept
+    {
+        std::size_t Seed = 0;
+        for (size_t i = 0; i < Length; ++i)
+            Seed = Seed * 65599 + static_cast<std::size_t>(str[i]);
+        return Seed;
+    }
 };
 
 template <typename CharType>
@@ -246,6 +249,16 @@ public:
         }
     }
 
+    // Creates a non-owning key with a precomputed hash. The hash must be
+    // computed by CStringHash, and the string must outlive the key.
+    HashMapStringKey(const Char* _Str, size_t Hash) noexcept :
+        Str{_Str},
+        Ownership_Hash{Hash & HashMask}
+    {
+        VERIFY(Str, "String pointer must not be null");
+        VERIFY(GetHash() == (CStringHash<Char>{}.operator()(Str) & HashMask), "The hash does not match the string");
+    }
+
     // Make this constructor explicit to avoid unintentional string copies
     explicit HashMapStringKey(const String& Str, bool bMakeCopy = true) :
         HashMapStringKey{Str.c_str(), bMakeCopy}
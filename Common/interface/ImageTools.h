@@ -30,6 +30,7 @@
 /// Image processing tools
 
 #include "../../Primitives/interface/BasicTypes.h"
+#include "../../Graphics/GraphicsEngine/interface/GraphicsTypes.h"
 
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
@@ -53,6 +54,14 @@ struct ImageDiffInfo
 
     /// The root mean square difference between all pixels, not counting pixels that are equal
     float RmsDiff DEFAULT_INITIALIZER(0);
+
+    /// Peak signal-to-noise ratio, in decibels, computed over all channels of all pixels.
+    /// If the images are identical, the value is positive infinity.
+    float PSNR DEFAULT_INITIALIZER(0);
+
+    /// Mean structural similarity index, computed over non-overlapping 8x8 windows
+    /// of every channel. The value is 1 if the images are identical.
+    float SSIM DEFAULT_INITIALIZER(0);
 };
 typedef struct ImageDiffInfo ImageDiffInfo;
 
@@ -72,7 +81,7 @@ struct ComputeImageDifferenceAttribs
     /// Number of channels in the first image
     Uint32 NumChannels1 DEFAULT_INITIALIZER(0);
 
-    /// Row stride of the first image data, in bytes
+    /// Row stride of the first image data, in bytes. Must be a multiple of the component size.
     Uint32 Stride1 DEFAULT_INITIALIZER(0);
 
     /// A pointer to the second image data
@@ -81,7 +90,7 @@ struct ComputeImageDifferenceAttribs
     /// Number of channels in the second image
     Uint32 NumChannels2 DEFAULT_INITIALIZER(0);
 
-    /// Row stride of the second image data, in bytes
+    /// Row stride of the second image data, in bytes. Must be a multiple of the component size.
     Uint32 Stride2 DEFAULT_INITIALIZER(0);
 
     /// Difference threshold
@@ -100,6 +109,17 @@ struct ComputeImageDifferenceAttribs
 
     /// Scale factor for the difference image
     float Scale DEFAULT_INITIALIZER(1.f);
+
+    /// Image component type: VT_UINT8, VT_UINT16 or VT_FLOAT32.
+    /// Both images must use the same component type. The difference image is always 8-bit.
+    ///
+    /// Float components are compared in 1/255 units, so that the threshold, the difference
+    /// values and the difference image have the same meaning as for 8-bit images.
+    /// The maximum difference is rounded to the nearest integer.
+    VALUE_TYPE ComponentType DEFAULT_INITIALIZER(VT_UINT8);
+
+    /// An optional thread pool that is used to process the image rows in parallel.
+    IThreadPool* pThreadPool DEFAULT_INITIALIZER(nullptr);
 };
 typedef struct ComputeImageDifferenceAttribs ComputeImageDifferenceAttribs;
 
@@ -115,6 +135,10 @@ typedef struct ComputeImageDifferenceAttribs ComputeImageDifferenceAttribs;
 /// The root mean square difference is calculated as the square root of
 /// the average of the squares of all differences, not counting pixels that
 /// are equal.
+///
+/// The peak signal-to-noise ratio and the structural similarity index are
+/// computed in the same pass over the image data. The peak value is 255 for
+/// 8-bit and float images, and 65535 for 16-bit images.
 void DILIGENT_GLOBAL_FUNCTION(ComputeImageDifference)(const ComputeImageDifferenceAttribs REF Attribs, ImageDiffInfo REF ImageDiff);
 
 
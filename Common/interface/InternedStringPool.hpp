@@ -0,0 +1,199 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::InternedStringPool class
+
+#include <mutex>
+#include <memory>
+#include <string>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/MemoryAllocator.h"
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+/// Handle of a string interned in the InternedStringPool.
+///
+/// The handle is a single pointer to the immutable string data that is stored in the pool
+/// together with the string length and hash. Two handles obtained from the same pool are equal
+/// if and only if they refer to equal strings, so comparison is a pointer compare.
+/// The handle remains valid as long as the pool is alive.
+class InternedString
+{
+public:
+    InternedString() noexcept {}
+
+    /// Returns the null-terminated string, or null if the handle is empty.
+    const Char* GetStr() const noexcept
+    {
+        return m_pHeader != nullptr ? reinterpret_cast<const Char*>(m_pHeader + 1) : nullptr;
+    }
+
+    /// Returns the string length, not including the null terminator.
+    size_t GetLength() const noexcept
+    {
+        return m_pHeader != nullptr ? m_pHeader->Length : 0;
+    }
+
+    /// Returns the string hash. The hash is the same as the one computed by CStringHash<Char>.
+    size_t GetHash() const noexcept
+    {
+        return m_pHeader != nullptr ? m_pHeader->Hash : 0;
+    }
+
+    bool operator==(const InternedString& RHS) const noexcept
+    {
+        return m_pHeader == RHS.m_pHeader;
+    }
+
+    bool operator!=(const InternedString& RHS) const noexcept
+    {
+        return m_pHeader != RHS.m_pHeader;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return m_pHeader != nullptr;
+    }
+
+    struct Hasher
+    {
+        size_t operator()(const InternedString& Str) const noexcept
+        {
+            return Str.GetHash();
+        }
+    };
+
+private:
+    friend class InternedStringPool;
+
+    // The header is immediately followed by the null-terminated string.
+    struct Header
+    {
+        size_t Hash;
+        size_t Length;
+    };
+
+    explicit InternedString(const Header* pHeader) noexcept :
+        m_pHeader{pHeader}
+    {}
+
+    const Header* m_pHeader = nullptr;
+};
+
+
+/// Interned string pool statistics.
+struct InternedStringPoolStats
+{
+    /// The number of unique strings in the pool.
+    size_t NumStrings = 0;
+
+    /// The number of Intern() calls.
+    size_t NumRequests = 0;
+
+    /// The total size of all strings passed to Intern(), including the null terminators.
+    /// This is the memory that would be used if every string was copied.
+    size_t RequestedSize = 0;
+
+    /// The total size of the unique strings, including the null terminators.
+    size_t StoredSize = 0;
+
+    /// The total size of the memory used by the pool, including the string headers,
+    /// the hash tables and the unused space in the memory chunks.
+    size_t ReservedSize = 0;
+};
+
+
+/// Thread-safe pool that keeps a single copy of every string.
+///
+/// Strings are stored in chunked arenas and are never moved or released until the pool is destroyed,
+/// so the handles returned by Intern() remain valid for the lifetime of the pool.
+/// The pool is split into shards selected by the string hash; each shard has its own lock,
+/// open-addressing hash set and memory chunks, so threads interning different strings rarely contend.
+///
+/// Usage example:
+///
+///     InternedStringPool Pool{DefaultRawMemoryAllocator::GetAllocator()};
+///     InternedString     Name1 = Pool.Intern("g_Texture");
+///     InternedString     Name2 = Pool.Intern(std::string{"g_Texture"});
+///     VERIFY_EXPR(Name1 == Name2 && Name1.GetStr() == Name2.GetStr());
+class InternedStringPool
+{
+public:
+    /// \param [in] Allocator - Allocator that is used to allocate memory chunks and hash tables.
+    /// \param [in] ChunkSize - The size of a memory chunk.
+    /// \param [in] NumShards - The number of independent shards.
+    explicit InternedStringPool(IMemoryAllocator& Allocator, Uint32 ChunkSize = 4 << 10, Uint32 NumShards = 8);
+    ~InternedStringPool();
+
+    // clang-format off
+    InternedStringPool           (const InternedStringPool&) = delete;
+    InternedStringPool           (InternedStringPool&&)      = delete;
+    InternedStringPool& operator=(const InternedStringPool&) = delete;
+    InternedStringPool& operator=(InternedStringPool&&)      = delete;
+    // clang-format on
+
+    /// Returns the handle of the interned copy of the string. The string is added to the pool if it is not there yet.
+    /// If Str is null, returns an empty handle.
+    InternedString Intern(const Char* Str);
+
+    /// Interns the string of the given length. The string does not need to be null-terminated.
+    InternedString Intern(const Char* Str, size_t Length);
+
+    InternedString Intern(const String& Str)
+    {
+        return Intern(Str.c_str(), Str.length());
+    }
+
+    /// Returns the handle of the interned string, or an empty handle if the string is not in the pool.
+    InternedString Find(const Char* Str) const;
+
+    /// Returns the pool statistics.
+    InternedStringPoolStats GetStats() const;
+
+    /// Computes the string hash. The hash is the same as the one computed by CStringHash<Char>.
+    static size_t ComputeHash(const Char* Str, size_t Length) noexcept
+    {
+        return CStringHash<Char>{}(Str, Length);
+    }
+
+private:
+    class Shard;
+
+    Shard& GetShard(size_t Hash) const;
+
+    IMemoryAllocator&        m_Allocator;
+    const Uint32             m_NumShards;
+    std::unique_ptr<Shard[]> m_Shards;
+};
+
+} // namespace Diligent
@@ -18,13 +18,13 @@
 #pragma once
 
 #include <unordered_map>
-#include <deque>
 #include <mutex>
 #include <memory>
 #include <algorithm>
 #include <atomic>
 #include <vector>
 
+#include "../../../DiligentCore/Primitives/interface/BasicTypes.h"
 #include "../../../DiligentCore/Platforms/Basic/interface/DebugUtilities.hpp"
 
 namespace Diligent
@@ -54,17 +54,34 @@ namespace Diligent
 ///
 /// If the data is not found, it is atomically initialized by the provided initializer function.
 /// If the data is found, the initializer function is not called.
+///
+/// The cache may optionally be split into several shards. Every key is mapped to one shard
+/// by its hash, and each shard has its own mutex, hash map and LRU list, so that threads that
+/// access keys in different shards do not contend. The maximum size is divided evenly between
+/// the shards, and the least recently used items are evicted from each shard independently.
 template <typename KeyType, typename DataType, typename KeyHasher = std::hash<KeyType>>
 class LRUCache
 {
 public:
-    LRUCache() noexcept
+    LRUCache() :
+        LRUCache{0}
     {}
 
-    explicit LRUCache(size_t MaxSize) noexcept :
+    /// \param [in] MaxSize   - The maximum cache size.
+    /// \param [in] NumShards - The number of independent cache shards.
+    explicit LRUCache(size_t MaxSize, size_t NumShards = 1) :
+        m_NumShards{(std::max)(NumShards, size_t{1})},
+        m_Shards{new Shard[m_NumShards]},
         m_MaxSize{MaxSize}
     {}
 
+    // clang-format off
+    LRUCache           (const LRUCache&)  = delete;
+    LRUCache           (      LRUCache&&) = delete;
+    LRUCache& operator=(const LRUCache&)  = delete;
+    LRUCache& operator=(      LRUCache&&) = delete;
+    // clang-format on
+
     /// Finds the data in the cache and returns it. If the data is not found, it is atomically created
     /// using the provided initializer.
     ///
@@ -88,34 +105,36 @@ public:
             return Data;
         }
 
+        Shard& CacheShard = GetShard(Key);
+
         // Get the data wrapper. Since this is a shared pointer, it may not be destroyed
         // while we keep one, even if it is popped from the cache by another thread.
-        auto pDataWrpr = GetDataWrapper(Key);
+        auto pDataWrpr = CacheShard.GetDataWrapper(Key);
         VERIFY_EXPR(pDataWrpr);
 
         // Get data by value. It will be atomically initialized if necessary,
-        // while the main cache mutex is not locked.
+        // while the shard mutex is not locked.
         bool IsNewObject = false;
         // InitData may throw, which will leave the wrapper in the cache in the 'InitFailure' state.
-        // It will be removed from the cache later when the LRU queue is processed.
+        // It will be removed from the cache later when the LRU list is processed.
         auto Data = pDataWrpr->GetData(std::forward<InitDataType>(InitData), IsNewObject);
 
         // Process the release queue
         std::vector<std::shared_ptr<DataWrapper>> DeleteList;
         {
-            std::lock_guard<std::mutex> Lock{m_Mtx};
+            std::lock_guard<std::mutex> Lock{CacheShard.Mtx};
 
             if (IsNewObject)
             {
                 VERIFY_EXPR(pDataWrpr->GetState() == DataWrapper::DataState::InitializedUnaccounted);
 
-                // NB: since we released the cache mutex, there is no guarantee that pDataWrpr is
+                // NB: since we released the shard mutex, there is no guarantee that pDataWrpr is
                 //     still in the cache as it could have been removed by another thread in <Erase>.
-                auto it = m_Cache.find(Key);
-                if (it != m_Cache.end())
+                auto it = CacheShard.Cache.find(Key);
+                if (it != CacheShard.Cache.end())
                 {
                     // Check that the object wrapper is the same.
-                    if (it->second == pDataWrpr)
+                    if (it->second.pWrpr == pDataWrpr)
                     {
                         // The wrapper is in the cache - label it as accounted and update the cache size.
 
@@ -123,9 +142,10 @@ public:
                         // initialize the object and obtain IsNewObject == true in <NewObj>.
                         pDataWrpr->SetAccounted(); /* <SA> */
 
+                        CacheShard.CurrSize += pDataWrpr->GetAccountedSize();
                         m_CurrSize += pDataWrpr->GetAccountedSize();
                         // Note that since we hold the mutex, no other thread can access the
-                        // LRUQueue and remove this wrapper from the cache in <Erase>.
+                        // LRU list and remove this wrapper from the cache in <Erase>.
                     }
                     else
                     {
@@ -145,27 +165,26 @@ public:
                 }
             }
 
-            for (int idx = static_cast<int>(m_LRUQueue.size()) - 1; idx >= 0; --idx)
+            const size_t MaxShardSize = GetMaxShardSize();
+            for (CacheEntry* pEntry = CacheShard.pTail; pEntry != nullptr && CacheShard.CurrSize > MaxShardSize;)
             {
-                if (m_CurrSize <= m_MaxSize)
-                    break;
-
-                VERIFY_EXPR(!m_LRUQueue.empty());
+                // Get the previous entry before the current one is potentially erased.
+                CacheEntry* const pPrevEntry = pEntry->pPrev;
 
                 // State stransition table:
-                //                                                     Protected by m_Mtx   Accounted Size
+                //                                                     Protected by Mtx     Accounted Size
                 //   Default                -> InitializedUnaccounted         No                 0          <D2U>
                 //   Default                -> InitFailure                    No                 0          <D2F>
                 //   InitFailure            -> Default                        No                 0          <F2D>
                 //   InitializedUnaccounted -> InitializedAccounted          Yes                !0          <U2A>
                 //   InitializedAccounted                                 Final State
                 //
-                const auto& cache_it = m_LRUQueue[idx];
-                const auto  State    = cache_it->second->GetState(); /* <ReadState> */
+                const auto State = pEntry->pWrpr->GetState(); /* <ReadState> */
                 if (State == DataWrapper::DataState::Default)
                 {
                     // The object is being initialized in another thread in DataWrapper::Get().
                     // Possible actual states here are Default, InitializedUnaccounted or InitFailure.
+                    pEntry = pPrevEntry;
                     continue;
                 }
                 if (State == DataWrapper::DataState::InitializedUnaccounted)
@@ -174,6 +193,7 @@ public:
                     // in the cache yet as this thread acquired the mutex first.
                     // The only possible actual state here is InitializedUnaccounted as transition to
                     // InitializedAccounted in <SA> requires mutex.
+                    pEntry = pPrevEntry;
                     continue;
                 }
 
@@ -191,22 +211,23 @@ public:
 
                 // NB: if the state was not InitializedAccounted when we read it in <ReadState>, it can't be
                 //     InitializedAccounted now since the transition <U2A> is protected by mutex in <SA>.
-                VERIFY_EXPR((State == DataWrapper::DataState::InitializedAccounted && cache_it->second->GetState() == DataWrapper::DataState::InitializedAccounted) ||
-                            (State != DataWrapper::DataState::InitializedAccounted && cache_it->second->GetState() != DataWrapper::DataState::InitializedAccounted));
+                VERIFY_EXPR((State == DataWrapper::DataState::InitializedAccounted && pEntry->pWrpr->GetState() == DataWrapper::DataState::InitializedAccounted) ||
+                            (State != DataWrapper::DataState::InitializedAccounted && pEntry->pWrpr->GetState() != DataWrapper::DataState::InitializedAccounted));
 
                 // Note that transition to InitializedAccounted state is protected by the mutex in <SA>, so
                 // we can't remove a wrapper before it was accounted for.
-                const size_t AccountedSize = cache_it->second->GetAccountedSize();
-                DeleteList.emplace_back(std::move(cache_it->second));
-                m_Cache.erase(cache_it); /* <Erase> */
-                m_LRUQueue.erase(m_LRUQueue.begin() + idx);
-                VERIFY_EXPR(m_CurrSize >= AccountedSize);
+                const size_t AccountedSize = pEntry->pWrpr->GetAccountedSize();
+                DeleteList.emplace_back(std::move(pEntry->pWrpr));
+                CacheShard.Erase(*pEntry); /* <Erase> */
+                VERIFY_EXPR(CacheShard.CurrSize >= AccountedSize && m_CurrSize >= AccountedSize);
+                CacheShard.CurrSize -= AccountedSize;
                 m_CurrSize -= AccountedSize;
+
+                pEntry = pPrevEntry;
             }
-            VERIFY_EXPR(m_Cache.size() == m_LRUQueue.size());
         }
 
-        // Delete objects after releasing the cache mutex
+        // Delete objects after releasing the shard mutex
         DeleteList.clear();
 
         return Data;
@@ -224,19 +245,32 @@ public:
         return m_CurrSize;
     }
 
+    /// Returns the number of cache shards.
+    size_t GetNumShards() const
+    {
+        return m_NumShards;
+    }
+
     ~LRUCache()
     {
 #ifdef DILIGENT_DEBUG
         size_t DbgSize = 0;
-        VERIFY_EXPR(m_Cache.size() == m_LRUQueue.size());
-        while (!m_LRUQueue.empty())
+        for (size_t i = 0; i < m_NumShards; ++i)
         {
-            auto last_it = m_LRUQueue.back();
-            m_LRUQueue.pop_back();
-            DbgSize += last_it->second->GetAccountedSize();
-            m_Cache.erase(last_it);
+            const Shard& CacheShard = m_Shards[i];
+
+            size_t DbgShardSize  = 0;
+            size_t DbgNumEntries = 0;
+            for (const CacheEntry* pEntry = CacheShard.pHead; pEntry != nullptr; pEntry = pEntry->pNext)
+            {
+                VERIFY_EXPR(pEntry->pNext != nullptr || pEntry == CacheShard.pTail);
+                DbgShardSize += pEntry->pWrpr->GetAccountedSize();
+                ++DbgNumEntries;
+            }
+            VERIFY_EXPR(DbgNumEntries == CacheShard.Cache.size());
+            VERIFY_EXPR(DbgShardSize == CacheShard.CurrSize);
+            DbgSize += DbgShardSize;
         }
-        VERIFY_EXPR(m_Cache.empty());
         VERIFY_EXPR(DbgSize == m_CurrSize);
 #endif
     }
@@ -313,37 +347,118 @@ private:
         std::atomic<size_t> m_AccountedSize{0};
     };
 
-    std::shared_ptr<DataWrapper> GetDataWrapper(const KeyType& Key)
+    // Cache entries are stored in the hash map and are linked into an intrusive doubly-linked
+    // LRU list, so that an entry can be moved to the front or removed in constant time.
+    // Pointers to the hash map elements remain valid when the map is rehashed.
+    struct CacheEntry
+    {
+        std::shared_ptr<DataWrapper> pWrpr;
+
+        const KeyType* pKey  = nullptr;
+        CacheEntry*    pPrev = nullptr;
+        CacheEntry*    pNext = nullptr;
+    };
+
+    using CacheType = std::unordered_map<KeyType, CacheEntry, KeyHasher>;
+
+    struct Shard
     {
-        std::lock_guard<std::mutex> Lock{m_Mtx};
+        std::mutex Mtx;
+        CacheType  Cache;
+
+        // The most recently used entry
+        CacheEntry* pHead = nullptr;
+        // The least recently used entry
+        CacheEntry* pTail = nullptr;
+
+        // The total accounted size of all entries in this shard
+        size_t CurrSize = 0;
+
+        std::shared_ptr<DataWrapper> GetDataWrapper(const KeyType& Key)
+        {
+            std::lock_guard<std::mutex> Lock{Mtx};
+
+            auto it = Cache.find(Key);
+            if (it == Cache.end())
+            {
+                it = Cache.emplace(Key, CacheEntry{}).first;
+
+                it->second.pWrpr = std::make_shared<DataWrapper>();
+                it->second.pKey  = &it->first;
+            }
+            else
+            {
+                // Pop the entry from the list
+                Unlink(it->second);
+            }
+
+            // Move the entry to the front of the list
+            PushFront(it->second);
+
+            return it->second.pWrpr;
+        }
 
-        auto it = m_Cache.find(Key);
-        if (it == m_Cache.end())
+        void Erase(CacheEntry& Entry)
         {
-            it = m_Cache.emplace(Key, std::make_shared<DataWrapper>()).first;
+            Unlink(Entry);
+            auto it = Cache.find(*Entry.pKey);
+            VERIFY_EXPR(it != Cache.end() && &it->second == &Entry);
+            Cache.erase(it);
         }
-        else
+
+    private:
+        void PushFront(CacheEntry& Entry)
         {
-            // Pop the wrapper iterator from the queue
-            auto queue_it = std::find(m_LRUQueue.begin(), m_LRUQueue.end(), it);
-            VERIFY_EXPR(queue_it != m_LRUQueue.end());
-            m_LRUQueue.erase(queue_it);
+            VERIFY_EXPR(Entry.pPrev == nullptr && Entry.pNext == nullptr);
+            Entry.pNext = pHead;
+            if (pHead != nullptr)
+                pHead->pPrev = &Entry;
+            else
+                pTail = &Entry;
+            pHead = &Entry;
         }
 
-        // Move iterator to the front of the queue
-        m_LRUQueue.push_front(it);
-        VERIFY_EXPR(m_Cache.size() == m_LRUQueue.size());
+        void Unlink(CacheEntry& Entry)
+        {
+            if (Entry.pPrev != nullptr)
+                Entry.pPrev->pNext = Entry.pNext;
+            else
+            {
+                VERIFY_EXPR(pHead == &Entry);
+                pHead = Entry.pNext;
+            }
+
+            if (Entry.pNext != nullptr)
+                Entry.pNext->pPrev = Entry.pPrev;
+            else
+            {
+                VERIFY_EXPR(pTail == &Entry);
+                pTail = Entry.pPrev;
+            }
 
-        return it->second;
-    }
+            Entry.pPrev = nullptr;
+            Entry.pNext = nullptr;
+        }
+    };
 
+    Shard& GetShard(const KeyType& Key)
+    {
+        if (m_NumShards == 1)
+            return m_Shards[0];
 
-    using CacheType = std::unordered_map<KeyType, std::shared_ptr<DataWrapper>, KeyHasher>;
-    CacheType m_Cache;
+        // Mix the hash so that the shard index does not correlate with the
+        // bucket index in the shard's hash map.
+        const Uint64 Hash = static_cast<Uint64>(KeyHasher{}(Key)) * Uint64{0x9E3779B97F4A7C15};
+        return m_Shards[static_cast<size_t>((Hash >> 32) % m_NumShards)];
+    }
 
-    std::deque<typename CacheType::iterator> m_LRUQueue;
+    size_t GetMaxShardSize() const
+    {
+        return (m_MaxSize.load() + m_NumShards - 1) / m_NumShards;
+    }
 
-    std::mutex m_Mtx;
+    const size_t             m_NumShards;
+    std::unique_ptr<Shard[]> m_Shards;
 
     std::atomic<size_t> m_CurrSize{0};
     std::atomic<size_t> m_MaxSize{0};
@@ -0,0 +1,99 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Implementation of the MappedFileStream class
+
+#include <memory>
+
+#include "../../Primitives/interface/FileStream.h"
+#include "../../Primitives/interface/DataBlob.h"
+#include "../../Platforms/Linux/interface/LinuxMappedFile.hpp"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Read-only file stream backed by a memory-mapped file.
+
+/// Unlike BasicFileStream, the stream does not copy the file contents: GetDataView returns
+/// data blobs that reference the mapped memory directly and keep the stream alive. Such blobs
+/// can be passed to DeviceObjectArchive (with MakeCopy = false) or IBytecodeCache::Load
+/// without doubling the peak memory usage. The data of the views must not be modified.
+class MappedFileStream : public ObjectBase<IFileStream>
+{
+public:
+    typedef ObjectBase<IFileStream> TBase;
+
+    static RefCntAutoPtr<MappedFileStream> Create(const Char* Path, MappedFileAccessHint Hint = MappedFileAccessHint::Normal);
+
+    MappedFileStream(IReferenceCounters*  pRefCounters,
+                     const Char*          Path,
+                     MappedFileAccessHint Hint = MappedFileAccessHint::Normal);
+
+    virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override;
+
+    /// Copies the entire file into pData.
+    virtual void DILIGENT_CALL_TYPE ReadBlob(IDataBlob* pData) override;
+
+    /// Reads data from the stream
+    virtual bool DILIGENT_CALL_TYPE Read(void* Data, size_t Size) override;
+
+    /// The stream is read-only, so this method always fails.
+    virtual bool DILIGENT_CALL_TYPE Write(const void* Data, size_t Size) override;
+
+    virtual size_t DILIGENT_CALL_TYPE GetSize() override;
+
+    virtual size_t DILIGENT_CALL_TYPE GetPos() override;
+
+    virtual bool DILIGENT_CALL_TYPE SetPos(size_t Offset, int Origin) override;
+
+    virtual bool DILIGENT_CALL_TYPE IsValid() override;
+
+    /// Returns the pointer to the mapped data, or null if the stream is invalid or the file is empty.
+    const void* GetData() const;
+
+    /// Returns a data blob that references the mapped range [Offset, Offset + Size) without copying it.
+
+    /// The range is clamped to the file size. The blob keeps the stream and the mapping alive.
+    /// Returns null if the stream is invalid.
+    RefCntAutoPtr<IDataBlob> GetDataView(size_t Offset = 0, size_t Size = ~size_t{0});
+
+    /// Gives the kernel an access pattern hint for the range [Offset, Offset + Size).
+    bool Advise(MappedFileAccessHint Hint, size_t Offset = 0, size_t Size = ~size_t{0});
+
+private:
+    std::unique_ptr<LinuxMappedFile> m_pFile;
+
+    size_t m_Size = 0;
+    size_t m_Pos  = 0;
+};
+
+} // namespace Diligent
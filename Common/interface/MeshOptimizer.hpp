@@ -0,0 +1,264 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Index and vertex buffer optimization for GPU rendering.
+///
+/// The functions in this file work with any triangle list with 32-bit indices, for example
+/// the output of CreateGeometryPrimitive(). A typical pipeline is:
+///
+///     OptimizeVertexCache(Indices, NumIndices, NumVertices, Indices);
+///     OptimizeOverdraw(Indices, NumIndices, Positions, VertexStride, NumVertices, Indices);
+///     Uint32 NumUsedVertices = OptimizeVertexFetchRemap(Indices, NumIndices, NumVertices, Remap);
+///     RemapIndexBuffer(Indices, NumIndices, Remap, Indices);
+///     RemapVertexBuffer(Vertices, NumVertices, VertexStride, Remap, NewVertices);
+///
+/// All functions allow the destination index array to be the same as the source array.
+/// Vertex positions are read as three floats at the address pPositions + i * PositionStride.
+
+#include <vector>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "BasicMath.hpp"
+
+namespace Diligent
+{
+
+/// Post-transform vertex cache statistics, see AnalyzeVertexCache().
+struct VertexCacheStatistics
+{
+    /// The number of vertices processed by the vertex shader.
+    Uint32 VerticesTransformed = 0;
+
+    /// Average cache miss ratio: the number of transformed vertices per triangle.
+    /// The value is in the [0.5, 3] range; lower is better.
+    float ACMR = 0;
+
+    /// Average transform to vertex ratio: the number of transformed vertices per referenced vertex.
+    /// 1 is the optimum.
+    float ATVR = 0;
+};
+
+/// Simulates a FIFO post-transform vertex cache and returns its statistics.
+
+/// \param[in] pIndices    - Triangle list indices.
+/// \param[in] NumIndices  - The number of indices. Must be a multiple of 3.
+/// \param[in] NumVertices - The number of vertices.
+/// \param[in] CacheSize   - The number of vertices in the cache.
+VertexCacheStatistics AnalyzeVertexCache(const Uint32* pIndices, size_t NumIndices, Uint32 NumVertices, Uint32 CacheSize = 16);
+
+
+/// Vertex fetch statistics, see AnalyzeVertexFetch().
+struct VertexFetchStatistics
+{
+    /// The number of bytes read from the vertex buffer.
+    size_t BytesFetched = 0;
+
+    /// The number of bytes fetched divided by the size of the referenced vertices.
+    /// 1 is the optimum.
+    float Overfetch = 0;
+};
+
+/// Simulates the vertex fetch cache and returns its statistics.
+
+/// \param[in] pIndices      - Triangle list indices.
+/// \param[in] NumIndices    - The number of indices.
+/// \param[in] NumVertices   - The number of vertices.
+/// \param[in] VertexSize    - The vertex size in bytes.
+/// \param[in] CacheLineSize - The size of the cache line in bytes.
+/// \param[in] NumCacheLines - The number of cache lines in the cache, which is modeled as fully associative with LRU replacement.
+VertexFetchStatistics AnalyzeVertexFetch(const Uint32* pIndices,
+                                         size_t        NumIndices,
+                                         Uint32        NumVertices,
+                                         Uint32        VertexSize,
+                                         Uint32        CacheLineSize = 64,
+                                         Uint32        NumCacheLines = 64);
+
+
+/// Reorders the triangles to reduce the number of vertex shader invocations.
+
+/// The function implements the linear-speed vertex cache optimization by Tom Forsyth,
+/// which does not depend on the cache size and works well with both FIFO and LRU caches.
+///
+/// \param[in]  pIndices    - Triangle list indices.
+/// \param[in]  NumIndices  - The number of indices. Must be a multiple of 3.
+/// \param[in]  NumVertices - The number of vertices.
+/// \param[out] pDstIndices - Reordered indices. May be the same as pIndices.
+void OptimizeVertexCache(const Uint32* pIndices, size_t NumIndices, Uint32 NumVertices, Uint32* pDstIndices);
+
+/// Reorders the triangles for a FIFO vertex cache of the given size.
+
+/// The function implements Tipsify by Sander, Nehab and Barczak ("Fast Triangle Reordering
+/// for Vertex Locality and Reduced Overdraw", 2007). It is faster than OptimizeVertexCache()
+/// and is the recommended input to OptimizeOverdraw().
+///
+/// \param[in]  pIndices    - Triangle list indices.
+/// \param[in]  NumIndices  - The number of indices. Must be a multiple of 3.
+/// \param[in]  NumVertices - The number of vertices.
+/// \param[in]  CacheSize   - The number of vertices in the cache.
+/// \param[out] pDstIndices - Reordered indices. May be the same as pIndices.
+void OptimizeVertexCacheFIFO(const Uint32* pIndices, size_t NumIndices, Uint32 NumVertices, Uint32 CacheSize, Uint32* pDstIndices);
+
+/// Reorders the clusters of triangles to reduce overdraw.
+
+/// The index buffer is split into clusters at the points where the vertex cache is flushed,
+/// and the clusters are further split while the cache efficiency stays within the threshold.
+/// The clusters that face away from the mesh center are then drawn first, because they are
+/// likely to occlude the others. The input should be optimized for the vertex cache first.
+///
+/// \param[in]  pIndices       - Triangle list indices.
+/// \param[in]  NumIndices     - The number of indices. Must be a multiple of 3.
+/// \param[in]  pPositions     - Vertex positions.
+/// \param[in]  PositionStride - The distance between the positions of two consecutive vertices in bytes.
+/// \param[in]  NumVertices    - The number of vertices.
+/// \param[out] pDstIndices    - Reordered indices. May be the same as pIndices.
+/// \param[in]  Threshold      - The maximum allowed increase of ACMR, e.g. 1.05 allows 5% more cache misses.
+/// \param[in]  CacheSize      - The number of vertices in the FIFO cache.
+void OptimizeOverdraw(const Uint32* pIndices,
+                      size_t        NumIndices,
+                      const void*   pPositions,
+                      Uint32        PositionStride,
+                      Uint32        NumVertices,
+                      Uint32*       pDstIndices,
+                      float         Threshold = 1.05f,
+                      Uint32        CacheSize = 16);
+
+/// Generates the vertex remap table that orders the vertices by their first use in the index buffer.
+
+/// \param[in]  pIndices    - Triangle list indices.
+/// \param[in]  NumIndices  - The number of indices.
+/// \param[in]  NumVertices - The number of vertices.
+/// \param[out] pRemap      - Remap table with NumVertices elements: pRemap[OldIndex] = NewIndex.
+///                           The vertices that are not referenced by the index buffer are
+///                           mapped to ~0u and are removed by RemapVertexBuffer().
+/// \return     The number of referenced vertices, which is the number of vertices after remapping.
+Uint32 OptimizeVertexFetchRemap(const Uint32* pIndices, size_t NumIndices, Uint32 NumVertices, Uint32* pRemap);
+
+/// Applies the remap table to the index buffer: pDstIndices[i] = pRemap[pIndices[i]].
+void RemapIndexBuffer(const Uint32* pIndices, size_t NumIndices, const Uint32* pRemap, Uint32* pDstIndices);
+
+/// Applies the remap table to the vertex buffer: the vertex i is copied to the position pRemap[i].
+
+/// \param[in]  pVertices    - Source vertices.
+/// \param[in]  NumVertices  - The number of source vertices.
+/// \param[in]  VertexStride - The vertex size in bytes.
+/// \param[in]  pRemap       - Remap table returned by OptimizeVertexFetchRemap().
+/// \param[out] pDstVertices - Destination vertex buffer. Must not overlap with the source buffer.
+void RemapVertexBuffer(const void* pVertices, Uint32 NumVertices, Uint32 VertexStride, const Uint32* pRemap, void* pDstVertices);
+
+
+/// Meshlet, see BuildMeshlets().
+struct Meshlet
+{
+    /// Offset of the first vertex index in MeshletData::Vertices.
+    Uint32 VertexOffset = 0;
+
+    /// Offset of the first triangle in MeshletData::Triangles, in triangles.
+    Uint32 TriangleOffset = 0;
+
+    /// The number of vertices.
+    Uint32 VertexCount = 0;
+
+    /// The number of triangles.
+    Uint32 TriangleCount = 0;
+};
+
+/// Meshlets of a mesh.
+struct MeshletData
+{
+    /// Meshlets.
+    std::vector<Meshlet> Meshlets;
+
+    /// Indices of the meshlet vertices in the mesh vertex buffer.
+    std::vector<Uint32> Vertices;
+
+    /// Meshlet triangles: three 8-bit indices per triangle into the meshlet vertices.
+    std::vector<Uint8> Triangles;
+};
+
+/// Meshlet build attributes.
+struct MeshletBuildAttribs
+{
+    /// The maximum number of vertices in a meshlet (3 to 256).
+    Uint32 MaxVertices = 64;
+
+    /// The maximum number of triangles in a meshlet (1 to 512).
+    Uint32 MaxTriangles = 124;
+};
+
+/// Splits the triangle list into meshlets for mesh shader pipelines.
+
+/// Every meshlet is grown from a seed triangle by adding the adjacent triangle that adds the
+/// fewest new vertices, until the vertex or the triangle limit is reached. The seeds are taken
+/// in the index buffer order, so the meshlets follow the vertex cache order of the input.
+///
+/// \param[in] pIndices    - Triangle list indices.
+/// \param[in] NumIndices  - The number of indices. Must be a multiple of 3.
+/// \param[in] NumVertices - The number of vertices.
+/// \param[in] Attribs     - Meshlet build attributes.
+MeshletData BuildMeshlets(const Uint32* pIndices, size_t NumIndices, Uint32 NumVertices, const MeshletBuildAttribs& Attribs = MeshletBuildAttribs{});
+
+/// Meshlet bounding sphere and normal cone.
+struct MeshletBounds
+{
+    /// Bounding sphere center.
+    float3 Center;
+
+    /// Bounding sphere radius.
+    float Radius = 0;
+
+    /// Normal cone apex.
+    float3 ConeApex;
+
+    /// Normal cone axis.
+    float3 ConeAxis;
+
+    /// Sine of the cone half-angle, or 1 if the cone is too wide for culling.
+    float ConeCutoff = 1;
+};
+
+/// Computes the bounding sphere and the normal cone of the meshlet.
+
+/// Triangle normals are computed as cross(V1 - V0, V2 - V0), which points outward for the meshes
+/// produced by CreateGeometryPrimitive(). Set FlipNormals to true for the opposite winding.
+MeshletBounds ComputeMeshletBounds(const MeshletData& Data,
+                                   const Meshlet&     M,
+                                   const void*        pPositions,
+                                   Uint32             PositionStride,
+                                   Uint32             NumVertices,
+                                   bool               FlipNormals = false);
+
+/// Returns true if all triangles of the meshlet face away from the camera, see ComputeMeshletBounds().
+inline bool IsMeshletBackFacing(const MeshletBounds& Bounds, const float3& CameraPos)
+{
+    const float3 ViewDir = Bounds.ConeApex - CameraPos;
+    const float  Len     = length(ViewDir);
+    return Len > 0 && dot(ViewDir, Bounds.ConeAxis) >= Bounds.ConeCutoff * Len;
+}
+
+} // namespace Diligent
@@ -0,0 +1,225 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::OcclusionRasterizer class
+
+#include <vector>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "AdvancedMath.hpp"
+#include "ThreadPool.h"
+
+namespace Diligent
+{
+
+/// Occluder mesh rasterized by Diligent::OcclusionRasterizer.
+struct OccluderMeshDesc
+{
+    /// Object-space vertex positions.
+    const float3* pVertices = nullptr;
+
+    /// The number of vertices.
+    Uint32 NumVertices = 0;
+
+    /// Triangle list indices.
+    const Uint32* pIndices = nullptr;
+
+    /// The number of indices. Must be a multiple of 3.
+    Uint32 NumIndices = 0;
+
+    /// Object-space to clip-space transform.
+    float4x4 WorldViewProj = float4x4::Identity();
+
+    /// Whether to skip the triangles facing away from the camera.
+    /// The front faces are the ones whose vertices are in clockwise order on the screen.
+    bool CullBackFaces = true;
+};
+
+/// Software rasterizer of occluder depth for CPU occlusion culling.
+
+/// The rasterizer renders the depth of occluder meshes into a low-resolution depth buffer
+/// and tests screen-space bounding rectangles of other objects against it, so that hidden
+/// objects can be rejected before they are submitted to the GPU.
+///
+/// The depth buffer is stored in 8x8 pixel tiles, and every tile keeps the maximum depth of
+/// its pixels. The tiles are grouped into bins of 4x4 tiles. Triangles are first set up and
+/// binned, and then every bin is rasterized independently, 8 pixels (AVX2) or 4 pixels
+/// (SSE2/NEON) at a time; the instruction set is selected at run time. Both passes are split
+/// between the threads of an optional IThreadPool, and the result does not depend on the
+/// number of threads.
+///
+/// Depth is z/w in the [0, 1] range with 0 at the near plane. For OpenGL-style projection
+/// matrices, the [-1, 1] range is mapped to [0, 1]. Occluders are rasterized conservatively:
+/// a pixel is covered only if its center is strictly inside the triangle.
+///
+///     OcclusionRasterizer Rasterizer{256, 128};
+///     Rasterizer.Clear();
+///     Rasterizer.RasterizeOccluders(Occluders.data(), NumOccluders, false, pThreadPool);
+///     if (Rasterizer.IsBoxVisible(Box, ViewProj, false))
+///         DrawObject();
+class OcclusionRasterizer
+{
+public:
+    /// Tile width and height in pixels.
+    static constexpr Uint32 TileSize = 8;
+
+    /// Bin width and height in tiles.
+    static constexpr Uint32 BinSizeInTiles = 4;
+
+    /// Creates the rasterizer with the given depth buffer size. The size is rounded up to a multiple of TileSize.
+    OcclusionRasterizer(Uint32 Width, Uint32 Height);
+
+    /// Resizes the depth buffer. The depth buffer is cleared.
+    void Resize(Uint32 Width, Uint32 Height);
+
+    /// Sets all depths to the far plane.
+    void Clear();
+
+    /// Rasterizes the occluder meshes into the depth buffer.
+
+    /// \param[in] pMeshes     - Occluder meshes.
+    /// \param[in] NumMeshes   - The number of meshes.
+    /// \param[in] IsGL        - Whether the clip-space z range is [-w, w] (OpenGL) rather than [0, w].
+    /// \param[in] pThreadPool - An optional thread pool to set up and rasterize the triangles in parallel.
+    void RasterizeOccluders(const OccluderMeshDesc* pMeshes,
+                            Uint32                  NumMeshes,
+                            bool                    IsGL,
+                            IThreadPool*            pThreadPool = nullptr);
+
+    /// Tests if any part of the screen-space rectangle may be visible.
+
+    /// \param[in] MinX, MinY - Top-left corner of the rectangle in pixels.
+    /// \param[in] MaxX, MaxY - Bottom-right corner of the rectangle in pixels.
+    /// \param[in] MinDepth   - The minimum depth of the object inside the rectangle.
+    /// \return     true if the depth of any pixel covered by the rectangle is greater than MinDepth,
+    ///             and false if the rectangle is completely occluded or does not overlap the buffer.
+    ///
+    /// \remarks    A pixel is considered covered if the rectangle overlaps any part of it.
+    bool IsRectVisible(float MinX, float MinY, float MaxX, float MaxY, float MinDepth) const;
+
+    /// Projects the bounding box to the screen and tests its bounding rectangle, see IsRectVisible().
+
+    /// \param[in] Box      - Bounding box.
+    /// \param[in] ViewProj - Transform from the box space to clip space.
+    /// \param[in] IsGL     - Whether the clip-space z range is [-w, w].
+    /// \return     true if the box may be visible. Boxes that cross the near plane are always visible.
+    bool IsBoxVisible(const BoundBox& Box, const float4x4& ViewProj, bool IsGL) const;
+
+    /// Tests an array of bounding boxes, see IsBoxVisible().
+
+    /// \param[in]  pBoxes       - Bounding boxes.
+    /// \param[in]  NumBoxes     - The number of boxes.
+    /// \param[in]  ViewProj     - Transform from the box space to clip space.
+    /// \param[in]  IsGL         - Whether the clip-space z range is [-w, w].
+    /// \param[out] pVisibleMask - Bit mask of the visible boxes. Bit (i % 32) of element (i / 32)
+    ///                            is set if box i may be visible. The array must contain at least
+    ///                            (NumBoxes + 31) / 32 elements.
+    /// \param[in]  pThreadPool  - An optional thread pool to split the boxes between the threads.
+    void TestBoxes(const BoundBox* pBoxes,
+                   size_t          NumBoxes,
+                   const float4x4& ViewProj,
+                   bool            IsGL,
+                   Uint32*         pVisibleMask,
+                   IThreadPool*    pThreadPool = nullptr) const;
+
+    /// Returns the depth of the pixel.
+    float GetDepth(Uint32 x, Uint32 y) const
+    {
+        VERIFY_EXPR(x < m_Width && y < m_Height);
+        return m_Depth[GetPixelOffset(x, y)];
+    }
+
+    /// Returns the maximum depth of the tile that contains the pixel.
+    float GetTileMaxDepth(Uint32 x, Uint32 y) const
+    {
+        VERIFY_EXPR(x < m_Width && y < m_Height);
+        return m_TileMaxDepth[(y / TileSize) * m_NumTilesX + x / TileSize];
+    }
+
+    /// Copies the depth buffer to the row-major array of Width * Height floats.
+    void ReadDepth(float* pDepth) const;
+
+    Uint32 GetWidth() const { return m_Width; }
+    Uint32 GetHeight() const { return m_Height; }
+
+    /// Triangle set up for rasterization, see RasterizeOccluders().
+    struct ScreenTriangle
+    {
+        /// Edge functions E(x, y) = EdgeA * x + EdgeB * y + EdgeC, positive inside the triangle.
+        float  EdgeA[3];
+        float  EdgeB[3];
+        double EdgeC[3];
+
+        /// Depth plane Z(x, y) = DepthA * x + DepthB * y + DepthC.
+        float  DepthA;
+        float  DepthB;
+        double DepthC;
+
+        /// The minimum depth of the vertices.
+        float MinDepth;
+
+        /// Inclusive pixel bounds.
+        int MinX, MinY, MaxX, MaxY;
+    };
+
+private:
+    size_t GetPixelOffset(Uint32 x, Uint32 y) const
+    {
+        const size_t Tile = size_t{y / TileSize} * m_NumTilesX + x / TileSize;
+        return Tile * (TileSize * TileSize) + (y % TileSize) * TileSize + x % TileSize;
+    }
+
+    void RasterizeBin(Uint32 BinIdx);
+
+    Uint32 m_Width     = 0;
+    Uint32 m_Height    = 0;
+    Uint32 m_NumTilesX = 0;
+    Uint32 m_NumTilesY = 0;
+    Uint32 m_NumBinsX  = 0;
+    Uint32 m_NumBinsY  = 0;
+
+    // Tile-major depth: every tile stores TileSize x TileSize depths in row-major order
+    std::vector<float> m_Depth;
+    std::vector<float> m_TileMaxDepth;
+
+    // Triangles set up by one batch and the indices of the triangles overlapping every bin.
+    // The batches are rasterized in order, so the result does not depend on the thread count.
+    struct TriangleBatch
+    {
+        std::vector<ScreenTriangle>      Triangles;
+        std::vector<std::vector<Uint32>> BinTriangles;
+    };
+    std::vector<TriangleBatch> m_Batches;
+    Uint32                     m_NumUsedBatches = 0;
+
+    std::vector<float4> m_ClipVerts;
+};
+
+} // namespace Diligent
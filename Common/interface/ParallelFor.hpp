@@ -0,0 +1,205 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::TaskGroup class and Diligent::ParallelFor function.
+
+#include <atomic>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+/// A group of functions that are executed asynchronously by the thread pool.
+///
+/// Every function added to the group with Run() is executed exactly once, either by a thread pool
+/// worker or by the thread that calls Wait(). Instead of blocking, Wait() executes the functions
+/// that have not been started yet on the calling thread, and then waits for the functions that are
+/// being executed by the worker threads. Wait() thus never deadlocks, even if all worker threads
+/// are busy or the thread pool has no threads at all.
+///
+///     TaskGroup Group{pThreadPool};
+///     for (auto& Mip : Mips)
+///         Group.Run([&Mip]() { GenerateMip(Mip); });
+///     Group.Wait();
+///
+/// The group is not thread-safe: Run() and Wait() must be called from the same thread.
+class TaskGroup
+{
+public:
+    /// Creates the task group.
+
+    /// \param [in] pThreadPool - The thread pool to run the functions.
+    ///                           If null, all functions are executed by Wait().
+    /// \param [in] fPriority   - The priority of the thread pool tasks.
+    explicit TaskGroup(IThreadPool* pThreadPool, float fPriority = 0);
+
+    /// Waits for all functions to finish.
+    ~TaskGroup();
+
+    // clang-format off
+    TaskGroup           (const TaskGroup&)  = delete;
+    TaskGroup& operator=(const TaskGroup&)  = delete;
+    TaskGroup           (      TaskGroup&&) = delete;
+    TaskGroup& operator=(      TaskGroup&&) = delete;
+    // clang-format on
+
+    /// Adds the function to the group and enqueues a thread pool task to run it.
+    void Run(std::function<void()> Func);
+
+    /// Executes the functions that have not been started yet on the calling
+    /// thread and waits until all functions in the group are finished.
+
+    /// \remarks   The thread pool tasks that have not been started by the time the
+    ///            functions are finished are removed from the pool.
+    void Wait();
+
+private:
+    struct State;
+
+    RefCntAutoPtr<IThreadPool> m_pThreadPool;
+    const float                m_fPriority;
+    std::shared_ptr<State>     m_pState;
+
+    std::vector<RefCntAutoPtr<IAsyncTask>> m_Tasks;
+};
+
+
+/// Splits the range into chunks that are claimed by the threads executing
+/// Diligent::ParallelFor.
+///
+/// The chunk size is adaptive: large chunks are handed out first to reduce the
+/// scheduling overhead, and the size decreases as the range is consumed, down to the
+/// minimum grain size, so that the threads finish at approximately the same time.
+class ParallelForRangeSplitter
+{
+public:
+    ParallelForRangeSplitter(size_t Begin, size_t End, size_t Grain, size_t NumThreads) noexcept :
+        m_Next{Begin},
+        m_End{End},
+        m_Grain{std::max(Grain, size_t{1})},
+        m_NumThreads{std::max(NumThreads, size_t{1})}
+    {}
+
+    /// Claims the next chunk. Returns false if the range is exhausted.
+    bool ClaimChunk(size_t& ChunkBegin, size_t& ChunkEnd) noexcept
+    {
+        size_t Curr = m_Next.load(std::memory_order_relaxed);
+        while (Curr < m_End)
+        {
+            const size_t Remaining = m_End - Curr;
+            const size_t ChunkSize = std::min(std::max(Remaining / (2 * m_NumThreads), m_Grain), Remaining);
+            if (m_Next.compare_exchange_weak(Curr, Curr + ChunkSize, std::memory_order_relaxed))
+            {
+                ChunkBegin = Curr;
+                ChunkEnd   = Curr + ChunkSize;
+                return true;
+            }
+            // If exchange fails, Curr holds the actual value of m_Next.
+        }
+        return false;
+    }
+
+private:
+    std::atomic<size_t> m_Next;
+
+    const size_t m_End;
+    const size_t m_Grain;
+    const size_t m_NumThreads;
+};
+
+
+/// Executes the function for the range [Begin, End) in parallel.
+
+/// \param [in] pThreadPool - The thread pool. If null, the function is executed
+///                           on the calling thread for the entire range.
+/// \param [in] Begin       - The beginning of the range.
+/// \param [in] End         - The end of the range.
+/// \param [in] Grain       - The minimum number of elements processed by one call of the function.
+///                           If zero, the minimum chunk size is one element.
+/// \param [in] Func        - The function to execute. It is called with the chunk boundaries:
+///                           Func(size_t ChunkBegin, size_t ChunkEnd), and must process
+///                           the elements [ChunkBegin, ChunkEnd).
+/// \param [in] fPriority   - The priority of the thread pool tasks.
+///
+/// The range is split into chunks of adaptive size (see Diligent::ParallelForRangeSplitter).
+/// The calling thread processes the chunks together with the thread pool workers, and the
+/// function returns when the entire range has been processed.
+template <typename FuncType>
+void ParallelFor(IThreadPool* pThreadPool,
+                 size_t       Begin,
+                 size_t       End,
+                 size_t       Grain,
+                 FuncType&&   Func,
+                 float        fPriority = 0)
+{
+    if (Begin >= End)
+        return;
+
+    Grain = std::max(Grain, size_t{1});
+
+    const size_t NumChunks = (End - Begin + Grain - 1) / Grain;
+    if (pThreadPool == nullptr || NumChunks == 1)
+    {
+        Func(Begin, End);
+        return;
+    }
+
+    // The calling thread also processes the chunks, so one helper task per worker thread
+    // is enough. If the pool has no threads, the tasks are run by the application threads
+    // that call ProcessTask(), and their number is unknown.
+    const Uint32 NumWorkers = pThreadPool->GetThreadCount();
+    const size_t NumHelpers = std::min(NumChunks - 1, size_t{NumWorkers > 0 ? NumWorkers : std::max(std::thread::hardware_concurrency(), 1u)});
+
+    ParallelForRangeSplitter Splitter{Begin, End, Grain, NumHelpers + 1};
+
+    auto ProcessChunks = [&Splitter, &Func]() {
+        size_t ChunkBegin = 0;
+        size_t ChunkEnd   = 0;
+        while (Splitter.ClaimChunk(ChunkBegin, ChunkEnd))
+            Func(ChunkBegin, ChunkEnd);
+    };
+
+    TaskGroup Group{pThreadPool, fPriority};
+    for (size_t i = 0; i < NumHelpers; ++i)
+        Group.Run(ProcessChunks);
+
+    ProcessChunks();
+
+    // Helpers that have not started yet will run on this thread
+    // and return immediately as the range is exhausted.
+    Group.Wait();
+}
+
+} // namespace Diligent
@@ -30,6 +30,7 @@
 #include <array>
 #include <cstring>
 #include <atomic>
+#include <vector>
 
 #include "../../Primitives/interface/BasicTypes.h"
 #include "../../Primitives/interface/MemoryAllocator.h"
@@ -41,6 +42,8 @@
 namespace Diligent
 {
 
+struct IFileStream;
+
 class SerializedData
 {
 public:
@@ -141,12 +144,58 @@ enum class SerializerMode
 {
     Read,
     Write,
-    Measure
+    Measure,
+
+    /// Writes the data to a file stream in a single pass, without a preceding Measure pass.
+    /// Use ChunkedMemoryFileStream to serialize into a growable memory buffer.
+    Stream
+};
+
+
+/// State of the serializer that is only used in Stream mode.
+
+/// The primary template is empty, so that the serializers in other modes
+/// do not carry the stream state and keep their implicit special members.
+template <SerializerMode Mode>
+class SerializerStreamState
+{
+};
+
+/// Stream mode state: the destination stream and the intermediate buffer.
+/// The buffered data is written to the stream when the state is destroyed.
+template <>
+class SerializerStreamState<SerializerMode::Stream>
+{
+public:
+    SerializerStreamState(IFileStream* pStream, size_t BufferSize);
+    ~SerializerStreamState();
+
+    // clang-format off
+    SerializerStreamState           (const SerializerStreamState&)  = delete;
+    SerializerStreamState           (      SerializerStreamState&&) = delete;
+    SerializerStreamState& operator=(const SerializerStreamState&)  = delete;
+    SerializerStreamState& operator=(      SerializerStreamState&&) = delete;
+    // clang-format on
+
+protected:
+    // Appends Size bytes to the buffer. Null data is written as zeros.
+    bool StreamWrite(const void* pData, size_t Size);
+    bool StreamFlush();
+    bool StreamPatch(size_t Offset, const void* pData, size_t Size);
+
+private:
+    IFileStream* const m_pStream;
+    std::vector<Uint8> m_StreamBuffer;
+    // Offset of the first byte in m_StreamBuffer from the beginning of the serialized data
+    size_t m_StreamBufferOffset = 0;
+    // Stream position that corresponds to the beginning of the serialized data
+    size_t m_StreamStartPos = 0;
+    bool   m_StreamFailed   = false;
 };
 
 
 template <SerializerMode Mode>
-class Serializer
+class Serializer : private SerializerStreamState<Mode>
 {
 public:
     template <typename T>
@@ -189,6 +238,22 @@ public:
         static_assert(Mode == SerializerMode::Read || Mode == SerializerMode::Write, "Only Read or Write mode is supported");
     }
 
+    /// Creates a serializer that appends the data to pStream starting at its current position.
+    /// The data is accumulated in an intermediate buffer of BufferSize bytes that is written
+    /// to the stream when it is full, when Flush() is called, and when the serializer is destroyed.
+    explicit Serializer(IFileStream* pStream, size_t BufferSize = DefaultStreamBufferSize) :
+        // clang-format off
+        SerializerStreamState<Mode>{pStream, BufferSize},
+        m_Start{nullptr},
+        m_End  {m_Start + ~size_t{0}},
+        m_Ptr  {m_Start}
+    // clang-format on
+    {
+        static_assert(Mode == SerializerMode::Stream, "Only Stream mode is supported");
+    }
+
+    static constexpr size_t DefaultStreamBufferSize = size_t{64} << 10;
+
     template <typename T>
     TEnable<T> Serialize(ConstQual<T>& Value)
     {
@@ -218,6 +283,9 @@ public:
     ///      Aligns up current offset to Alignment bytes
     ///      Writes Size bytes from pBytes
     ///
+    ///  * Stream
+    ///      Same as Write, but the padding and the bytes are appended to the stream
+    ///
     ///  * Read
     ///      Reads Size as Uint32
     ///      Aligns up current offset to Alignment bytes
@@ -290,18 +358,36 @@ public:
         return SerializedData{GetSize(), Allocator};
     }
 
+    /// Overwrites Size bytes at the given Offset from the beginning of the serialized data.
+    ///
+    /// This is used to back-patch values, such as offsets or sizes, that only become known
+    /// after the subsequent data has been serialized. The range must have already been written.
+    /// In Stream mode, patching the data that has already been flushed requires the stream
+    /// to support SetPos().
+    bool Patch(size_t Offset, const void* pData, size_t Size);
+
+    template <typename T>
+    TEnable<T> Patch(size_t Offset, const T& Value)
+    {
+        return Patch(Offset, &Value, sizeof(Value));
+    }
+
+    /// Writes the buffered data to the stream in Stream mode; does nothing in other modes.
+    bool Flush();
+
     static constexpr SerializerMode GetMode() { return Mode; }
 
 private:
     template <typename T>
     bool Copy(T* pData, size_t Size);
 
-    void AlignOffset(size_t Alignment)
+    bool AlignOffset(size_t Alignment)
     {
         const size_t Size       = GetSize();
         const size_t AlignShift = AlignUp(Size, Alignment) - Size;
         VERIFY_EXPR(m_Ptr + AlignShift <= m_End);
         m_Ptr += AlignShift;
+        return true;
     }
 
 private:
@@ -311,6 +397,18 @@ private:
     TPointer m_Ptr = nullptr;
 };
 
+template <SerializerMode Mode>
+bool Serializer<Mode>::Flush()
+{
+    return true;
+}
+
+template <>
+inline bool Serializer<SerializerMode::Stream>::Flush()
+{
+    return StreamFlush();
+}
+
 #define CHECK_REMAINING_SIZE(Size, ...) \
     do                                  \
     {                                   \
@@ -352,6 +450,70 @@ bool Serializer<SerializerMode::Measure>::Copy(T* pData, size_t Size)
     return true;
 }
 
+template <>
+template <typename T>
+bool Serializer<SerializerMode::Stream>::Copy(T* pData, size_t Size)
+{
+    static_assert(IsAlignedBaseClass<T>::Value, "There is unused space at the end of the structure that may be filled with garbage. Use padding to zero-initialize this space and avoid nasty issues.");
+    if (!StreamWrite(pData, Size))
+        return false;
+    m_Ptr += Size;
+    return true;
+}
+
+template <>
+inline bool Serializer<SerializerMode::Write>::AlignOffset(size_t Alignment)
+{
+    const size_t Size       = GetSize();
+    const size_t AlignShift = AlignUp(Size, Alignment) - Size;
+    CHECK_REMAINING_SIZE(AlignShift, "Note enough space to write ", AlignShift, " padding bytes");
+    // Zero the padding so that the output does not depend on the initial contents of the memory
+    std::memset(m_Ptr, 0, AlignShift);
+    m_Ptr += AlignShift;
+    return true;
+}
+
+template <>
+inline bool Serializer<SerializerMode::Stream>::AlignOffset(size_t Alignment)
+{
+    const size_t Size       = GetSize();
+    const size_t AlignShift = AlignUp(Size, Alignment) - Size;
+    // Null data is written as zeros
+    return Copy<const void>(nullptr, AlignShift);
+}
+
+template <SerializerMode Mode>
+bool Serializer<Mode>::Patch(size_t Offset, const void* pData, size_t Size)
+{
+    static_assert(Mode != SerializerMode::Read, "Patching is not supported in Read mode");
+    return false;
+}
+
+template <>
+inline bool Serializer<SerializerMode::Write>::Patch(size_t Offset, const void* pData, size_t Size)
+{
+    if (Offset + Size > GetSize())
+    {
+        UNEXPECTED("Patched range [", Offset, ", ", Offset + Size, ") is outside of the serialized data (", GetSize(), " bytes)");
+        return false;
+    }
+    std::memcpy(m_Start + Offset, pData, Size);
+    return true;
+}
+
+template <>
+inline bool Serializer<SerializerMode::Measure>::Patch(size_t Offset, const void* pData, size_t Size)
+{
+    VERIFY_EXPR(Offset + Size <= GetSize());
+    return true;
+}
+
+template <>
+inline bool Serializer<SerializerMode::Stream>::Patch(size_t Offset, const void* pData, size_t Size)
+{
+    return StreamPatch(Offset, pData, Size);
+}
+
 template <>
 template <typename T>
 typename Serializer<SerializerMode::Read>::TEnableStr<T> Serializer<SerializerMode::Read>::Serialize(CharPtr Str)
@@ -368,11 +530,11 @@ typename Serializer<SerializerMode::Read>::TEnableStr<T> Serializer<SerializerMo
     return true;
 }
 
-template <SerializerMode Mode> // Write or Measure
+template <SerializerMode Mode> // Write, Measure or Stream
 template <typename T>
 typename Serializer<Mode>::template TEnableStr<T> Serializer<Mode>::Serialize(CharPtr Str)
 {
-    static_assert(Mode == SerializerMode::Write || Mode == SerializerMode::Measure, "Unexpected mode");
+    static_assert(Mode == SerializerMode::Write || Mode == SerializerMode::Measure || Mode == SerializerMode::Stream, "Unexpected mode");
     const Uint32 LenWithNull = static_cast<Uint32>((Str != nullptr && Str[0] != '\0') ? strlen(Str) + 1 : 0);
     if (!Serialize<Uint32>(LenWithNull))
         return false;
@@ -390,7 +552,8 @@ inline bool Serializer<SerializerMode::Read>::SerializeBytes(VoidPtr pBytes, Con
 
     Size = Size32;
 
-    AlignOffset(Alignment);
+    if (!AlignOffset(Alignment))
+        return false;
 
     CHECK_REMAINING_SIZE(Size, "Note enough data to read ", Size, " bytes.");
 
@@ -400,13 +563,14 @@ inline bool Serializer<SerializerMode::Read>::SerializeBytes(VoidPtr pBytes, Con
     return true;
 }
 
-template <SerializerMode Mode> // Write or Measure
+template <SerializerMode Mode> // Write, Measure or Stream
 inline bool Serializer<Mode>::SerializeBytes(VoidPtr pBytes, ConstQual<size_t>& Size, size_t Alignment)
 {
-    static_assert(Mode == SerializerMode::Write || Mode == SerializerMode::Measure, "Unexpected mode");
+    static_assert(Mode == SerializerMode::Write || Mode == SerializerMode::Measure || Mode == SerializerMode::Stream, "Unexpected mode");
     if (!Serialize<Uint32>(static_cast<Uint32>(Size)))
         return false;
-    AlignOffset(Alignment);
+    if (!AlignOffset(Alignment))
+        return false;
     return Copy(pBytes, Size);
 }
 
@@ -434,6 +598,12 @@ inline bool Serializer<SerializerMode::Measure>::Serialize(const SerializedData&
     return SerializeBytes(Data.Ptr(), Data.Size());
 }
 
+template <>
+inline bool Serializer<SerializerMode::Stream>::Serialize(const SerializedData& Data)
+{
+    return SerializeBytes(Data.Ptr(), Data.Size());
+}
+
 
 template <SerializerMode Mode>
 template <typename ElemPtrType, typename CountType, typename ArrayElemSerializerType>
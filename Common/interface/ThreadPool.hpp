@@ -34,15 +34,86 @@
 #include <atomic>
 #include <functional>
 #include <thread>
+#include <vector>
+#include <utility>
+#include <mutex>
+#include <condition_variable>
 
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "../../Platforms/Basic/interface/BasicPlatformMisc.hpp"
 
 #include "ObjectBase.hpp"
 #include "RefCntAutoPtr.hpp"
+#include "SpinLock.hpp"
 
 namespace Diligent
 {
 
+class ThreadPoolProfiler;
+
+/// Thread pool task scheduler type
+enum THREAD_POOL_SCHEDULER : Uint8
+{
+    /// All tasks are kept in a single priority queue protected by one mutex.
+    ///
+    /// Tasks are strictly ordered by their priorities. This is the default scheduler.
+    THREAD_POOL_SCHEDULER_PRIORITY_QUEUE = 0,
+
+    /// Every worker thread owns its own set of task deques, one per priority band.
+    /// A worker thread processes its own tasks first and steals tasks from other
+    /// workers when it runs out of work.
+    ///
+    /// Task priorities are quantized into ThreadPoolCreateInfo::NumPriorityBands bands:
+    /// the band index is the integer part of the priority clamped to [0, NumPriorityBands - 1].
+    /// Tasks in higher bands are always started first, but the order of tasks
+    /// within the same band is not defined.
+    ///
+    /// This scheduler scales much better with the number of threads when
+    /// many small tasks are enqueued.
+    THREAD_POOL_SCHEDULER_WORK_STEALING,
+
+    THREAD_POOL_SCHEDULER_COUNT
+};
+
+/// Worker thread affinity mode
+enum THREAD_POOL_AFFINITY_MODE : Uint8
+{
+    /// The affinity of worker threads is not changed. This is the default mode.
+    THREAD_POOL_AFFINITY_MODE_NONE = 0,
+
+    /// Every worker thread is pinned to one logical processor.
+    ///
+    /// If ThreadPoolAffinityInfo::PreferPhysicalCores is true, the workers are assigned
+    /// to different physical cores first, and SMT siblings are only used when there are
+    /// more workers than cores. Otherwise, SMT siblings are assigned to consecutive workers.
+    /// If there are more workers than allowed processors, the assignment wraps around.
+    THREAD_POOL_AFFINITY_MODE_PROCESSOR,
+
+    /// Worker threads are grouped by NUMA node: the workers are distributed between
+    /// the nodes in proportion to the number of allowed processors in each node, and
+    /// every worker may run on any allowed processor of its node.
+    THREAD_POOL_AFFINITY_MODE_NUMA_NODE,
+
+    THREAD_POOL_AFFINITY_MODE_COUNT
+};
+
+/// Worker thread affinity description
+struct ThreadPoolAffinityInfo
+{
+    /// Affinity mode, see Diligent::THREAD_POOL_AFFINITY_MODE.
+    THREAD_POOL_AFFINITY_MODE Mode = THREAD_POOL_AFFINITY_MODE_NONE;
+
+    /// The IDs of logical processors the worker threads may run on, see LogicalProcessorInfo::Id.
+
+    /// If empty, all logical processors are allowed.
+    std::vector<Uint32> AllowedProcessors;
+
+    /// Whether to assign worker threads to different physical cores before using SMT siblings.
+
+    /// This member is only used in THREAD_POOL_AFFINITY_MODE_PROCESSOR mode.
+    bool PreferPhysicalCores = true;
+};
+
 /// Thread pool create information
 struct ThreadPoolCreateInfo
 {
@@ -61,10 +132,44 @@ struct ThreadPoolCreateInfo
     /// An optional function that will be called by the thread pool from
     /// the worker thread before the worker thread exits.
     std::function<void(Uint32)> OnThreadExiting = nullptr;
+
+    /// Task scheduler type, see Diligent::THREAD_POOL_SCHEDULER.
+    THREAD_POOL_SCHEDULER Scheduler = THREAD_POOL_SCHEDULER_PRIORITY_QUEUE;
+
+    /// The number of priority bands used by the work-stealing scheduler.
+
+    /// This member is ignored by other schedulers.
+    Uint32 NumPriorityBands = 4;
+
+    /// An optional profiler that collects the thread pool statistics,
+    /// see Diligent::ThreadPoolProfiler.
+
+    /// The thread pool keeps a strong reference to the profiler.
+    /// If null, the instrumentation is disabled.
+    ThreadPoolProfiler* pProfiler = nullptr;
+
+    /// Worker thread affinity.
+
+    /// The affinity is set before the OnThreadStarted callback is called.
+    /// Unlike PinWorkerThread(), it supports any number of logical processors.
+    ThreadPoolAffinityInfo Affinity = {};
 };
 
 RefCntAutoPtr<IThreadPool> CreateThreadPool(const ThreadPoolCreateInfo& ThreadPoolCI);
 
+/// Returns the logical processors every worker thread should run on.
+
+/// \param [in] Topology   - Processor topology, see PlatformMisc::GetProcessorTopology().
+/// \param [in] Affinity   - Worker thread affinity description.
+/// \param [in] NumThreads - The number of worker threads.
+/// \return     An array of NumThreads processor ID lists, or an empty array if the affinity
+///             mode is THREAD_POOL_AFFINITY_MODE_NONE or none of the allowed processors exists.
+///
+/// This function is used by the thread pool to set the affinity of its worker threads.
+std::vector<std::vector<Uint32>> GetThreadPoolWorkerAffinity(const ProcessorTopology&      Topology,
+                                                             const ThreadPoolAffinityInfo& Affinity,
+                                                             size_t                        NumThreads);
+
 /// Pins the worker thread to one of the allowed cores.
 ///
 /// \param ThreadId         - The thread ID.
@@ -76,6 +181,7 @@ RefCntAutoPtr<IThreadPool> CreateThreadPool(const ThreadPoolCreateInfo& ThreadPo
 /// to cores 1, 3, 6, 1, 3, 6, etc.
 ///
 /// This function can be used as the OnThreadStarted callback in the ThreadPoolCreateInfo.
+/// It only supports the first 64 logical processors, see ThreadPoolCreateInfo::Affinity.
 Uint64 PinWorkerThread(Uint32 ThreadId, Uint64 AllowedCoresMask);
 
 /// Base implementation of the IAsyncTask interface.
@@ -83,6 +189,10 @@ class AsyncTaskBase : public ObjectBase<IAsyncTask>
 {
 public:
     using TBase = ObjectBase<IAsyncTask>;
+
+    // {E1D82FA0-DA29-4127-81B7-D16E23A2BC97}
+    static constexpr INTERFACE_ID IID_InternalImpl =
+        {0xe1d82fa0, 0xda29, 0x4127, {0x81, 0xb7, 0xd1, 0x6e, 0x23, 0xa2, 0xbc, 0x97}};
     explicit AsyncTaskBase(IReferenceCounters* pRefCounters,
                            float               fPriority = 0) noexcept :
         TBase{pRefCounters},
@@ -91,7 +201,7 @@ public:
     }
     virtual ~AsyncTaskBase() = 0;
 
-    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_AsyncTask, TBase)
+    IMPLEMENT_QUERY_INTERFACE2_IN_PLACE(IID_AsyncTask, IID_InternalImpl, TBase)
 
     virtual void DILIGENT_CALL_TYPE Cancel() override
     {
@@ -136,6 +246,22 @@ public:
         }
 #endif
         m_TaskStatus.store(TaskStatus);
+
+        // NB: the number of waiters must be checked after the status is updated.
+        //     The waiting thread increments the number of waiters before checking the status,
+        //     so at least one of the threads is guaranteed to see the other's update.
+        if (m_NumWaiters.load() > 0)
+        {
+            {
+                // Acquiring the mutex guarantees that a thread that has checked the
+                // status but has not yet started waiting will not miss the notification.
+                std::lock_guard<std::mutex> Lock{m_WaitMtx};
+            }
+            m_WaitCond.notify_all();
+        }
+
+        if (TaskStatus == ASYNC_TASK_STATUS_CANCELLED || TaskStatus == ASYNC_TASK_STATUS_COMPLETE)
+            InvokeCompletionCallbacks();
     }
 
     virtual ASYNC_TASK_STATUS DILIGENT_CALL_TYPE GetStatus() const override final
@@ -162,25 +288,148 @@ public:
 
     virtual void DILIGENT_CALL_TYPE WaitForCompletion() const override final
     {
-        while (!IsFinished())
-            std::this_thread::yield();
+        Wait([this]() { return IsFinished(); });
     }
 
     virtual void DILIGENT_CALL_TYPE WaitUntilRunning() const override final
     {
-        while (GetStatus() == ASYNC_TASK_STATUS_NOT_STARTED)
-            std::this_thread::yield();
+        Wait([this]() { return GetStatus() != ASYNC_TASK_STATUS_NOT_STARTED; });
+    }
+
+    /// Handle of a completion callback, see AddCompletionCallback().
+    using CompletionCallbackHandle = Uint64;
+
+    /// Invalid completion callback handle.
+    static constexpr CompletionCallbackHandle InvalidCompletionCallbackHandle = 0;
+
+    /// Adds a function that will be called once when the task is finished.
+
+    /// \param [in] Callback - The function to call.
+    ///
+    /// \return    The handle that can be passed to RemoveCompletionCallback(), or
+    ///            InvalidCompletionCallbackHandle if the task is already finished,
+    ///            in which case the callback is not called.
+    ///
+    /// The callback is called by the thread that moves the task to the
+    /// ASYNC_TASK_STATUS_COMPLETE or ASYNC_TASK_STATUS_CANCELLED state.
+    /// If the task is destroyed before it is finished, the callback is called
+    /// from the destructor.
+    ///
+    /// Thread pools use completion callbacks to start the tasks that depend on this task.
+    CompletionCallbackHandle AddCompletionCallback(std::function<void()>&& Callback)
+    {
+        Threading::SpinLockGuard Guard{m_CompletionCallbacksLock};
+        if (IsFinished())
+            return InvalidCompletionCallbackHandle;
+
+        const CompletionCallbackHandle Handle = ++m_LastCompletionCallbackHandle;
+        m_CompletionCallbacks.emplace_back(Handle, std::move(Callback));
+        return Handle;
+    }
+
+    /// Removes the completion callback that has not been called yet.
+
+    /// \param [in] Handle - The handle returned by AddCompletionCallback().
+    ///
+    /// \return    true if the callback was removed, and false if it has
+    ///            already been called or is being called by another thread.
+    bool RemoveCompletionCallback(CompletionCallbackHandle Handle)
+    {
+        Threading::SpinLockGuard Guard{m_CompletionCallbacksLock};
+        for (auto it = m_CompletionCallbacks.begin(); it != m_CompletionCallbacks.end(); ++it)
+        {
+            if (it->first == Handle)
+            {
+                m_CompletionCallbacks.erase(it);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Returns the number of completion callbacks that have not been called yet.
+    size_t GetCompletionCallbackCount() const
+    {
+        Threading::SpinLockGuard Guard{m_CompletionCallbacksLock};
+        return m_CompletionCallbacks.size();
     }
 
 protected:
     std::atomic<bool> m_bSafelyCancel{false};
 
+private:
+    // Waits until the predicate is satisfied. The thread spins for a short while first, since
+    // many tasks finish quickly and parking the thread is expensive, and then blocks until the
+    // task status changes.
+    template <typename PredicateType>
+    void Wait(PredicateType&& Predicate) const
+    {
+        constexpr Uint32 SpinCount = 64;
+        for (Uint32 i = 0; i < SpinCount; ++i)
+        {
+            if (Predicate())
+                return;
+            std::this_thread::yield();
+        }
+
+        m_NumWaiters.fetch_add(1);
+        {
+            std::unique_lock<std::mutex> Lock{m_WaitMtx};
+            m_WaitCond.wait(Lock, Predicate);
+        }
+        m_NumWaiters.fetch_add(-1);
+    }
+
+    void InvokeCompletionCallbacks()
+    {
+        std::vector<std::pair<CompletionCallbackHandle, std::function<void()>>> Callbacks;
+        {
+            Threading::SpinLockGuard Guard{m_CompletionCallbacksLock};
+            Callbacks.swap(m_CompletionCallbacks);
+        }
+        for (auto& Callback : Callbacks)
+            Callback.second();
+    }
+
 private:
     std::atomic<float>             m_fPriority{0};
     std::atomic<ASYNC_TASK_STATUS> m_TaskStatus{ASYNC_TASK_STATUS_NOT_STARTED};
+
+    mutable Threading::SpinLock                                             m_CompletionCallbacksLock;
+    std::vector<std::pair<CompletionCallbackHandle, std::function<void()>>> m_CompletionCallbacks;
+    CompletionCallbackHandle                                                m_LastCompletionCallbackHandle = InvalidCompletionCallbackHandle;
+
+    mutable std::atomic<int>        m_NumWaiters{0};
+    mutable std::mutex              m_WaitMtx;
+    mutable std::condition_variable m_WaitCond;
 };
 
 
+/// Waits until all tasks in the array are finished.
+
+/// \param [in] ppTasks  - An array of tasks. Null entries are ignored.
+/// \param [in] NumTasks - The number of tasks in the array.
+///
+/// \note   This function must not be called from a thread that is
+///         running any of the tasks or a deadlock will occur.
+void WaitForAllTasks(IAsyncTask* const* ppTasks, Uint32 NumTasks);
+
+/// Waits until any task in the array is finished.
+
+/// \param [in] ppTasks  - An array of tasks. Null entries are ignored.
+/// \param [in] NumTasks - The number of tasks in the array.
+///
+/// \return    The index of a finished task, or NumTasks if the array contains no tasks.
+///
+/// The calling thread is blocked until one of the tasks is finished. If the array
+/// contains tasks that are not derived from Diligent::AsyncTaskBase, the function
+/// has to periodically poll their status.
+///
+/// \note   This function must not be called from a thread that is
+///         running any of the tasks or a deadlock will occur.
+Uint32 WaitForAnyTask(IAsyncTask* const* ppTasks, Uint32 NumTasks);
+
+
 /// Enqueues a function to be executed asynchronously by the thread pool.
 /// For the list of parameters, see Diligent::IThreadPool::EnqueueTask() method.
 /// The handler function must return the task status, see Diligent::IAsyncTask::Run() method.
@@ -0,0 +1,277 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::ThreadPoolProfiler class.
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+/// Histogram of durations with power-of-two buckets.
+struct ThreadPoolDurationHistogram
+{
+    static constexpr Uint32 NumBuckets = 24;
+
+    /// The number of samples in each bucket.
+
+    /// Bucket 0 counts durations shorter than 1 microsecond, bucket i > 0 counts
+    /// durations in the range [2^(i-1), 2^i) microseconds. The last bucket also
+    /// counts all longer durations.
+    std::array<Uint64, NumBuckets> Counts = {};
+
+    /// The total number of samples.
+    Uint64 NumSamples = 0;
+
+    /// The total, minimum and maximum duration, in seconds.
+    double TotalTime = 0;
+    double MinTime   = 0;
+    double MaxTime   = 0;
+
+    /// Adds the duration, in nanoseconds, to the histogram.
+    void AddSample(Int64 DurationNs);
+
+    /// Returns the average duration, in seconds.
+    double GetAverageTime() const
+    {
+        return NumSamples > 0 ? TotalTime / static_cast<double>(NumSamples) : 0;
+    }
+
+    /// Returns the upper bound of the bucket, in seconds.
+    static double GetBucketUpperBound(Uint32 Bucket)
+    {
+        return static_cast<double>(Uint64{1} << Bucket) * 1e-6;
+    }
+
+    ThreadPoolDurationHistogram& operator+=(const ThreadPoolDurationHistogram& Rhs);
+};
+
+/// Statistics of a thread that processes thread pool tasks.
+struct ThreadPoolThreadStatistics
+{
+    /// The time spent running tasks, in seconds.
+    double BusyTime = 0;
+
+    /// The time spent waiting for new tasks, in seconds.
+    double IdleTime = 0;
+
+    /// The number of times the thread ran a task.
+    Uint64 NumTasksRun = 0;
+};
+
+/// Thread pool statistics, see Diligent::ThreadPoolProfiler::GetStatistics().
+struct ThreadPoolStatistics
+{
+    /// Per-thread statistics, indexed by the thread slot (thread ID modulo the number of slots).
+    std::vector<ThreadPoolThreadStatistics> Threads;
+
+    /// The time between a task being put into the queue and starting to run.
+    ThreadPoolDurationHistogram QueueLatency;
+
+    /// The time the task spent in IAsyncTask::Run().
+    ThreadPoolDurationHistogram RunTime;
+
+    /// The number of times tasks were put back into the queue because their
+    /// prerequisites were not met or because they did not finish.
+    Uint64 NumTasksReenqueued = 0;
+
+    /// The total time threads spent waiting for the thread pool locks, in seconds.
+    double LockWaitTime = 0;
+
+    /// The number of times a thread had to wait for a thread pool lock.
+    Uint64 NumContendedLocks = 0;
+
+    /// The number of trace events that were not recorded because the buffer was full.
+    Uint64 NumDroppedTraceEvents = 0;
+
+    /// The time since the profiler was created or reset, in seconds.
+    double ElapsedTime = 0;
+};
+
+/// Thread pool profiler create information
+struct ThreadPoolProfilerCreateInfo
+{
+    /// The number of per-thread statistics slots.
+
+    /// Threads whose IDs are equal modulo this number share the slot.
+    /// If zero, the number of hardware threads is used.
+    Uint32 NumThreadSlots = 0;
+
+    /// The maximum number of trace events recorded in every thread slot.
+
+    /// Once the slot is full, the events are counted in ThreadPoolStatistics::NumDroppedTraceEvents.
+    /// If zero, trace events are not recorded and only the statistics are collected.
+    Uint32 MaxTraceEventsPerThread = 0;
+};
+
+/// Collects thread pool statistics and task timeline.
+///
+/// To enable instrumentation, create the profiler and set it in ThreadPoolCreateInfo::pProfiler.
+/// When the profiler is not set, the thread pool does not read the clock and the only cost
+/// is a null pointer check.
+///
+///     auto pProfiler = CreateThreadPoolProfiler({});
+///     ThreadPoolCreateInfo PoolCI;
+///     PoolCI.pProfiler = pProfiler;
+///     auto pPool = CreateThreadPool(PoolCI);
+///     ...
+///     ThreadPoolStatistics Stats = pProfiler->GetStatistics();
+///     std::string Trace = pProfiler->GetChromeTrace();
+///
+/// A profiler should only be used by one thread pool.
+class ThreadPoolProfiler final : public ObjectBase<IObject>
+{
+public:
+    using TBase = ObjectBase<IObject>;
+
+    ThreadPoolProfiler(IReferenceCounters* pRefCounters, const ThreadPoolProfilerCreateInfo& CI);
+
+    /// Returns the statistics collected since the profiler was created or reset.
+    ThreadPoolStatistics GetStatistics() const;
+
+    /// Returns the recorded task timeline in the Chrome trace event JSON format.
+
+    /// The string can be saved to a file and loaded into chrome://tracing or https://ui.perfetto.dev.
+    /// Every task run is a complete ('X') event on the track of the thread that ran it.
+    std::string GetChromeTrace() const;
+
+    /// Clears all statistics and trace events.
+    void Reset();
+
+    /// Returns the time in nanoseconds since the profiler was created or reset.
+    Int64 GetTimestamp() const
+    {
+        return GetClockTime() - m_StartTime.load(std::memory_order_relaxed);
+    }
+
+    // The following methods are called by the thread pool.
+
+    /// Records the task run.
+
+    /// \param [in] ThreadId    - The ID of the thread that ran the task.
+    /// \param [in] EnqueueTime - The time the task was put into the queue.
+    /// \param [in] StartTime   - The time the task started running.
+    /// \param [in] EndTime     - The time the task returned from IAsyncTask::Run().
+    /// \param [in] fPriority   - The task priority.
+    /// \param [in] Status      - The status returned by IAsyncTask::Run().
+    void RecordTaskRun(Uint32            ThreadId,
+                       Int64             EnqueueTime,
+                       Int64             StartTime,
+                       Int64             EndTime,
+                       float             fPriority,
+                       ASYNC_TASK_STATUS Status);
+
+    /// Records the time the thread waited for new tasks.
+    void RecordIdleTime(Uint32 ThreadId, Int64 StartTime, Int64 EndTime);
+
+    /// Records that the task was put back into the queue.
+    void RecordTaskReenqueue()
+    {
+        m_NumTasksReenqueued.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Records the time a thread waited for a lock.
+    void RecordLockWait(Int64 DurationNs)
+    {
+        m_LockWaitTimeNs.fetch_add(DurationNs, std::memory_order_relaxed);
+        m_NumContendedLocks.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Locks the mutex and records the wait time if the mutex is contended and the profiler is not null.
+    template <typename MutexType>
+    static std::unique_lock<MutexType> LockMutex(MutexType& Mtx, ThreadPoolProfiler* pProfiler)
+    {
+        if (pProfiler == nullptr)
+            return std::unique_lock<MutexType>{Mtx};
+
+        std::unique_lock<MutexType> Lock{Mtx, std::try_to_lock};
+        if (!Lock.owns_lock())
+        {
+            const Int64 StartTime = pProfiler->GetTimestamp();
+            Lock.lock();
+            pProfiler->RecordLockWait(pProfiler->GetTimestamp() - StartTime);
+        }
+        return Lock;
+    }
+
+private:
+    struct TraceEvent
+    {
+        Int64             StartTime    = 0;
+        Int64             Duration     = 0;
+        Int64             QueueLatency = 0;
+        float             fPriority    = 0;
+        Uint32            ThreadId     = 0;
+        ASYNC_TASK_STATUS Status       = ASYNC_TASK_STATUS_UNKNOWN;
+    };
+
+    struct alignas(64) ThreadSlot
+    {
+        mutable std::mutex Mtx;
+
+        ThreadPoolThreadStatistics  Stats;
+        ThreadPoolDurationHistogram QueueLatency;
+        ThreadPoolDurationHistogram RunTime;
+
+        std::vector<TraceEvent> TraceEvents;
+        Uint64                  NumDroppedTraceEvents = 0;
+    };
+
+    static Int64 GetClockTime()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    ThreadSlot& GetSlot(Uint32 ThreadId)
+    {
+        return m_Slots[ThreadId % m_Slots.size()];
+    }
+
+private:
+    const Uint32 m_MaxTraceEventsPerThread;
+
+    std::atomic<Int64> m_StartTime{0};
+
+    std::vector<ThreadSlot> m_Slots;
+
+    std::atomic<Uint64> m_NumTasksReenqueued{0};
+    std::atomic<Int64>  m_LockWaitTimeNs{0};
+    std::atomic<Uint64> m_NumContendedLocks{0};
+};
+
+RefCntAutoPtr<ThreadPoolProfiler> CreateThreadPoolProfiler(const ThreadPoolProfilerCreateInfo& CI);
+
+} // namespace Diligent
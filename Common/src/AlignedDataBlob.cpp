@@ -0,0 +1,197 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+#include "AlignedDataBlob.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "Align.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if PLATFORM_LINUX
+#    include <sys/mman.h>
+#endif
+
+namespace Diligent
+{
+
+namespace
+{
+
+size_t GetValidAlignment(size_t Alignment)
+{
+    DEV_CHECK_ERR(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be a power of two");
+    return std::max(Alignment, sizeof(void*));
+}
+
+} // namespace
+
+RefCntAutoPtr<AlignedDataBlob> AlignedDataBlob::Create(size_t            InitialSize,
+                                                       const void*       pData,
+                                                       size_t            Alignment,
+                                                       IMemoryAllocator* pAllocator)
+{
+    if (pAllocator == nullptr)
+        pAllocator = &DefaultRawMemoryAllocator::GetAllocator();
+
+    RefCntAutoPtr<AlignedDataBlob> pBlob{MakeNewRCObj<AlignedDataBlob>()(*pAllocator, GetValidAlignment(Alignment))};
+    pBlob->Resize(InitialSize);
+    if (pData != nullptr && InitialSize > 0)
+        std::memcpy(pBlob->m_pData, pData, InitialSize);
+
+    return pBlob;
+}
+
+RefCntAutoPtr<AlignedDataBlob> AlignedDataBlob::Adopt(void*         pData,
+                                                      size_t        Size,
+                                                      DeleterType&& Deleter,
+                                                      size_t        Capacity,
+                                                      size_t        Alignment)
+{
+    Alignment = GetValidAlignment(Alignment);
+    DEV_CHECK_ERR(pData != nullptr || Size == 0, "pData must not be null");
+    DEV_CHECK_ERR((reinterpret_cast<uintptr_t>(pData) & (Alignment - 1)) == 0, "pData is not aligned by ", Alignment, " bytes");
+    DEV_CHECK_ERR(Capacity == 0 || Capacity >= Size, "Capacity (", Capacity, ") must not be less than the size (", Size, ")");
+
+    RefCntAutoPtr<AlignedDataBlob> pBlob{MakeNewRCObj<AlignedDataBlob>()(DefaultRawMemoryAllocator::GetAllocator(), Alignment)};
+    pBlob->m_pData     = static_cast<Uint8*>(pData);
+    pBlob->m_Size      = Size;
+    pBlob->m_Capacity  = std::max(Capacity, Size);
+    pBlob->m_Deleter   = std::move(Deleter);
+    pBlob->m_IsAdopted = true;
+
+    return pBlob;
+}
+
+RefCntAutoPtr<AlignedDataBlob> AlignedDataBlob::MakeCopy(const IDataBlob* pDataBlob, size_t Alignment)
+{
+    if (pDataBlob == nullptr)
+        return {};
+
+    const size_t Size = pDataBlob->GetSize();
+    return Create(Size, Size > 0 ? pDataBlob->GetConstDataPtr() : nullptr, Alignment);
+}
+
+AlignedDataBlob::AlignedDataBlob(IReferenceCounters* pRefCounters,
+                                 IMemoryAllocator&   Allocator,
+                                 size_t              Alignment) :
+    TBase{pRefCounters},
+    m_Allocator{Allocator},
+    m_Alignment{Alignment}
+{
+}
+
+AlignedDataBlob::~AlignedDataBlob()
+{
+    ReleaseMemory();
+}
+
+void AlignedDataBlob::ReleaseMemory()
+{
+    if (m_pData != nullptr)
+    {
+        if (m_IsAdopted)
+        {
+            if (m_Deleter)
+                m_Deleter(m_pData);
+        }
+        else
+        {
+            m_Allocator.FreeAligned(m_pData);
+        }
+    }
+
+    m_pData     = nullptr;
+    m_Capacity  = 0;
+    m_Deleter   = nullptr;
+    m_IsAdopted = false;
+}
+
+void AlignedDataBlob::Reallocate(size_t NewCapacity)
+{
+    VERIFY_EXPR(NewCapacity > m_Capacity);
+
+    Uint8* pNewData = static_cast<Uint8*>(m_Allocator.AllocateAligned(NewCapacity, m_Alignment, "Aligned data blob", __FILE__, __LINE__));
+    if (pNewData == nullptr)
+    {
+        LOG_ERROR_AND_THROW("Failed to allocate ", NewCapacity, " bytes for the data blob");
+    }
+
+#if PLATFORM_LINUX && defined(MADV_HUGEPAGE)
+    if (m_Alignment >= HugePageAlignment && NewCapacity >= HugePageAlignment)
+        madvise(pNewData, AlignDown(NewCapacity, HugePageAlignment), MADV_HUGEPAGE);
+#endif
+
+    if (m_Size > 0)
+        std::memcpy(pNewData, m_pData, m_Size);
+
+    const size_t Size = m_Size;
+    ReleaseMemory();
+
+    m_pData    = pNewData;
+    m_Size     = Size;
+    m_Capacity = NewCapacity;
+}
+
+void AlignedDataBlob::Reserve(size_t Capacity)
+{
+    if (Capacity > m_Capacity)
+        Reallocate(Capacity);
+}
+
+void AlignedDataBlob::Resize(size_t NewSize)
+{
+    if (NewSize > m_Capacity)
+    {
+        // Grow geometrically when the blob is extended, but allocate the exact
+        // size when an empty blob is resized for the first time.
+        Reallocate(m_Size > 0 ? std::max(NewSize, m_Capacity + m_Capacity / 2) : NewSize);
+    }
+    m_Size = NewSize;
+}
+
+size_t AlignedDataBlob::GetSize() const
+{
+    return m_Size;
+}
+
+void* AlignedDataBlob::GetDataPtr(size_t Offset)
+{
+    VERIFY(Offset <= m_Size, "Offset (", Offset, ") exceeds the data size (", m_Size, ")");
+    return m_pData + Offset;
+}
+
+const void* AlignedDataBlob::GetConstDataPtr(size_t Offset) const
+{
+    VERIFY(Offset <= m_Size, "Offset (", Offset, ") exceeds the data size (", m_Size, ")");
+    return m_pData + Offset;
+}
+
+IMPLEMENT_QUERY_INTERFACE(AlignedDataBlob, IID_DataBlob, TBase)
+
+} // namespace Diligent
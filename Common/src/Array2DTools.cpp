@@ -27,10 +27,17 @@
 #include "Array2DTools.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <vector>
 
 #include "Intrinsics.hpp"
 #include "DebugUtilities.hpp"
 #include "Align.hpp"
+#include "ParallelFor.hpp"
+#include "PlatformMisc.hpp"
 
 namespace Diligent
 {
@@ -38,95 +45,644 @@ namespace Diligent
 namespace
 {
 
-void GetArray2DMinMaxValueGeneric(const float* pData,
-                                  size_t       StrideInFloats,
-                                  Uint32       Width,
-                                  Uint32       Height,
-                                  float&       MinValue,
-                                  float&       MaxValue)
+// Row kernels that operate on contiguous spans of 32-bit floats.
+// The best implementation for the current CPU is selected at run time, see GetFloatRowKernels().
+struct FloatRowKernels
 {
-    for (size_t row = 0; row < Height; ++row)
+    // Updates MinValue and MaxValue with the values of the span.
+    void (*MinMax)(const float* pData, size_t Count, float& MinValue, float& MaxValue);
+
+    // Returns the sum of the span values.
+    double (*Sum)(const float* pData, size_t Count);
+
+    // Returns the number of span values that are greater than the threshold.
+    size_t (*CountAbove)(const float* pData, size_t Count, float Threshold);
+
+    // Converts half-precision values to 32-bit floats.
+    void (*HalfToFloat)(const Uint16* pSrc, size_t Count, float* pDst);
+};
+
+void MinMaxRowScalar(const float* pData, size_t Count, float& MinValue, float& MaxValue)
+{
+    for (const float* Ptr = pData; Ptr < pData + Count; ++Ptr)
+    {
+        MinValue = std::min(MinValue, *Ptr);
+        MaxValue = std::max(MaxValue, *Ptr);
+    }
+}
+
+double SumRowScalar(const float* pData, size_t Count)
+{
+    double Sum = 0;
+    for (size_t i = 0; i < Count; ++i)
+        Sum += pData[i];
+    return Sum;
+}
+
+size_t CountAboveRowScalar(const float* pData, size_t Count, float Threshold)
+{
+    size_t NumAbove = 0;
+    for (size_t i = 0; i < Count; ++i)
+        NumAbove += pData[i] > Threshold ? 1 : 0;
+    return NumAbove;
+}
+
+float HalfToFloat(Uint16 Half)
+{
+    const Uint32 Sign     = Uint32{Half & 0x8000u} << 16u;
+    const Uint32 Exponent = (Half >> 10u) & 0x1Fu;
+    const Uint32 Mantissa = Half & 0x3FFu;
+
+    Uint32 Bits = 0;
+    if (Exponent == 0x1Fu)
     {
-        const float* pRowStart = pData + row * StrideInFloats;
-        const float* pRowEnd   = pRowStart + Width;
-        for (const float* ptr = pRowStart; ptr < pRowEnd; ++ptr)
+        // Infinity or NaN
+        Bits = Sign | 0x7F800000u | (Mantissa << 13u);
+    }
+    else if (Exponent != 0)
+    {
+        Bits = Sign | ((Exponent + (127u - 15u)) << 23u) | (Mantissa << 13u);
+    }
+    else
+    {
+        // Zero or denormal: Mantissa * 2^-24
+        const float Value = static_cast<float>(Mantissa) * (1.f / 16777216.f);
+        return Sign != 0 ? -Value : Value;
+    }
+
+    float Value;
+    std::memcpy(&Value, &Bits, sizeof(Value));
+    return Value;
+}
+
+void HalfToFloatRowScalar(const Uint16* pSrc, size_t Count, float* pDst)
+{
+    for (size_t i = 0; i < Count; ++i)
+        pDst[i] = HalfToFloat(pSrc[i]);
+}
+
+#if DILIGENT_SSE2_ENABLED
+float HorizontalMin(__m128 mVal)
+{
+    mVal = _mm_min_ps(mVal, _mm_movehl_ps(mVal, mVal));
+    mVal = _mm_min_ss(mVal, _mm_shuffle_ps(mVal, mVal, 1));
+    return _mm_cvtss_f32(mVal);
+}
+
+float HorizontalMax(__m128 mVal)
+{
+    mVal = _mm_max_ps(mVal, _mm_movehl_ps(mVal, mVal));
+    mVal = _mm_max_ss(mVal, _mm_shuffle_ps(mVal, mVal, 1));
+    return _mm_cvtss_f32(mVal);
+}
+
+double HorizontalSum(__m128d mVal)
+{
+    return _mm_cvtsd_f64(_mm_add_sd(mVal, _mm_unpackhi_pd(mVal, mVal)));
+}
+
+size_t HorizontalSum(__m128i mVal)
+{
+    alignas(16) Uint32 Lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(Lanes), mVal);
+    return size_t{Lanes[0]} + size_t{Lanes[1]} + size_t{Lanes[2]} + size_t{Lanes[3]};
+}
+
+void MinMaxRowSSE2(const float* pData, size_t Count, float& MinValue, float& MaxValue)
+{
+    size_t i = 0;
+    if (Count >= 4)
+    {
+        __m128 mMin = _mm_set1_ps(MinValue);
+        __m128 mMax = _mm_set1_ps(MaxValue);
+        for (; i + 4 <= Count; i += 4)
         {
-            MinValue = std::min(MinValue, *ptr);
-            MaxValue = std::max(MaxValue, *ptr);
+            const __m128 mVal = _mm_loadu_ps(pData + i);
+
+            mMin = _mm_min_ps(mMin, mVal);
+            mMax = _mm_max_ps(mMax, mVal);
         }
+        MinValue = HorizontalMin(mMin);
+        MaxValue = HorizontalMax(mMax);
+    }
+    MinMaxRowScalar(pData + i, Count - i, MinValue, MaxValue);
+}
+
+double SumRowSSE2(const float* pData, size_t Count)
+{
+    // Accumulate in double precision to keep the sum exact for integer data
+    __m128d mSum0 = _mm_setzero_pd();
+    __m128d mSum1 = _mm_setzero_pd();
+
+    size_t i = 0;
+    for (; i + 4 <= Count; i += 4)
+    {
+        const __m128 mVal = _mm_loadu_ps(pData + i);
+
+        mSum0 = _mm_add_pd(mSum0, _mm_cvtps_pd(mVal));
+        mSum1 = _mm_add_pd(mSum1, _mm_cvtps_pd(_mm_movehl_ps(mVal, mVal)));
     }
+    return HorizontalSum(_mm_add_pd(mSum0, mSum1)) + SumRowScalar(pData + i, Count - i);
 }
 
-#if DILIGENT_AVX2_ENABLED
-bool GetArray2DMinMaxValueAVX2(const float* pData,
-                               size_t       StrideInFloats,
-                               Uint32       Width,
-                               Uint32       Height,
-                               float&       MinValue,
-                               float&       MaxValue)
+size_t CountAboveRowSSE2(const float* pData, size_t Count, float Threshold)
 {
-    MinValue   = pData[0];
-    MaxValue   = pData[0];
-    auto mmMin = _mm256_set1_ps(MinValue);
-    auto mmMax = _mm256_set1_ps(MaxValue);
-    for (size_t row = 0; row < Height; ++row)
+    const __m128 mThreshold = _mm_set1_ps(Threshold);
+
+    // Comparison results are all-ones (-1) in every lane that passes the test
+    __m128i mCount = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 4 <= Count; i += 4)
     {
-        const float* pRowStart = pData + row * StrideInFloats;
-        const float* pRowEnd   = pRowStart + Width;
-        const float* pAVXEnd   = pRowEnd - 8;
+        const __m128 mAbove = _mm_cmpgt_ps(_mm_loadu_ps(pData + i), mThreshold);
+
+        mCount = _mm_sub_epi32(mCount, _mm_castps_si128(mAbove));
+    }
+    return HorizontalSum(mCount) + CountAboveRowScalar(pData + i, Count - i, Threshold);
+}
+#endif
+
+#if DILIGENT_AVX2_SUPPORTED
+// AVX2 kernels are compiled for the AVX2 target regardless of the build flags
+// and are only selected when the CPU supports them.
 
-        const float* Ptr = pRowStart;
-        for (; Ptr < pAVXEnd; Ptr += 8)
+DILIGENT_TARGET_AVX2 void MinMaxRowAVX2(const float* pData, size_t Count, float& MinValue, float& MaxValue)
+{
+    size_t i = 0;
+    if (Count >= 8)
+    {
+        __m256 mmMin = _mm256_set1_ps(MinValue);
+        __m256 mmMax = _mm256_set1_ps(MaxValue);
+        for (; i + 8 <= Count; i += 8)
         {
-            // NOTE: MSVC generates vmovups when using _mm256_load_ps regardless,
-            //       so no reason to bother with aligning the pointer.
-            auto mmVal = _mm256_loadu_ps(Ptr);
+            const __m256 mmVal = _mm256_loadu_ps(pData + i);
 
             mmMin = _mm256_min_ps(mmMin, mmVal);
             mmMax = _mm256_max_ps(mmMax, mmVal);
         }
 
-        for (; Ptr < pRowEnd; ++Ptr)
+        __m128 mMin = _mm_min_ps(_mm256_castps256_ps128(mmMin), _mm256_extractf128_ps(mmMin, 1));
+        __m128 mMax = _mm_max_ps(_mm256_castps256_ps128(mmMax), _mm256_extractf128_ps(mmMax, 1));
+        mMin        = _mm_min_ps(mMin, _mm_movehl_ps(mMin, mMin));
+        mMax        = _mm_max_ps(mMax, _mm_movehl_ps(mMax, mMax));
+        mMin        = _mm_min_ss(mMin, _mm_shuffle_ps(mMin, mMin, 1));
+        mMax        = _mm_max_ss(mMax, _mm_shuffle_ps(mMax, mMax, 1));
+        MinValue    = _mm_cvtss_f32(mMin);
+        MaxValue    = _mm_cvtss_f32(mMax);
+    }
+
+    for (; i < Count; ++i)
+    {
+        MinValue = std::min(MinValue, pData[i]);
+        MaxValue = std::max(MaxValue, pData[i]);
+    }
+}
+
+DILIGENT_TARGET_AVX2 double SumRowAVX2(const float* pData, size_t Count)
+{
+    __m256d mmSum0 = _mm256_setzero_pd();
+    __m256d mmSum1 = _mm256_setzero_pd();
+
+    size_t i = 0;
+    for (; i + 8 <= Count; i += 8)
+    {
+        const __m256 mmVal = _mm256_loadu_ps(pData + i);
+
+        mmSum0 = _mm256_add_pd(mmSum0, _mm256_cvtps_pd(_mm256_castps256_ps128(mmVal)));
+        mmSum1 = _mm256_add_pd(mmSum1, _mm256_cvtps_pd(_mm256_extractf128_ps(mmVal, 1)));
+    }
+
+    mmSum0       = _mm256_add_pd(mmSum0, mmSum1);
+    __m128d mSum = _mm_add_pd(_mm256_castpd256_pd128(mmSum0), _mm256_extractf128_pd(mmSum0, 1));
+    double  Sum  = _mm_cvtsd_f64(_mm_add_sd(mSum, _mm_unpackhi_pd(mSum, mSum)));
+
+    for (; i < Count; ++i)
+        Sum += pData[i];
+    return Sum;
+}
+
+DILIGENT_TARGET_AVX2 size_t CountAboveRowAVX2(const float* pData, size_t Count, float Threshold)
+{
+    const __m256 mmThreshold = _mm256_set1_ps(Threshold);
+
+    // Comparison results are all-ones (-1) in every lane that passes the test
+    __m256i mmCount = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (; i + 8 <= Count; i += 8)
+    {
+        const __m256 mmAbove = _mm256_cmp_ps(_mm256_loadu_ps(pData + i), mmThreshold, _CMP_GT_OQ);
+
+        mmCount = _mm256_sub_epi32(mmCount, _mm256_castps_si256(mmAbove));
+    }
+
+    alignas(32) Uint32 Lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(Lanes), mmCount);
+
+    size_t NumAbove = 0;
+    for (Uint32 Lane : Lanes)
+        NumAbove += Lane;
+    for (; i < Count; ++i)
+        NumAbove += pData[i] > Threshold ? 1 : 0;
+    return NumAbove;
+}
+
+DILIGENT_TARGET_AVX2_F16C void HalfToFloatRowF16C(const Uint16* pSrc, size_t Count, float* pDst)
+{
+    size_t i = 0;
+    for (; i + 8 <= Count; i += 8)
+        _mm256_storeu_ps(pDst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i))));
+
+    for (; i < Count; ++i)
+        pDst[i] = HalfToFloat(pSrc[i]);
+}
+#endif
+
+#if DILIGENT_NEON_ENABLED
+float HorizontalMin(float32x4_t Val)
+{
+    const float32x2_t Min2 = vmin_f32(vget_low_f32(Val), vget_high_f32(Val));
+    return std::min(vget_lane_f32(Min2, 0), vget_lane_f32(Min2, 1));
+}
+
+float HorizontalMax(float32x4_t Val)
+{
+    const float32x2_t Max2 = vmax_f32(vget_low_f32(Val), vget_high_f32(Val));
+    return std::max(vget_lane_f32(Max2, 0), vget_lane_f32(Max2, 1));
+}
+
+void MinMaxRowNEON(const float* pData, size_t Count, float& MinValue, float& MaxValue)
+{
+    size_t i = 0;
+    if (Count >= 4)
+    {
+        float32x4_t Min4 = vdupq_n_f32(MinValue);
+        float32x4_t Max4 = vdupq_n_f32(MaxValue);
+        for (; i + 4 <= Count; i += 4)
         {
-            MinValue = std::min(MinValue, *Ptr);
-            MaxValue = std::max(MaxValue, *Ptr);
+            const float32x4_t Val = vld1q_f32(pData + i);
+
+            Min4 = vminq_f32(Min4, Val);
+            Max4 = vmaxq_f32(Max4, Val);
         }
+        MinValue = HorizontalMin(Min4);
+        MaxValue = HorizontalMax(Max4);
     }
+    MinMaxRowScalar(pData + i, Count - i, MinValue, MaxValue);
+}
+
+double SumRowNEON(const float* pData, size_t Count)
+{
+    // 32-bit NEON has no double-precision vectors, so the values are summed in
+    // short float blocks that are then accumulated in double precision.
+    constexpr size_t BlockSize = 64;
 
-// Shuffle only works within 128-bit halves
-#    define MAKE_SHUFFLE(i0, i1, i2, i3) ((i0 << 0) | (i1 << 2) | (i2 << 4) | (i3 << 6))
-    constexpr int Shuffle1032 = MAKE_SHUFFLE(1, 0, 3, 2);
-    // |  0  |  1  |  2  |  3  |       |  1  |  0  |  3  |  2  |
-    // |  A  |  B  |  C  |  D  |   =>  |  B  |  A  |  D  |  C  |
-    mmMin = _mm256_min_ps(mmMin, _mm256_permute_ps(mmMin, Shuffle1032));
-    mmMax = _mm256_max_ps(mmMax, _mm256_permute_ps(mmMax, Shuffle1032));
+    double Sum = 0;
+    size_t i   = 0;
+    while (i + 4 <= Count)
+    {
+        const size_t BlockEnd = std::min(i + BlockSize, Count & ~size_t{3});
+
+        float32x4_t Sum4 = vdupq_n_f32(0);
+        for (; i < BlockEnd; i += 4)
+            Sum4 = vaddq_f32(Sum4, vld1q_f32(pData + i));
 
-    constexpr int Shuffle2301 = MAKE_SHUFFLE(2, 3, 0, 1);
-    //       0           1           2          3                    2           3           0           1
-    // | max(A, B) | max(A, B) | max(C, D) | max(C, D) |  =>  | max(C, D) | max(C, D) | max(A, B) | max(A, B) |
-    mmMin = _mm256_min_ps(mmMin, _mm256_permute_ps(mmMin, Shuffle2301));
-    mmMax = _mm256_max_ps(mmMax, _mm256_permute_ps(mmMax, Shuffle2301));
+        Sum += double{vgetq_lane_f32(Sum4, 0)} + double{vgetq_lane_f32(Sum4, 1)} +
+            double{vgetq_lane_f32(Sum4, 2)} + double{vgetq_lane_f32(Sum4, 3)};
+    }
+    return Sum + SumRowScalar(pData + i, Count - i);
+}
 
-    // Note that _mm256_permute_ps is faster than _mm256_permutevar8x32_ps
-    const auto SelectElement4 = _mm256_set1_epi32(4);
-    // We only need to do min/max between elements 4 and 0
-    mmMin = _mm256_min_ps(mmMin, _mm256_permutevar8x32_ps(mmMin, SelectElement4));
-    mmMax = _mm256_max_ps(mmMax, _mm256_permutevar8x32_ps(mmMax, SelectElement4));
+size_t CountAboveRowNEON(const float* pData, size_t Count, float Threshold)
+{
+    const float32x4_t Threshold4 = vdupq_n_f32(Threshold);
 
-    // Extract lower 128 bits
-    auto mMin0123 = _mm256_castps256_ps128(mmMin);
-    auto mMax0123 = _mm256_castps256_ps128(mmMax);
+    // Comparison results are all-ones (-1) in every lane that passes the test
+    uint32x4_t Count4 = vdupq_n_u32(0);
 
-    float Min0, Max0;
-    _mm_store_ss(&Min0, mMin0123);
-    _mm_store_ss(&Max0, mMax0123);
-    MinValue = std::min(Min0, MinValue);
-    MaxValue = std::max(Max0, MaxValue);
+    size_t i = 0;
+    for (; i + 4 <= Count; i += 4)
+        Count4 = vsubq_u32(Count4, vcgtq_f32(vld1q_f32(pData + i), Threshold4));
 
-    return true;
+    return size_t{vgetq_lane_u32(Count4, 0)} + size_t{vgetq_lane_u32(Count4, 1)} +
+        size_t{vgetq_lane_u32(Count4, 2)} + size_t{vgetq_lane_u32(Count4, 3)} +
+        CountAboveRowScalar(pData + i, Count - i, Threshold);
 }
 #endif
 
+FloatRowKernels SelectFloatRowKernels()
+{
+    FloatRowKernels Kernels{MinMaxRowScalar, SumRowScalar, CountAboveRowScalar, HalfToFloatRowScalar};
+#if DILIGENT_SSE2_ENABLED
+    Kernels.MinMax     = MinMaxRowSSE2;
+    Kernels.Sum        = SumRowSSE2;
+    Kernels.CountAbove = CountAboveRowSSE2;
+#elif DILIGENT_NEON_ENABLED
+    Kernels.MinMax     = MinMaxRowNEON;
+    Kernels.Sum        = SumRowNEON;
+    Kernels.CountAbove = CountAboveRowNEON;
+#endif
+
+#if DILIGENT_AVX2_SUPPORTED
+    const CPUFeatures Features = PlatformMisc::GetCPUFeatures();
+    if (Features.AVX2)
+    {
+        Kernels.MinMax     = MinMaxRowAVX2;
+        Kernels.Sum        = SumRowAVX2;
+        Kernels.CountAbove = CountAboveRowAVX2;
+        if (Features.F16C)
+            Kernels.HalfToFloat = HalfToFloatRowF16C;
+    }
+#endif
+
+    return Kernels;
+}
+
+const FloatRowKernels& GetFloatRowKernels()
+{
+    static const FloatRowKernels Kernels = SelectFloatRowKernels();
+    return Kernels;
+}
+
+
+// The number of elements converted to float at a time
+constexpr Uint32 ConversionBlockSize = 1024;
+
+// The minimum number of elements processed by one thread
+constexpr size_t MinElementsPerThread = size_t{64} << 10u;
+
+template <typename SrcType>
+void ConvertToFloat(const SrcType* pSrc, size_t Count, float* pDst)
+{
+    for (size_t i = 0; i < Count; ++i)
+        pDst[i] = static_cast<float>(pSrc[i]);
+}
+
+// Calls Op(pValues, Row, FirstColumn, Count) for all values of the row. Float, half and 8/16-bit
+// integer values are passed as spans of 32-bit floats, 32-bit integers are passed as is.
+template <typename OpType>
+void ProcessArray2DRow(const Array2DDesc& Desc, const FloatRowKernels& Kernels, Uint32 Row, OpType& Op)
+{
+    const Uint8* pRow = static_cast<const Uint8*>(Desc.pData) + Desc.Stride * Row;
+    switch (Desc.ElementType)
+    {
+        case VT_FLOAT32: Op(reinterpret_cast<const float*>(pRow), Row, 0, Desc.Width); return;
+        case VT_INT32: Op(reinterpret_cast<const Int32*>(pRow), Row, 0, Desc.Width); return;
+        case VT_UINT32: Op(reinterpret_cast<const Uint32*>(pRow), Row, 0, Desc.Width); return;
+        default: break;
+    }
+
+    float Buffer[ConversionBlockSize];
+    for (Uint32 x = 0; x < Desc.Width; x += ConversionBlockSize)
+    {
+        const Uint32 Count = std::min(Desc.Width - x, ConversionBlockSize);
+        switch (Desc.ElementType)
+        {
+            // clang-format off
+            case VT_FLOAT16: Kernels.HalfToFloat(reinterpret_cast<const Uint16*>(pRow) + x, Count, Buffer); break;
+            case VT_INT8:    ConvertToFloat(reinterpret_cast<const Int8*  >(pRow) + x, Count, Buffer); break;
+            case VT_UINT8:   ConvertToFloat(reinterpret_cast<const Uint8* >(pRow) + x, Count, Buffer); break;
+            case VT_INT16:   ConvertToFloat(reinterpret_cast<const Int16* >(pRow) + x, Count, Buffer); break;
+            case VT_UINT16:  ConvertToFloat(reinterpret_cast<const Uint16*>(pRow) + x, Count, Buffer); break;
+            // clang-format on
+            default:
+                UNEXPECTED("Unexpected element type");
+                return;
+        }
+        Op(static_cast<const float*>(Buffer), Row, x, Count);
+    }
+}
+
+Uint32 GetElementSize(VALUE_TYPE ElementType)
+{
+    switch (ElementType)
+    {
+        case VT_INT8:
+        case VT_UINT8:
+            return 1;
+
+        case VT_FLOAT16:
+        case VT_INT16:
+        case VT_UINT16:
+            return 2;
+
+        case VT_FLOAT32:
+        case VT_INT32:
+        case VT_UINT32:
+            return 4;
+
+        default:
+            return 0;
+    }
+}
+
+bool VerifyArray2DDesc(const Array2DDesc& Desc)
+{
+    if (Desc.Width == 0 || Desc.Height == 0)
+        return false;
+
+    const Uint32 ElementSize = GetElementSize(Desc.ElementType);
+    if (ElementSize == 0)
+    {
+        UNEXPECTED("Unsupported element type");
+        return false;
+    }
+
+    DEV_CHECK_ERR(Desc.pData != nullptr, "Data pointer must not be null");
+    DEV_CHECK_ERR(Desc.Height == 1 || Desc.Stride >= size_t{Desc.Width} * ElementSize, "Row stride (", Desc.Stride, ") must be at least ", size_t{Desc.Width} * ElementSize);
+    DEV_CHECK_ERR(Desc.Stride % ElementSize == 0, "Row stride (", Desc.Stride, ") must be a multiple of the element size (", ElementSize, ")");
+    DEV_CHECK_ERR(AlignDown(Desc.pData, ElementSize) == Desc.pData, "Data pointer is not naturally aligned");
+
+    return Desc.pData != nullptr;
+}
+
+// Reduces the rows of the array with OpType and returns the merged result.
+// OpType must define the operator() called by ProcessArray2DRow and Merge(const OpType&).
+// The initial operation must be the identity of Merge.
+template <typename OpType>
+OpType ReduceArray2DRows(const Array2DDesc& Desc, IThreadPool* pThreadPool, const OpType& InitialOp)
+{
+    const FloatRowKernels& Kernels = GetFloatRowKernels();
+
+    auto ProcessRows = [&](size_t FirstRow, size_t EndRow) {
+        OpType Op{InitialOp};
+        for (size_t Row = FirstRow; Row < EndRow; ++Row)
+            ProcessArray2DRow(Desc, Kernels, static_cast<Uint32>(Row), Op);
+        return Op;
+    };
+
+    if (pThreadPool == nullptr)
+        return ProcessRows(0, Desc.Height);
+
+    const size_t MinRowsPerThread = std::max(MinElementsPerThread / Desc.Width, size_t{1});
+
+    OpType     Result{InitialOp};
+    std::mutex ResultMtx;
+    ParallelFor(pThreadPool, 0, Desc.Height, MinRowsPerThread,
+                [&](size_t FirstRow, size_t EndRow) {
+                    const OpType ChunkOp = ProcessRows(FirstRow, EndRow);
+
+                    std::lock_guard<std::mutex> Lock{ResultMtx};
+                    Result.Merge(ChunkOp);
+                });
+    return Result;
+}
+
+
+struct MinMaxOp
+{
+    const FloatRowKernels* pKernels = nullptr;
+
+    Uint32 Width    = 0;
+    bool   HasValue = false;
+
+    double MinValue = 0;
+    double MaxValue = 0;
+    Uint64 MinIndex = 0; // Row-major index of the first minimum
+    Uint64 MaxIndex = 0; // Row-major index of the first maximum
+
+    void operator()(const float* pValues, Uint32 Row, Uint32 FirstColumn, size_t Count)
+    {
+        float SpanMin = pValues[0];
+        float SpanMax = pValues[0];
+        pKernels->MinMax(pValues, Count, SpanMin, SpanMax);
+        // Locate the values only when the span improves the result, which is rare for large arrays
+        Update(pValues, Row, FirstColumn, Count, SpanMin, SpanMax);
+    }
+
+    template <typename T>
+    void operator()(const T* pValues, Uint32 Row, Uint32 FirstColumn, size_t Count)
+    {
+        T SpanMin = pValues[0];
+        T SpanMax = pValues[0];
+        for (size_t i = 1; i < Count; ++i)
+        {
+            SpanMin = std::min(SpanMin, pValues[i]);
+            SpanMax = std::max(SpanMax, pValues[i]);
+        }
+        Update(pValues, Row, FirstColumn, Count, SpanMin, SpanMax);
+    }
+
+    void Merge(const MinMaxOp& Other)
+    {
+        if (!Other.HasValue)
+            return;
+
+        if (!HasValue || Other.MinValue < MinValue || (Other.MinValue == MinValue && Other.MinIndex < MinIndex))
+        {
+            MinValue = Other.MinValue;
+            MinIndex = Other.MinIndex;
+        }
+        if (!HasValue || Other.MaxValue > MaxValue || (Other.MaxValue == MaxValue && Other.MaxIndex < MaxIndex))
+        {
+            MaxValue = Other.MaxValue;
+            MaxIndex = Other.MaxIndex;
+        }
+        HasValue = true;
+    }
+
+private:
+    template <typename T>
+    void Update(const T* pValues, Uint32 Row, Uint32 FirstColumn, size_t Count, T SpanMin, T SpanMax)
+    {
+        const Uint64 SpanStart = Uint64{Row} * Width + FirstColumn;
+        if (!HasValue || SpanMin < MinValue)
+        {
+            MinValue = static_cast<double>(SpanMin);
+            MinIndex = SpanStart + (std::find(pValues, pValues + Count, SpanMin) - pValues);
+        }
+        if (!HasValue || SpanMax > MaxValue)
+        {
+            MaxValue = static_cast<double>(SpanMax);
+            MaxIndex = SpanStart + (std::find(pValues, pValues + Count, SpanMax) - pValues);
+        }
+        HasValue = true;
+    }
+};
+
+struct SumOp
+{
+    const FloatRowKernels* pKernels = nullptr;
+
+    double Sum = 0;
+
+    void operator()(const float* pValues, Uint32, Uint32, size_t Count)
+    {
+        Sum += pKernels->Sum(pValues, Count);
+    }
+
+    template <typename T>
+    void operator()(const T* pValues, Uint32, Uint32, size_t Count)
+    {
+        // 32-bit integers are summed exactly
+        Int64 RowSum = 0;
+        for (size_t i = 0; i < Count; ++i)
+            RowSum += pValues[i];
+        Sum += static_cast<double>(RowSum);
+    }
+
+    void Merge(const SumOp& Other)
+    {
+        Sum += Other.Sum;
+    }
+};
+
+struct CountAboveOp
+{
+    const FloatRowKernels* pKernels = nullptr;
+
+    double Threshold      = 0;
+    float  FloatThreshold = 0;
+
+    Uint64 NumAbove = 0;
+
+    void operator()(const float* pValues, Uint32, Uint32, size_t Count)
+    {
+        NumAbove += pKernels->CountAbove(pValues, Count, FloatThreshold);
+    }
+
+    template <typename T>
+    void operator()(const T* pValues, Uint32, Uint32, size_t Count)
+    {
+        for (size_t i = 0; i < Count; ++i)
+            NumAbove += static_cast<double>(pValues[i]) > Threshold ? 1 : 0;
+    }
+
+    void Merge(const CountAboveOp& Other)
+    {
+        NumAbove += Other.NumAbove;
+    }
+};
+
+struct HistogramOp
+{
+    double MinValue = 0;
+    double BinScale = 0;
+    Uint32 NumBins  = 0;
+
+    std::vector<Uint64> Bins;
+
+    template <typename T>
+    void operator()(const T* pValues, Uint32, Uint32, size_t Count)
+    {
+        const double MaxBin = static_cast<double>(NumBins - 1);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const double Bin = (static_cast<double>(pValues[i]) - MinValue) * BinScale;
+            // NaN values are skipped
+            if (Bin == Bin)
+                ++Bins[static_cast<size_t>(std::min(std::max(Bin, 0.0), MaxBin))];
+        }
+    }
+
+    void Merge(const HistogramOp& Other)
+    {
+        for (size_t i = 0; i < Bins.size(); ++i)
+            Bins[i] += Other.Bins[i];
+    }
+};
+
 } // namespace
 
 void GetArray2DMinMaxValue(const float* pData,
@@ -139,17 +695,115 @@ void GetArray2DMinMaxValue(const float* pData,
     if (Width == 0 || Height == 0)
         return;
 
-    DEV_CHECK_ERR(pData != nullptr, "Data pointer must not be null");
-    DEV_CHECK_ERR(Height == 1 || StrideInFloats >= Width, "Row stride (", StrideInFloats, ") must be at least ", Width);
-    DEV_CHECK_ERR(AlignDown(pData, alignof(float)) == pData, "Data pointer is not naturally aligned");
+    Array2DDesc Desc;
+    Desc.pData       = pData;
+    Desc.Stride      = StrideInFloats * sizeof(float);
+    Desc.Width       = Width;
+    Desc.Height      = Height;
+    Desc.ElementType = VT_FLOAT32;
+
+    const Array2DMinMax MinMax = GetArray2DMinMax(Desc);
+
+    MinValue = static_cast<float>(MinMax.MinValue);
+    MaxValue = static_cast<float>(MinMax.MaxValue);
+}
+
+Array2DMinMax GetArray2DMinMax(const Array2DDesc& Desc, IThreadPool* pThreadPool)
+{
+    if (!VerifyArray2DDesc(Desc))
+        return {};
+
+    MinMaxOp InitialOp;
+    InitialOp.pKernels = &GetFloatRowKernels();
+    InitialOp.Width    = Desc.Width;
+
+    const MinMaxOp Op = ReduceArray2DRows(Desc, pThreadPool, InitialOp);
+
+    Array2DMinMax MinMax;
+    MinMax.MinValue = Op.MinValue;
+    MinMax.MaxValue = Op.MaxValue;
+    MinMax.MinX     = static_cast<Uint32>(Op.MinIndex % Desc.Width);
+    MinMax.MinY     = static_cast<Uint32>(Op.MinIndex / Desc.Width);
+    MinMax.MaxX     = static_cast<Uint32>(Op.MaxIndex % Desc.Width);
+    MinMax.MaxY     = static_cast<Uint32>(Op.MaxIndex / Desc.Width);
+    return MinMax;
+}
+
+double GetArray2DSum(const Array2DDesc& Desc, IThreadPool* pThreadPool)
+{
+    if (!VerifyArray2DDesc(Desc))
+        return 0;
+
+    SumOp InitialOp;
+    InitialOp.pKernels = &GetFloatRowKernels();
+    return ReduceArray2DRows(Desc, pThreadPool, InitialOp).Sum;
+}
+
+double GetArray2DMean(const Array2DDesc& Desc, IThreadPool* pThreadPool)
+{
+    if (Desc.Width == 0 || Desc.Height == 0)
+        return 0;
+
+    return GetArray2DSum(Desc, pThreadPool) / (static_cast<double>(Desc.Width) * static_cast<double>(Desc.Height));
+}
+
+Uint64 GetArray2DCountAbove(const Array2DDesc& Desc, double Threshold, IThreadPool* pThreadPool)
+{
+    if (!VerifyArray2DDesc(Desc))
+        return 0;
+
+    CountAboveOp InitialOp;
+    InitialOp.pKernels  = &GetFloatRowKernels();
+    InitialOp.Threshold = Threshold;
+
+    // Find the float threshold that gives the same result for all float values:
+    // the largest float that is not greater than the double threshold.
+    constexpr double MaxFloat = std::numeric_limits<float>::max();
+    if (Threshold >= MaxFloat)
+        InitialOp.FloatThreshold = std::numeric_limits<float>::max();
+    else if (Threshold < -MaxFloat)
+        InitialOp.FloatThreshold = -std::numeric_limits<float>::infinity();
+    else
+    {
+        InitialOp.FloatThreshold = static_cast<float>(Threshold);
+        if (static_cast<double>(InitialOp.FloatThreshold) > Threshold)
+            InitialOp.FloatThreshold = std::nextafter(InitialOp.FloatThreshold, -std::numeric_limits<float>::infinity());
+        // NaN threshold stays NaN, and no value is counted
+    }
+
+    return ReduceArray2DRows(Desc, pThreadPool, InitialOp).NumAbove;
+}
+
+void ComputeArray2DHistogram(const Array2DDesc& Desc,
+                             double             MinValue,
+                             double             MaxValue,
+                             Uint32             NumBins,
+                             Uint64*            pBins,
+                             IThreadPool*       pThreadPool)
+{
+    if (NumBins == 0)
+        return;
+
+    DEV_CHECK_ERR(pBins != nullptr, "Bins pointer must not be null");
+    std::fill(pBins, pBins + NumBins, Uint64{0});
 
-    MinValue = MaxValue = pData[0];
-#if DILIGENT_AVX2_ENABLED
-    if (GetArray2DMinMaxValueAVX2(pData, StrideInFloats, Width, Height, MinValue, MaxValue))
+    if (!VerifyArray2DDesc(Desc))
         return;
-#endif
 
-    GetArray2DMinMaxValueGeneric(pData, StrideInFloats, Width, Height, MinValue, MaxValue);
+    if (!(MaxValue > MinValue))
+    {
+        UNEXPECTED("Maximum value (", MaxValue, ") must be greater than the minimum value (", MinValue, ")");
+        return;
+    }
+
+    HistogramOp InitialOp;
+    InitialOp.MinValue = MinValue;
+    InitialOp.BinScale = NumBins / (MaxValue - MinValue);
+    InitialOp.NumBins  = NumBins;
+    InitialOp.Bins.resize(NumBins);
+
+    const HistogramOp Op = ReduceArray2DRows(Desc, pThreadPool, InitialOp);
+    std::copy(Op.Bins.begin(), Op.Bins.end(), pBins);
 }
 
 } // namespace Diligent
@@ -0,0 +1,169 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+#include "AsyncFileReader.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "FileWrapper.hpp"
+#include "DataBlobImpl.hpp"
+
+namespace Diligent
+{
+
+AsyncFileReadTask::AsyncFileReadTask(IReferenceCounters* pRefCounters,
+                                     const Char*         Path,
+                                     float               fPriority) :
+    AsyncTaskBase{pRefCounters, fPriority},
+    m_Path{Path}
+{
+}
+
+ASYNC_TASK_STATUS AsyncFileReadTask::Run(Uint32 ThreadId)
+{
+    if (m_bSafelyCancel.load())
+        return ASYNC_TASK_STATUS_CANCELLED;
+
+    FileWrapper File{m_Path.c_str(), EFileAccessMode::Read};
+    if (File)
+    {
+        RefCntAutoPtr<DataBlobImpl> pData = DataBlobImpl::Create();
+        if (File->Read(pData))
+            m_pData = pData;
+        else
+            LOG_ERROR_MESSAGE("Failed to read file ", m_Path);
+    }
+
+    return ASYNC_TASK_STATUS_COMPLETE;
+}
+
+
+AsyncFileReader::AsyncFileReader(const AsyncFileReaderCreateInfo& CI)
+{
+    ThreadPoolCreateInfo PoolCI;
+    PoolCI.NumThreads = std::max(CI.NumThreads, 1u);
+    m_pThreadPool     = CreateThreadPool(PoolCI);
+}
+
+AsyncFileReader::~AsyncFileReader()
+{
+    ClearPrefetchCache();
+    m_pThreadPool->WaitForAllTasks();
+}
+
+RefCntAutoPtr<AsyncFileReadTask> AsyncFileReader::ReadFile(const Char* Path, float fPriority)
+{
+    DEV_CHECK_ERR(Path != nullptr && Path[0] != '\0', "Path must not be null or empty");
+
+    RefCntAutoPtr<AsyncFileReadTask> pTask;
+    {
+        std::lock_guard<std::mutex> Guard{m_PrefetchCacheMtx};
+
+        auto it = m_PrefetchCache.find(Path);
+        if (it != m_PrefetchCache.end())
+        {
+            pTask = std::move(it->second);
+            m_PrefetchCache.erase(it);
+        }
+    }
+
+    if (pTask)
+    {
+        if (pTask->GetStatus() == ASYNC_TASK_STATUS_NOT_STARTED && pTask->GetPriority() < fPriority)
+        {
+            pTask->SetPriority(fPriority);
+            m_pThreadPool->ReprioritizeTask(pTask);
+        }
+        return pTask;
+    }
+
+    pTask = RefCntAutoPtr<AsyncFileReadTask>{MakeNewRCObj<AsyncFileReadTask>()(Path, fPriority)};
+    m_pThreadPool->EnqueueTask(pTask);
+
+    return pTask;
+}
+
+void AsyncFileReader::Prefetch(const Char* const* ppPaths, Uint32 NumPaths, float fPriority)
+{
+    DEV_CHECK_ERR(ppPaths != nullptr || NumPaths == 0, "ppPaths must not be null");
+
+    std::vector<RefCntAutoPtr<AsyncFileReadTask>> NewTasks;
+    NewTasks.reserve(NumPaths);
+    {
+        std::lock_guard<std::mutex> Guard{m_PrefetchCacheMtx};
+        for (Uint32 i = 0; i < NumPaths; ++i)
+        {
+            const Char* Path = ppPaths[i];
+            if (Path == nullptr || Path[0] == '\0')
+            {
+                DEV_ERROR("Prefetch path must not be null or empty");
+                continue;
+            }
+
+            RefCntAutoPtr<AsyncFileReadTask>& pTask = m_PrefetchCache[Path];
+            if (pTask)
+                continue;
+
+            pTask = RefCntAutoPtr<AsyncFileReadTask>{MakeNewRCObj<AsyncFileReadTask>()(Path, fPriority)};
+            NewTasks.emplace_back(pTask);
+        }
+    }
+
+    // Enqueue the tasks outside of the lock so that the workers are not blocked by ReadFile()
+    for (RefCntAutoPtr<AsyncFileReadTask>& pTask : NewTasks)
+        m_pThreadPool->EnqueueTask(pTask);
+}
+
+void AsyncFileReader::ClearPrefetchCache()
+{
+    std::unordered_map<std::string, RefCntAutoPtr<AsyncFileReadTask>> PrefetchCache;
+    {
+        std::lock_guard<std::mutex> Guard{m_PrefetchCacheMtx};
+        PrefetchCache.swap(m_PrefetchCache);
+    }
+
+    for (auto& it : PrefetchCache)
+    {
+        // Tasks that have not started yet will finish immediately
+        it.second->Cancel();
+    }
+}
+
+size_t AsyncFileReader::GetPrefetchCacheSize() const
+{
+    std::lock_guard<std::mutex> Guard{m_PrefetchCacheMtx};
+    return m_PrefetchCache.size();
+}
+
+void AsyncFileReader::WaitForAllReads()
+{
+    m_pThreadPool->WaitForAllTasks();
+}
+
+} // namespace Diligent
@@ -0,0 +1,224 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "AsyncTaskDependencyTracker.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <cfloat>
+
+namespace Diligent
+{
+
+struct AsyncTaskDependencyTracker::PendingTask
+{
+    TaskInfo Info;
+
+    // The number of prerequisites that have not finished yet.
+    std::atomic<Uint32> NumOutstandingPrerequisites{0};
+};
+
+struct AsyncTaskDependencyTracker::State
+{
+    std::mutex Mtx;
+
+    // Set to null when the tracker is destroyed
+    OnTaskReadyType OnTaskReady;
+
+    std::unordered_map<IAsyncTask*, std::shared_ptr<PendingTask>> PendingTasks;
+
+    std::atomic<Uint32> NumPendingTasks{0};
+};
+
+AsyncTaskDependencyTracker::AsyncTaskDependencyTracker(OnTaskReadyType OnTaskReady) :
+    m_pState{std::make_shared<State>()}
+{
+    m_pState->OnTaskReady = std::move(OnTaskReady);
+}
+
+AsyncTaskDependencyTracker::~AsyncTaskDependencyTracker()
+{
+    // Prerequisites may outlive the tracker and call the completion callbacks later.
+    // The callbacks keep weak references to the state and check the OnTaskReady function
+    // while holding the mutex.
+    std::unordered_map<IAsyncTask*, std::shared_ptr<PendingTask>> PendingTasks;
+    {
+        std::lock_guard<std::mutex> Lock{m_pState->Mtx};
+        m_pState->OnTaskReady = nullptr;
+        // Releasing a task may run the completion callbacks of other tasks,
+        // so the tasks must be released after the mutex is unlocked.
+        PendingTasks.swap(m_pState->PendingTasks);
+    }
+}
+
+bool AsyncTaskDependencyTracker::AddTask(IAsyncTask* pTask, IAsyncTask** ppPrerequisites, Uint32 NumPrerequisites, TaskInfo& ReadyTask)
+{
+    VERIFY_EXPR(pTask != nullptr);
+
+    std::shared_ptr<PendingTask> pPendingTask = std::make_shared<PendingTask>();
+    pPendingTask->Info.pTask                  = pTask;
+
+    std::vector<RefCntAutoPtr<AsyncTaskBase>> TrackedPrerequisites;
+    if (ppPrerequisites != nullptr && NumPrerequisites > 0)
+    {
+        float MinPrereqPriority = +FLT_MAX;
+        for (Uint32 i = 0; i < NumPrerequisites; ++i)
+        {
+            IAsyncTask* pPrereq = ppPrerequisites[i];
+            if (pPrereq == nullptr || pPrereq->IsFinished())
+                continue;
+
+            MinPrereqPriority = std::min(MinPrereqPriority, pPrereq->GetPriority());
+
+            RefCntAutoPtr<AsyncTaskBase> pPrereqImpl{pPrereq, AsyncTaskBase::IID_InternalImpl};
+            if (pPrereqImpl)
+                TrackedPrerequisites.emplace_back(std::move(pPrereqImpl));
+            else
+                pPendingTask->Info.Prerequisites.emplace_back(pPrereq);
+        }
+
+        if (pTask->GetPriority() > MinPrereqPriority)
+            pTask->SetPriority(MinPrereqPriority);
+    }
+
+    if (TrackedPrerequisites.empty())
+    {
+        ReadyTask = std::move(pPendingTask->Info);
+        return true;
+    }
+
+    // Hold an extra reference so that the task does not become ready
+    // while the completion callbacks are being added.
+    pPendingTask->NumOutstandingPrerequisites.store(static_cast<Uint32>(TrackedPrerequisites.size()) + 1);
+
+    {
+        // The task must be registered before any of the callbacks may run
+        std::lock_guard<std::mutex> Lock{m_pState->Mtx};
+        DEV_CHECK_ERR(m_pState->PendingTasks.find(pTask) == m_pState->PendingTasks.end(), "The task is already pending");
+        m_pState->PendingTasks[pTask] = pPendingTask;
+        m_pState->NumPendingTasks.fetch_add(1);
+    }
+
+    std::weak_ptr<State> wpState = m_pState;
+    for (RefCntAutoPtr<AsyncTaskBase>& pPrereq : TrackedPrerequisites)
+    {
+        const AsyncTaskBase::CompletionCallbackHandle hCallback = pPrereq->AddCompletionCallback(
+            [wpState, pPendingTask]() {
+                OnPrerequisiteFinished(wpState, pPendingTask);
+            });
+        if (hCallback == AsyncTaskBase::InvalidCompletionCallbackHandle)
+        {
+            // The prerequisite has finished since we checked its status
+            pPendingTask->NumOutstandingPrerequisites.fetch_sub(1);
+        }
+    }
+
+    // Release the extra reference
+    if (pPendingTask->NumOutstandingPrerequisites.fetch_sub(1) > 1)
+        return false;
+
+    // All prerequisites have finished while we were adding the callbacks
+    std::lock_guard<std::mutex> Lock{m_pState->Mtx};
+
+    auto it = m_pState->PendingTasks.find(pTask);
+    if (it == m_pState->PendingTasks.end() || it->second != pPendingTask)
+    {
+        // The task has been removed by another thread
+        return false;
+    }
+    ReadyTask = std::move(pPendingTask->Info);
+    m_pState->PendingTasks.erase(it);
+    m_pState->NumPendingTasks.fetch_sub(1);
+    return true;
+}
+
+void AsyncTaskDependencyTracker::OnPrerequisiteFinished(const std::weak_ptr<State>& wpState, const std::shared_ptr<PendingTask>& pPendingTask)
+{
+    if (pPendingTask->NumOutstandingPrerequisites.fetch_sub(1) > 1)
+        return;
+
+    std::shared_ptr<State> pState = wpState.lock();
+    if (!pState)
+        return;
+
+    std::lock_guard<std::mutex> Lock{pState->Mtx};
+    if (!pState->OnTaskReady)
+        return;
+
+    auto it = pState->PendingTasks.find(pPendingTask->Info.pTask);
+    if (it == pState->PendingTasks.end() || it->second != pPendingTask)
+    {
+        // The task has been removed
+        return;
+    }
+    pState->PendingTasks.erase(it);
+
+    // NB: the number of pending tasks is decremented by OnReadyTaskQueued() after the task
+    //     has been queued, otherwise WaitForAllTasks() may miss the task.
+    pState->OnTaskReady(std::move(pPendingTask->Info));
+}
+
+bool AsyncTaskDependencyTracker::RemoveTask(IAsyncTask* pTask)
+{
+    // Releasing a task may run the completion callbacks of other tasks,
+    // so the task must be released after the mutex is unlocked.
+    TaskInfo RemovedTask;
+    {
+        std::lock_guard<std::mutex> Lock{m_pState->Mtx};
+
+        auto it = m_pState->PendingTasks.find(pTask);
+        if (it == m_pState->PendingTasks.end())
+            return false;
+
+        // Completion callbacks of unfinished prerequisites keep references to the pending task,
+        // so move the task information out to release the task now.
+        RemovedTask = std::move(it->second->Info);
+        m_pState->PendingTasks.erase(it);
+        m_pState->NumPendingTasks.fetch_sub(1);
+    }
+    return true;
+}
+
+bool AsyncTaskDependencyTracker::IsTaskPending(IAsyncTask* pTask) const
+{
+    std::lock_guard<std::mutex> Lock{m_pState->Mtx};
+    return m_pState->PendingTasks.find(pTask) != m_pState->PendingTasks.end();
+}
+
+Uint32 AsyncTaskDependencyTracker::GetNumPendingTasks() const
+{
+    return m_pState->NumPendingTasks.load();
+}
+
+Uint32 AsyncTaskDependencyTracker::OnReadyTaskQueued()
+{
+    const Uint32 NumPendingTasks = m_pState->NumPendingTasks.fetch_sub(1);
+    VERIFY_EXPR(NumPendingTasks > 0);
+    return NumPendingTasks - 1;
+}
+
+} // namespace Diligent
@@ -0,0 +1,217 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BasicMathSIMD.hpp"
+
+namespace Diligent
+{
+
+static_assert(sizeof(float3) == sizeof(float) * 3, "float3 must be tightly packed");
+static_assert(sizeof(float4) == sizeof(float) * 4, "float4 must be tightly packed");
+
+namespace
+{
+
+#if DILIGENT_BASIC_MATH_SIMD
+
+using namespace BasicMathSIMDInternal;
+
+#    if DILIGENT_SSE2_ENABLED
+
+constexpr int ShuffleMask(int i0, int i1, int i2, int i3)
+{
+    return _MM_SHUFFLE(i3, i2, i1, i0);
+}
+
+// Loads four float3 values and deinterleaves them into x, y and z registers
+inline void LoadFloat3x4(const float* p, Float4Reg& x, Float4Reg& y, Float4Reg& z)
+{
+    const __m128 a = _mm_loadu_ps(p);     // x0 y0 z0 x1
+    const __m128 b = _mm_loadu_ps(p + 4); // y1 z1 x2 y2
+    const __m128 c = _mm_loadu_ps(p + 8); // z2 x3 y3 z3
+
+    x = _mm_shuffle_ps(_mm_shuffle_ps(a, a, ShuffleMask(0, 3, 0, 3)), _mm_shuffle_ps(b, c, ShuffleMask(2, 2, 1, 1)), ShuffleMask(0, 1, 0, 2));
+    y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, ShuffleMask(1, 1, 0, 0)), _mm_shuffle_ps(b, c, ShuffleMask(3, 3, 2, 2)), ShuffleMask(0, 2, 0, 2));
+    z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, ShuffleMask(2, 2, 1, 1)), _mm_shuffle_ps(c, c, ShuffleMask(0, 0, 3, 3)), ShuffleMask(0, 2, 0, 2));
+}
+
+// Interleaves x, y and z registers and stores them as four float3 values
+inline void StoreFloat3x4(float* p, Float4Reg x, Float4Reg y, Float4Reg z)
+{
+    const __m128 xy_lo = _mm_unpacklo_ps(x, y); // x0 y0 x1 y1
+    const __m128 xy_hi = _mm_unpackhi_ps(x, y); // x2 y2 x3 y3
+
+    _mm_storeu_ps(p, _mm_shuffle_ps(xy_lo, _mm_shuffle_ps(z, x, ShuffleMask(0, 0, 1, 1)), ShuffleMask(0, 1, 0, 2)));
+    _mm_storeu_ps(p + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, ShuffleMask(1, 1, 1, 1)), xy_hi, ShuffleMask(0, 2, 0, 1)));
+    _mm_storeu_ps(p + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, ShuffleMask(2, 2, 3, 3)), _mm_shuffle_ps(y, z, ShuffleMask(3, 3, 3, 3)), ShuffleMask(0, 2, 0, 2)));
+}
+
+#    elif DILIGENT_NEON_ENABLED
+
+inline void LoadFloat3x4(const float* p, Float4Reg& x, Float4Reg& y, Float4Reg& z)
+{
+    const float32x4x3_t xyz = vld3q_f32(p);
+
+    x = xyz.val[0];
+    y = xyz.val[1];
+    z = xyz.val[2];
+}
+
+inline void StoreFloat3x4(float* p, Float4Reg x, Float4Reg y, Float4Reg z)
+{
+    float32x4x3_t xyz;
+    xyz.val[0] = x;
+    xyz.val[1] = y;
+    xyz.val[2] = z;
+    vst3q_f32(p, xyz);
+}
+
+#    endif
+
+// Transforms four 3-component vectors in the structure-of-arrays layout by the matrix, using the
+// same order of operations as Vector4::operator*. WTerm is the product of w and the last matrix row.
+template <bool DivideByW>
+void TransformFloat3x4(Float4Reg& x, Float4Reg& y, Float4Reg& z, const float4x4& m, const Float4Reg WTerm[4])
+{
+    Float4Reg Out[4];
+    for (int c = 0; c < (DivideByW ? 4 : 3); ++c)
+    {
+        Float4Reg r = Mul(x, Splat(m.m[0][c]));
+        r           = Add(r, Mul(y, Splat(m.m[1][c])));
+        r           = Add(r, Mul(z, Splat(m.m[2][c])));
+        Out[c]      = Add(r, WTerm[c]);
+    }
+
+    if (DivideByW)
+    {
+        x = Div(Out[0], Out[3]);
+        y = Div(Out[1], Out[3]);
+        z = Div(Out[2], Out[3]);
+    }
+    else
+    {
+        x = Out[0];
+        y = Out[1];
+        z = Out[2];
+    }
+}
+
+template <bool DivideByW>
+void TransformFloat3Array(const float3* pSrc, size_t Count, const float4x4& m, float w, float3* pDst)
+{
+    // Copy the matrix in case it aliases the destination array
+    const float4x4 Mat = m;
+
+    Float4Reg WTerm[4];
+    for (int c = 0; c < 4; ++c)
+        WTerm[c] = Splat(w * Mat.m[3][c]);
+
+    size_t i = 0;
+    for (; i + 4 <= Count; i += 4)
+    {
+        Float4Reg x, y, z;
+        LoadFloat3x4(&pSrc[i].x, x, y, z);
+        TransformFloat3x4<DivideByW>(x, y, z, Mat, WTerm);
+        StoreFloat3x4(&pDst[i].x, x, y, z);
+    }
+
+    for (; i < Count; ++i)
+    {
+        const float4 Out = float4{pSrc[i], w} * Mat;
+        pDst[i]          = DivideByW ? float3{Out.x / Out.w, Out.y / Out.w, Out.z / Out.w} : float3{Out};
+    }
+}
+
+#endif
+
+} // namespace
+
+void TransformPoints(const float3* pSrc, size_t NumPoints, const float4x4& m, float3* pDst)
+{
+    VERIFY_EXPR(NumPoints == 0 || (pSrc != nullptr && pDst != nullptr));
+#if DILIGENT_BASIC_MATH_SIMD
+    TransformFloat3Array<true>(pSrc, NumPoints, m, 1.f, pDst);
+#else
+    const float4x4 Mat = m;
+    for (size_t i = 0; i < NumPoints; ++i)
+        pDst[i] = pSrc[i] * Mat;
+#endif
+}
+
+void TransformVectors(const float3* pSrc, size_t NumVectors, const float4x4& m, float3* pDst)
+{
+    VERIFY_EXPR(NumVectors == 0 || (pSrc != nullptr && pDst != nullptr));
+#if DILIGENT_BASIC_MATH_SIMD
+    TransformFloat3Array<false>(pSrc, NumVectors, m, 0.f, pDst);
+#else
+    const float4x4 Mat = m;
+    for (size_t i = 0; i < NumVectors; ++i)
+        pDst[i] = float3{float4{pSrc[i], 0} * Mat};
+#endif
+}
+
+void TransformVectors(const float4* pSrc, size_t NumVectors, const float4x4& m, float4* pDst)
+{
+    VERIFY_EXPR(NumVectors == 0 || (pSrc != nullptr && pDst != nullptr));
+#if DILIGENT_BASIC_MATH_SIMD
+    const Float4Reg r0 = Load(m.m[0]);
+    const Float4Reg r1 = Load(m.m[1]);
+    const Float4Reg r2 = Load(m.m[2]);
+    const Float4Reg r3 = Load(m.m[3]);
+    for (size_t i = 0; i < NumVectors; ++i)
+    {
+        const float4 v = pSrc[i];
+        Store(&pDst[i].x, MulVecMat(v.x, v.y, v.z, v.w, r0, r1, r2, r3));
+    }
+#else
+    const float4x4 Mat = m;
+    for (size_t i = 0; i < NumVectors; ++i)
+        pDst[i] = pSrc[i] * Mat;
+#endif
+}
+
+void MulMatrices(const float4x4* pSrc, size_t NumMatrices, const float4x4& m, float4x4* pDst)
+{
+    VERIFY_EXPR(NumMatrices == 0 || (pSrc != nullptr && pDst != nullptr));
+#if DILIGENT_BASIC_MATH_SIMD
+    const Float4Reg r0 = Load(m.m[0]);
+    const Float4Reg r1 = Load(m.m[1]);
+    const Float4Reg r2 = Load(m.m[2]);
+    const Float4Reg r3 = Load(m.m[3]);
+    for (size_t i = 0; i < NumMatrices; ++i)
+    {
+        // Every output row only depends on the same input row, so the arrays may alias
+        for (int row = 0; row < 4; ++row)
+            Store(pDst[i].m[row], MulRowMat(pSrc[i].m[row], r0, r1, r2, r3));
+    }
+#else
+    const float4x4 Mat = m;
+    for (size_t i = 0; i < NumMatrices; ++i)
+        pDst[i] = pSrc[i] * Mat;
+#endif
+}
+
+} // namespace Diligent
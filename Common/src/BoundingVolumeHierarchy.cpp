@@ -0,0 +1,538 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BoundingVolumeHierarchy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <numeric>
+
+#include "ParallelFor.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Cost of traversing a node relative to the cost of intersecting a primitive
+constexpr float SAHTraversalCost = 1.f;
+
+constexpr Uint32 MaxBins = 64;
+
+// Nodes with at least this many primitives compute the bounds and the bins in parallel
+constexpr Uint32 MinPrimsForParallelBinning = 1u << 16;
+
+// The minimum number of primitives processed by one thread when computing the bounds and the bins
+constexpr size_t MinPrimsPerThread = size_t{1} << 14;
+
+// Subtrees with at most this many primitives are built by a single thread
+constexpr Uint32 MinPrimsPerSubtreeTask = 1u << 12;
+
+using Node = BoundingVolumeHierarchy::Node;
+
+struct Bounds
+{
+    float3 Min{+FLT_MAX, +FLT_MAX, +FLT_MAX};
+    float3 Max{-FLT_MAX, -FLT_MAX, -FLT_MAX};
+
+    void Add(const float3& MinPt, const float3& MaxPt)
+    {
+        Min = (min)(Min, MinPt);
+        Max = (max)(Max, MaxPt);
+    }
+
+    void Add(const Bounds& Other)
+    {
+        Add(Other.Min, Other.Max);
+    }
+
+    // Half of the surface area, which is sufficient to compare the SAH costs
+    float GetHalfArea() const
+    {
+        const float3 Size = Max - Min;
+        return Size.x * Size.y + Size.y * Size.z + Size.z * Size.x;
+    }
+};
+
+struct NodeBounds
+{
+    Bounds Boxes;
+    Bounds Centroids;
+
+    void Merge(const NodeBounds& Other)
+    {
+        Boxes.Add(Other.Boxes);
+        Centroids.Add(Other.Centroids);
+    }
+};
+
+struct SAHBin
+{
+    Bounds Boxes;
+    Uint32 Count = 0;
+};
+
+struct SAHBins
+{
+    SAHBin Bins[3][MaxBins];
+
+    void Merge(const SAHBins& Other, Uint32 NumBins)
+    {
+        for (int Axis = 0; Axis < 3; ++Axis)
+        {
+            for (Uint32 b = 0; b < NumBins; ++b)
+            {
+                Bins[Axis][b].Boxes.Add(Other.Bins[Axis][b].Boxes);
+                Bins[Axis][b].Count += Other.Bins[Axis][b].Count;
+            }
+        }
+    }
+};
+
+struct SubtreeTask
+{
+    Uint32 NodeIdx;
+    Uint32 First;
+    Uint32 Count;
+    Uint32 Depth;
+};
+
+class BVHBuilder
+{
+public:
+    BVHBuilder(const BoundBox*        Boxes,
+               Uint32                 NumPrims,
+               const BVHBuildAttribs& Attribs,
+               Uint32*                pPrimIndices) :
+        m_pBoxes{Boxes},
+        m_Centroids(NumPrims),
+        m_pPrimIndices{pPrimIndices},
+        m_MaxPrimsInLeaf{std::max(Attribs.MaxPrimsInLeaf, 1u)},
+        m_NumBins{std::min(std::max(Attribs.NumBins, 2u), MaxBins)},
+        m_pThreadPool{Attribs.pThreadPool}
+    {
+        for (Uint32 i = 0; i < NumPrims; ++i)
+            m_Centroids[i] = (Boxes[i].Min + Boxes[i].Max) * 0.5f;
+    }
+
+    // Builds the subtree of the primitives [First, First + Count) at Nodes[NodeIdx].
+    // If pTasks is not null, the subtrees that are small enough are not built, but added to the task list.
+    void BuildSubtree(std::vector<Node>& Nodes, Uint32 NodeIdx, Uint32 First, Uint32 Count, Uint32 Depth, std::vector<SubtreeTask>* pTasks) const
+    {
+        VERIFY_EXPR(Count > 0);
+        // Parallel binning is only used for the top levels of the tree, which are built by one thread
+        const bool UseThreadPool = pTasks != nullptr && Count >= MinPrimsForParallelBinning;
+
+        const NodeBounds NB = ComputeNodeBounds(First, Count, UseThreadPool);
+
+        Node& N = Nodes[NodeIdx];
+        N.Min   = NB.Boxes.Min;
+        N.Max   = NB.Boxes.Max;
+
+        Uint32 SplitAxis = 0;
+        Uint32 SplitBin  = 0;
+        Uint32 NumLeft   = 0;
+        if (Count > 1 && Depth + 1 < BoundingVolumeHierarchy::MaxDepth)
+        {
+            if (FindBestSplit(NB, First, Count, UseThreadPool, SplitAxis, SplitBin))
+            {
+                const float3 CentroidMin = NB.Centroids.Min;
+                const float  BinScale    = GetBinScale(NB, SplitAxis);
+
+                Uint32* const pMid = std::partition(m_pPrimIndices + First, m_pPrimIndices + First + Count, [&](Uint32 PrimIdx) {
+                    return GetBin(m_Centroids[PrimIdx][SplitAxis], CentroidMin[SplitAxis], BinScale) < SplitBin;
+                });
+                NumLeft            = static_cast<Uint32>(pMid - (m_pPrimIndices + First));
+                VERIFY_EXPR(NumLeft > 0 && NumLeft < Count);
+            }
+            else if (Count > m_MaxPrimsInLeaf)
+            {
+                // The primitives cannot be separated by the centroids or the leaf
+                // is cheaper, but there are too many primitives for one leaf.
+                NumLeft = Count / 2;
+            }
+        }
+
+        if (NumLeft == 0)
+        {
+            N.FirstChildOrPrim = First;
+            N.NumPrims         = Count;
+            return;
+        }
+
+        const Uint32 LeftIdx            = static_cast<Uint32>(Nodes.size());
+        Nodes[NodeIdx].FirstChildOrPrim = LeftIdx;
+        Nodes[NodeIdx].NumPrims         = 0;
+        Nodes.resize(Nodes.size() + 2);
+
+        const Uint32 Counts[] = {NumLeft, Count - NumLeft};
+        const Uint32 Firsts[] = {First, First + NumLeft};
+        for (Uint32 Child = 0; Child < 2; ++Child)
+        {
+            if (pTasks != nullptr && Counts[Child] <= m_SubtreeTaskSize)
+                pTasks->push_back({LeftIdx + Child, Firsts[Child], Counts[Child], Depth + 1});
+            else
+                BuildSubtree(Nodes, LeftIdx + Child, Firsts[Child], Counts[Child], Depth + 1, pTasks);
+        }
+    }
+
+    void SetSubtreeTaskSize(Uint32 Size)
+    {
+        m_SubtreeTaskSize = Size;
+    }
+
+private:
+    // Processes the primitives [First, First + Count) with Op, optionally using the thread pool.
+    // OpType must define operator()(Uint32 PrimIdx) and Merge(const OpType&).
+    template <typename OpType>
+    void ProcessPrims(Uint32 First, Uint32 Count, bool UseThreadPool, OpType& Op) const
+    {
+        if (!UseThreadPool || m_pThreadPool == nullptr)
+        {
+            for (Uint32 i = First; i < First + Count; ++i)
+                Op(m_pPrimIndices[i]);
+            return;
+        }
+
+        std::mutex OpMtx;
+        ParallelFor(m_pThreadPool, First, First + Count, MinPrimsPerThread,
+                    [&](size_t ChunkBegin, size_t ChunkEnd) {
+                        OpType ChunkOp{Op.GetIdentity()};
+                        for (size_t i = ChunkBegin; i < ChunkEnd; ++i)
+                            ChunkOp(m_pPrimIndices[i]);
+
+                        std::lock_guard<std::mutex> Lock{OpMtx};
+                        Op.Merge(ChunkOp);
+                    });
+    }
+
+    NodeBounds ComputeNodeBounds(Uint32 First, Uint32 Count, bool UseThreadPool) const
+    {
+        struct BoundsOp
+        {
+            const BVHBuilder& Builder;
+            NodeBounds        NB;
+
+            BoundsOp GetIdentity() const { return BoundsOp{Builder, {}}; }
+
+            void operator()(Uint32 PrimIdx)
+            {
+                NB.Boxes.Add(Builder.m_pBoxes[PrimIdx].Min, Builder.m_pBoxes[PrimIdx].Max);
+                NB.Centroids.Add(Builder.m_Centroids[PrimIdx], Builder.m_Centroids[PrimIdx]);
+            }
+
+            void Merge(const BoundsOp& Other) { NB.Merge(Other.NB); }
+        };
+
+        BoundsOp Op{*this, {}};
+        ProcessPrims(First, Count, UseThreadPool, Op);
+        return Op.NB;
+    }
+
+    float GetBinScale(const NodeBounds& NB, Uint32 Axis) const
+    {
+        const float Extent = NB.Centroids.Max[Axis] - NB.Centroids.Min[Axis];
+        return Extent > 0 ? static_cast<float>(m_NumBins) / Extent : 0.f;
+    }
+
+    Uint32 GetBin(float Centroid, float CentroidMin, float BinScale) const
+    {
+        return std::min(static_cast<Uint32>((Centroid - CentroidMin) * BinScale), m_NumBins - 1);
+    }
+
+    // Finds the SAH split. Returns false if the leaf is cheaper than the best split, or
+    // if the primitives cannot be split by their centroids.
+    bool FindBestSplit(const NodeBounds& NB, Uint32 First, Uint32 Count, bool UseThreadPool, Uint32& BestAxis, Uint32& BestBin) const
+    {
+        const float BinScale[] = {GetBinScale(NB, 0), GetBinScale(NB, 1), GetBinScale(NB, 2)};
+
+        struct BinningOp
+        {
+            const BVHBuilder& Builder;
+            const float*      BinScale;
+            const float3&     CentroidMin;
+
+            std::unique_ptr<SAHBins> pBins{new SAHBins{}};
+
+            BinningOp GetIdentity() const { return BinningOp{Builder, BinScale, CentroidMin}; }
+
+            void operator()(Uint32 PrimIdx)
+            {
+                const float3&   Centroid = Builder.m_Centroids[PrimIdx];
+                const BoundBox& Box      = Builder.m_pBoxes[PrimIdx];
+                for (int Axis = 0; Axis < 3; ++Axis)
+                {
+                    SAHBin& Bin = pBins->Bins[Axis][Builder.GetBin(Centroid[Axis], CentroidMin[Axis], BinScale[Axis])];
+                    Bin.Boxes.Add(Box.Min, Box.Max);
+                    ++Bin.Count;
+                }
+            }
+
+            void Merge(const BinningOp& Other) { pBins->Merge(*Other.pBins, Builder.m_NumBins); }
+        };
+
+        BinningOp Op{*this, BinScale, NB.Centroids.Min};
+        ProcessPrims(First, Count, UseThreadPool, Op);
+
+        // SAH costs are not divided by the node area to handle degenerate boxes
+        const float NodeArea = NB.Boxes.GetHalfArea();
+        float       BestCost = +FLT_MAX;
+        for (Uint32 Axis = 0; Axis < 3; ++Axis)
+        {
+            if (BinScale[Axis] == 0)
+                continue;
+
+            const SAHBin* Bins = Op.pBins->Bins[Axis];
+
+            // Area and count of the primitives to the right of every split plane
+            float  RightCost[MaxBins] = {};
+            Bounds RightBounds;
+            Uint32 RightCount = 0;
+            for (Uint32 b = m_NumBins - 1; b > 0; --b)
+            {
+                RightBounds.Add(Bins[b].Boxes);
+                RightCount += Bins[b].Count;
+                RightCost[b] = RightCount > 0 ? RightBounds.GetHalfArea() * static_cast<float>(RightCount) : -1.f;
+            }
+
+            Bounds LeftBounds;
+            Uint32 LeftCount = 0;
+            for (Uint32 b = 1; b < m_NumBins; ++b)
+            {
+                LeftBounds.Add(Bins[b - 1].Boxes);
+                LeftCount += Bins[b - 1].Count;
+                // Split planes with all primitives on one side are invalid
+                if (LeftCount == 0 || RightCost[b] < 0)
+                    continue;
+
+                const float Cost = LeftBounds.GetHalfArea() * static_cast<float>(LeftCount) + RightCost[b];
+                if (Cost < BestCost)
+                {
+                    BestCost = Cost;
+                    BestAxis = Axis;
+                    BestBin  = b;
+                }
+            }
+        }
+
+        if (BestCost == +FLT_MAX)
+            return false;
+
+        const float LeafCost  = NodeArea * static_cast<float>(Count);
+        const float SplitCost = NodeArea * SAHTraversalCost + BestCost;
+        return Count > m_MaxPrimsInLeaf || SplitCost < LeafCost;
+    }
+
+    const BoundBox* const m_pBoxes;
+    std::vector<float3>   m_Centroids;
+    Uint32* const         m_pPrimIndices;
+
+    const Uint32       m_MaxPrimsInLeaf;
+    const Uint32       m_NumBins;
+    IThreadPool* const m_pThreadPool;
+
+    Uint32 m_SubtreeTaskSize = 0;
+};
+
+} // namespace
+
+void BoundingVolumeHierarchy::Build(const BoundBox* pBoxes, Uint32 NumBoxes, const BVHBuildAttribs& Attribs)
+{
+    Clear();
+    if (NumBoxes == 0)
+        return;
+
+    DEV_CHECK_ERR(pBoxes != nullptr, "Box array must not be null");
+    if (pBoxes == nullptr)
+        return;
+
+    m_PrimIndices.resize(NumBoxes);
+    std::iota(m_PrimIndices.begin(), m_PrimIndices.end(), 0u);
+
+    BVHBuilder Builder{pBoxes, NumBoxes, Attribs, m_PrimIndices.data()};
+
+    m_Nodes.reserve(size_t{NumBoxes} * 2 - 1);
+    m_Nodes.emplace_back();
+    if (Attribs.pThreadPool == nullptr || NumBoxes < MinPrimsPerSubtreeTask * 2)
+    {
+        Builder.BuildSubtree(m_Nodes, 0, 0, NumBoxes, 0, nullptr);
+    }
+    else
+    {
+        // Build the top levels of the tree on this thread, then build the subtrees in parallel
+        std::vector<SubtreeTask> Tasks;
+        Builder.SetSubtreeTaskSize(std::max(NumBoxes / 64, MinPrimsPerSubtreeTask));
+        Builder.BuildSubtree(m_Nodes, 0, 0, NumBoxes, 0, &Tasks);
+
+        std::vector<std::vector<Node>> SubtreeNodes(Tasks.size());
+        {
+            TaskGroup Group{Attribs.pThreadPool};
+            for (size_t i = 0; i < Tasks.size(); ++i)
+            {
+                Group.Run([&Builder, &Task = Tasks[i], &Nodes = SubtreeNodes[i]]() {
+                    Nodes.reserve(size_t{Task.Count} * 2 - 1);
+                    Nodes.emplace_back();
+                    Builder.BuildSubtree(Nodes, 0, Task.First, Task.Count, Task.Depth, nullptr);
+                });
+            }
+            Group.Wait();
+        }
+
+        // Append the subtrees in the order of the tasks, so that the layout is deterministic.
+        // The subtree root replaces the placeholder node, and the remaining nodes are appended.
+        for (size_t i = 0; i < Tasks.size(); ++i)
+        {
+            const std::vector<Node>& Nodes = SubtreeNodes[i];
+
+            const Uint32 Offset  = static_cast<Uint32>(m_Nodes.size()) - 1;
+            auto         MapNode = [Offset](Node N) {
+                if (!N.IsLeaf())
+                    N.FirstChildOrPrim += Offset;
+                return N;
+            };
+
+            m_Nodes[Tasks[i].NodeIdx] = MapNode(Nodes[0]);
+            for (size_t n = 1; n < Nodes.size(); ++n)
+                m_Nodes.push_back(MapNode(Nodes[n]));
+        }
+    }
+
+    m_PrimBoxes.resize(NumBoxes);
+    for (Uint32 i = 0; i < NumBoxes; ++i)
+        m_PrimBoxes[i] = pBoxes[m_PrimIndices[i]];
+}
+
+void BoundingVolumeHierarchy::Refit(const BoundBox* pBoxes)
+{
+    if (m_Nodes.empty())
+        return;
+
+    DEV_CHECK_ERR(pBoxes != nullptr, "Box array must not be null");
+    if (pBoxes == nullptr)
+        return;
+
+    for (size_t i = 0; i < m_PrimIndices.size(); ++i)
+        m_PrimBoxes[i] = pBoxes[m_PrimIndices[i]];
+
+    // Children always follow their parent in the node array
+    for (size_t NodeIdx = m_Nodes.size(); NodeIdx-- > 0;)
+    {
+        Node& N = m_Nodes[NodeIdx];
+
+        Bounds NodeBounds;
+        if (N.IsLeaf())
+        {
+            for (Uint32 i = N.FirstChildOrPrim; i < N.FirstChildOrPrim + N.NumPrims; ++i)
+                NodeBounds.Add(m_PrimBoxes[i].Min, m_PrimBoxes[i].Max);
+        }
+        else
+        {
+            VERIFY_EXPR(N.FirstChildOrPrim > NodeIdx);
+            for (Uint32 Child = N.FirstChildOrPrim; Child < N.FirstChildOrPrim + 2; ++Child)
+                NodeBounds.Add(m_Nodes[Child].Min, m_Nodes[Child].Max);
+        }
+        N.Min = NodeBounds.Min;
+        N.Max = NodeBounds.Max;
+    }
+}
+
+void BoundingVolumeHierarchy::Clear()
+{
+    m_Nodes.clear();
+    m_PrimIndices.clear();
+    m_PrimBoxes.clear();
+}
+
+Uint32 BoundingVolumeHierarchy::FindNearestBox(const float3& Pos, float& Distance, float MaxDistance) const
+{
+    Distance = MaxDistance;
+    if (m_Nodes.empty())
+        return InvalidIndex;
+
+    Uint32 NearestPrim    = InvalidIndex;
+    float  NearestDistSqr = MaxDistance * MaxDistance;
+
+    StackEntry StackBuffer[MaxDepth + 1];
+    Uint32     StackSize = 0;
+
+    StackBuffer[StackSize++] = {0, GetPointToBoxDistanceSqr(m_Nodes[0].GetBox(), Pos)};
+    while (StackSize > 0)
+    {
+        const StackEntry Entry = StackBuffer[--StackSize];
+        if (Entry.Distance >= NearestDistSqr)
+            continue;
+
+        Uint32 NodeIdx = Entry.NodeIdx;
+        while (true)
+        {
+            const Node& N = m_Nodes[NodeIdx];
+            if (N.IsLeaf())
+            {
+                for (Uint32 i = N.FirstChildOrPrim; i < N.FirstChildOrPrim + N.NumPrims; ++i)
+                {
+                    const float DistSqr = GetPointToBoxDistanceSqr(m_PrimBoxes[i], Pos);
+                    if (DistSqr < NearestDistSqr)
+                    {
+                        NearestDistSqr = DistSqr;
+                        NearestPrim    = m_PrimIndices[i];
+                    }
+                }
+                break;
+            }
+
+            // Visit the closer child first, and push the other one to the stack
+            Uint32 Child0 = N.FirstChildOrPrim;
+            Uint32 Child1 = N.FirstChildOrPrim + 1;
+            float  Dist0  = GetPointToBoxDistanceSqr(m_Nodes[Child0].GetBox(), Pos);
+            float  Dist1  = GetPointToBoxDistanceSqr(m_Nodes[Child1].GetBox(), Pos);
+            if (Dist1 < Dist0)
+            {
+                std::swap(Child0, Child1);
+                std::swap(Dist0, Dist1);
+            }
+
+            if (Dist0 >= NearestDistSqr)
+                break;
+
+            if (Dist1 < NearestDistSqr)
+            {
+                VERIFY_EXPR(StackSize <= MaxDepth);
+                StackBuffer[StackSize++] = {Child1, Dist1};
+            }
+            NodeIdx = Child0;
+        }
+    }
+
+    if (NearestPrim != InvalidIndex)
+        Distance = std::sqrt(NearestDistSqr);
+
+    return NearestPrim;
+}
+
+} // namespace Diligent
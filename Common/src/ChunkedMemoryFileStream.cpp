@@ -0,0 +1,243 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+#include "ChunkedMemoryFileStream.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "DefaultRawMemoryAllocator.hpp"
+
+namespace Diligent
+{
+
+RefCntAutoPtr<ChunkedMemoryFileStream> ChunkedMemoryFileStream::Create(size_t            InitialChunkSize,
+                                                                       size_t            MaxChunkSize,
+                                                                       IMemoryAllocator* pAllocator)
+{
+    return RefCntAutoPtr<ChunkedMemoryFileStream>{MakeNewRCObj<ChunkedMemoryFileStream>()(InitialChunkSize, MaxChunkSize, pAllocator)};
+}
+
+ChunkedMemoryFileStream::ChunkedMemoryFileStream(IReferenceCounters* pRefCounters,
+                                                 size_t              InitialChunkSize,
+                                                 size_t              MaxChunkSize,
+                                                 IMemoryAllocator*   pAllocator) :
+    TBase{pRefCounters},
+    m_Allocator{pAllocator != nullptr ? *pAllocator : DefaultRawMemoryAllocator::GetAllocator()},
+    m_InitialChunkSize{std::max(InitialChunkSize, size_t{1})},
+    m_MaxChunkSize{std::max(MaxChunkSize, m_InitialChunkSize)}
+{
+}
+
+IMPLEMENT_QUERY_INTERFACE(ChunkedMemoryFileStream, IID_FileStream, TBase)
+
+void ChunkedMemoryFileStream::AddChunk(size_t MinSize)
+{
+    // Double the stream capacity with every new chunk until the maximum chunk size is reached.
+    // Large writes get a chunk of their own size so that they are never split.
+    const size_t ChunkSize = std::max(std::min(std::max(m_Size, m_InitialChunkSize), m_MaxChunkSize), MinSize);
+
+    RefCntAutoPtr<AlignedDataBlob> pChunk = AlignedDataBlob::Create(0, nullptr, AlignedDataBlob::DefaultAlignment, &m_Allocator);
+    pChunk->Reserve(ChunkSize);
+
+    m_ChunkOffsets.push_back(m_Size);
+    m_Chunks.emplace_back(std::move(pChunk));
+}
+
+Uint32 ChunkedMemoryFileStream::FindChunk(size_t Offset) const
+{
+    VERIFY_EXPR(Offset < m_Size);
+    // Find the last chunk that starts at or before Offset
+    auto it = std::upper_bound(m_ChunkOffsets.begin(), m_ChunkOffsets.end(), Offset);
+    VERIFY_EXPR(it != m_ChunkOffsets.begin());
+    return static_cast<Uint32>(it - m_ChunkOffsets.begin() - 1);
+}
+
+bool ChunkedMemoryFileStream::Read(void* Data, size_t Size)
+{
+    VERIFY_EXPR(m_Pos <= m_Size);
+    const size_t BytesToRead = std::min(Size, m_Size - m_Pos);
+
+    Uint8* pDst      = static_cast<Uint8*>(Data);
+    size_t BytesLeft = BytesToRead;
+    while (BytesLeft > 0)
+    {
+        const Uint32           ChunkIdx = FindChunk(m_Pos);
+        const AlignedDataBlob& Chunk    = *m_Chunks[ChunkIdx];
+        const size_t           ChunkPos = m_Pos - m_ChunkOffsets[ChunkIdx];
+        const size_t           CopySize = std::min(BytesLeft, Chunk.GetSize() - ChunkPos);
+        std::memcpy(pDst, Chunk.GetConstDataPtr(ChunkPos), CopySize);
+        pDst += CopySize;
+        m_Pos += CopySize;
+        BytesLeft -= CopySize;
+    }
+
+    return BytesToRead == Size;
+}
+
+void ChunkedMemoryFileStream::ReadBlob(IDataBlob* pData)
+{
+    VERIFY_EXPR(pData != nullptr);
+    pData->Resize(m_Size - m_Pos);
+    if (pData->GetSize() > 0)
+    {
+        bool res = Read(pData->GetDataPtr(), pData->GetSize());
+        VERIFY_EXPR(res);
+        (void)res;
+    }
+}
+
+bool ChunkedMemoryFileStream::Write(const void* Data, size_t Size)
+{
+    const Uint8* pSrc = static_cast<const Uint8*>(Data);
+
+    // Overwrite the existing data
+    while (Size > 0 && m_Pos < m_Size)
+    {
+        const Uint32     ChunkIdx = FindChunk(m_Pos);
+        AlignedDataBlob& Chunk    = *m_Chunks[ChunkIdx];
+        const size_t     ChunkPos = m_Pos - m_ChunkOffsets[ChunkIdx];
+        const size_t     CopySize = std::min(Size, Chunk.GetSize() - ChunkPos);
+        std::memcpy(Chunk.GetDataPtr(ChunkPos), pSrc, CopySize);
+        pSrc += CopySize;
+        m_Pos += CopySize;
+        Size -= CopySize;
+    }
+
+    // Append the rest
+    while (Size > 0)
+    {
+        if (m_Chunks.empty() || m_Chunks.back()->GetSize() == m_Chunks.back()->GetCapacity())
+            AddChunk(Size);
+
+        AlignedDataBlob& Chunk    = *m_Chunks.back();
+        const size_t     ChunkPos = Chunk.GetSize();
+        const size_t     CopySize = std::min(Size, Chunk.GetCapacity() - ChunkPos);
+        // Growing within the capacity neither reallocates nor initializes the memory
+        Chunk.Resize(ChunkPos + CopySize);
+        std::memcpy(Chunk.GetDataPtr(ChunkPos), pSrc, CopySize);
+        pSrc += CopySize;
+        m_Pos += CopySize;
+        m_Size += CopySize;
+        Size -= CopySize;
+    }
+
+    return true;
+}
+
+bool ChunkedMemoryFileStream::IsValid()
+{
+    return true;
+}
+
+size_t ChunkedMemoryFileStream::GetSize()
+{
+    return m_Size;
+}
+
+size_t ChunkedMemoryFileStream::GetPos()
+{
+    return m_Pos;
+}
+
+bool ChunkedMemoryFileStream::SetPos(size_t Offset, int Origin)
+{
+    size_t Base = 0;
+    switch (static_cast<FilePosOrigin>(Origin))
+    {
+        // clang-format off
+        case FilePosOrigin::Start: Base = 0;      break;
+        case FilePosOrigin::Curr:  Base = m_Pos;  break;
+        case FilePosOrigin::End:   Base = m_Size; break;
+        // clang-format on
+        default:
+            UNEXPECTED("Unknown origin");
+            return false;
+    }
+
+    // Negative offsets are passed as wrapped-around unsigned values
+    const size_t NewPos = Base + Offset;
+    if (NewPos > m_Size)
+        return false;
+
+    m_Pos = NewPos;
+    return true;
+}
+
+ChunkedMemoryFileStream::Chunk ChunkedMemoryFileStream::GetChunk(Uint32 Index) const
+{
+    VERIFY(Index < m_Chunks.size(), "Chunk index (", Index, ") is out of range");
+    const AlignedDataBlob& Chunk = *m_Chunks[Index];
+    return {Chunk.GetConstDataPtr(), Chunk.GetSize()};
+}
+
+bool ChunkedMemoryFileStream::WriteTo(IFileStream* pDstStream) const
+{
+    DEV_CHECK_ERR(pDstStream != nullptr, "Destination stream must not be null");
+    for (const RefCntAutoPtr<AlignedDataBlob>& pChunk : m_Chunks)
+    {
+        if (!pDstStream->Write(pChunk->GetConstDataPtr(), pChunk->GetSize()))
+            return false;
+    }
+    return true;
+}
+
+RefCntAutoPtr<IDataBlob> ChunkedMemoryFileStream::DetachData()
+{
+    RefCntAutoPtr<AlignedDataBlob> pData;
+    if (m_Chunks.size() == 1)
+    {
+        // The only chunk is handed over to the caller without copying
+        pData = std::move(m_Chunks[0]);
+        VERIFY_EXPR(pData->GetSize() == m_Size);
+    }
+    else
+    {
+        pData = AlignedDataBlob::Create(m_Size, nullptr, AlignedDataBlob::DefaultAlignment, &m_Allocator);
+        for (size_t i = 0; i < m_Chunks.size(); ++i)
+        {
+            const AlignedDataBlob& Chunk = *m_Chunks[i];
+            std::memcpy(pData->GetDataPtr(m_ChunkOffsets[i]), Chunk.GetConstDataPtr(), Chunk.GetSize());
+        }
+    }
+
+    // The stream does not keep any reference to the returned blob
+    Reset();
+
+    return RefCntAutoPtr<IDataBlob>{std::move(pData)};
+}
+
+void ChunkedMemoryFileStream::Reset()
+{
+    m_Chunks.clear();
+    m_ChunkOffsets.clear();
+    m_Size = 0;
+    m_Pos  = 0;
+}
+
+} // namespace Diligent
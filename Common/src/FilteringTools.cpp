@@ -0,0 +1,341 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FilteringTools.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "Intrinsics.hpp"
+#include "PlatformMisc.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Computes the first and the second sample indices and the blend weights for the coordinates
+// before the texture address mode is applied. Coordinates are multiplied by Scale.
+using ComputeLinearFilterCoordsFn = void (*)(const float* pCoords, size_t Count, float Scale, Int32* pI0, Int32* pI1, float* pW);
+
+// Blends bilinear samples of a float texture, see FilterTexture2DBilinearSamples.
+using BlendBilinearSamplesFn = void (*)(const float*                        pData,
+                                        size_t                              Stride,
+                                        const LinearTexFilterSampleInfoSoA& UFilterInfo,
+                                        const LinearTexFilterSampleInfoSoA& VFilterInfo,
+                                        size_t                              NumSamples,
+                                        float*                              pDst);
+
+void ComputeLinearFilterCoordsScalar(const float* pCoords, size_t Count, float Scale, Int32* pI0, Int32* pI1, float* pW)
+{
+    for (size_t i = 0; i < Count; ++i)
+    {
+        // Same as in GetLinearTexFilterSampleInfo
+        float x  = pCoords[i] * Scale;
+        float x0 = FastFloor(x - 0.5f);
+
+        pI0[i] = static_cast<Int32>(x0);
+        pI1[i] = static_cast<Int32>(x0 + 1);
+        pW[i]  = x - 0.5f - x0;
+    }
+}
+
+#if DILIGENT_SSE2_ENABLED
+void ComputeLinearFilterCoordsSSE2(const float* pCoords, size_t Count, float Scale, Int32* pI0, Int32* pI1, float* pW)
+{
+    const __m128 mScale = _mm_set1_ps(Scale);
+    const __m128 mHalf  = _mm_set1_ps(0.5f);
+    const __m128 mOne   = _mm_set1_ps(1.f);
+
+    size_t i = 0;
+    for (; i + 4 <= Count; i += 4)
+    {
+        const __m128 mX     = _mm_mul_ps(_mm_loadu_ps(pCoords + i), mScale);
+        const __m128 mXHalf = _mm_sub_ps(mX, mHalf);
+
+        // floor(x - 0.5): truncate and subtract one if the truncated value is greater (see FastFloor)
+        __m128 mX0 = _mm_cvtepi32_ps(_mm_cvttps_epi32(mXHalf));
+        mX0        = _mm_sub_ps(mX0, _mm_and_ps(_mm_cmpgt_ps(mX0, mXHalf), mOne));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pI0 + i), _mm_cvttps_epi32(mX0));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pI1 + i), _mm_cvttps_epi32(_mm_add_ps(mX0, mOne)));
+        _mm_storeu_ps(pW + i, _mm_sub_ps(mXHalf, mX0));
+    }
+    ComputeLinearFilterCoordsScalar(pCoords + i, Count - i, Scale, pI0 + i, pI1 + i, pW + i);
+}
+#endif
+
+#if DILIGENT_AVX2_SUPPORTED
+DILIGENT_TARGET_AVX2 void ComputeLinearFilterCoordsAVX2(const float* pCoords, size_t Count, float Scale, Int32* pI0, Int32* pI1, float* pW)
+{
+    const __m256 mmScale = _mm256_set1_ps(Scale);
+    const __m256 mmHalf  = _mm256_set1_ps(0.5f);
+    const __m256 mmOne   = _mm256_set1_ps(1.f);
+
+    size_t i = 0;
+    for (; i + 8 <= Count; i += 8)
+    {
+        const __m256 mmX     = _mm256_mul_ps(_mm256_loadu_ps(pCoords + i), mmScale);
+        const __m256 mmXHalf = _mm256_sub_ps(mmX, mmHalf);
+
+        // floor(x - 0.5): truncate and subtract one if the truncated value is greater (see FastFloor)
+        __m256 mmX0 = _mm256_cvtepi32_ps(_mm256_cvttps_epi32(mmXHalf));
+        mmX0        = _mm256_sub_ps(mmX0, _mm256_and_ps(_mm256_cmp_ps(mmX0, mmXHalf, _CMP_GT_OQ), mmOne));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pI0 + i), _mm256_cvttps_epi32(mmX0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(pI1 + i), _mm256_cvttps_epi32(_mm256_add_ps(mmX0, mmOne)));
+        _mm256_storeu_ps(pW + i, _mm256_sub_ps(mmXHalf, mmX0));
+    }
+
+    for (; i < Count; ++i)
+    {
+        float x  = pCoords[i] * Scale;
+        float x0 = FastFloor(x - 0.5f);
+
+        pI0[i] = static_cast<Int32>(x0);
+        pI1[i] = static_cast<Int32>(x0 + 1);
+        pW[i]  = x - 0.5f - x0;
+    }
+}
+
+DILIGENT_TARGET_AVX2 void BlendBilinearSamplesAVX2(const float*                        pData,
+                                                   size_t                              Stride,
+                                                   const LinearTexFilterSampleInfoSoA& UFilterInfo,
+                                                   const LinearTexFilterSampleInfoSoA& VFilterInfo,
+                                                   size_t                              NumSamples,
+                                                   float*                              pDst)
+{
+    // The caller guarantees that all offsets fit into 32-bit signed integers
+    const __m256i mmStride = _mm256_set1_epi32(static_cast<int>(Stride));
+    const __m256  mmOne    = _mm256_set1_ps(1.f);
+
+    size_t i = 0;
+    for (; i + 8 <= NumSamples; i += 8)
+    {
+        const __m256i mmU0   = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(UFilterInfo.pI0 + i));
+        const __m256i mmU1   = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(UFilterInfo.pI1 + i));
+        const __m256i mmRow0 = _mm256_mullo_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(VFilterInfo.pI0 + i)), mmStride);
+        const __m256i mmRow1 = _mm256_mullo_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(VFilterInfo.pI1 + i)), mmStride);
+
+        const __m256 mmS00 = _mm256_i32gather_ps(pData, _mm256_add_epi32(mmU0, mmRow0), 4);
+        const __m256 mmS10 = _mm256_i32gather_ps(pData, _mm256_add_epi32(mmU1, mmRow0), 4);
+        const __m256 mmS01 = _mm256_i32gather_ps(pData, _mm256_add_epi32(mmU0, mmRow1), 4);
+        const __m256 mmS11 = _mm256_i32gather_ps(pData, _mm256_add_epi32(mmU1, mmRow1), 4);
+
+        // lerp(Left, Right, w) = Left * (1 - w) + Right * w
+        const __m256 mmWu  = _mm256_loadu_ps(UFilterInfo.pW + i);
+        const __m256 mmWv  = _mm256_loadu_ps(VFilterInfo.pW + i);
+        const __m256 mmWu1 = _mm256_sub_ps(mmOne, mmWu);
+        const __m256 mmWv1 = _mm256_sub_ps(mmOne, mmWv);
+
+        const __m256 mmRow0Val = _mm256_add_ps(_mm256_mul_ps(mmS00, mmWu1), _mm256_mul_ps(mmS10, mmWu));
+        const __m256 mmRow1Val = _mm256_add_ps(_mm256_mul_ps(mmS01, mmWu1), _mm256_mul_ps(mmS11, mmWu));
+        _mm256_storeu_ps(pDst + i, _mm256_add_ps(_mm256_mul_ps(mmRow0Val, mmWv1), _mm256_mul_ps(mmRow1Val, mmWv)));
+    }
+
+    if (i < NumSamples)
+    {
+        const LinearTexFilterSampleInfoSoA UTail{UFilterInfo.pI0 + i, UFilterInfo.pI1 + i, UFilterInfo.pW + i};
+        const LinearTexFilterSampleInfoSoA VTail{VFilterInfo.pI0 + i, VFilterInfo.pI1 + i, VFilterInfo.pW + i};
+        FilterTexture2DBilinearSamples<float, float>(pData, Stride, UTail, VTail, NumSamples - i, pDst + i);
+    }
+}
+#endif
+
+#if DILIGENT_NEON_ENABLED
+void ComputeLinearFilterCoordsNEON(const float* pCoords, size_t Count, float Scale, Int32* pI0, Int32* pI1, float* pW)
+{
+    const float32x4_t Half4 = vdupq_n_f32(0.5f);
+    const float32x4_t One4  = vdupq_n_f32(1.f);
+
+    size_t i = 0;
+    for (; i + 4 <= Count; i += 4)
+    {
+        const float32x4_t X4     = vmulq_n_f32(vld1q_f32(pCoords + i), Scale);
+        const float32x4_t XHalf4 = vsubq_f32(X4, Half4);
+
+        // floor(x - 0.5): truncate and subtract one if the truncated value is greater (see FastFloor)
+        float32x4_t X04 = vcvtq_f32_s32(vcvtq_s32_f32(XHalf4));
+        X04             = vsubq_f32(X04, vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(X04, XHalf4), vreinterpretq_u32_f32(One4))));
+
+        vst1q_s32(pI0 + i, vcvtq_s32_f32(X04));
+        vst1q_s32(pI1 + i, vcvtq_s32_f32(vaddq_f32(X04, One4)));
+        vst1q_f32(pW + i, vsubq_f32(XHalf4, X04));
+    }
+    ComputeLinearFilterCoordsScalar(pCoords + i, Count - i, Scale, pI0 + i, pI1 + i, pW + i);
+}
+#endif
+
+struct FilteringKernels
+{
+    ComputeLinearFilterCoordsFn ComputeLinearFilterCoords = ComputeLinearFilterCoordsScalar;
+    BlendBilinearSamplesFn      BlendBilinearSamples      = nullptr;
+};
+
+FilteringKernels SelectFilteringKernels()
+{
+    FilteringKernels Kernels;
+#if DILIGENT_SSE2_ENABLED
+    Kernels.ComputeLinearFilterCoords = ComputeLinearFilterCoordsSSE2;
+#elif DILIGENT_NEON_ENABLED
+    Kernels.ComputeLinearFilterCoords = ComputeLinearFilterCoordsNEON;
+#endif
+
+#if DILIGENT_AVX2_SUPPORTED
+    if (PlatformMisc::GetCPUFeatures().AVX2)
+    {
+        Kernels.ComputeLinearFilterCoords = ComputeLinearFilterCoordsAVX2;
+        Kernels.BlendBilinearSamples      = BlendBilinearSamplesAVX2;
+    }
+#endif
+
+    return Kernels;
+}
+
+const FilteringKernels& GetFilteringKernels()
+{
+    static const FilteringKernels Kernels = SelectFilteringKernels();
+    return Kernels;
+}
+
+template <TEXTURE_ADDRESS_MODE AddressMode>
+void ApplyTexAddressMode(Int32* pIndices, size_t Count, Uint32 Width)
+{
+    const Int32 w = static_cast<Int32>(Width);
+    switch (AddressMode)
+    {
+        case TEXTURE_ADDRESS_WRAP:
+            if ((Width & (Width - 1)) == 0)
+            {
+                // Two's complement makes masking correct for negative indices too
+                for (size_t i = 0; i < Count; ++i)
+                    pIndices[i] &= w - 1;
+            }
+            else
+            {
+                for (size_t i = 0; i < Count; ++i)
+                    pIndices[i] = WrapTexCoordIndex(pIndices[i], Width);
+            }
+            break;
+
+        case TEXTURE_ADDRESS_MIRROR:
+            if ((Width & (Width - 1)) == 0)
+            {
+                for (size_t i = 0; i < Count; ++i)
+                {
+                    const Int32 j = pIndices[i] & (w * 2 - 1);
+                    pIndices[i]   = j >= w ? (w * 2 - 1) - j : j;
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < Count; ++i)
+                    pIndices[i] = MirrorTexCoordIndex(pIndices[i], Width);
+            }
+            break;
+
+        case TEXTURE_ADDRESS_CLAMP:
+            for (size_t i = 0; i < Count; ++i)
+                pIndices[i] = std::min(std::max(pIndices[i], 0), w - 1);
+            break;
+
+        default:
+            break;
+    }
+}
+
+} // namespace
+
+void GetLinearTexFilterSampleInfoBatch(TEXTURE_ADDRESS_MODE                AddressMode,
+                                       bool                                IsNormalizedCoord,
+                                       Uint32                              Width,
+                                       const float*                        pCoords,
+                                       size_t                              NumSamples,
+                                       const LinearTexFilterSampleInfoSoA& SampleInfo)
+{
+    if (NumSamples == 0)
+        return;
+
+    DEV_CHECK_ERR(pCoords != nullptr && SampleInfo.pI0 != nullptr && SampleInfo.pI1 != nullptr && SampleInfo.pW != nullptr,
+                  "Coordinates and sample info arrays must not be null");
+
+    const float Scale = IsNormalizedCoord ? static_cast<float>(Width) : 1.f;
+    GetFilteringKernels().ComputeLinearFilterCoords(pCoords, NumSamples, Scale, SampleInfo.pI0, SampleInfo.pI1, SampleInfo.pW);
+
+    switch (AddressMode)
+    {
+        case TEXTURE_ADDRESS_UNKNOWN:
+            // do nothing
+            break;
+
+        case TEXTURE_ADDRESS_WRAP:
+            ApplyTexAddressMode<TEXTURE_ADDRESS_WRAP>(SampleInfo.pI0, NumSamples, Width);
+            ApplyTexAddressMode<TEXTURE_ADDRESS_WRAP>(SampleInfo.pI1, NumSamples, Width);
+            break;
+
+        case TEXTURE_ADDRESS_MIRROR:
+            ApplyTexAddressMode<TEXTURE_ADDRESS_MIRROR>(SampleInfo.pI0, NumSamples, Width);
+            ApplyTexAddressMode<TEXTURE_ADDRESS_MIRROR>(SampleInfo.pI1, NumSamples, Width);
+            break;
+
+        case TEXTURE_ADDRESS_CLAMP:
+            ApplyTexAddressMode<TEXTURE_ADDRESS_CLAMP>(SampleInfo.pI0, NumSamples, Width);
+            ApplyTexAddressMode<TEXTURE_ADDRESS_CLAMP>(SampleInfo.pI1, NumSamples, Width);
+            break;
+
+        default:
+            UNEXPECTED("Unexpected texture address mode");
+    }
+}
+
+void FilterTexture2DBilinearSamples(const float*                        pData,
+                                    size_t                              Stride,
+                                    const LinearTexFilterSampleInfoSoA& UFilterInfo,
+                                    const LinearTexFilterSampleInfoSoA& VFilterInfo,
+                                    size_t                              NumSamples,
+                                    float*                              pDst)
+{
+    const BlendBilinearSamplesFn BlendBilinearSamples = GetFilteringKernels().BlendBilinearSamples;
+
+    // Gather instructions use 32-bit signed offsets, so the row offsets must fit into them
+    if (BlendBilinearSamples != nullptr && Stride <= static_cast<size_t>(std::numeric_limits<Int32>::max()))
+    {
+        Int32 MaxRow = 0;
+        for (size_t i = 0; i < NumSamples; ++i)
+            MaxRow = std::max(MaxRow, std::max(VFilterInfo.pI0[i], VFilterInfo.pI1[i]));
+
+        if (static_cast<Uint64>(MaxRow + 1) * Stride <= static_cast<Uint64>(std::numeric_limits<Int32>::max()))
+        {
+            BlendBilinearSamples(pData, Stride, UFilterInfo, VFilterInfo, NumSamples, pDst);
+            return;
+        }
+    }
+
+    FilterTexture2DBilinearSamples<float, float>(pData, Stride, UFilterInfo, VFilterInfo, NumSamples, pDst);
+}
+
+} // namespace Diligent
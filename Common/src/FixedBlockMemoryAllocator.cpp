@@ -27,6 +27,8 @@
 
 #include "pch.h"
 #include <algorithm>
+#include <atomic>
+#include <thread>
 #include "FixedBlockMemoryAllocator.hpp"
 #include "Align.hpp"
 
@@ -175,10 +177,12 @@ FixedBlockMemoryAllocator::FixedBlockMemoryAllocator(IMemoryAllocator& RawMemory
     // clang-format off
     m_PagePool          (STD_ALLOCATOR_RAW_MEM(MemoryPage, RawMemoryAllocator, "Allocator for vector<MemoryPage>")),
     m_AvailablePages    (STD_ALLOCATOR_RAW_MEM(size_t, RawMemoryAllocator, "Allocator for unordered_set<size_t>") ),
-    m_AddrToPageId      (STD_ALLOCATOR_RAW_MEM(AddrToPageIdMapElem, RawMemoryAllocator, "Allocator for unordered_map<void*, size_t>")),
+    m_PageDescs         (STD_ALLOCATOR_RAW_MEM(PageDesc*, RawMemoryAllocator, "Allocator for vector<PageDesc*>")),
+    m_PageDirs          (STD_ALLOCATOR_RAW_MEM(PageDirEntry*, RawMemoryAllocator, "Allocator for vector<PageDirEntry*>")),
     m_RawMemoryAllocator{RawMemoryAllocator        },
     m_BlockSize         {AdjustBlockSize(BlockSize)},
-    m_NumBlocksInPage   {NumBlocksInPage           }
+    m_NumBlocksInPage   {NumBlocksInPage           },
+    m_CacheBatchSize    {std::max(std::min(NumBlocksInPage / 4, MaxCacheBatchSize), 1u)}
 // clang-format on
 {
     // Allocate one page
@@ -190,6 +194,13 @@ FixedBlockMemoryAllocator::FixedBlockMemoryAllocator(IMemoryAllocator& RawMemory
 
 FixedBlockMemoryAllocator::~FixedBlockMemoryAllocator()
 {
+    // Return all cached blocks to the pages
+    for (ThreadCache& Cache : m_ThreadCaches)
+    {
+        Threading::SpinLockGuard CacheGuard{Cache.Lock};
+        FlushCache(Cache, Cache.NumBlocks);
+    }
+
 #ifdef DILIGENT_DEBUG
     for (size_t p = 0; p < m_PagePool.size(); ++p)
     {
@@ -197,14 +208,168 @@ FixedBlockMemoryAllocator::~FixedBlockMemoryAllocator()
         VERIFY(m_AvailablePages.find(p) != m_AvailablePages.end(), "Memory page is not in the available page pool");
     }
 #endif
+
+    for (PageDesc* pDesc : m_PageDescs)
+        m_RawMemoryAllocator.Free(pDesc);
+    for (PageDirEntry* pDir : m_PageDirs)
+        m_RawMemoryAllocator.Free(pDir);
 }
 
 void FixedBlockMemoryAllocator::CreateNewPage()
 {
     VERIFY_EXPR(m_BlockSize > 0);
     m_PagePool.emplace_back(*this);
-    m_AvailablePages.insert(m_PagePool.size() - 1);
-    m_AddrToPageId.reserve(m_PagePool.size() * m_NumBlocksInPage);
+    const size_t PageId = m_PagePool.size() - 1;
+    m_AvailablePages.insert(PageId);
+
+    // The descriptor and the block states are allocated together
+    const size_t NumStateWords = (m_NumBlocksInPage + 31) / 32;
+    const size_t StatesOffset  = AlignUp(sizeof(PageDesc), alignof(std::atomic<Uint32>));
+    void*        pDescMem      = m_RawMemoryAllocator.Allocate(StatesOffset + NumStateWords * sizeof(std::atomic<Uint32>), "FixedBlockMemoryAllocator page descriptor", __FILE__, __LINE__);
+
+    PageDesc* pDesc     = new (pDescMem) PageDesc{};
+    pDesc->pStart       = static_cast<const Uint8*>(m_PagePool[PageId].GetBlockStartAddress(0));
+    pDesc->PageId       = PageId;
+    pDesc->pBlockStates = reinterpret_cast<std::atomic<Uint32>*>(static_cast<Uint8*>(pDescMem) + StatesOffset);
+    for (size_t i = 0; i < NumStateWords; ++i)
+        new (&pDesc->pBlockStates[i]) std::atomic<Uint32>{0};
+    m_PageDescs.push_back(pDesc);
+
+    // Insert the descriptor into the directory
+    const size_t  DirSize = m_PageDirSize.load(std::memory_order_relaxed);
+    PageDirEntry* pDir    = m_pPageDir.load(std::memory_order_relaxed);
+    if (DirSize == m_PageDirCapacity)
+    {
+        // Readers do not modify the directory, so the new one does not need to be versioned
+        const size_t NewCapacity = std::max(m_PageDirCapacity * 2, size_t{16});
+        PageDirEntry* pNewDir    = static_cast<PageDirEntry*>(m_RawMemoryAllocator.Allocate(NewCapacity * sizeof(PageDirEntry), "FixedBlockMemoryAllocator page directory", __FILE__, __LINE__));
+        for (size_t i = 0; i < NewCapacity; ++i)
+            new (&pNewDir[i]) PageDirEntry{i < DirSize ? pDir[i].load(std::memory_order_relaxed) : nullptr};
+        m_PageDirs.push_back(pNewDir);
+        m_PageDirCapacity = NewCapacity;
+
+        pDir = pNewDir;
+        m_pPageDir.store(pDir, std::memory_order_release);
+    }
+
+    const Uint32 Version = m_PageDirVersion.load(std::memory_order_relaxed);
+    m_PageDirVersion.store(Version + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    size_t Pos = DirSize;
+    for (; Pos > 0 && pDir[Pos - 1].load(std::memory_order_relaxed)->pStart > pDesc->pStart; --Pos)
+        pDir[Pos].store(pDir[Pos - 1].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    pDir[Pos].store(pDesc, std::memory_order_release);
+    // The directory size is published after the directory pointer, so that a reader
+    // that sees the new size also sees the directory that is large enough.
+    m_PageDirSize.store(DirSize + 1, std::memory_order_release);
+
+    m_PageDirVersion.store(Version + 2, std::memory_order_release);
+}
+
+const FixedBlockMemoryAllocator::PageDesc* FixedBlockMemoryAllocator::FindPage(const void* Ptr) const
+{
+    const Uint8* pBlock   = static_cast<const Uint8*>(Ptr);
+    const size_t PageSize = m_BlockSize * m_NumBlocksInPage;
+
+    while (true)
+    {
+        const Uint32 Version = m_PageDirVersion.load(std::memory_order_acquire);
+        if ((Version & 1u) != 0)
+        {
+            // The directory is being modified
+            std::this_thread::yield();
+            continue;
+        }
+
+        const size_t        DirSize = m_PageDirSize.load(std::memory_order_acquire);
+        const PageDirEntry* pDir    = m_pPageDir.load(std::memory_order_acquire);
+
+        // Find the last page that starts at or before the block
+        size_t First = 0;
+        size_t Count = DirSize;
+        while (Count > 0)
+        {
+            const size_t Step = Count / 2;
+            if (pDir[First + Step].load(std::memory_order_acquire)->pStart <= pBlock)
+            {
+                First += Step + 1;
+                Count -= Step + 1;
+            }
+            else
+            {
+                Count = Step;
+            }
+        }
+
+        const PageDesc* pPage = First > 0 ? pDir[First - 1].load(std::memory_order_acquire) : nullptr;
+        if (pPage != nullptr && pBlock >= pPage->pStart + PageSize)
+            pPage = nullptr;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_PageDirVersion.load(std::memory_order_relaxed) == Version)
+            return pPage;
+    }
+}
+
+FixedBlockMemoryAllocator::ThreadCache& FixedBlockMemoryAllocator::GetThreadCache()
+{
+    // Threads are assigned to the caches in a round-robin fashion when they first use any allocator
+    static std::atomic<Uint32> NextCacheIdx{0};
+    static thread_local Uint32 CacheIdx = NextCacheIdx.fetch_add(1) % NumThreadCaches;
+    return m_ThreadCaches[CacheIdx];
+}
+
+void FixedBlockMemoryAllocator::RefillCache(ThreadCache& Cache)
+{
+    VERIFY_EXPR(Cache.NumBlocks == 0);
+
+    std::lock_guard<std::mutex> LockGuard(m_Mutex);
+    for (Uint32 i = 0; i < m_CacheBatchSize; ++i)
+    {
+        if (m_AvailablePages.empty())
+        {
+            CreateNewPage();
+        }
+
+        auto        PageId = *m_AvailablePages.begin();
+        MemoryPage& Page   = m_PagePool[PageId];
+        void*       Ptr    = Page.Allocate();
+        if (!Page.HasSpace())
+        {
+            m_AvailablePages.erase(m_AvailablePages.begin());
+        }
+
+        // The block allocated first must be at the end of the cache so that it is returned first
+        const PageDesc* pPage                  = m_PageDescs[PageId];
+        Cache.Blocks[m_CacheBatchSize - 1 - i] = {Ptr, pPage, static_cast<size_t>(static_cast<const Uint8*>(Ptr) - pPage->pStart) / m_BlockSize};
+    }
+    Cache.NumBlocks = m_CacheBatchSize;
+}
+
+void FixedBlockMemoryAllocator::FlushCache(ThreadCache& Cache, Uint32 NumBlocks)
+{
+    VERIFY_EXPR(NumBlocks <= Cache.NumBlocks);
+    if (NumBlocks == 0)
+        return;
+
+    {
+        std::lock_guard<std::mutex> LockGuard(m_Mutex);
+        // Release the least recently used blocks. The blocks are released in the order
+        // opposite to the one they would have been allocated from the cache, so that the
+        // page returns them in the same order.
+        for (Uint32 i = 0; i < NumBlocks; ++i)
+        {
+            const CachedBlock& Block  = Cache.Blocks[i];
+            const size_t       PageId = Block.pPage->PageId;
+            m_PagePool[PageId].DeAllocate(Block.Ptr);
+            m_AvailablePages.insert(PageId);
+            // In current implementation pages are never released!
+        }
+    }
+
+    Cache.NumBlocks -= NumBlocks;
+    std::move(Cache.Blocks.begin() + NumBlocks, Cache.Blocks.begin() + NumBlocks + Cache.NumBlocks, Cache.Blocks.begin());
 }
 
 void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
@@ -214,49 +379,61 @@ void* FixedBlockMemoryAllocator::Allocate(size_t Size, const Char* dbgDescriptio
     Size = AdjustBlockSize(Size);
     VERIFY(m_BlockSize == Size, "Requested size (", Size, ") does not match the block size (", m_BlockSize, ")");
 
-    std::lock_guard<std::mutex> LockGuard(m_Mutex);
+    ThreadCache& Cache = GetThreadCache();
 
-    if (m_AvailablePages.empty())
+    Threading::SpinLockGuard CacheGuard{Cache.Lock};
+    if (Cache.NumBlocks == 0)
     {
-        CreateNewPage();
+        RefillCache(Cache);
     }
 
-    auto        PageId = *m_AvailablePages.begin();
-    MemoryPage& Page   = m_PagePool[PageId];
-    void*       Ptr    = Page.Allocate();
-    m_AddrToPageId.insert(std::make_pair(Ptr, PageId));
-    if (!Page.HasSpace())
-    {
-        m_AvailablePages.erase(m_AvailablePages.begin());
-    }
+    const CachedBlock& Block = Cache.Blocks[--Cache.NumBlocks];
 
-    return Ptr;
+    const Uint32 BlockMask = 1u << (Block.BlockIdx % 32);
+    const Uint32 States    = Block.pPage->pBlockStates[Block.BlockIdx / 32].fetch_or(BlockMask, std::memory_order_relaxed);
+    VERIFY((States & BlockMask) == 0, "The block is already allocated");
+    (void)States;
+
+    FillWithDebugPattern(Block.Ptr, MemoryPage::AllocatedBlockMemPattern, m_BlockSize);
+    return Block.Ptr;
 }
 
 void FixedBlockMemoryAllocator::Free(void* Ptr)
 {
-    std::lock_guard<std::mutex> LockGuard(m_Mutex);
-    auto                        PageIdIt = m_AddrToPageId.find(Ptr);
-    if (PageIdIt != m_AddrToPageId.end())
+    // The block must be validated before it is put into the cache, where it may be handed out again
+    const PageDesc* pPage = FindPage(Ptr);
+    if (pPage == nullptr)
     {
-        size_t PageId = PageIdIt->second;
-        VERIFY_EXPR(PageId < m_PagePool.size());
-        m_PagePool[PageId].DeAllocate(Ptr);
-        m_AvailablePages.insert(PageId);
-        m_AddrToPageId.erase(PageIdIt);
-        if (m_AvailablePages.size() > 1 && !m_PagePool[PageId].HasAllocations())
-        {
-            // In current implementation pages are never released!
-            // Note that if we delete a page, all indices past it will be invalid
+        UNEXPECTED("Address not found in the allocator pages - freeing memory that was not allocated by this allocator?");
+        return;
+    }
 
-            //m_PagePool.erase(m_PagePool.begin() + PageId);
-            //m_AvailablePages.erase(PageId);
-        }
+    const size_t Offset = static_cast<const Uint8*>(Ptr) - pPage->pStart;
+    if (Offset % m_BlockSize != 0)
+    {
+        UNEXPECTED("Address does not point to the beginning of a block");
+        return;
     }
-    else
+
+    const size_t BlockIdx  = Offset / m_BlockSize;
+    const Uint32 BlockMask = 1u << (BlockIdx % 32);
+    if ((pPage->pBlockStates[BlockIdx / 32].fetch_and(~BlockMask, std::memory_order_relaxed) & BlockMask) == 0)
     {
         UNEXPECTED("Address not found in the allocations list - double freeing memory?");
+        return;
+    }
+
+    FillWithDebugPattern(Ptr, MemoryPage::DeallocatedBlockMemPattern, m_BlockSize);
+
+    ThreadCache& Cache = GetThreadCache();
+
+    Threading::SpinLockGuard CacheGuard{Cache.Lock};
+    if (Cache.NumBlocks == m_CacheBatchSize * 2)
+    {
+        // Keep the most recently released blocks as they are likely to be in the cache
+        FlushCache(Cache, m_CacheBatchSize);
     }
+    Cache.Blocks[Cache.NumBlocks++] = {Ptr, pPage, BlockIdx};
 }
 
 void* FixedBlockMemoryAllocator::AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
@@ -0,0 +1,176 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrameArena.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "DefaultRawMemoryAllocator.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+class ThreadArenaRegistry
+{
+public:
+    static ThreadArenaRegistry& Get()
+    {
+        static ThreadArenaRegistry Registry;
+        return Registry;
+    }
+
+    void Add(const FrameArena* pArena)
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        m_Arenas.push_back(pArena);
+    }
+
+    void Remove(const FrameArena* pArena)
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        auto                        it = std::find(m_Arenas.begin(), m_Arenas.end(), pArena);
+        VERIFY_EXPR(it != m_Arenas.end());
+        if (it != m_Arenas.end())
+            m_Arenas.erase(it);
+    }
+
+    FrameArenaStats GetStats()
+    {
+        FrameArenaStats Stats;
+
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        for (const FrameArena* pArena : m_Arenas)
+            Stats += pArena->GetStats();
+
+        return Stats;
+    }
+
+private:
+    std::mutex                     m_Mtx;
+    std::vector<const FrameArena*> m_Arenas;
+};
+
+class ThreadArenaHolder
+{
+public:
+    ThreadArenaHolder() :
+        m_Arena{DefaultRawMemoryAllocator::GetAllocator()}
+    {
+        ThreadArenaRegistry::Get().Add(&m_Arena);
+    }
+
+    ~ThreadArenaHolder()
+    {
+        ThreadArenaRegistry::Get().Remove(&m_Arena);
+    }
+
+    FrameArena& GetArena()
+    {
+        return m_Arena;
+    }
+
+private:
+    FrameArena m_Arena;
+};
+
+template <typename T>
+void AtomicMax(std::atomic<T>& Dst, T Val)
+{
+    T Curr = Dst.load(std::memory_order_relaxed);
+    while (Curr < Val && !Dst.compare_exchange_weak(Curr, Val, std::memory_order_relaxed))
+    {
+    }
+}
+
+} // namespace
+
+FrameArena::FrameArena(IMemoryAllocator& Allocator, Uint32 BlockSize) :
+    m_Allocator{Allocator, BlockSize}
+{
+}
+
+FrameArena::~FrameArena()
+{
+    VERIFY(m_NumActiveCheckpoints == 0, "Destroying frame arena with ", m_NumActiveCheckpoints, " active checkpoint(s)");
+}
+
+void FrameArena::UpdateStats()
+{
+    const size_t UsedSize = m_Allocator.GetUsedSize();
+    m_FramePeakSize       = (std::max)(m_FramePeakSize, UsedSize);
+    AtomicMax(m_PeakSize, UsedSize);
+    m_ReservedSize.store(m_Allocator.GetReservedSize(), std::memory_order_relaxed);
+}
+
+void FrameArena::Rewind(const DynamicLinearAllocator::Marker& Marker)
+{
+    VERIFY(m_NumActiveCheckpoints > 0, "There are no active checkpoints");
+    --m_NumActiveCheckpoints;
+
+    UpdateStats();
+    m_Allocator.Rewind(Marker);
+}
+
+void FrameArena::EndFrame()
+{
+    UpdateStats();
+
+    if (m_NumActiveCheckpoints == 0)
+        m_Allocator.Discard();
+
+    m_LastFramePeakSize.store(m_FramePeakSize, std::memory_order_relaxed);
+    m_FramePeakSize = 0;
+    m_NumFrames.fetch_add(1, std::memory_order_relaxed);
+}
+
+FrameArenaStats FrameArena::GetStats() const
+{
+    FrameArenaStats Stats;
+    Stats.LastFramePeakSize = m_LastFramePeakSize.load(std::memory_order_relaxed);
+    Stats.PeakSize          = m_PeakSize.load(std::memory_order_relaxed);
+    Stats.ReservedSize      = m_ReservedSize.load(std::memory_order_relaxed);
+    Stats.NumFrames         = m_NumFrames.load(std::memory_order_relaxed);
+    return Stats;
+}
+
+FrameArena& FrameArena::GetThreadArena()
+{
+    static thread_local ThreadArenaHolder Holder;
+    return Holder.GetArena();
+}
+
+FrameArenaStats FrameArena::GetThreadArenasStats()
+{
+    return ThreadArenaRegistry::Get().GetStats();
+}
+
+} // namespace Diligent
@@ -0,0 +1,701 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrustumCulling.hpp"
+
+#include <algorithm>
+
+#include "Intrinsics.hpp"
+#include "DebugUtilities.hpp"
+#include "ParallelFor.hpp"
+#include "PlatformMisc.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr size_t BoxesPerMaskWord = 32;
+
+// The minimum number of mask words processed by one thread
+constexpr size_t MinMaskWordsPerThread = 256;
+
+// Frustum planes selected by the plane flags
+struct FrustumPlanesSoA
+{
+    Uint32 NumPlanes = 0;
+
+    Plane3D Planes[ViewFrustum::NUM_PLANES] = {};
+
+    float NormalX[ViewFrustum::NUM_PLANES] = {};
+    float NormalY[ViewFrustum::NUM_PLANES] = {};
+    float NormalZ[ViewFrustum::NUM_PLANES] = {};
+
+    float AbsNormalX[ViewFrustum::NUM_PLANES] = {};
+    float AbsNormalY[ViewFrustum::NUM_PLANES] = {};
+    float AbsNormalZ[ViewFrustum::NUM_PLANES] = {};
+
+    float Distance[ViewFrustum::NUM_PLANES] = {};
+
+    FrustumPlanesSoA(const ViewFrustum& Frustum, FRUSTUM_PLANE_FLAGS PlaneFlags)
+    {
+        for (Uint32 plane_idx = 0; plane_idx < ViewFrustum::NUM_PLANES; ++plane_idx)
+        {
+            if ((PlaneFlags & (1 << plane_idx)) == 0)
+                continue;
+
+            const Plane3D& Plane  = Frustum.GetPlane(static_cast<ViewFrustum::PLANE_IDX>(plane_idx));
+            const float3   AbsN   = abs(Plane.Normal);
+            Planes[NumPlanes]     = Plane;
+            NormalX[NumPlanes]    = Plane.Normal.x;
+            NormalY[NumPlanes]    = Plane.Normal.y;
+            NormalZ[NumPlanes]    = Plane.Normal.z;
+            AbsNormalX[NumPlanes] = AbsN.x;
+            AbsNormalY[NumPlanes] = AbsN.y;
+            AbsNormalZ[NumPlanes] = AbsN.z;
+            Distance[NumPlanes]   = Plane.Distance;
+            ++NumPlanes;
+        }
+    }
+};
+
+// Tests 32 boxes starting with FirstBox against the planes.
+// Returns the mask of the visible boxes and writes the mask of the fully visible boxes to FullyVisibleBits.
+// The kernels perform the same floating-point operations in the same order as GetBoxVisibilityAgainstPlane.
+using CullBoundBoxesFn         = Uint32 (*)(const BoundBoxesSoA& Boxes, size_t FirstBox, const FrustumPlanesSoA& Planes, Uint32& FullyVisibleBits);
+using CullOrientedBoundBoxesFn = Uint32 (*)(const OrientedBoundingBoxesSoA& Boxes, size_t FirstBox, const FrustumPlanesSoA& Planes, Uint32& FullyVisibleBits);
+
+template <typename BoundBoxType>
+Uint32 CullBoxScalar(const BoundBoxType& Box, const FrustumPlanesSoA& Planes, Uint32 Bit, Uint32& FullyVisibleBits)
+{
+    bool IsFullyVisible = true;
+    for (Uint32 p = 0; p < Planes.NumPlanes; ++p)
+    {
+        const BoxVisibility Visibility = GetBoxVisibilityAgainstPlane(Planes.Planes[p], Box);
+        if (Visibility == BoxVisibility::Invisible)
+            return 0;
+        IsFullyVisible = IsFullyVisible && Visibility == BoxVisibility::FullyVisible;
+    }
+    if (IsFullyVisible)
+        FullyVisibleBits |= Bit;
+    return Bit;
+}
+
+BoundBox GetBox(const BoundBoxesSoA& Boxes, size_t Idx)
+{
+    return BoundBox{
+        float3{Boxes.pMinX[Idx], Boxes.pMinY[Idx], Boxes.pMinZ[Idx]},
+        float3{Boxes.pMaxX[Idx], Boxes.pMaxY[Idx], Boxes.pMaxZ[Idx]},
+    };
+}
+
+OrientedBoundingBox GetBox(const OrientedBoundingBoxesSoA& Boxes, size_t Idx)
+{
+    OrientedBoundingBox Box;
+    Box.Center = float3{Boxes.pCenterX[Idx], Boxes.pCenterY[Idx], Boxes.pCenterZ[Idx]};
+    for (size_t i = 0; i < 3; ++i)
+    {
+        Box.Axes[i]        = float3{Boxes.pAxes[i][0][Idx], Boxes.pAxes[i][1][Idx], Boxes.pAxes[i][2][Idx]};
+        Box.HalfExtents[i] = Boxes.pHalfExtents[i][Idx];
+    }
+    return Box;
+}
+
+Uint32 CullBoundBoxesScalar(const BoundBoxesSoA& Boxes, size_t FirstBox, const FrustumPlanesSoA& Planes, Uint32& FullyVisibleBits)
+{
+    Uint32 VisibleBits = 0;
+    for (Uint32 i = 0; i < BoxesPerMaskWord; ++i)
+        VisibleBits |= CullBoxScalar(GetBox(Boxes, FirstBox + i), Planes, 1u << i, FullyVisibleBits);
+    return VisibleBits;
+}
+
+Uint32 CullOrientedBoundBoxesScalar(const OrientedBoundingBoxesSoA& Boxes, size_t FirstBox, const FrustumPlanesSoA& Planes, Uint32& FullyVisibleBits)
+{
+    Uint32 VisibleBits = 0;
+    for (Uint32 i = 0; i < BoxesPerMaskWord; ++i)
+        VisibleBits |= CullBoxScalar(GetBox(Boxes, FirstBox + i), Planes, 1u << i, FullyVisibleBits);
+    return VisibleBits;
+}
+
+#if DILIGENT_SSE2_ENABLED
+Uint32 CullBoundBoxesSSE2(const BoundBoxesSoA& Boxes, size_t FirstBox, const FrustumPlanesSoA& Planes, Uint32& FullyVisibleBits)
+{
+    const __m128 mHalf     = _mm_set1_ps(0.5f);
+    const __m128 mSignMask = _mm_set1_ps(-0.f);
+
+    Uint32 VisibleBits = 0;
+    for (Uint32 i = 0; i < BoxesPerMaskWord; i += 4)
+    {
+        const size_t Idx = FirstBox + i;
+
+        const __m128 MinX = _mm_loadu_ps(Boxes.pMinX + Idx);
+        const __m128 MinY = _mm_loadu_ps(Boxes.pMinY + Idx);
+        const __m128 MinZ = _mm_loadu_ps(Boxes.pMinZ + Idx);
+        const __m128 MaxX = _mm_loadu_ps(Boxes.pMaxX + Idx);
+        const __m128 MaxY = _mm_loadu_ps(Boxes.pMaxY + Idx);
+        const __m128 MaxZ = _mm_loadu_ps(Boxes.pMaxZ + Idx);
+
+        // Max + Min and Max - Min, see GetBoxVisibilityAgainstPlane
+        const __m128 SumX  = _mm_add_ps(MaxX, MinX);
+        const __m128 SumY  = _mm_add_ps(MaxY, MinY);
+        const __m128 SumZ  = _mm_add_ps(MaxZ, MinZ);
+        const __m128 DiffX = _mm_sub_ps(MaxX, MinX);
+        const __m128 DiffY = _mm_sub_ps(MaxY, MinY);
+        const __m128 DiffZ = _mm_sub_ps(MaxZ, MinZ);
+
+        __m128 Invisible    = _mm_setzero_ps();
+        __m128 FullyVisible = _mm_cmpeq_ps(Invisible, Invisible);
+        for (Uint32 p = 0; p < Planes.NumPlanes; ++p)
+        {
+            const __m128 DistanceToCenter =
+                _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(SumX, _mm_set1_ps(Planes.NormalX[p])),
+                                                            _mm_mul_ps(SumY, _mm_set1_ps(Planes.NormalY[p]))),
+                                                 _mm_mul_ps(SumZ, _mm_set1_ps(Planes.NormalZ[p]))),
+                                      mHalf),
+                           _mm_set1_ps(Planes.Distance[p]));
+
+            const __m128 ProjHalfLen =
+                _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(DiffX, _mm_set1_ps(Planes.AbsNormalX[p])),
+                                                 _mm_mul_ps(DiffY, _mm_set1_ps(Planes.AbsNormalY[p]))),
+                                      _mm_mul_ps(DiffZ, _mm_set1_ps(Planes.AbsNormalZ[p]))),
+                           mHalf);
+
+            Invisible    = _mm_or_ps(Invisible, _mm_cmplt_ps(DistanceToCenter, _mm_xor_ps(ProjHalfLen, mSignMask)));
+            FullyVisible = _mm_and_ps(FullyVisible, _mm_cmpgt_ps(DistanceToCenter, ProjHalfLen));
+        }
+
+        VisibleBits |= static_cast<Uint32>(~_mm_movemask_ps(Invisible) & 0xF) << i;
+        FullyVisibleBits |= static_cast<Uint32>(_mm_movemask_ps(FullyVisible)) << i;
+    }
+    return VisibleBits;
+}
+
+Uint32 CullOrientedBoundBoxesSSE2(const OrientedBoundingBoxesSoA& Boxes, size_t FirstBox, const FrustumPlanesSoA& Planes, Uint32& FullyVisibleBits)
+{
+    const __m128 mSignMask = _mm_set1_ps(-0.f);
+
+    Uint32 VisibleBits = 0;
+    for (Uint32 i = 0; i < BoxesPerMaskWord; i += 4)
+    {
+        const size_t Idx = FirstBox + i;
+
+        const __m128 CenterX = _mm_loadu_ps(Boxes.pCenterX + Idx);
+        const __m128 CenterY = _mm_loadu_ps(Boxes.pCenterY + Idx);
+        const __m128 CenterZ = _mm_loadu_ps(Boxes.pCenterZ + Idx);
+
+        __m128 Axes[3][3];
+        __m128 HalfExtents[3];
+        for (size_t a = 0; a < 3; ++a)
+        {
+            for (size_t c = 0; c < 3; ++c)
+                Axes[a][c] = _mm_loadu_ps(Boxes.pAxes[a][c] + Idx);
+            HalfExtents[a] = _mm_loadu_ps(Boxes.pHalfExtents[a] + Idx);
+        }
+
+        __m128 Invisible    = _mm_setzero_ps();
+        __m128 FullyVisible = _mm_cmpeq_ps(Invisible, Invisible);
+        for (Uint32 p = 0; p < Planes.NumPlanes; ++p)
+        {
+            const __m128 NormalX = _mm_set1_ps(Planes.NormalX[p]);
+            const __m128 NormalY = _mm_set1_ps(Planes.NormalY[p]);
+            const __m128 NormalZ = _mm_set1_ps(Planes.NormalZ[p]);
+
+            const __m128 Distance =
+                _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(CenterX, NormalX), _mm_mul_ps(CenterY, NormalY)), _mm_mul_ps(CenterZ, NormalZ)),
+                           _mm_set1_ps(Planes.Distance[p]));
+
+            __m128 ProjHalfExtents[3];
+            for (size_t a = 0; a < 3; ++a)
+            {
+                const __m128 AxisDotN =
+                    _mm_add_ps(_mm_add_ps(_mm_mul_ps(Axes[a][0], NormalX), _mm_mul_ps(Axes[a][1], NormalY)), _mm_mul_ps(Axes[a][2], NormalZ));
+                ProjHalfExtents[a] = _mm_mul_ps(_mm_andnot_ps(mSignMask, AxisDotN), HalfExtents[a]);
+            }
+            const __m128 ProjHalfLen = _mm_add_ps(_mm_add_ps(ProjHalfExtents[0], ProjHalfExtents[1]), ProjHalfExtents[2]);
+
+            Invisible    = _mm_or_ps(Invisible, _mm_cmplt_ps(Distance, _mm_xor_ps(ProjHalfLen, mSignMask)));
+            FullyVisible = _mm_and_ps(FullyVisible, _mm_cmpgt_ps(Distance, ProjHalfLen));
+        }
+
+        VisibleBits |= static_cast<Uint32>(~_mm_movemask_ps(Invisible) & 0xF) << i;
+        FullyVisibleBits |= static_cast<Uint32>(_mm_movemask_ps(FullyVisible)) << i;
+    }
+    return VisibleBits;
+}
+#endif
+
+#if DILIGENT_AVX2_SUPPORTED
+DILIGENT_TARGET_AVX2 Uint32 CullBoundBoxesAVX2(const BoundBoxesSoA& Boxes, size_t FirstBox, const FrustumPlanesSoA& Planes, Uint32& FullyVisibleBits)
+{
+    const __m256 mHalf     = _mm256_set1_ps(0.5f);
+    const __m256 mSignMask = _mm256_set1_ps(-0.f);
+
+    Uint32 VisibleBits = 0;
+    for (Uint32 i = 0; i < BoxesPerMaskWord; i += 8)
+    {
+        const size_t Idx = FirstBox + i;
+
+        const __m256 MinX = _mm256_loadu_ps(Boxes.pMinX + Idx);
+        const __m256 MinY = _mm256_loadu_ps(Boxes.pMinY + Idx);
+        const __m256 MinZ = _mm256_loadu_ps(Boxes.pMinZ + Idx);
+        const __m256 MaxX = _mm256_loadu_ps(Boxes.pMaxX + Idx);
+        const __m256 MaxY = _mm256_loadu_ps(Boxes.pMaxY + Idx);
+        const __m256 MaxZ = _mm256_loadu_ps(Boxes.pMaxZ + Idx);
+
+        const __m256 SumX  = _mm256_add_ps(MaxX, MinX);
+        const __m256 SumY  = _mm256_add_ps(MaxY, MinY);
+        const __m256 SumZ  = _mm256_add_ps(MaxZ, MinZ);
+        const __m256 DiffX = _mm256_sub_ps(MaxX, MinX);
+        const __m256 DiffY = _mm256_sub_ps(MaxY, MinY);
+        const __m256 DiffZ = _mm256_sub_ps(MaxZ, MinZ);
+
+        // No FMA to keep the results identical to the scalar code
+        __m256 Invisible    = _mm256_setzero_ps();
+        __m256 FullyVisible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (Uint32 p = 0; p < Planes.NumPlanes; ++p)
+        {
+            const __m256 DistanceToCenter =
+                _mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(SumX, _mm256_set1_ps(Planes.NormalX[p])),
+                                                                        _mm256_mul_ps(SumY, _mm256_set1_ps(Planes.NormalY[p]))),
+                                                          _mm256_mul_ps(SumZ, _mm256_set1_ps(Planes.NormalZ[p]))),
+                                            mHalf),
+                              _mm256_set1_ps(Planes.Distance[p]));
+
+            const __m256 ProjHalfLen =
+                _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(DiffX, _mm256_set1_ps(Planes.AbsNormalX[p])),
+                                                          _mm256_mul_ps(DiffY, _mm256_set1_ps(Planes.AbsNormalY[p]))),
+                                            _mm256_mul_ps(DiffZ, _mm256_set1_ps(Planes.AbsNormalZ[p]))),
+                              mHalf);
+
+            Invisible    = _mm256_or_ps(Invisible, _mm256_cmp_ps(DistanceToCenter, _mm256_xor_ps(ProjHalfLen, mSignMask), _CMP_LT_OQ));
+            FullyVisible = _mm256_and_ps(FullyVisible, _mm256_cmp_ps(DistanceToCenter, ProjHalfLen, _CMP_GT_OQ));
+        }
+
+        VisibleBits |= static_cast<Uint32>(~_mm256_movemask_ps(Invisible) & 0xFF) << i;
+        FullyVisibleBits |= static_cast<Uint32>(_mm256_movemask_ps(FullyVisible)) << i;
+    }
+    return VisibleBits;
+}
+
+DILIGENT_TARGET_AVX2 Uint32 CullOrientedBoundBoxesAVX2(const OrientedBoundingBoxesSoA& Boxes, size_t FirstBox, const FrustumPlanesSoA& Planes, Uint32& FullyVisibleBits)
+{
+    const __m256 mSignMask = _mm256_set1_ps(-0.f);
+
+    Uint32 VisibleBits = 0;
+    for (Uint32 i = 0; i < BoxesPerMaskWord; i += 8)
+    {
+        const size_t Idx = FirstBox + i;
+
+        const __m256 CenterX = _mm256_loadu_ps(Boxes.pCenterX + Idx);
+        const __m256 CenterY = _mm256_loadu_ps(Boxes.pCenterY + Idx);
+        const __m256 CenterZ = _mm256_loadu_ps(Boxes.pCenterZ + Idx);
+
+        __m256 Axes[3][3];
+        __m256 HalfExtents[3];
+        for (size_t a = 0; a < 3; ++a)
+        {
+            for (size_t c = 0; c < 3; ++c)
+                Axes[a][c] = _mm256_loadu_ps(Boxes.pAxes[a][c] + Idx);
+            HalfExtents[a] = _mm256_loadu_ps(Boxes.pHalfExtents[a] + Idx);
+        }
+
+        __m256 Invisible    = _mm256_setzero_ps();
+        __m256 FullyVisible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (Uint32 p = 0; p < Planes.NumPlanes; ++p)
+        {
+            const __m256 NormalX = _mm256_set1_ps(Planes.NormalX[p]);
+            const __m256 NormalY = _mm256_set1_ps(Planes.NormalY[p]);
+            const __m256 NormalZ = _mm256_set1_ps(Planes.NormalZ[p]);
+
+            const __m256 Distance =
+                _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(CenterX, NormalX), _mm256_mul_ps(CenterY, NormalY)), _mm256_mul_ps(CenterZ, NormalZ)),
+                              _mm256_set1_ps(Planes.Distance[p]));
+
+            __m256 ProjHalfExtents[3];
+            for (size_t a = 0; a < 3; ++a)
+            {
+                const __m256 AxisDotN =
+                    _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(Axes[a][0], NormalX), _mm256_mul_ps(Axes[a][1], NormalY)), _mm256_mul_ps(Axes[a][2], NormalZ));
+                ProjHalfExtents[a] = _mm256_mul_ps(_mm256_andnot_ps(mSignMask, AxisDotN), HalfExtents[a]);
+            }
+            const __m256 ProjHalfLen = _mm256_add_ps(_mm256_add_ps(ProjHalfExtents[0], ProjHalfExtents[1]), ProjHalfExtents[2]);
+
+            Invisible    = _mm256_or_ps(Invisible, _mm256_cmp_ps(Distance, _mm256_xor_ps(ProjHalfLen, mSignMask), _CMP_LT_OQ));
+            FullyVisible = _mm256_and_ps(FullyVisible, _mm256_cmp_ps(Distance, ProjHalfLen, _CMP_GT_OQ));
+        }
+
+        VisibleBits |= static_cast<Uint32>(~_mm256_movemask_ps(Invisible) & 0xFF) << i;
+        FullyVisibleBits |= static_cast<Uint32>(_mm256_movemask_ps(FullyVisible)) << i;
+    }
+    return VisibleBits;
+}
+#endif
+
+#if DILIGENT_NEON_ENABLED
+// Packs the lane masks into the lowest four bits
+Uint32 MoveMaskNEON(uint32x4_t Mask)
+{
+    static const uint32_t LaneBits[] = {1, 2, 4, 8};
+
+    const uint32x4_t Bits  = vandq_u32(Mask, vld1q_u32(LaneBits));
+    const uint32x2_t Bits2 = vpadd_u32(vget_low_u32(Bits), vget_high_u32(Bits));
+    return vget_lane_u32(Bits2, 0) | vget_lane_u32(Bits2, 1);
+}
+
+Uint32 CullBoundBoxesNEON(const BoundBoxesSoA& Boxes, size_t FirstBox, const FrustumPlanesSoA& Planes, Uint32& FullyVisibleBits)
+{
+    const float32x4_t mHalf = vdupq_n_f32(0.5f);
+
+    Uint32 VisibleBits = 0;
+    for (Uint32 i = 0; i < BoxesPerMaskWord; i += 4)
+    {
+        const size_t Idx = FirstBox + i;
+
+        const float32x4_t MinX = vld1q_f32(Boxes.pMinX + Idx);
+        const float32x4_t MinY = vld1q_f32(Boxes.pMinY + Idx);
+        const float32x4_t MinZ = vld1q_f32(Boxes.pMinZ + Idx);
+        const float32x4_t MaxX = vld1q_f32(Boxes.pMaxX + Idx);
+        const float32x4_t MaxY = vld1q_f32(Boxes.pMaxY + Idx);
+        const float32x4_t MaxZ = vld1q_f32(Boxes.pMaxZ + Idx);
+
+        const float32x4_t SumX  = vaddq_f32(MaxX, MinX);
+        const float32x4_t SumY  = vaddq_f32(MaxY, MinY);
+        const float32x4_t SumZ  = vaddq_f32(MaxZ, MinZ);
+        const float32x4_t DiffX = vsubq_f32(MaxX, MinX);
+        const float32x4_t DiffY = vsubq_f32(MaxY, MinY);
+        const float32x4_t DiffZ = vsubq_f32(MaxZ, MinZ);
+
+        // vmlaq_f32 is not used to keep the results identical to the scalar code
+        uint32x4_t Invisible    = vdupq_n_u32(0);
+        uint32x4_t FullyVisible = vdupq_n_u32(~0u);
+        for (Uint32 p = 0; p < Planes.NumPlanes; ++p)
+        {
+            const float32x4_t DistanceToCenter =
+                vaddq_f32(vmulq_f32(vaddq_f32(vaddq_f32(vmulq_f32(SumX, vdupq_n_f32(Planes.NormalX[p])),
+                                                        vmulq_f32(SumY, vdupq_n_f32(Planes.NormalY[p]))),
+                                              vmulq_f32(SumZ, vdupq_n_f32(Planes.NormalZ[p]))),
+                                    mHalf),
+                          vdupq_n_f32(Planes.Distance[p]));
+
+            const float32x4_t ProjHalfLen =
+                vmulq_f32(vaddq_f32(vaddq_f32(vmulq_f32(DiffX, vdupq_n_f32(Planes.AbsNormalX[p])),
+                                              vmulq_f32(DiffY, vdupq_n_f32(Planes.AbsNormalY[p]))),
+                                    vmulq_f32(DiffZ, vdupq_n_f32(Planes.AbsNormalZ[p]))),
+                          mHalf);
+
+            Invisible    = vorrq_u32(Invisible, vcltq_f32(DistanceToCenter, vnegq_f32(ProjHalfLen)));
+            FullyVisible = vandq_u32(FullyVisible, vcgtq_f32(DistanceToCenter, ProjHalfLen));
+        }
+
+        VisibleBits |= (~MoveMaskNEON(Invisible) & 0xF) << i;
+        FullyVisibleBits |= MoveMaskNEON(FullyVisible) << i;
+    }
+    return VisibleBits;
+}
+
+Uint32 CullOrientedBoundBoxesNEON(const OrientedBoundingBoxesSoA& Boxes, size_t FirstBox, const FrustumPlanesSoA& Planes, Uint32& FullyVisibleBits)
+{
+    Uint32 VisibleBits = 0;
+    for (Uint32 i = 0; i < BoxesPerMaskWord; i += 4)
+    {
+        const size_t Idx = FirstBox + i;
+
+        const float32x4_t CenterX = vld1q_f32(Boxes.pCenterX + Idx);
+        const float32x4_t CenterY = vld1q_f32(Boxes.pCenterY + Idx);
+        const float32x4_t CenterZ = vld1q_f32(Boxes.pCenterZ + Idx);
+
+        float32x4_t Axes[3][3];
+        float32x4_t HalfExtents[3];
+        for (size_t a = 0; a < 3; ++a)
+        {
+            for (size_t c = 0; c < 3; ++c)
+                Axes[a][c] = vld1q_f32(Boxes.pAxes[a][c] + Idx);
+            HalfExtents[a] = vld1q_f32(Boxes.pHalfExtents[a] + Idx);
+        }
+
+        uint32x4_t Invisible    = vdupq_n_u32(0);
+        uint32x4_t FullyVisible = vdupq_n_u32(~0u);
+        for (Uint32 p = 0; p < Planes.NumPlanes; ++p)
+        {
+            const float32x4_t NormalX = vdupq_n_f32(Planes.NormalX[p]);
+            const float32x4_t NormalY = vdupq_n_f32(Planes.NormalY[p]);
+            const float32x4_t NormalZ = vdupq_n_f32(Planes.NormalZ[p]);
+
+            const float32x4_t Distance =
+                vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(CenterX, NormalX), vmulq_f32(CenterY, NormalY)), vmulq_f32(CenterZ, NormalZ)),
+                          vdupq_n_f32(Planes.Distance[p]));
+
+            float32x4_t ProjHalfExtents[3];
+            for (size_t a = 0; a < 3; ++a)
+            {
+                const float32x4_t AxisDotN =
+                    vaddq_f32(vaddq_f32(vmulq_f32(Axes[a][0], NormalX), vmulq_f32(Axes[a][1], NormalY)), vmulq_f32(Axes[a][2], NormalZ));
+                ProjHalfExtents[a] = vmulq_f32(vabsq_f32(AxisDotN), HalfExtents[a]);
+            }
+            const float32x4_t ProjHalfLen = vaddq_f32(vaddq_f32(ProjHalfExtents[0], ProjHalfExtents[1]), ProjHalfExtents[2]);
+
+            Invisible    = vorrq_u32(Invisible, vcltq_f32(Distance, vnegq_f32(ProjHalfLen)));
+            FullyVisible = vandq_u32(FullyVisible, vcgtq_f32(Distance, ProjHalfLen));
+        }
+
+        VisibleBits |= (~MoveMaskNEON(Invisible) & 0xF) << i;
+        FullyVisibleBits |= MoveMaskNEON(FullyVisible) << i;
+    }
+    return VisibleBits;
+}
+#endif
+
+struct CullingKernels
+{
+    CullBoundBoxesFn         CullBoundBoxes         = CullBoundBoxesScalar;
+    CullOrientedBoundBoxesFn CullOrientedBoundBoxes = CullOrientedBoundBoxesScalar;
+};
+
+CullingKernels SelectCullingKernels()
+{
+    CullingKernels Kernels;
+#if DILIGENT_SSE2_ENABLED
+    Kernels.CullBoundBoxes         = CullBoundBoxesSSE2;
+    Kernels.CullOrientedBoundBoxes = CullOrientedBoundBoxesSSE2;
+#elif DILIGENT_NEON_ENABLED
+    Kernels.CullBoundBoxes         = CullBoundBoxesNEON;
+    Kernels.CullOrientedBoundBoxes = CullOrientedBoundBoxesNEON;
+#endif
+
+#if DILIGENT_AVX2_SUPPORTED
+    if (PlatformMisc::GetCPUFeatures().AVX2)
+    {
+        Kernels.CullBoundBoxes         = CullBoundBoxesAVX2;
+        Kernels.CullOrientedBoundBoxes = CullOrientedBoundBoxesAVX2;
+    }
+#endif
+
+    return Kernels;
+}
+
+const CullingKernels& GetCullingKernels()
+{
+    static const CullingKernels Kernels = SelectCullingKernels();
+    return Kernels;
+}
+
+Uint32 CullBoxes(const CullingKernels& Kernels, const BoundBoxesSoA& Boxes, size_t FirstBox, const FrustumPlanesSoA& Planes, Uint32& FullyVisibleBits)
+{
+    return Kernels.CullBoundBoxes(Boxes, FirstBox, Planes, FullyVisibleBits);
+}
+
+Uint32 CullBoxes(const CullingKernels& Kernels, const OrientedBoundingBoxesSoA& Boxes, size_t FirstBox, const FrustumPlanesSoA& Planes, Uint32& FullyVisibleBits)
+{
+    return Kernels.CullOrientedBoundBoxes(Boxes, FirstBox, Planes, FullyVisibleBits);
+}
+
+// Copies the last incomplete group of boxes to the padded arrays, so that the kernels
+// can always process full mask words.
+struct PaddedBoundBoxes
+{
+    float         Data[6][BoxesPerMaskWord] = {};
+    BoundBoxesSoA Boxes;
+
+    PaddedBoundBoxes(const BoundBoxesSoA& Src, size_t FirstBox)
+    {
+        const float* pSrc[] = {Src.pMinX, Src.pMinY, Src.pMinZ, Src.pMaxX, Src.pMaxY, Src.pMaxZ};
+        for (size_t i = 0; i < 6; ++i)
+            std::copy(pSrc[i] + FirstBox, pSrc[i] + Src.NumBoxes, Data[i]);
+
+        Boxes.pMinX    = Data[0];
+        Boxes.pMinY    = Data[1];
+        Boxes.pMinZ    = Data[2];
+        Boxes.pMaxX    = Data[3];
+        Boxes.pMaxY    = Data[4];
+        Boxes.pMaxZ    = Data[5];
+        Boxes.NumBoxes = BoxesPerMaskWord;
+    }
+};
+
+struct PaddedOrientedBoundingBoxes
+{
+    float                    Data[15][BoxesPerMaskWord] = {};
+    OrientedBoundingBoxesSoA Boxes;
+
+    PaddedOrientedBoundingBoxes(const OrientedBoundingBoxesSoA& Src, size_t FirstBox)
+    {
+        const float* pSrc[] = {
+            Src.pCenterX, Src.pCenterY, Src.pCenterZ,
+            Src.pAxes[0][0], Src.pAxes[0][1], Src.pAxes[0][2],
+            Src.pAxes[1][0], Src.pAxes[1][1], Src.pAxes[1][2],
+            Src.pAxes[2][0], Src.pAxes[2][1], Src.pAxes[2][2],
+            Src.pHalfExtents[0], Src.pHalfExtents[1], Src.pHalfExtents[2]};
+        for (size_t i = 0; i < 15; ++i)
+            std::copy(pSrc[i] + FirstBox, pSrc[i] + Src.NumBoxes, Data[i]);
+
+        Boxes.pCenterX = Data[0];
+        Boxes.pCenterY = Data[1];
+        Boxes.pCenterZ = Data[2];
+        for (size_t a = 0; a < 3; ++a)
+        {
+            for (size_t c = 0; c < 3; ++c)
+                Boxes.pAxes[a][c] = Data[3 + a * 3 + c];
+            Boxes.pHalfExtents[a] = Data[12 + a];
+        }
+        Boxes.NumBoxes = BoxesPerMaskWord;
+    }
+};
+
+PaddedBoundBoxes GetPaddedBoxes(const BoundBoxesSoA& Boxes, size_t FirstBox)
+{
+    return PaddedBoundBoxes{Boxes, FirstBox};
+}
+
+PaddedOrientedBoundingBoxes GetPaddedBoxes(const OrientedBoundingBoxesSoA& Boxes, size_t FirstBox)
+{
+    return PaddedOrientedBoundingBoxes{Boxes, FirstBox};
+}
+
+// Additionally tests the intersecting boxes against the frustum corners
+Uint32 TestFrustumCorners(const ViewFrustum&, const BoundBoxesSoA&, size_t, Uint32 VisibleBits, Uint32, FRUSTUM_PLANE_FLAGS)
+{
+    return VisibleBits;
+}
+
+Uint32 TestFrustumCorners(const ViewFrustum&, const OrientedBoundingBoxesSoA&, size_t, Uint32 VisibleBits, Uint32, FRUSTUM_PLANE_FLAGS)
+{
+    return VisibleBits;
+}
+
+template <typename BoxesSoAType>
+Uint32 TestFrustumCorners(const ViewFrustumExt& Frustum, const BoxesSoAType& Boxes, size_t FirstBox, Uint32 VisibleBits, Uint32 FullyVisibleBits, FRUSTUM_PLANE_FLAGS PlaneFlags)
+{
+    if ((PlaneFlags & FRUSTUM_PLANE_FLAG_FULL_FRUSTUM) != FRUSTUM_PLANE_FLAG_FULL_FRUSTUM)
+        return VisibleBits;
+
+    // Intersecting boxes are typically a small fraction, so they are tested with the scalar code
+    for (Uint32 IntersectingBits = VisibleBits & ~FullyVisibleBits; IntersectingBits != 0; IntersectingBits &= IntersectingBits - 1)
+    {
+        const Uint32 Bit = IntersectingBits & (~IntersectingBits + 1);
+        const size_t Idx = FirstBox + PlatformMisc::GetLSB(Bit);
+        if (GetBoxVisibility(Frustum, GetBox(Boxes, Idx), PlaneFlags) == BoxVisibility::Invisible)
+            VisibleBits &= ~Bit;
+    }
+    return VisibleBits;
+}
+
+template <typename FrustumType, typename BoxesSoAType>
+void CullBoxes(const FrustumType&  Frustum,
+               const BoxesSoAType& Boxes,
+               Uint32*             pVisibleMask,
+               Uint32*             pFullyVisibleMask,
+               FRUSTUM_PLANE_FLAGS PlaneFlags,
+               IThreadPool*        pThreadPool)
+{
+    if (Boxes.NumBoxes == 0)
+        return;
+
+    DEV_CHECK_ERR(pVisibleMask != nullptr, "Visible mask must not be null");
+    if (pVisibleMask == nullptr)
+        return;
+
+    const CullingKernels&  Kernels = GetCullingKernels();
+    const FrustumPlanesSoA Planes{Frustum, PlaneFlags};
+
+    const size_t NumFullWords = Boxes.NumBoxes / BoxesPerMaskWord;
+    const size_t NumWords     = (Boxes.NumBoxes + BoxesPerMaskWord - 1) / BoxesPerMaskWord;
+
+    auto CullWords = [&](size_t FirstWord, size_t EndWord) {
+        for (size_t Word = FirstWord; Word < EndWord; ++Word)
+        {
+            const size_t FirstBox = Word * BoxesPerMaskWord;
+
+            Uint32 VisibleBits      = 0;
+            Uint32 FullyVisibleBits = 0;
+            if (Word < NumFullWords)
+            {
+                VisibleBits = CullBoxes(Kernels, Boxes, FirstBox, Planes, FullyVisibleBits);
+            }
+            else
+            {
+                const auto   Padded    = GetPaddedBoxes(Boxes, FirstBox);
+                const Uint32 ValidBits = (1u << (Boxes.NumBoxes - FirstBox)) - 1u;
+
+                VisibleBits = CullBoxes(Kernels, Padded.Boxes, 0, Planes, FullyVisibleBits) & ValidBits;
+                FullyVisibleBits &= ValidBits;
+            }
+
+            VisibleBits = TestFrustumCorners(Frustum, Boxes, FirstBox, VisibleBits, FullyVisibleBits, PlaneFlags);
+
+            pVisibleMask[Word] = VisibleBits;
+            if (pFullyVisibleMask != nullptr)
+                pFullyVisibleMask[Word] = FullyVisibleBits;
+        }
+    };
+
+    // Every thread writes its own range of mask words
+    ParallelFor(pThreadPool, 0, NumWords, MinMaskWordsPerThread, CullWords);
+}
+
+} // namespace
+
+void GetBoxesVisibility(const ViewFrustum&   Frustum,
+                        const BoundBoxesSoA& Boxes,
+                        Uint32*              pVisibleMask,
+                        Uint32*              pFullyVisibleMask,
+                        FRUSTUM_PLANE_FLAGS  PlaneFlags,
+                        IThreadPool*         pThreadPool)
+{
+    CullBoxes(Frustum, Boxes, pVisibleMask, pFullyVisibleMask, PlaneFlags, pThreadPool);
+}
+
+void GetBoxesVisibility(const ViewFrustumExt& Frustum,
+                        const BoundBoxesSoA&  Boxes,
+                        Uint32*               pVisibleMask,
+                        Uint32*               pFullyVisibleMask,
+                        FRUSTUM_PLANE_FLAGS   PlaneFlags,
+                        IThreadPool*          pThreadPool)
+{
+    CullBoxes(Frustum, Boxes, pVisibleMask, pFullyVisibleMask, PlaneFlags, pThreadPool);
+}
+
+void GetBoxesVisibility(const ViewFrustum&              Frustum,
+                        const OrientedBoundingBoxesSoA& Boxes,
+                        Uint32*                         pVisibleMask,
+                        Uint32*                         pFullyVisibleMask,
+                        FRUSTUM_PLANE_FLAGS             PlaneFlags,
+                        IThreadPool*                    pThreadPool)
+{
+    CullBoxes(Frustum, Boxes, pVisibleMask, pFullyVisibleMask, PlaneFlags, pThreadPool);
+}
+
+void GetBoxesVisibility(const ViewFrustumExt&           Frustum,
+                        const OrientedBoundingBoxesSoA& Boxes,
+                        Uint32*                         pVisibleMask,
+                        Uint32*                         pFullyVisibleMask,
+                        FRUSTUM_PLANE_FLAGS             PlaneFlags,
+                        IThreadPool*                    pThreadPool)
+{
+    CullBoxes(Frustum, Boxes, pVisibleMask, pFullyVisibleMask, PlaneFlags, pThreadPool);
+}
+
+} // namespace Diligent
@@ -0,0 +1,88 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "HashUtils.hpp"
+
+// Inline the xxHash implementation into this file so that the batch functions
+// do not make an out-of-line call for every key. The symbols have internal linkage
+// and do not clash with the xxHash library linked by other modules.
+// NB: the vector code path (SSE2 on x86-64, NEON on ARM64) is selected at build
+//     time from the compiler target; runtime AVX2 dispatch (XXH_DISPATCH) is not used.
+#define XXH_INLINE_ALL
+#include "xxhash.h"
+
+namespace Diligent
+{
+
+Uint64 ComputeHashRaw64(const void* pData, size_t Size, Uint64 Seed) noexcept
+{
+    return XXH3_64bits_withSeed(pData, Size, Seed);
+}
+
+void ComputeHashRawBatch(const void* const* ppKeys, const size_t* pSizes, size_t Count, Uint64* pHashes, Uint64 Seed) noexcept
+{
+    VERIFY_EXPR(Count == 0 || (ppKeys != nullptr && pSizes != nullptr && pHashes != nullptr));
+    for (size_t i = 0; i < Count; ++i)
+        pHashes[i] = XXH3_64bits_withSeed(ppKeys[i], pSizes[i], Seed);
+}
+
+namespace
+{
+
+template <size_t KeySize>
+void ComputeHashRawBatchFixedSize(const Uint8* pKey, size_t Stride, size_t Count, Uint64* pHashes, Uint64 Seed) noexcept
+{
+    // The key size is a compile-time constant, so the size class checks in XXH3 are folded away
+    for (size_t i = 0; i < Count; ++i, pKey += Stride)
+        pHashes[i] = XXH3_64bits_withSeed(pKey, KeySize, Seed);
+}
+
+} // namespace
+
+void ComputeHashRawBatch(const void* pKeys, size_t KeySize, size_t Stride, size_t Count, Uint64* pHashes, Uint64 Seed) noexcept
+{
+    VERIFY_EXPR(Count == 0 || (pKeys != nullptr && pHashes != nullptr));
+
+    const Uint8* pKey = static_cast<const Uint8*>(pKeys);
+    switch (KeySize)
+    {
+        // clang-format off
+        case  4: ComputeHashRawBatchFixedSize< 4>(pKey, Stride, Count, pHashes, Seed); break;
+        case  8: ComputeHashRawBatchFixedSize< 8>(pKey, Stride, Count, pHashes, Seed); break;
+        case 12: ComputeHashRawBatchFixedSize<12>(pKey, Stride, Count, pHashes, Seed); break;
+        case 16: ComputeHashRawBatchFixedSize<16>(pKey, Stride, Count, pHashes, Seed); break;
+        case 32: ComputeHashRawBatchFixedSize<32>(pKey, Stride, Count, pHashes, Seed); break;
+        case 64: ComputeHashRawBatchFixedSize<64>(pKey, Stride, Count, pHashes, Seed); break;
+        // clang-format on
+
+        default:
+            for (size_t i = 0; i < Count; ++i, pKey += Stride)
+                pHashes[i] = XXH3_64bits_withSeed(pKey, KeySize, Seed);
+    }
+}
+
+} // namespace Diligent
@@ -28,12 +28,630 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
+#include <mutex>
+#include <type_traits>
+#include <vector>
 
 #include "DebugUtilities.hpp"
+#include "ParallelFor.hpp"
+#include "Intrinsics.hpp"
 
 namespace Diligent
 {
 
+namespace
+{
+
+// The size of the structural similarity window
+constexpr Uint32 SSIMWindowSize = 8;
+
+template <typename T>
+struct ImageDiffTraits;
+
+template <>
+struct ImageDiffTraits<Uint8>
+{
+    using DiffType      = Uint8;
+    using LinearSumType = Uint16; // 8 * 255 fits into 16 bits
+    using SumType       = Uint32; // 64 * 255^2 fits into 32 bits
+
+    static constexpr double PeakValue = 255;
+
+    static DiffType ToDiffUnits(Uint8 Val) { return Val; }
+};
+
+template <>
+struct ImageDiffTraits<Uint16>
+{
+    using DiffType      = Uint32;
+    using LinearSumType = Uint32;
+    using SumType       = Uint64;
+
+    static constexpr double PeakValue = 65535;
+
+    static DiffType ToDiffUnits(Uint16 Val) { return Val; }
+};
+
+template <>
+struct ImageDiffTraits<float>
+{
+    using DiffType      = float;
+    using LinearSumType = double;
+    using SumType       = double;
+
+    static constexpr double PeakValue = 255;
+
+    static DiffType ToDiffUnits(float Val) { return Val * 255.f; }
+};
+
+template <typename DiffType>
+DiffType AbsDiff(DiffType Val1, DiffType Val2)
+{
+    return Val1 > Val2 ? static_cast<DiffType>(Val1 - Val2) : static_cast<DiffType>(Val2 - Val1);
+}
+
+struct ImageDiffAccumulator
+{
+    Uint64 NumDiffPixels               = 0;
+    Uint64 NumDiffPixelsAboveThreshold = 0;
+    float  MaxDiff                     = 0;
+    double SumDiff                     = 0;
+    double SumDiffSq                   = 0;
+    // Sum of squared channel differences for the PSNR
+    double SumSqErr       = 0;
+    double SumSSIM        = 0;
+    Uint64 NumSSIMWindows = 0;
+
+    ImageDiffAccumulator& operator+=(const ImageDiffAccumulator& RHS)
+    {
+        NumDiffPixels += RHS.NumDiffPixels;
+        NumDiffPixelsAboveThreshold += RHS.NumDiffPixelsAboveThreshold;
+        MaxDiff = std::max(MaxDiff, RHS.MaxDiff);
+        SumDiff += RHS.SumDiff;
+        SumDiffSq += RHS.SumDiffSq;
+        SumSqErr += RHS.SumSqErr;
+        SumSSIM += RHS.SumSSIM;
+        NumSSIMWindows += RHS.NumSSIMWindows;
+        return *this;
+    }
+};
+
+// The vectorized kernels below process 8-bit images where both rows have the same
+// channel layout. Every kernel returns the number of elements it processed; the
+// remaining elements are processed by the generic code.
+
+// Computes the absolute differences of the first Num bytes and the sum of their squares.
+size_t ComputeAbsDiffU8(const Uint8* pData1, const Uint8* pData2, size_t Num, Uint8* pDiff, Uint64& SumSq)
+{
+    size_t i = 0;
+
+#if DILIGENT_AVX2_ENABLED
+    const __m256i Zero = _mm256_setzero_si256();
+    while (i + 32 <= Num)
+    {
+        // Every iteration adds at most 2 * 2 * 255^2 to every 32-bit lane,
+        // so the lanes are flushed every 4096 iterations to avoid overflow.
+        __m256i      Sum     = Zero;
+        const size_t SpanEnd = std::min(Num, i + size_t{32} * 4096);
+        for (; i + 32 <= SpanEnd; i += 32)
+        {
+            const __m256i Val1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData1 + i));
+            const __m256i Val2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData2 + i));
+            const __m256i Diff = _mm256_or_si256(_mm256_subs_epu8(Val1, Val2), _mm256_subs_epu8(Val2, Val1));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDiff + i), Diff);
+
+            const __m256i Lo = _mm256_unpacklo_epi8(Diff, Zero);
+            const __m256i Hi = _mm256_unpackhi_epi8(Diff, Zero);
+            Sum              = _mm256_add_epi32(Sum, _mm256_madd_epi16(Lo, Lo));
+            Sum              = _mm256_add_epi32(Sum, _mm256_madd_epi16(Hi, Hi));
+        }
+
+        alignas(32) Uint32 Lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(Lanes), Sum);
+        for (Uint32 Lane : Lanes)
+            SumSq += Lane;
+    }
+#elif DILIGENT_SSE2_ENABLED
+    const __m128i Zero = _mm_setzero_si128();
+    while (i + 16 <= Num)
+    {
+        __m128i      Sum     = Zero;
+        const size_t SpanEnd = std::min(Num, i + size_t{16} * 4096);
+        for (; i + 16 <= SpanEnd; i += 16)
+        {
+            const __m128i Val1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData1 + i));
+            const __m128i Val2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData2 + i));
+            const __m128i Diff = _mm_or_si128(_mm_subs_epu8(Val1, Val2), _mm_subs_epu8(Val2, Val1));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(pDiff + i), Diff);
+
+            const __m128i Lo = _mm_unpacklo_epi8(Diff, Zero);
+            const __m128i Hi = _mm_unpackhi_epi8(Diff, Zero);
+            Sum              = _mm_add_epi32(Sum, _mm_madd_epi16(Lo, Lo));
+            Sum              = _mm_add_epi32(Sum, _mm_madd_epi16(Hi, Hi));
+        }
+
+        alignas(16) Uint32 Lanes[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(Lanes), Sum);
+        for (Uint32 Lane : Lanes)
+            SumSq += Lane;
+    }
+#elif DILIGENT_NEON_ENABLED
+    while (i + 16 <= Num)
+    {
+        uint32x4_t   Sum     = vdupq_n_u32(0);
+        const size_t SpanEnd = std::min(Num, i + size_t{16} * 4096);
+        for (; i + 16 <= SpanEnd; i += 16)
+        {
+            const uint8x16_t Diff = vabdq_u8(vld1q_u8(pData1 + i), vld1q_u8(pData2 + i));
+            vst1q_u8(pDiff + i, Diff);
+
+            const uint16x8_t Lo = vmovl_u8(vget_low_u8(Diff));
+            const uint16x8_t Hi = vmovl_u8(vget_high_u8(Diff));
+            Sum                 = vpadalq_u16(Sum, vmulq_u16(Lo, Lo));
+            Sum                 = vpadalq_u16(Sum, vmulq_u16(Hi, Hi));
+        }
+
+        SumSq += Uint64{vgetq_lane_u32(Sum, 0)} + vgetq_lane_u32(Sum, 1) + vgetq_lane_u32(Sum, 2) + vgetq_lane_u32(Sum, 3);
+    }
+#endif
+
+    return i;
+}
+
+// Computes the per-pixel statistics of the first pixels of a row of 4-channel differences.
+// A pixel difference is the maximum of its channel differences.
+size_t AccumulatePixelStatsRGBA8(const Uint8* pDiffs, size_t NumPixels, Uint32 Threshold, ImageDiffAccumulator& Acc)
+{
+    size_t i = 0;
+
+    // Pixel differences never exceed 255
+    const int Thresh = static_cast<int>(std::min(Threshold, 255u));
+
+    Uint32 NumDiff      = 0;
+    Uint32 NumAbove     = 0;
+    Uint64 SumDiff      = 0;
+    Uint64 SumDiffSq    = 0;
+    Uint32 MaxPixelDiff = 0;
+
+#if DILIGENT_AVX2_ENABLED || DILIGENT_SSE2_ENABLED
+#    if DILIGENT_AVX2_ENABLED
+    using VecType          = __m256i;
+    constexpr size_t Width = 8;
+#        define VEC_OP(Op) _mm256_##Op
+#        define VEC_SI(Op) _mm256_##Op##_si256
+#        define VEC_STORE  _mm256_store_si256
+#    else
+    using VecType          = __m128i;
+    constexpr size_t Width = 4;
+#        define VEC_OP(Op) _mm_##Op
+#        define VEC_SI(Op) _mm_##Op##_si128
+#        define VEC_STORE  _mm_store_si128
+#    endif
+
+    const VecType ByteMask  = VEC_OP(set1_epi32)(0xFF);
+    const VecType ThreshVec = VEC_OP(set1_epi32)(Thresh);
+    const VecType Zero      = VEC_SI(setzero)();
+
+    VecType NumDiffVec  = Zero;
+    VecType NumAboveVec = Zero;
+    VecType SumVec      = Zero;
+    VecType SumSqVec    = Zero;
+    VecType MaxVec      = Zero;
+    // Every lane processes at most 2^16 / Width pixels, so its sum of squares
+    // (255^2 per pixel at most) cannot overflow 32 bits.
+    const size_t NumVecPixels = std::min(NumPixels, size_t{1} << 16) / Width * Width;
+    for (; i < NumVecPixels; i += Width)
+    {
+        const VecType Diff = VEC_SI(loadu)(reinterpret_cast<const VecType*>(pDiffs + i * 4));
+
+        // Compute the maximum of the four bytes of every 32-bit lane
+        VecType PixelDiff = VEC_OP(max_epu8)(Diff, VEC_OP(srli_epi32)(Diff, 8));
+        PixelDiff         = VEC_OP(max_epu8)(PixelDiff, VEC_OP(srli_epi32)(PixelDiff, 16));
+        PixelDiff         = VEC_SI(and)(PixelDiff, ByteMask);
+
+        // Comparison masks are -1 for true, so subtracting them increments the counters
+        NumDiffVec  = VEC_OP(sub_epi32)(NumDiffVec, VEC_OP(cmpgt_epi32)(PixelDiff, Zero));
+        NumAboveVec = VEC_OP(sub_epi32)(NumAboveVec, VEC_OP(cmpgt_epi32)(PixelDiff, ThreshVec));
+        SumVec      = VEC_OP(add_epi32)(SumVec, PixelDiff);
+        // The upper 16 bits of every lane are zero, so madd computes the square
+        SumSqVec = VEC_OP(add_epi32)(SumSqVec, VEC_OP(madd_epi16)(PixelDiff, PixelDiff));
+        MaxVec   = VEC_OP(max_epu8)(MaxVec, PixelDiff);
+    }
+
+    alignas(32) Uint32 Lanes[5][Width];
+    VEC_STORE(reinterpret_cast<VecType*>(Lanes[0]), NumDiffVec);
+    VEC_STORE(reinterpret_cast<VecType*>(Lanes[1]), NumAboveVec);
+    VEC_STORE(reinterpret_cast<VecType*>(Lanes[2]), SumVec);
+    VEC_STORE(reinterpret_cast<VecType*>(Lanes[3]), SumSqVec);
+    VEC_STORE(reinterpret_cast<VecType*>(Lanes[4]), MaxVec);
+    for (size_t l = 0; l < Width; ++l)
+    {
+        NumDiff += Lanes[0][l];
+        NumAbove += Lanes[1][l];
+        SumDiff += Lanes[2][l];
+        SumDiffSq += Lanes[3][l];
+        MaxPixelDiff = std::max(MaxPixelDiff, Lanes[4][l]);
+    }
+#    undef VEC_OP
+#    undef VEC_SI
+#    undef VEC_STORE
+#elif DILIGENT_NEON_ENABLED
+    const uint32x4_t ByteMask  = vdupq_n_u32(0xFF);
+    const uint32x4_t ThreshVec = vdupq_n_u32(static_cast<Uint32>(Thresh));
+
+    uint32x4_t   NumDiffVec   = vdupq_n_u32(0);
+    uint32x4_t   NumAboveVec  = vdupq_n_u32(0);
+    uint32x4_t   SumVec       = vdupq_n_u32(0);
+    uint32x4_t   SumSqVec     = vdupq_n_u32(0);
+    uint32x4_t   MaxVec       = vdupq_n_u32(0);
+    const size_t NumVecPixels = std::min(NumPixels, size_t{1} << 16) / 4 * 4;
+    for (; i < NumVecPixels; i += 4)
+    {
+        const uint32x4_t Diff = vreinterpretq_u32_u8(vld1q_u8(pDiffs + i * 4));
+
+        uint32x4_t PixelDiff = vreinterpretq_u32_u8(vmaxq_u8(vreinterpretq_u8_u32(Diff), vreinterpretq_u8_u32(vshrq_n_u32(Diff, 8))));
+        PixelDiff            = vreinterpretq_u32_u8(vmaxq_u8(vreinterpretq_u8_u32(PixelDiff), vreinterpretq_u8_u32(vshrq_n_u32(PixelDiff, 16))));
+        PixelDiff            = vandq_u32(PixelDiff, ByteMask);
+
+        // Comparison masks are all ones for true, so subtracting them increments the counters
+        NumDiffVec  = vsubq_u32(NumDiffVec, vtstq_u32(PixelDiff, PixelDiff));
+        NumAboveVec = vsubq_u32(NumAboveVec, vcgtq_u32(PixelDiff, ThreshVec));
+        SumVec      = vaddq_u32(SumVec, PixelDiff);
+        SumSqVec    = vmlaq_u32(SumSqVec, PixelDiff, PixelDiff);
+        MaxVec      = vmaxq_u32(MaxVec, PixelDiff);
+    }
+
+    Uint32 Lanes[5][4];
+    vst1q_u32(Lanes[0], NumDiffVec);
+    vst1q_u32(Lanes[1], NumAboveVec);
+    vst1q_u32(Lanes[2], SumVec);
+    vst1q_u32(Lanes[3], SumSqVec);
+    vst1q_u32(Lanes[4], MaxVec);
+    for (size_t l = 0; l < 4; ++l)
+    {
+        NumDiff += Lanes[0][l];
+        NumAbove += Lanes[1][l];
+        SumDiff += Lanes[2][l];
+        SumDiffSq += Lanes[3][l];
+        MaxPixelDiff = std::max(MaxPixelDiff, Lanes[4][l]);
+    }
+#endif
+
+    Acc.NumDiffPixels += NumDiff;
+    Acc.NumDiffPixelsAboveThreshold += NumAbove;
+    Acc.SumDiff += static_cast<double>(SumDiff);
+    Acc.SumDiffSq += static_cast<double>(SumDiffSq);
+    Acc.MaxDiff = std::max(Acc.MaxDiff, static_cast<float>(MaxPixelDiff));
+
+    (void)Thresh;
+    return i;
+}
+
+// Adds the first values of the rows and their products to the SSIM column sums.
+size_t AccumulateColumnSumsU8(const Uint8* pRow1, const Uint8* pRow2, size_t Num, Uint16* pX, Uint16* pY, Uint32* pXX, Uint32* pYY, Uint32* pXY)
+{
+    size_t i = 0;
+
+#if DILIGENT_AVX2_ENABLED
+    auto AddProduct = [](Uint32* pSums, __m256i Prod) {
+        __m256i* pLo = reinterpret_cast<__m256i*>(pSums);
+        __m256i* pHi = reinterpret_cast<__m256i*>(pSums + 8);
+        _mm256_storeu_si256(pLo, _mm256_add_epi32(_mm256_loadu_si256(pLo), _mm256_cvtepu16_epi32(_mm256_castsi256_si128(Prod))));
+        _mm256_storeu_si256(pHi, _mm256_add_epi32(_mm256_loadu_si256(pHi), _mm256_cvtepu16_epi32(_mm256_extracti128_si256(Prod, 1))));
+    };
+    for (; i + 16 <= Num; i += 16)
+    {
+        const __m256i x = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pRow1 + i)));
+        const __m256i y = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pRow2 + i)));
+
+        __m256i* pSumX = reinterpret_cast<__m256i*>(pX + i);
+        __m256i* pSumY = reinterpret_cast<__m256i*>(pY + i);
+        _mm256_storeu_si256(pSumX, _mm256_add_epi16(_mm256_loadu_si256(pSumX), x));
+        _mm256_storeu_si256(pSumY, _mm256_add_epi16(_mm256_loadu_si256(pSumY), y));
+
+        // The products of 8-bit values fit into 16 bits
+        AddProduct(pXX + i, _mm256_mullo_epi16(x, x));
+        AddProduct(pYY + i, _mm256_mullo_epi16(y, y));
+        AddProduct(pXY + i, _mm256_mullo_epi16(x, y));
+    }
+#elif DILIGENT_SSE2_ENABLED
+    const __m128i Zero       = _mm_setzero_si128();
+    auto          AddProduct = [Zero](Uint32* pSums, __m128i Prod) {
+        __m128i* pLo = reinterpret_cast<__m128i*>(pSums);
+        __m128i* pHi = reinterpret_cast<__m128i*>(pSums + 4);
+        _mm_storeu_si128(pLo, _mm_add_epi32(_mm_loadu_si128(pLo), _mm_unpacklo_epi16(Prod, Zero)));
+        _mm_storeu_si128(pHi, _mm_add_epi32(_mm_loadu_si128(pHi), _mm_unpackhi_epi16(Prod, Zero)));
+    };
+    for (; i + 8 <= Num; i += 8)
+    {
+        const __m128i x = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pRow1 + i)), Zero);
+        const __m128i y = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pRow2 + i)), Zero);
+
+        __m128i* pSumX = reinterpret_cast<__m128i*>(pX + i);
+        __m128i* pSumY = reinterpret_cast<__m128i*>(pY + i);
+        _mm_storeu_si128(pSumX, _mm_add_epi16(_mm_loadu_si128(pSumX), x));
+        _mm_storeu_si128(pSumY, _mm_add_epi16(_mm_loadu_si128(pSumY), y));
+
+        // The products of 8-bit values fit into 16 bits
+        AddProduct(pXX + i, _mm_mullo_epi16(x, x));
+        AddProduct(pYY + i, _mm_mullo_epi16(y, y));
+        AddProduct(pXY + i, _mm_mullo_epi16(x, y));
+    }
+#elif DILIGENT_NEON_ENABLED
+    auto AddProduct = [](Uint32* pSums, uint16x8_t Prod) {
+        vst1q_u32(pSums, vaddw_u16(vld1q_u32(pSums), vget_low_u16(Prod)));
+        vst1q_u32(pSums + 4, vaddw_u16(vld1q_u32(pSums + 4), vget_high_u16(Prod)));
+    };
+    for (; i + 8 <= Num; i += 8)
+    {
+        const uint16x8_t x = vmovl_u8(vld1_u8(pRow1 + i));
+        const uint16x8_t y = vmovl_u8(vld1_u8(pRow2 + i));
+
+        vst1q_u16(pX + i, vaddq_u16(vld1q_u16(pX + i), x));
+        vst1q_u16(pY + i, vaddq_u16(vld1q_u16(pY + i), y));
+
+        AddProduct(pXX + i, vmulq_u16(x, x));
+        AddProduct(pYY + i, vmulq_u16(y, y));
+        AddProduct(pXY + i, vmulq_u16(x, y));
+    }
+#endif
+
+    return i;
+}
+
+template <typename T>
+class ImageDiffProcessor
+{
+public:
+    using Traits        = ImageDiffTraits<T>;
+    using DiffType      = typename Traits::DiffType;
+    using LinearSumType = typename Traits::LinearSumType;
+    using SumType       = typename Traits::SumType;
+
+    ImageDiffProcessor(const ComputeImageDifferenceAttribs& Attribs, Uint32 NumSrcChannels, Uint32 NumDiffChannels) :
+        m_Attribs{Attribs},
+        m_NumSrcChannels{NumSrcChannels},
+        m_NumDiffChannels{NumDiffChannels},
+        m_NumWindows{(Attribs.Width + SSIMWindowSize - 1) / SSIMWindowSize},
+        m_IsPacked{Attribs.NumChannels1 == NumSrcChannels && Attribs.NumChannels2 == NumSrcChannels}
+    {}
+
+    // Processes the rows [FirstRow, EndRow). FirstRow must be a multiple of the SSIM window size.
+    void ProcessRows(Uint32 FirstRow, Uint32 EndRow, ImageDiffAccumulator& Acc) const
+    {
+        VERIFY_EXPR(FirstRow % SSIMWindowSize == 0);
+
+        const size_t NumSamples = size_t{m_Attribs.Width} * m_NumSrcChannels;
+
+        std::vector<DiffType> ChannelDiffs(NumSamples);
+        ColumnSums            Sums{NumSamples};
+        for (Uint32 row = FirstRow; row < EndRow; ++row)
+        {
+            if (row % SSIMWindowSize == 0)
+                Sums.Reset();
+
+            const T* pRow1    = reinterpret_cast<const T*>(reinterpret_cast<const Uint8*>(m_Attribs.pImage1) + size_t{row} * m_Attribs.Stride1);
+            const T* pRow2    = reinterpret_cast<const T*>(reinterpret_cast<const Uint8*>(m_Attribs.pImage2) + size_t{row} * m_Attribs.Stride2);
+            Uint8*   pDiffRow = m_Attribs.pDiffImage != nullptr ? reinterpret_cast<Uint8*>(m_Attribs.pDiffImage) + size_t{row} * m_Attribs.DiffStride : nullptr;
+
+            ComputeChannelDiffs(pRow1, pRow2, ChannelDiffs.data(), Acc);
+            AccumulatePixelStats(ChannelDiffs.data(), Acc);
+            if (pDiffRow != nullptr)
+                WriteDiffRow(ChannelDiffs.data(), pDiffRow);
+            AccumulateColumnSums(pRow1, pRow2, Sums);
+
+            if ((row + 1) % SSIMWindowSize == 0 || row + 1 == m_Attribs.Height)
+            {
+                const Uint32 NumWindowRows = row % SSIMWindowSize + 1;
+                ComputeWindowSSIM(Sums, NumWindowRows, Acc);
+            }
+        }
+    }
+
+private:
+    // The sums of x, y, x^2, y^2 and xy over the rows of the current band of SSIM windows,
+    // for every column and channel. Accumulating the columns independently keeps the
+    // per-row loop free of indexing, so that it can be vectorized; the columns are
+    // reduced to windows once per band.
+    struct ColumnSums
+    {
+        explicit ColumnSums(size_t NumSamples) :
+            X(NumSamples), Y(NumSamples), XX(NumSamples), YY(NumSamples), XY(NumSamples)
+        {}
+
+        void Reset()
+        {
+            std::fill(X.begin(), X.end(), LinearSumType{0});
+            std::fill(Y.begin(), Y.end(), LinearSumType{0});
+            std::fill(XX.begin(), XX.end(), SumType{0});
+            std::fill(YY.begin(), YY.end(), SumType{0});
+            std::fill(XY.begin(), XY.end(), SumType{0});
+        }
+
+        std::vector<LinearSumType> X, Y;
+        std::vector<SumType>       XX, YY, XY;
+    };
+
+    Uint32 SampleOffset1(size_t i) const { return m_IsPacked ? static_cast<Uint32>(i) : static_cast<Uint32>(i / m_NumSrcChannels * m_Attribs.NumChannels1 + i % m_NumSrcChannels); }
+    Uint32 SampleOffset2(size_t i) const { return m_IsPacked ? static_cast<Uint32>(i) : static_cast<Uint32>(i / m_NumSrcChannels * m_Attribs.NumChannels2 + i % m_NumSrcChannels); }
+
+    void ComputeChannelDiffs(const T* pRow1, const T* pRow2, DiffType* pChannelDiffs, ImageDiffAccumulator& Acc) const
+    {
+        const size_t NumSamples = size_t{m_Attribs.Width} * m_NumSrcChannels;
+
+        size_t i = 0;
+        if (m_IsPacked && std::is_same<T, Uint8>::value)
+        {
+            Uint64 SumSq = 0;
+            i            = ComputeAbsDiffU8(reinterpret_cast<const Uint8*>(pRow1), reinterpret_cast<const Uint8*>(pRow2), NumSamples,
+                                 reinterpret_cast<Uint8*>(pChannelDiffs), SumSq);
+            Acc.SumSqErr += static_cast<double>(SumSq);
+        }
+
+        double SumSqErr = 0;
+        for (; i < NumSamples; ++i)
+        {
+            const DiffType Diff = AbsDiff(Traits::ToDiffUnits(pRow1[SampleOffset1(i)]), Traits::ToDiffUnits(pRow2[SampleOffset2(i)]));
+
+            pChannelDiffs[i] = Diff;
+            SumSqErr += static_cast<double>(Diff) * static_cast<double>(Diff);
+        }
+        Acc.SumSqErr += SumSqErr;
+    }
+
+    void AccumulatePixelStats(const DiffType* pChannelDiffs, ImageDiffAccumulator& Acc) const
+    {
+        Uint32 col = 0;
+        if (m_NumSrcChannels == 4 && std::is_same<T, Uint8>::value)
+        {
+            col = static_cast<Uint32>(AccumulatePixelStatsRGBA8(reinterpret_cast<const Uint8*>(pChannelDiffs), m_Attribs.Width, m_Attribs.Threshold, Acc));
+        }
+
+        const float Threshold = static_cast<float>(m_Attribs.Threshold);
+        for (; col < m_Attribs.Width; ++col)
+        {
+            const DiffType* pPixelDiffs = pChannelDiffs + col * m_NumSrcChannels;
+
+            DiffType PixelDiff = 0;
+            for (Uint32 ch = 0; ch < m_NumSrcChannels; ++ch)
+                PixelDiff = std::max(PixelDiff, pPixelDiffs[ch]);
+
+            if (PixelDiff != 0)
+            {
+                const double Diff = static_cast<double>(PixelDiff);
+                ++Acc.NumDiffPixels;
+                Acc.SumDiff += Diff;
+                Acc.SumDiffSq += Diff * Diff;
+                Acc.MaxDiff = std::max(Acc.MaxDiff, static_cast<float>(PixelDiff));
+
+                if (static_cast<float>(PixelDiff) > Threshold)
+                    ++Acc.NumDiffPixelsAboveThreshold;
+            }
+        }
+    }
+
+    void WriteDiffRow(const DiffType* pChannelDiffs, Uint8* pDiffRow) const
+    {
+        for (Uint32 col = 0; col < m_Attribs.Width; ++col)
+        {
+            const DiffType* pPixelDiffs = pChannelDiffs + col * m_NumSrcChannels;
+            Uint8*          pDiffPixel  = pDiffRow + col * m_NumDiffChannels;
+            for (Uint32 ch = 0; ch < m_NumDiffChannels; ++ch)
+            {
+                pDiffPixel[ch] = ch < m_NumSrcChannels ?
+                    static_cast<Uint8>(std::min(static_cast<float>(pPixelDiffs[ch]) * m_Attribs.Scale, 255.f)) :
+                    (ch == 3 ? 255 : 0);
+            }
+        }
+    }
+
+    void AccumulateColumnSums(const T* pRow1, const T* pRow2, ColumnSums& Sums) const
+    {
+        const size_t NumSamples = size_t{m_Attribs.Width} * m_NumSrcChannels;
+
+        LinearSumType* const pX  = Sums.X.data();
+        LinearSumType* const pY  = Sums.Y.data();
+        SumType* const       pXX = Sums.XX.data();
+        SumType* const       pYY = Sums.YY.data();
+        SumType* const       pXY = Sums.XY.data();
+
+        size_t i = 0;
+        if (m_IsPacked && std::is_same<T, Uint8>::value)
+        {
+            i = AccumulateColumnSumsU8(reinterpret_cast<const Uint8*>(pRow1), reinterpret_cast<const Uint8*>(pRow2), NumSamples,
+                                       reinterpret_cast<Uint16*>(pX), reinterpret_cast<Uint16*>(pY),
+                                       reinterpret_cast<Uint32*>(pXX), reinterpret_cast<Uint32*>(pYY), reinterpret_cast<Uint32*>(pXY));
+        }
+
+        for (; i < NumSamples; ++i)
+        {
+            const SumType x = static_cast<SumType>(Traits::ToDiffUnits(pRow1[SampleOffset1(i)]));
+            const SumType y = static_cast<SumType>(Traits::ToDiffUnits(pRow2[SampleOffset2(i)]));
+            pX[i] += static_cast<LinearSumType>(x);
+            pY[i] += static_cast<LinearSumType>(y);
+            pXX[i] += x * x;
+            pYY[i] += y * y;
+            pXY[i] += x * y;
+        }
+    }
+
+    void ComputeWindowSSIM(const ColumnSums& Sums, Uint32 NumWindowRows, ImageDiffAccumulator& Acc) const
+    {
+        constexpr double L  = Traits::PeakValue;
+        constexpr double C1 = (0.01 * L) * (0.01 * L);
+        constexpr double C2 = (0.03 * L) * (0.03 * L);
+
+        for (Uint32 wnd = 0; wnd < m_NumWindows; ++wnd)
+        {
+            const Uint32 FirstCol      = wnd * SSIMWindowSize;
+            const Uint32 NumWindowCols = std::min(SSIMWindowSize, m_Attribs.Width - FirstCol);
+            const double InvN          = 1.0 / static_cast<double>(NumWindowCols * NumWindowRows);
+            for (Uint32 ch = 0; ch < m_NumSrcChannels; ++ch)
+            {
+                SumType X = 0, Y = 0, XX = 0, YY = 0, XY = 0;
+                for (Uint32 col = FirstCol; col < FirstCol + NumWindowCols; ++col)
+                {
+                    const size_t i = size_t{col} * m_NumSrcChannels + ch;
+                    X += Sums.X[i];
+                    Y += Sums.Y[i];
+                    XX += Sums.XX[i];
+                    YY += Sums.YY[i];
+                    XY += Sums.XY[i];
+                }
+
+                const double MeanX = static_cast<double>(X) * InvN;
+                const double MeanY = static_cast<double>(Y) * InvN;
+                const double VarX  = std::max(static_cast<double>(XX) * InvN - MeanX * MeanX, 0.0);
+                const double VarY  = std::max(static_cast<double>(YY) * InvN - MeanY * MeanY, 0.0);
+                const double CovXY = static_cast<double>(XY) * InvN - MeanX * MeanY;
+
+                Acc.SumSSIM += ((2 * MeanX * MeanY + C1) * (2 * CovXY + C2)) /
+                    ((MeanX * MeanX + MeanY * MeanY + C1) * (VarX + VarY + C2));
+            }
+            Acc.NumSSIMWindows += m_NumSrcChannels;
+        }
+    }
+
+private:
+    const ComputeImageDifferenceAttribs& m_Attribs;
+
+    const Uint32 m_NumSrcChannels;
+    const Uint32 m_NumDiffChannels;
+    const Uint32 m_NumWindows;
+
+    // Both images have exactly NumSrcChannels channels
+    const bool m_IsPacked;
+};
+
+template <typename T>
+void ComputeImageDifferenceImpl(const ComputeImageDifferenceAttribs& Attribs,
+                                Uint32                               NumSrcChannels,
+                                Uint32                               NumDiffChannels,
+                                ImageDiffAccumulator&                Acc)
+{
+    const ImageDiffProcessor<T> Processor{Attribs, NumSrcChannels, NumDiffChannels};
+
+    // Rows are processed in bands of whole SSIM windows so that every band is independent.
+    // A band of at least 64K pixels amortizes the scheduling overhead.
+    const Uint32 NumBands    = (Attribs.Height + SSIMWindowSize - 1) / SSIMWindowSize;
+    const size_t MinBandSize = std::max(size_t{64 << 10} / (size_t{Attribs.Width} * SSIMWindowSize + 1), size_t{1});
+
+    std::mutex AccMtx;
+    ParallelFor(Attribs.pThreadPool, 0, NumBands, MinBandSize,
+                [&](size_t FirstBand, size_t EndBand) {
+                    ImageDiffAccumulator ChunkAcc;
+                    Processor.ProcessRows(static_cast<Uint32>(FirstBand * SSIMWindowSize),
+                                          std::min(static_cast<Uint32>(EndBand * SSIMWindowSize), Attribs.Height),
+                                          ChunkAcc);
+
+                    std::lock_guard<std::mutex> Lock{AccMtx};
+                    Acc += ChunkAcc;
+                });
+}
+
+} // namespace
+
 void ComputeImageDifference(const ComputeImageDifferenceAttribs& Attribs,
                             ImageDiffInfo&                       Diff)
 {
@@ -45,15 +663,26 @@ void ComputeImageDifference(const ComputeImageDifferenceAttribs& Attribs,
         return;
     }
 
+    Uint32 ComponentSize = 0;
+    switch (Attribs.ComponentType)
+    {
+        case VT_UINT8: ComponentSize = 1; break;
+        case VT_UINT16: ComponentSize = 2; break;
+        case VT_FLOAT32: ComponentSize = 4; break;
+        default:
+            UNEXPECTED("Unsupported component type. Only VT_UINT8, VT_UINT16 and VT_FLOAT32 are supported.");
+            return;
+    }
+
     if (Attribs.NumChannels1 == 0)
     {
         UNEXPECTED("NumChannels1 cannot be zero");
         return;
     }
 
-    if (Attribs.Stride1 < Attribs.Width * Attribs.NumChannels1)
+    if (Attribs.Stride1 < Attribs.Width * Attribs.NumChannels1 * ComponentSize)
     {
-        UNEXPECTED("Stride1 is too small. It must be at least ", Attribs.Width * Attribs.NumChannels1, " bytes long.");
+        UNEXPECTED("Stride1 is too small. It must be at least ", Attribs.Width * Attribs.NumChannels1 * ComponentSize, " bytes long.");
         return;
     }
 
@@ -62,9 +691,15 @@ void ComputeImageDifference(const ComputeImageDifferenceAttribs& Attribs,
         UNEXPECTED("NumChannels2 cannot be zero");
         return;
     }
-    if (Attribs.Stride2 < Attribs.Width * Attribs.NumChannels2)
+    if (Attribs.Stride2 < Attribs.Width * Attribs.NumChannels2 * ComponentSize)
     {
-        UNEXPECTED("Stride2 is too small. It must be at least ", Attribs.Width * Attribs.NumChannels2, " bytes long.");
+        UNEXPECTED("Stride2 is too small. It must be at least ", Attribs.Width * Attribs.NumChannels2 * ComponentSize, " bytes long.");
+        return;
+    }
+
+    if (Attribs.Height > 1 && (Attribs.Stride1 % ComponentSize != 0 || Attribs.Stride2 % ComponentSize != 0))
+    {
+        UNEXPECTED("Image strides must be multiples of the component size (", ComponentSize, ")");
         return;
     }
 
@@ -79,56 +714,47 @@ void ComputeImageDifference(const ComputeImageDifferenceAttribs& Attribs,
         }
     }
 
-    for (Uint32 row = 0; row < Attribs.Height; ++row)
+    if (Attribs.Width == 0 || Attribs.Height == 0)
+        return;
+
+    ImageDiffAccumulator Acc;
+    double               PeakValue = 0;
+    switch (Attribs.ComponentType)
     {
-        const Uint8* pRow1    = reinterpret_cast<const Uint8*>(Attribs.pImage1) + row * Attribs.Stride1;
-        const Uint8* pRow2    = reinterpret_cast<const Uint8*>(Attribs.pImage2) + row * Attribs.Stride2;
-        Uint8*       pDiffRow = Attribs.pDiffImage != nullptr ? reinterpret_cast<Uint8*>(Attribs.pDiffImage) + row * Attribs.DiffStride : nullptr;
+        case VT_UINT8:
+            ComputeImageDifferenceImpl<Uint8>(Attribs, NumSrcChannels, NumDiffChannels, Acc);
+            PeakValue = ImageDiffTraits<Uint8>::PeakValue;
+            break;
 
-        for (Uint32 col = 0; col < Attribs.Width; ++col)
-        {
-            Uint32 PixelDiff = 0;
-            for (Uint32 ch = 0; ch < NumSrcChannels; ++ch)
-            {
-                const Uint32 ChannelDiff = static_cast<Uint32>(
-                    std::abs(static_cast<int>(pRow1[col * Attribs.NumChannels1 + ch]) -
-                             static_cast<int>(pRow2[col * Attribs.NumChannels2 + ch])));
-                PixelDiff = std::max(PixelDiff, ChannelDiff);
+        case VT_UINT16:
+            ComputeImageDifferenceImpl<Uint16>(Attribs, NumSrcChannels, NumDiffChannels, Acc);
+            PeakValue = ImageDiffTraits<Uint16>::PeakValue;
+            break;
 
-                if (pDiffRow != nullptr && ch < NumDiffChannels)
-                {
-                    pDiffRow[col * NumDiffChannels + ch] = static_cast<Uint8>(std::min(ChannelDiff * Attribs.Scale, 255.f));
-                }
-            }
+        case VT_FLOAT32:
+            ComputeImageDifferenceImpl<float>(Attribs, NumSrcChannels, NumDiffChannels, Acc);
+            PeakValue = ImageDiffTraits<float>::PeakValue;
+            break;
 
-            if (pDiffRow != nullptr)
-            {
-                for (Uint32 ch = NumSrcChannels; ch < NumDiffChannels; ++ch)
-                {
-                    pDiffRow[col * NumDiffChannels + ch] = ch == 3 ? 255 : 0;
-                }
-            }
-
-            if (PixelDiff != 0)
-            {
-                ++Diff.NumDiffPixels;
-                Diff.AvgDiff += static_cast<float>(PixelDiff);
-                Diff.RmsDiff += static_cast<float>(PixelDiff * PixelDiff);
-                Diff.MaxDiff = std::max(Diff.MaxDiff, PixelDiff);
-
-                if (PixelDiff > Attribs.Threshold)
-                {
-                    ++Diff.NumDiffPixelsAboveThreshold;
-                }
-            }
-        }
+        default:
+            UNEXPECTED("Unexpected component type");
     }
 
-    if (Diff.NumDiffPixels > 0)
+    Diff.NumDiffPixels               = static_cast<Uint32>(Acc.NumDiffPixels);
+    Diff.NumDiffPixelsAboveThreshold = static_cast<Uint32>(Acc.NumDiffPixelsAboveThreshold);
+    Diff.MaxDiff                     = static_cast<Uint32>(std::round(Acc.MaxDiff));
+    if (Acc.NumDiffPixels > 0)
     {
-        Diff.AvgDiff /= static_cast<float>(Diff.NumDiffPixels);
-        Diff.RmsDiff = std::sqrt(Diff.RmsDiff / static_cast<float>(Diff.NumDiffPixels));
+        Diff.AvgDiff = static_cast<float>(Acc.SumDiff / static_cast<double>(Acc.NumDiffPixels));
+        Diff.RmsDiff = static_cast<float>(std::sqrt(Acc.SumDiffSq / static_cast<double>(Acc.NumDiffPixels)));
     }
+
+    const double NumSamples = static_cast<double>(Attribs.Width) * Attribs.Height * NumSrcChannels;
+    const double MSE        = Acc.SumSqErr / NumSamples;
+    Diff.PSNR               = MSE > 0 ?
+        static_cast<float>(10.0 * std::log10(PeakValue * PeakValue / MSE)) :
+        std::numeric_limits<float>::infinity();
+    Diff.SSIM = Acc.NumSSIMWindows > 0 ? static_cast<float>(Acc.SumSSIM / static_cast<double>(Acc.NumSSIMWindows)) : 1.f;
 }
 
 } // namespace Diligent
@@ -0,0 +1,215 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "InternedStringPool.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "DynamicLinearAllocator.hpp"
+#include "STDAllocator.hpp"
+
+namespace Diligent
+{
+
+class InternedStringPool::Shard
+{
+public:
+    using Header = InternedString::Header;
+
+    void Initialize(IMemoryAllocator& Allocator, Uint32 ChunkSize)
+    {
+        m_pArena.reset(new DynamicLinearAllocator{Allocator, ChunkSize});
+        m_pTable.reset(new TableType{STD_ALLOCATOR_RAW_MEM(const Header*, Allocator, "Allocator for vector<const Header*>")});
+        m_pTable->resize(MinTableSize);
+    }
+
+    const Header* Intern(const Char* Str, size_t Length, size_t Hash)
+    {
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+
+        ++m_Stats.NumRequests;
+        m_Stats.RequestedSize += Length + 1;
+
+        size_t Idx = FindSlot(Str, Length, Hash);
+        if (const Header* pHeader = (*m_pTable)[Idx])
+            return pHeader;
+
+        Header* pHeader = reinterpret_cast<Header*>(m_pArena->Allocate(sizeof(Header) + Length + 1, alignof(Header)));
+        pHeader->Hash   = Hash;
+        pHeader->Length = Length;
+
+        Char* pStr = reinterpret_cast<Char*>(pHeader + 1);
+        if (Length != 0)
+            std::memcpy(pStr, Str, Length);
+        pStr[Length] = 0;
+
+        ++m_Stats.NumStrings;
+        m_Stats.StoredSize += Length + 1;
+
+        // Keep the load factor below 1/2
+        if ((m_Stats.NumStrings * 2) > m_pTable->size())
+        {
+            Grow();
+            Idx = FindSlot(Str, Length, Hash);
+        }
+        VERIFY_EXPR((*m_pTable)[Idx] == nullptr);
+        (*m_pTable)[Idx] = pHeader;
+
+        return pHeader;
+    }
+
+    const Header* Find(const Char* Str, size_t Length, size_t Hash)
+    {
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+        return (*m_pTable)[FindSlot(Str, Length, Hash)];
+    }
+
+    void AddStats(InternedStringPoolStats& Stats)
+    {
+        std::lock_guard<std::mutex> Guard{m_Mtx};
+        Stats.NumStrings += m_Stats.NumStrings;
+        Stats.NumRequests += m_Stats.NumRequests;
+        Stats.RequestedSize += m_Stats.RequestedSize;
+        Stats.StoredSize += m_Stats.StoredSize;
+        Stats.ReservedSize += m_pArena->GetReservedSize() + m_pTable->size() * sizeof(const Header*);
+    }
+
+private:
+    // Returns the index of the slot that contains the string, or of the empty slot where it should be inserted.
+    size_t FindSlot(const Char* Str, size_t Length, size_t Hash) const
+    {
+        const TableType& Table = *m_pTable;
+        VERIFY_EXPR(IsPowerOfTwo(Table.size()));
+        const size_t Mask = Table.size() - 1;
+        for (size_t Idx = Hash & Mask;; Idx = (Idx + 1) & Mask)
+        {
+            const Header* pHeader = Table[Idx];
+            if (pHeader == nullptr)
+                return Idx;
+
+            if (pHeader->Hash == Hash &&
+                pHeader->Length == Length &&
+                std::memcmp(pHeader + 1, Str, Length) == 0)
+                return Idx;
+        }
+    }
+
+    void Grow()
+    {
+        TableType NewTable{m_pTable->size() * 2, nullptr, m_pTable->get_allocator()};
+
+        const size_t Mask = NewTable.size() - 1;
+        for (const Header* pHeader : *m_pTable)
+        {
+            if (pHeader == nullptr)
+                continue;
+
+            size_t Idx = pHeader->Hash & Mask;
+            while (NewTable[Idx] != nullptr)
+                Idx = (Idx + 1) & Mask;
+            NewTable[Idx] = pHeader;
+        }
+        m_pTable->swap(NewTable);
+    }
+
+private:
+    static constexpr size_t MinTableSize = 64;
+
+    using TableType = std::vector<const Header*, STDAllocatorRawMem<const Header*>>;
+
+    std::mutex m_Mtx;
+
+    std::unique_ptr<DynamicLinearAllocator> m_pArena;
+    std::unique_ptr<TableType>              m_pTable;
+
+    InternedStringPoolStats m_Stats;
+};
+
+InternedStringPool::InternedStringPool(IMemoryAllocator& Allocator, Uint32 ChunkSize, Uint32 NumShards) :
+    m_Allocator{Allocator},
+    m_NumShards{std::max(NumShards, 1u)},
+    m_Shards{new Shard[m_NumShards]}
+{
+    for (Uint32 i = 0; i < m_NumShards; ++i)
+        m_Shards[i].Initialize(m_Allocator, ChunkSize);
+}
+
+InternedStringPool::~InternedStringPool()
+{
+}
+
+InternedStringPool::Shard& InternedStringPool::GetShard(size_t Hash) const
+{
+    if (m_NumShards == 1)
+        return m_Shards[0];
+
+    // Use the upper bits of the mixed hash to select the shard as the lower bits
+    // are used to index the shard's hash table.
+    const Uint64 MixedHash = static_cast<Uint64>(Hash) * Uint64{0x9E3779B97F4A7C15};
+    return m_Shards[static_cast<size_t>((MixedHash >> 32) % m_NumShards)];
+}
+
+InternedString InternedStringPool::Intern(const Char* Str)
+{
+    if (Str == nullptr)
+        return InternedString{};
+
+    return Intern(Str, strlen(Str));
+}
+
+InternedString InternedStringPool::Intern(const Char* Str, size_t Length)
+{
+    if (Str == nullptr)
+    {
+        VERIFY(Length == 0, "String is null, but its length is not zero");
+        return InternedString{};
+    }
+
+    const size_t Hash = ComputeHash(Str, Length);
+    return InternedString{GetShard(Hash).Intern(Str, Length, Hash)};
+}
+
+InternedString InternedStringPool::Find(const Char* Str) const
+{
+    if (Str == nullptr)
+        return InternedString{};
+
+    const size_t Length = strlen(Str);
+    const size_t Hash   = ComputeHash(Str, Length);
+    return InternedString{GetShard(Hash).Find(Str, Length, Hash)};
+}
+
+InternedStringPoolStats InternedStringPool::GetStats() const
+{
+    InternedStringPoolStats Stats;
+    for (Uint32 i = 0; i < m_NumShards; ++i)
+        m_Shards[i].AddStats(Stats);
+    return Stats;
+}
+
+} // namespace Diligent
@@ -0,0 +1,162 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+#include "MappedFileStream.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "FileSystem.hpp"
+#include "ProxyDataBlob.hpp"
+
+namespace Diligent
+{
+
+RefCntAutoPtr<MappedFileStream> MappedFileStream::Create(const Char* Path, MappedFileAccessHint Hint)
+{
+    if (Path == nullptr || Path[0] == '\0')
+    {
+        DEV_ERROR("Path must not be null or empty");
+        return {};
+    }
+
+    return RefCntAutoPtr<MappedFileStream>{MakeNewRCObj<MappedFileStream>()(Path, Hint)};
+}
+
+MappedFileStream::MappedFileStream(IReferenceCounters*  pRefCounters,
+                                   const Char*          Path,
+                                   MappedFileAccessHint Hint) :
+    TBase{pRefCounters},
+    m_pFile{FileSystem::MapFile(Path, Hint)},
+    m_Size{m_pFile ? static_cast<size_t>(m_pFile->GetSize()) : 0}
+{
+}
+
+IMPLEMENT_QUERY_INTERFACE(MappedFileStream, IID_FileStream, TBase)
+
+bool MappedFileStream::Read(void* Data, size_t Size)
+{
+    VERIFY(m_pFile, "File is not mapped");
+    if (!m_pFile)
+        return false;
+
+    const size_t BytesToRead = std::min(Size, m_Size - m_Pos);
+    if (BytesToRead > 0)
+    {
+        std::memcpy(Data, m_pFile->GetData() + m_Pos, BytesToRead);
+        m_Pos += BytesToRead;
+    }
+
+    return BytesToRead == Size;
+}
+
+void MappedFileStream::ReadBlob(IDataBlob* pData)
+{
+    VERIFY_EXPR(pData != nullptr);
+    VERIFY(m_pFile, "File is not mapped");
+    if (!m_pFile)
+        return;
+
+    pData->Resize(m_Size);
+    if (m_Size > 0)
+        std::memcpy(pData->GetDataPtr(), m_pFile->GetData(), m_Size);
+    m_Pos = m_Size;
+}
+
+bool MappedFileStream::Write(const void* Data, size_t Size)
+{
+    DEV_ERROR("Mapped file stream is read-only");
+    return false;
+}
+
+bool MappedFileStream::IsValid()
+{
+    return m_pFile != nullptr;
+}
+
+size_t MappedFileStream::GetSize()
+{
+    return m_Size;
+}
+
+size_t MappedFileStream::GetPos()
+{
+    return m_Pos;
+}
+
+bool MappedFileStream::SetPos(size_t Offset, int Origin)
+{
+    VERIFY(m_pFile, "File is not mapped");
+    if (!m_pFile)
+        return false;
+
+    size_t Base = 0;
+    switch (static_cast<FilePosOrigin>(Origin))
+    {
+        // clang-format off
+        case FilePosOrigin::Start: Base = 0;      break;
+        case FilePosOrigin::Curr:  Base = m_Pos;  break;
+        case FilePosOrigin::End:   Base = m_Size; break;
+        // clang-format on
+        default:
+            UNEXPECTED("Unknown origin");
+            return false;
+    }
+
+    // Negative offsets are passed as wrapped-around unsigned values, same as with fseek
+    const size_t NewPos = Base + Offset;
+    if (NewPos > m_Size)
+        return false;
+
+    m_Pos = NewPos;
+    return true;
+}
+
+const void* MappedFileStream::GetData() const
+{
+    return m_pFile ? m_pFile->GetData() : nullptr;
+}
+
+RefCntAutoPtr<IDataBlob> MappedFileStream::GetDataView(size_t Offset, size_t Size)
+{
+    if (!m_pFile)
+        return {};
+
+    Offset = std::min(Offset, m_Size);
+    Size   = std::min(Size, m_Size - Offset);
+
+    const void* pData = m_pFile->GetData() != nullptr ? m_pFile->GetData() + Offset : nullptr;
+    return ProxyDataBlob::Create(pData, Size, this);
+}
+
+bool MappedFileStream::Advise(MappedFileAccessHint Hint, size_t Offset, size_t Size)
+{
+    return m_pFile ? m_pFile->Advise(Hint, Offset, Size) : false;
+}
+
+} // namespace Diligent
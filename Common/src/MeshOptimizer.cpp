@@ -0,0 +1,849 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "MeshOptimizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr Uint32 InvalidIndex = ~0u;
+
+const float3& GetPosition(const void* pPositions, Uint32 PositionStride, Uint32 Idx)
+{
+    return *reinterpret_cast<const float3*>(static_cast<const Uint8*>(pPositions) + size_t{Idx} * PositionStride);
+}
+
+bool CheckIndices(const Uint32* pIndices, size_t NumIndices, Uint32 NumVertices, const void* pDst)
+{
+    DEV_CHECK_ERR(NumIndices % 3 == 0, "The number of indices (", NumIndices, ") must be a multiple of 3");
+    DEV_CHECK_ERR(NumIndices == 0 || (pIndices != nullptr && pDst != nullptr), "Index arrays must not be null");
+#ifdef DILIGENT_DEVELOPMENT
+    for (size_t i = 0; i < NumIndices && pIndices != nullptr; ++i)
+        DEV_CHECK_ERR(pIndices[i] < NumVertices, "Index ", pIndices[i], " at position ", i, " is out of range [0, ", NumVertices, ")");
+#endif
+    return NumIndices % 3 == 0 && pIndices != nullptr && pDst != nullptr;
+}
+
+// Triangles adjacent to every vertex in the compressed sparse row format:
+// the triangles of vertex v are Triangles[Offsets[v]] ... Triangles[Offsets[v] + Counts[v] - 1]
+struct VertexAdjacency
+{
+    std::vector<Uint32> Offsets;
+    std::vector<Uint32> Counts;
+    std::vector<Uint32> Triangles;
+
+    VertexAdjacency(const Uint32* pIndices, size_t NumIndices, Uint32 NumVertices) :
+        Offsets(NumVertices + 1),
+        Counts(NumVertices),
+        Triangles(NumIndices)
+    {
+        for (size_t i = 0; i < NumIndices; ++i)
+            ++Counts[pIndices[i]];
+
+        for (Uint32 v = 0; v < NumVertices; ++v)
+            Offsets[v + 1] = Offsets[v] + Counts[v];
+
+        std::fill(Counts.begin(), Counts.end(), 0u);
+        for (size_t i = 0; i < NumIndices; ++i)
+        {
+            const Uint32 v                  = pIndices[i];
+            Triangles[Offsets[v] + Counts[v]++] = static_cast<Uint32>(i / 3);
+        }
+    }
+
+    // Removes the triangle from the first Counts[v] triangles of the vertex and decrements Counts[v]
+    void RemoveTriangle(Uint32 v, Uint32 t)
+    {
+        Uint32* const pTris = &Triangles[Offsets[v]];
+        Uint32&       Count = Counts[v];
+        for (Uint32 j = 0; j < Count; ++j)
+        {
+            if (pTris[j] == t)
+            {
+                pTris[j] = pTris[--Count];
+                return;
+            }
+        }
+        UNEXPECTED("Triangle ", t, " is not found in the list of vertex ", v);
+    }
+};
+
+// Copies the source indices if the destination is the same array
+const Uint32* GetSourceIndices(const Uint32* pIndices, size_t NumIndices, const Uint32* pDstIndices, std::vector<Uint32>& Copy)
+{
+    if (pIndices != pDstIndices)
+        return pIndices;
+
+    Copy.assign(pIndices, pIndices + NumIndices);
+    return Copy.data();
+}
+
+// Forsyth's vertex scoring parameters
+constexpr Uint32 ForsythCacheSize         = 32;
+constexpr float  ForsythCacheDecayPower   = 1.5f;
+constexpr float  ForsythLastTriScore      = 0.75f;
+constexpr float  ForsythValenceBoostScale = 2.f;
+constexpr float  ForsythValenceBoostPower = 0.5f;
+constexpr Uint32 ForsythMaxValence        = 64;
+
+struct ForsythScoreTables
+{
+    float CachePos[ForsythCacheSize];
+    float Valence[ForsythMaxValence + 1];
+
+    ForsythScoreTables()
+    {
+        for (Uint32 i = 0; i < ForsythCacheSize; ++i)
+        {
+            // The vertices of the last triangle get the fixed score, so that the next triangle
+            // does not always reuse them, which would produce long thin strips.
+            CachePos[i] = i < 3 ?
+                ForsythLastTriScore :
+                std::pow(1.f - static_cast<float>(i - 3) / static_cast<float>(ForsythCacheSize - 3), ForsythCacheDecayPower);
+        }
+
+        // Boost the vertices with few remaining triangles to avoid leaving lone triangles behind
+        Valence[0] = 0;
+        for (Uint32 i = 1; i <= ForsythMaxValence; ++i)
+            Valence[i] = ForsythValenceBoostScale * std::pow(static_cast<float>(i), -ForsythValenceBoostPower);
+    }
+
+    float GetVertexScore(Uint32 CachePosition, Uint32 NumLiveTriangles) const
+    {
+        if (NumLiveTriangles == 0)
+            return -1;
+
+        const float Score = CachePosition < ForsythCacheSize ? CachePos[CachePosition] : 0.f;
+        return Score + (NumLiveTriangles <= ForsythMaxValence ? Valence[NumLiveTriangles] : ForsythValenceBoostScale * std::pow(static_cast<float>(NumLiveTriangles), -ForsythValenceBoostPower));
+    }
+};
+
+} // namespace
+
+VertexCacheStatistics AnalyzeVertexCache(const Uint32* pIndices, size_t NumIndices, Uint32 NumVertices, Uint32 CacheSize)
+{
+    VertexCacheStatistics Stats;
+    if (NumIndices == 0 || !CheckIndices(pIndices, NumIndices, NumVertices, pIndices))
+        return Stats;
+
+    CacheSize = std::max(CacheSize, 3u);
+
+    // A vertex is in the FIFO cache if fewer than CacheSize vertices were added after it
+    std::vector<Uint32> CacheTimestamps(NumVertices, 0);
+    std::vector<bool>   IsReferenced(NumVertices);
+
+    Uint32 Timestamp       = CacheSize + 1;
+    Uint32 NumReferenced   = 0;
+    for (size_t i = 0; i < NumIndices; ++i)
+    {
+        const Uint32 v = pIndices[i];
+        if (Timestamp - CacheTimestamps[v] > CacheSize)
+        {
+            CacheTimestamps[v] = Timestamp++;
+            ++Stats.VerticesTransformed;
+        }
+        if (!IsReferenced[v])
+        {
+            IsReferenced[v] = true;
+            ++NumReferenced;
+        }
+    }
+
+    Stats.ACMR = static_cast<float>(Stats.VerticesTransformed) / static_cast<float>(NumIndices / 3);
+    Stats.ATVR = static_cast<float>(Stats.VerticesTransformed) / static_cast<float>(NumReferenced);
+    return Stats;
+}
+
+VertexFetchStatistics AnalyzeVertexFetch(const Uint32* pIndices,
+                                         size_t        NumIndices,
+                                         Uint32        NumVertices,
+                                         Uint32        VertexSize,
+                                         Uint32        CacheLineSize,
+                                         Uint32        NumCacheLines)
+{
+    VertexFetchStatistics Stats;
+    DEV_CHECK_ERR(VertexSize > 0 && CacheLineSize > 0 && NumCacheLines > 0, "Vertex size and cache parameters must not be zero");
+    if (NumIndices == 0 || pIndices == nullptr || VertexSize == 0 || CacheLineSize == 0 || NumCacheLines == 0)
+        return Stats;
+
+    // Fully associative LRU cache: the line is in the cache if fewer than NumCacheLines
+    // distinct lines were accessed after it
+    const size_t        NumLines = (size_t{NumVertices} * VertexSize + CacheLineSize - 1) / CacheLineSize;
+    std::vector<size_t> LineTimestamps(NumLines, 0);
+    std::vector<size_t> Cache; // Most recently used lines are at the end
+    Cache.reserve(NumCacheLines);
+
+    std::vector<bool> IsReferenced(NumVertices);
+    size_t            NumReferenced = 0;
+    for (size_t i = 0; i < NumIndices; ++i)
+    {
+        const Uint32 v = pIndices[i];
+        if (v >= NumVertices)
+            continue;
+        if (!IsReferenced[v])
+        {
+            IsReferenced[v] = true;
+            ++NumReferenced;
+        }
+
+        const size_t FirstLine = size_t{v} * VertexSize / CacheLineSize;
+        const size_t LastLine  = (size_t{v} * VertexSize + VertexSize - 1) / CacheLineSize;
+        for (size_t Line = FirstLine; Line <= LastLine; ++Line)
+        {
+            auto it = std::find(Cache.begin(), Cache.end(), Line);
+            if (it != Cache.end())
+            {
+                Cache.erase(it);
+            }
+            else
+            {
+                Stats.BytesFetched += CacheLineSize;
+                if (Cache.size() == NumCacheLines)
+                    Cache.erase(Cache.begin());
+            }
+            Cache.push_back(Line);
+        }
+    }
+
+    Stats.Overfetch = NumReferenced > 0 ? static_cast<float>(Stats.BytesFetched) / static_cast<float>(NumReferenced * VertexSize) : 0.f;
+    return Stats;
+}
+
+void OptimizeVertexCache(const Uint32* pIndices, size_t NumIndices, Uint32 NumVertices, Uint32* pDstIndices)
+{
+    if (NumIndices == 0 || !CheckIndices(pIndices, NumIndices, NumVertices, pDstIndices))
+        return;
+
+    std::vector<Uint32> SrcCopy;
+    pIndices = GetSourceIndices(pIndices, NumIndices, pDstIndices, SrcCopy);
+
+    static const ForsythScoreTables Scores;
+
+    const Uint32 NumTriangles = static_cast<Uint32>(NumIndices / 3);
+
+    // Adjacency.Counts holds the number of triangles that have not been emitted yet,
+    // and the live triangles are kept at the beginning of every vertex's list.
+    VertexAdjacency Adjacency{pIndices, NumIndices, NumVertices};
+
+    std::vector<Uint32> CachePos(NumVertices, InvalidIndex);
+    std::vector<float>  VertexScores(NumVertices);
+    for (Uint32 v = 0; v < NumVertices; ++v)
+        VertexScores[v] = Scores.GetVertexScore(InvalidIndex, Adjacency.Counts[v]);
+
+    std::vector<float> TriangleScores(NumTriangles);
+    std::vector<bool>  IsEmitted(NumTriangles);
+    for (Uint32 t = 0; t < NumTriangles; ++t)
+        TriangleScores[t] = VertexScores[pIndices[t * 3]] + VertexScores[pIndices[t * 3 + 1]] + VertexScores[pIndices[t * 3 + 2]];
+
+    Uint32 Cache[ForsythCacheSize + 3];
+    Uint32 CacheCount = 0;
+
+    Uint32 BestTriangle = 0;
+    Uint32 NextCandidate = 0; // Next triangle to check when the cache yields no candidates
+    for (Uint32 NumEmitted = 0; NumEmitted < NumTriangles; ++NumEmitted)
+    {
+        if (BestTriangle == InvalidIndex)
+        {
+            // No triangles adjacent to the cached vertices: take the next triangle in the input order
+            while (IsEmitted[NextCandidate])
+                ++NextCandidate;
+            BestTriangle = NextCandidate;
+        }
+
+        const Uint32* TriVerts = pIndices + size_t{BestTriangle} * 3;
+        std::copy(TriVerts, TriVerts + 3, pDstIndices + size_t{NumEmitted} * 3);
+        IsEmitted[BestTriangle] = true;
+
+        // Remove the triangle from the live lists of its vertices
+        for (Uint32 i = 0; i < 3; ++i)
+            Adjacency.RemoveTriangle(TriVerts[i], BestTriangle);
+
+        // Move the triangle vertices to the front of the LRU cache
+        Uint32 NewCache[ForsythCacheSize + 3];
+        Uint32 NewCacheCount = 0;
+        for (Uint32 i = 0; i < 3; ++i)
+        {
+            if (std::find(NewCache, NewCache + NewCacheCount, TriVerts[i]) == NewCache + NewCacheCount)
+                NewCache[NewCacheCount++] = TriVerts[i];
+        }
+        for (Uint32 i = 0; i < CacheCount; ++i)
+        {
+            const Uint32 v = Cache[i];
+            if (v != TriVerts[0] && v != TriVerts[1] && v != TriVerts[2])
+                NewCache[NewCacheCount++] = v;
+        }
+
+        // Update the scores of the cached vertices and of the vertices pushed out of the cache
+        for (Uint32 i = 0; i < NewCacheCount; ++i)
+        {
+            const Uint32 v = NewCache[i];
+            CachePos[v]    = i < ForsythCacheSize ? i : InvalidIndex;
+
+            const float NewScore = Scores.GetVertexScore(CachePos[v], Adjacency.Counts[v]);
+            const float Delta    = NewScore - VertexScores[v];
+            VertexScores[v]      = NewScore;
+
+            const Uint32* pTris = &Adjacency.Triangles[Adjacency.Offsets[v]];
+            for (Uint32 j = 0; j < Adjacency.Counts[v]; ++j)
+                TriangleScores[pTris[j]] += Delta;
+        }
+
+        CacheCount = std::min(NewCacheCount, ForsythCacheSize);
+        std::copy(NewCache, NewCache + CacheCount, Cache);
+
+        // The best triangle is one of the live triangles of the cached vertices
+        BestTriangle    = InvalidIndex;
+        float BestScore = -1;
+        for (Uint32 i = 0; i < CacheCount; ++i)
+        {
+            const Uint32  v     = Cache[i];
+            const Uint32* pTris = &Adjacency.Triangles[Adjacency.Offsets[v]];
+            for (Uint32 j = 0; j < Adjacency.Counts[v]; ++j)
+            {
+                if (TriangleScores[pTris[j]] > BestScore)
+                {
+                    BestScore    = TriangleScores[pTris[j]];
+                    BestTriangle = pTris[j];
+                }
+            }
+        }
+    }
+}
+
+namespace
+{
+
+// Tipsify: emits the triangles by fanning around the vertices that are likely to stay in the cache
+void Tipsify(const Uint32* pIndices, size_t NumIndices, Uint32 NumVertices, Uint32 CacheSize, Uint32* pDstIndices)
+{
+    const Uint32 NumTriangles = static_cast<Uint32>(NumIndices / 3);
+
+    // Adjacency.Counts holds the number of live triangles of every vertex
+    VertexAdjacency Adjacency{pIndices, NumIndices, NumVertices};
+
+    std::vector<Uint32> CacheTimestamps(NumVertices, 0);
+    std::vector<bool>   IsEmitted(NumTriangles);
+    std::vector<Uint32> DeadEndStack;
+    std::vector<Uint32> Candidates;
+
+    Uint32 Timestamp     = CacheSize + 1;
+    Uint32 NextVertex    = 0; // Next vertex to check for live triangles when the stack is empty
+    Uint32 NumEmitted    = 0;
+    Uint32 FanningVertex = 0;
+    while (FanningVertex != InvalidIndex)
+    {
+        Candidates.clear();
+
+        // Emit all live triangles of the fanning vertex
+        const Uint32* pTris    = &Adjacency.Triangles[Adjacency.Offsets[FanningVertex]];
+        const Uint32  NumTris  = Adjacency.Offsets[FanningVertex + 1] - Adjacency.Offsets[FanningVertex];
+        for (Uint32 j = 0; j < NumTris; ++j)
+        {
+            const Uint32 t = pTris[j];
+            if (IsEmitted[t])
+                continue;
+            IsEmitted[t] = true;
+
+            for (Uint32 i = 0; i < 3; ++i)
+            {
+                const Uint32 v = pIndices[size_t{t} * 3 + i];
+
+                pDstIndices[size_t{NumEmitted} * 3 + i] = v;
+                DeadEndStack.push_back(v);
+                Candidates.push_back(v);
+                --Adjacency.Counts[v];
+                if (Timestamp - CacheTimestamps[v] > CacheSize)
+                    CacheTimestamps[v] = Timestamp++;
+            }
+            ++NumEmitted;
+        }
+
+        // Select the candidate that will be in the cache after all its triangles are emitted
+        // and that has been in the cache the longest
+        FanningVertex = InvalidIndex;
+        int BestPriority = -1;
+        for (Uint32 v : Candidates)
+        {
+            if (Adjacency.Counts[v] == 0)
+                continue;
+
+            int Priority = 0;
+            if (Timestamp - CacheTimestamps[v] + 2 * Adjacency.Counts[v] <= CacheSize)
+                Priority = static_cast<int>(Timestamp - CacheTimestamps[v]);
+            if (Priority > BestPriority)
+            {
+                BestPriority  = Priority;
+                FanningVertex = v;
+            }
+        }
+
+        if (FanningVertex == InvalidIndex)
+        {
+            // Dead end: take the most recently used vertex that still has live triangles
+            while (!DeadEndStack.empty() && FanningVertex == InvalidIndex)
+            {
+                const Uint32 v = DeadEndStack.back();
+                DeadEndStack.pop_back();
+                if (Adjacency.Counts[v] > 0)
+                    FanningVertex = v;
+            }
+
+            while (FanningVertex == InvalidIndex && NextVertex < NumVertices)
+            {
+                if (Adjacency.Counts[NextVertex] > 0)
+                    FanningVertex = NextVertex;
+                ++NextVertex;
+            }
+        }
+    }
+    VERIFY_EXPR(NumEmitted == NumTriangles);
+}
+
+} // namespace
+
+void OptimizeVertexCacheFIFO(const Uint32* pIndices, size_t NumIndices, Uint32 NumVertices, Uint32 CacheSize, Uint32* pDstIndices)
+{
+    if (NumIndices == 0 || !CheckIndices(pIndices, NumIndices, NumVertices, pDstIndices))
+        return;
+
+    std::vector<Uint32> SrcCopy;
+    pIndices = GetSourceIndices(pIndices, NumIndices, pDstIndices, SrcCopy);
+
+    Tipsify(pIndices, NumIndices, NumVertices, std::max(CacheSize, 3u), pDstIndices);
+}
+
+void OptimizeOverdraw(const Uint32* pIndices,
+                      size_t        NumIndices,
+                      const void*   pPositions,
+                      Uint32        PositionStride,
+                      Uint32        NumVertices,
+                      Uint32*       pDstIndices,
+                      float         Threshold,
+                      Uint32        CacheSize)
+{
+    if (NumIndices == 0 || !CheckIndices(pIndices, NumIndices, NumVertices, pDstIndices))
+        return;
+
+    DEV_CHECK_ERR(pPositions != nullptr, "Positions must not be null");
+    if (pPositions == nullptr)
+        return;
+
+    std::vector<Uint32> SrcCopy;
+    pIndices = GetSourceIndices(pIndices, NumIndices, pDstIndices, SrcCopy);
+
+    const Uint32 NumTriangles = static_cast<Uint32>(NumIndices / 3);
+    CacheSize                 = std::max(CacheSize, 3u);
+
+    // Simulates the FIFO cache and returns the number of misses of the triangle
+    std::vector<Uint32> CacheTimestamps(NumVertices, 0);
+    Uint32              Timestamp   = CacheSize + 1;
+    auto                GetNumMisses = [&](Uint32 t) {
+        Uint32 NumMisses = 0;
+        for (Uint32 i = 0; i < 3; ++i)
+        {
+            const Uint32 v = pIndices[size_t{t} * 3 + i];
+            if (Timestamp - CacheTimestamps[v] > CacheSize)
+            {
+                CacheTimestamps[v] = Timestamp++;
+                ++NumMisses;
+            }
+        }
+        return NumMisses;
+    };
+    auto ResetCache = [&]() {
+        // Advancing the timestamp past the cache size evicts all vertices
+        Timestamp += CacheSize + 1;
+    };
+
+    // Hard boundaries: the triangles that miss all three vertices start new clusters
+    std::vector<Uint32> HardClusters;
+    for (Uint32 t = 0; t < NumTriangles; ++t)
+    {
+        if (GetNumMisses(t) == 3)
+            HardClusters.push_back(t);
+    }
+    HardClusters.push_back(NumTriangles);
+
+    // Soft boundaries: split the hard clusters while the running ACMR stays below the threshold
+    std::vector<Uint32> Clusters;
+    for (size_t c = 0; c + 1 < HardClusters.size(); ++c)
+    {
+        const Uint32 Start = HardClusters[c];
+        const Uint32 End   = HardClusters[c + 1];
+
+        ResetCache();
+        Uint32 ClusterMisses = 0;
+        for (Uint32 t = Start; t < End; ++t)
+            ClusterMisses += GetNumMisses(t);
+        const float MaxACMR = Threshold * static_cast<float>(ClusterMisses) / static_cast<float>(End - Start);
+
+        ResetCache();
+        Clusters.push_back(Start);
+        Uint32 SubStart = Start;
+        Uint32 Misses   = 0;
+        for (Uint32 t = Start; t < End; ++t)
+        {
+            Misses += GetNumMisses(t);
+            // Split after the triangle if the cache efficiency of the part is good enough
+            if (t + 1 < End && t + 1 - SubStart >= 4 && static_cast<float>(Misses) / static_cast<float>(t + 1 - SubStart) <= MaxACMR)
+            {
+                Clusters.push_back(t + 1);
+                SubStart = t + 1;
+                Misses   = 0;
+                ResetCache();
+            }
+        }
+    }
+    const size_t NumClusters = Clusters.size();
+    Clusters.push_back(NumTriangles);
+
+    // Area-weighted centroid and normal of every cluster and of the mesh
+    std::vector<float3> ClusterCentroids(NumClusters);
+    std::vector<float3> ClusterNormals(NumClusters);
+    float3              MeshCentroid;
+    float               MeshArea = 0;
+    for (size_t c = 0; c < NumClusters; ++c)
+    {
+        float3 Centroid;
+        float3 Normal;
+        float  Area = 0;
+        for (Uint32 t = Clusters[c]; t < Clusters[c + 1]; ++t)
+        {
+            const float3& P0 = GetPosition(pPositions, PositionStride, pIndices[size_t{t} * 3 + 0]);
+            const float3& P1 = GetPosition(pPositions, PositionStride, pIndices[size_t{t} * 3 + 1]);
+            const float3& P2 = GetPosition(pPositions, PositionStride, pIndices[size_t{t} * 3 + 2]);
+
+            const float3 N       = cross(P1 - P0, P2 - P0);
+            const float  TriArea = length(N);
+            Centroid += (P0 + P1 + P2) * (TriArea / 3.f);
+            Normal += N;
+            Area += TriArea;
+        }
+
+        MeshCentroid += Centroid;
+        MeshArea += Area;
+
+        ClusterCentroids[c] = Area > 0 ? Centroid / Area : float3{};
+        ClusterNormals[c]   = Normal;
+    }
+    if (MeshArea > 0)
+        MeshCentroid /= MeshArea;
+
+    // Clusters that face away from the mesh centroid are drawn first
+    std::vector<float> SortKeys(NumClusters);
+    for (size_t c = 0; c < NumClusters; ++c)
+    {
+        const float NormalLen = length(ClusterNormals[c]);
+        SortKeys[c]           = NormalLen > 0 ? dot(ClusterCentroids[c] - MeshCentroid, ClusterNormals[c]) / NormalLen : 0.f;
+    }
+
+    std::vector<Uint32> ClusterOrder(NumClusters);
+    for (Uint32 c = 0; c < NumClusters; ++c)
+        ClusterOrder[c] = c;
+    std::stable_sort(ClusterOrder.begin(), ClusterOrder.end(), [&SortKeys](Uint32 c0, Uint32 c1) {
+        return SortKeys[c0] > SortKeys[c1];
+    });
+
+    Uint32* pDst = pDstIndices;
+    for (Uint32 c : ClusterOrder)
+    {
+        const Uint32* pSrc = pIndices + size_t{Clusters[c]} * 3;
+        pDst               = std::copy(pSrc, pSrc + size_t{Clusters[c + 1] - Clusters[c]} * 3, pDst);
+    }
+}
+
+Uint32 OptimizeVertexFetchRemap(const Uint32* pIndices, size_t NumIndices, Uint32 NumVertices, Uint32* pRemap)
+{
+    DEV_CHECK_ERR(pRemap != nullptr || NumVertices == 0, "Remap table must not be null");
+    if (pRemap == nullptr)
+        return 0;
+
+    std::fill(pRemap, pRemap + NumVertices, InvalidIndex);
+    if (NumIndices != 0 && !CheckIndices(pIndices, NumIndices - NumIndices % 3, NumVertices, pRemap))
+        return 0;
+
+    Uint32 NumUsed = 0;
+    for (size_t i = 0; i < NumIndices; ++i)
+    {
+        Uint32& NewIdx = pRemap[pIndices[i]];
+        if (NewIdx == InvalidIndex)
+            NewIdx = NumUsed++;
+    }
+    return NumUsed;
+}
+
+void RemapIndexBuffer(const Uint32* pIndices, size_t NumIndices, const Uint32* pRemap, Uint32* pDstIndices)
+{
+    DEV_CHECK_ERR(NumIndices == 0 || (pIndices != nullptr && pRemap != nullptr && pDstIndices != nullptr), "Arrays must not be null");
+    if (pIndices == nullptr || pRemap == nullptr || pDstIndices == nullptr)
+        return;
+
+    for (size_t i = 0; i < NumIndices; ++i)
+    {
+        VERIFY(pRemap[pIndices[i]] != InvalidIndex, "Vertex ", pIndices[i], " is not referenced by the index buffer used to build the remap table");
+        pDstIndices[i] = pRemap[pIndices[i]];
+    }
+}
+
+void RemapVertexBuffer(const void* pVertices, Uint32 NumVertices, Uint32 VertexStride, const Uint32* pRemap, void* pDstVertices)
+{
+    DEV_CHECK_ERR(NumVertices == 0 || (pVertices != nullptr && pRemap != nullptr && pDstVertices != nullptr), "Arrays must not be null");
+    DEV_CHECK_ERR(pVertices != pDstVertices, "Source and destination vertex buffers must not be the same");
+    if (pVertices == nullptr || pRemap == nullptr || pDstVertices == nullptr || pVertices == pDstVertices)
+        return;
+
+    const Uint8* pSrc = static_cast<const Uint8*>(pVertices);
+    Uint8*       pDst = static_cast<Uint8*>(pDstVertices);
+    for (Uint32 v = 0; v < NumVertices; ++v)
+    {
+        if (pRemap[v] != InvalidIndex)
+            memcpy(pDst + size_t{pRemap[v]} * VertexStride, pSrc + size_t{v} * VertexStride, VertexStride);
+    }
+}
+
+MeshletData BuildMeshlets(const Uint32* pIndices, size_t NumIndices, Uint32 NumVertices, const MeshletBuildAttribs& Attribs)
+{
+    MeshletData Data;
+    if (NumIndices == 0 || !CheckIndices(pIndices, NumIndices, NumVertices, pIndices))
+        return Data;
+
+    DEV_CHECK_ERR(Attribs.MaxVertices >= 3 && Attribs.MaxVertices <= 256, "MaxVertices (", Attribs.MaxVertices, ") must be in the range [3, 256]");
+    DEV_CHECK_ERR(Attribs.MaxTriangles >= 1 && Attribs.MaxTriangles <= 512, "MaxTriangles (", Attribs.MaxTriangles, ") must be in the range [1, 512]");
+    const Uint32 MaxVertices  = std::min(std::max(Attribs.MaxVertices, 3u), 256u);
+    const Uint32 MaxTriangles = std::min(std::max(Attribs.MaxTriangles, 1u), 512u);
+
+    const Uint32 NumTriangles = static_cast<Uint32>(NumIndices / 3);
+
+    // Adjacency.Counts holds the number of triangles that have not been added to a meshlet yet,
+    // and the live triangles are kept at the beginning of every vertex's list.
+    VertexAdjacency Adjacency{pIndices, NumIndices, NumVertices};
+
+    // Index of the vertex in the current meshlet, or InvalidIndex
+    std::vector<Uint32> LocalIndices(NumVertices, InvalidIndex);
+    std::vector<bool>   IsAdded(NumTriangles);
+
+    Meshlet Curr;
+    auto    FlushMeshlet = [&]() {
+        for (Uint32 i = 0; i < Curr.VertexCount; ++i)
+            LocalIndices[Data.Vertices[Curr.VertexOffset + i]] = InvalidIndex;
+        Data.Meshlets.push_back(Curr);
+
+        Curr.VertexOffset += Curr.VertexCount;
+        Curr.TriangleOffset += Curr.TriangleCount;
+        Curr.VertexCount   = 0;
+        Curr.TriangleCount = 0;
+    };
+
+    auto GetNumNewVertices = [&](Uint32 t) {
+        const Uint32* TriVerts    = pIndices + size_t{t} * 3;
+        Uint32        NumNewVerts = 0;
+        for (Uint32 i = 0; i < 3; ++i)
+        {
+            const bool IsDuplicate = (i > 0 && TriVerts[i] == TriVerts[0]) || (i > 1 && TriVerts[i] == TriVerts[1]);
+            NumNewVerts += (LocalIndices[TriVerts[i]] == InvalidIndex && !IsDuplicate) ? 1 : 0;
+        }
+        return NumNewVerts;
+    };
+
+    Data.Triangles.reserve(NumIndices);
+    Uint32 NextSeed = 0; // Next triangle to start from when the meshlet has no live neighbors
+    for (Uint32 NumAdded = 0; NumAdded < NumTriangles; ++NumAdded)
+    {
+        // Grow the meshlet with the adjacent triangle that adds the fewest vertices,
+        // which keeps the meshlets compact and their normal cones narrow.
+        Uint32 BestTriangle = InvalidIndex;
+        Uint32 BestNewVerts = 4;
+        for (Uint32 i = 0; i < Curr.VertexCount && BestNewVerts > 0; ++i)
+        {
+            const Uint32  v     = Data.Vertices[Curr.VertexOffset + i];
+            const Uint32* pTris = &Adjacency.Triangles[Adjacency.Offsets[v]];
+            for (Uint32 j = 0; j < Adjacency.Counts[v]; ++j)
+            {
+                const Uint32 NumNewVerts = GetNumNewVertices(pTris[j]);
+                if (NumNewVerts < BestNewVerts || (NumNewVerts == BestNewVerts && pTris[j] < BestTriangle))
+                {
+                    BestNewVerts = NumNewVerts;
+                    BestTriangle = pTris[j];
+                }
+            }
+        }
+
+        if (BestTriangle == InvalidIndex)
+        {
+            while (IsAdded[NextSeed])
+                ++NextSeed;
+            BestTriangle = NextSeed;
+            BestNewVerts = GetNumNewVertices(BestTriangle);
+        }
+
+        if (Curr.VertexCount + BestNewVerts > MaxVertices || Curr.TriangleCount + 1 > MaxTriangles)
+            FlushMeshlet();
+
+        const Uint32* TriVerts = pIndices + size_t{BestTriangle} * 3;
+        IsAdded[BestTriangle]  = true;
+        for (Uint32 i = 0; i < 3; ++i)
+        {
+            const Uint32 v = TriVerts[i];
+
+            Uint32& LocalIdx = LocalIndices[v];
+            if (LocalIdx == InvalidIndex)
+            {
+                LocalIdx = Curr.VertexCount++;
+                Data.Vertices.push_back(v);
+            }
+            Data.Triangles.push_back(static_cast<Uint8>(LocalIdx));
+            Adjacency.RemoveTriangle(v, BestTriangle);
+        }
+        ++Curr.TriangleCount;
+    }
+    if (Curr.TriangleCount > 0)
+        FlushMeshlet();
+
+    return Data;
+}
+
+MeshletBounds ComputeMeshletBounds(const MeshletData& Data,
+                                   const Meshlet&     M,
+                                   const void*        pPositions,
+                                   Uint32             PositionStride,
+                                   Uint32             NumVertices,
+                                   bool               FlipNormals)
+{
+    MeshletBounds Bounds;
+    DEV_CHECK_ERR(pPositions != nullptr, "Positions must not be null");
+    if (pPositions == nullptr || M.VertexCount == 0)
+        return Bounds;
+
+    DEV_CHECK_ERR(size_t{M.VertexOffset} + M.VertexCount <= Data.Vertices.size() && (size_t{M.TriangleOffset} + M.TriangleCount) * 3 <= Data.Triangles.size(),
+                  "Meshlet is out of the meshlet data range");
+
+    auto GetVertex = [&](Uint32 LocalIdx) -> const float3& {
+        const Uint32 v = Data.Vertices[M.VertexOffset + LocalIdx];
+        VERIFY_EXPR(v < NumVertices);
+        (void)NumVertices;
+        return GetPosition(pPositions, PositionStride, v);
+    };
+
+    // Ritter's bounding sphere: start with the two most distant points along the axes, then grow the sphere
+    Uint32 MinIdx[3] = {}, MaxIdx[3] = {};
+    for (Uint32 i = 1; i < M.VertexCount; ++i)
+    {
+        const float3& P = GetVertex(i);
+        for (int c = 0; c < 3; ++c)
+        {
+            if (P[c] < GetVertex(MinIdx[c])[c])
+                MinIdx[c] = i;
+            if (P[c] > GetVertex(MaxIdx[c])[c])
+                MaxIdx[c] = i;
+        }
+    }
+    int   Axis       = 0;
+    float MaxDistSqr = -1;
+    for (int c = 0; c < 3; ++c)
+    {
+        const float DistSqr = dot(GetVertex(MaxIdx[c]) - GetVertex(MinIdx[c]), GetVertex(MaxIdx[c]) - GetVertex(MinIdx[c]));
+        if (DistSqr > MaxDistSqr)
+        {
+            MaxDistSqr = DistSqr;
+            Axis       = c;
+        }
+    }
+    float3 Center = (GetVertex(MinIdx[Axis]) + GetVertex(MaxIdx[Axis])) * 0.5f;
+    float  Radius = std::sqrt(MaxDistSqr) * 0.5f;
+    for (Uint32 i = 0; i < M.VertexCount; ++i)
+    {
+        const float3& P    = GetVertex(i);
+        const float   Dist = length(P - Center);
+        if (Dist > Radius)
+        {
+            const float NewRadius = (Radius + Dist) * 0.5f;
+            Center += (P - Center) * ((NewRadius - Radius) / Dist);
+            Radius = NewRadius;
+        }
+    }
+    Bounds.Center = Center;
+    Bounds.Radius = Radius;
+
+    // Normal cone
+    const Uint8* pTris = &Data.Triangles[size_t{M.TriangleOffset} * 3];
+
+    float3 AxisSum;
+    for (Uint32 t = 0; t < M.TriangleCount; ++t)
+    {
+        const float3& P0 = GetVertex(pTris[t * 3 + 0]);
+        const float3  N  = cross(GetVertex(pTris[t * 3 + 1]) - P0, GetVertex(pTris[t * 3 + 2]) - P0);
+        const float   Len = length(N);
+        if (Len > 0)
+            AxisSum += N / Len;
+    }
+    if (FlipNormals)
+        AxisSum = -AxisSum;
+
+    const float AxisLen = length(AxisSum);
+    if (AxisLen == 0)
+        return Bounds;
+
+    const float3 ConeAxis = AxisSum / AxisLen;
+
+    float MinDot = 1;
+    float MaxT   = 0;
+    for (Uint32 t = 0; t < M.TriangleCount; ++t)
+    {
+        const float3& P0 = GetVertex(pTris[t * 3 + 0]);
+        float3        N  = cross(GetVertex(pTris[t * 3 + 1]) - P0, GetVertex(pTris[t * 3 + 2]) - P0);
+        const float   Len = length(N);
+        if (Len == 0)
+            continue;
+        N = (FlipNormals ? -N : N) / Len;
+
+        const float Dot = dot(N, ConeAxis);
+        MinDot          = std::min(MinDot, Dot);
+        if (Dot <= 0)
+            continue;
+
+        // Move the apex back along the axis so that the triangle plane is in front of it
+        const float T = dot(P0 - Center, N) / Dot;
+        MaxT          = std::max(MaxT, T);
+    }
+
+    Bounds.ConeAxis = ConeAxis;
+    Bounds.ConeApex = Center - ConeAxis * MaxT;
+    // The cone is too wide when the normals span a hemisphere or more
+    Bounds.ConeCutoff = MinDot <= 0 ? 1.f : std::sqrt(std::max(1.f - MinDot * MinDot, 0.f));
+
+    return Bounds;
+}
+
+} // namespace Diligent
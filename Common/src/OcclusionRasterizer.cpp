@@ -0,0 +1,680 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "OcclusionRasterizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Intrinsics.hpp"
+#include "DebugUtilities.hpp"
+#include "ParallelFor.hpp"
+#include "PlatformMisc.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr Uint32 TileSize       = OcclusionRasterizer::TileSize;
+constexpr Uint32 TilePixels     = TileSize * TileSize;
+constexpr Uint32 BinSizeInTiles = OcclusionRasterizer::BinSizeInTiles;
+constexpr Uint32 BinSize        = TileSize * BinSizeInTiles;
+
+// The number of triangles set up and binned by one task
+constexpr Uint32 TrianglesPerBatch = 4096;
+
+// The minimum number of vertices transformed by one thread
+constexpr size_t MinVerticesPerThread = 4096;
+
+// The minimum number of mask words processed by one thread when testing boxes
+constexpr size_t MinMaskWordsPerThread = 32;
+
+using ScreenTriangle = OcclusionRasterizer::ScreenTriangle;
+
+// Triangle edge and depth functions relative to the center of the top-left pixel of a tile
+struct TileTriangle
+{
+    float E0[3];
+    float A[3];
+    float B[3];
+    float Z0;
+    float ZA;
+    float ZB;
+    float MinZ;
+};
+
+// Rasterizes the triangle into the tile depths. Returns the new maximum depth of the tile.
+// A pixel is written if its center is strictly inside the triangle and the triangle is closer.
+// The kernels perform the same floating-point operations in the same order.
+using RasterizeTileFn = float (*)(const TileTriangle& Tri, float* pDepth);
+
+float RasterizeTileScalar(const TileTriangle& Tri, float* pDepth)
+{
+    float MaxDepth = 0;
+    for (Uint32 r = 0; r < TileSize; ++r)
+    {
+        const float Row  = static_cast<float>(r);
+        const float RowE[] = {Tri.E0[0] + Tri.B[0] * Row, Tri.E0[1] + Tri.B[1] * Row, Tri.E0[2] + Tri.B[2] * Row};
+        const float RowZ = Tri.Z0 + Tri.ZB * Row;
+        for (Uint32 c = 0; c < TileSize; ++c)
+        {
+            const float Col = static_cast<float>(c);
+
+            float&      Depth = pDepth[r * TileSize + c];
+            const float Z     = std::max(RowZ + Tri.ZA * Col, Tri.MinZ);
+            if (RowE[0] + Tri.A[0] * Col > 0 && RowE[1] + Tri.A[1] * Col > 0 && RowE[2] + Tri.A[2] * Col > 0 && Z < Depth)
+                Depth = Z;
+            MaxDepth = std::max(MaxDepth, Depth);
+        }
+    }
+    return MaxDepth;
+}
+
+#if DILIGENT_SSE2_ENABLED
+float RasterizeTileSSE2(const TileTriangle& Tri, float* pDepth)
+{
+    const __m128 Zero    = _mm_setzero_ps();
+    const __m128 Cols[]  = {_mm_setr_ps(0, 1, 2, 3), _mm_setr_ps(4, 5, 6, 7)};
+    const __m128 A[]     = {_mm_set1_ps(Tri.A[0]), _mm_set1_ps(Tri.A[1]), _mm_set1_ps(Tri.A[2])};
+    const __m128 ZA      = _mm_set1_ps(Tri.ZA);
+    const __m128 MinZ    = _mm_set1_ps(Tri.MinZ);
+    __m128       MaxDepth = Zero;
+    for (Uint32 r = 0; r < TileSize; ++r)
+    {
+        const float  Row    = static_cast<float>(r);
+        const __m128 RowE[] = {
+            _mm_set1_ps(Tri.E0[0] + Tri.B[0] * Row),
+            _mm_set1_ps(Tri.E0[1] + Tri.B[1] * Row),
+            _mm_set1_ps(Tri.E0[2] + Tri.B[2] * Row),
+        };
+        const __m128 RowZ = _mm_set1_ps(Tri.Z0 + Tri.ZB * Row);
+        for (Uint32 h = 0; h < 2; ++h)
+        {
+            float* const pRow = pDepth + r * TileSize + h * 4;
+
+            const __m128 Depth = _mm_loadu_ps(pRow);
+            const __m128 Z     = _mm_max_ps(_mm_add_ps(RowZ, _mm_mul_ps(ZA, Cols[h])), MinZ);
+
+            __m128 Mask = _mm_cmplt_ps(Z, Depth);
+            for (int e = 0; e < 3; ++e)
+                Mask = _mm_and_ps(Mask, _mm_cmpgt_ps(_mm_add_ps(RowE[e], _mm_mul_ps(A[e], Cols[h])), Zero));
+
+            const __m128 NewDepth = _mm_or_ps(_mm_and_ps(Mask, Z), _mm_andnot_ps(Mask, Depth));
+            _mm_storeu_ps(pRow, NewDepth);
+            MaxDepth = _mm_max_ps(MaxDepth, NewDepth);
+        }
+    }
+    MaxDepth = _mm_max_ps(MaxDepth, _mm_shuffle_ps(MaxDepth, MaxDepth, _MM_SHUFFLE(1, 0, 3, 2)));
+    MaxDepth = _mm_max_ps(MaxDepth, _mm_shuffle_ps(MaxDepth, MaxDepth, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtss_f32(MaxDepth);
+}
+#endif
+
+#if DILIGENT_AVX2_SUPPORTED
+DILIGENT_TARGET_AVX2 float RasterizeTileAVX2(const TileTriangle& Tri, float* pDepth)
+{
+    const __m256 Zero     = _mm256_setzero_ps();
+    const __m256 Cols     = _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256 ColsA[]  = {
+        _mm256_mul_ps(_mm256_set1_ps(Tri.A[0]), Cols),
+        _mm256_mul_ps(_mm256_set1_ps(Tri.A[1]), Cols),
+        _mm256_mul_ps(_mm256_set1_ps(Tri.A[2]), Cols),
+    };
+    const __m256 ColsZA   = _mm256_mul_ps(_mm256_set1_ps(Tri.ZA), Cols);
+    const __m256 MinZ     = _mm256_set1_ps(Tri.MinZ);
+    __m256       MaxDepth = Zero;
+    for (Uint32 r = 0; r < TileSize; ++r)
+    {
+        float* const pRow = pDepth + r * TileSize;
+        const float  Row  = static_cast<float>(r);
+
+        const __m256 Depth = _mm256_loadu_ps(pRow);
+        const __m256 Z     = _mm256_max_ps(_mm256_add_ps(_mm256_set1_ps(Tri.Z0 + Tri.ZB * Row), ColsZA), MinZ);
+
+        __m256 Mask = _mm256_cmp_ps(Z, Depth, _CMP_LT_OQ);
+        for (int e = 0; e < 3; ++e)
+            Mask = _mm256_and_ps(Mask, _mm256_cmp_ps(_mm256_add_ps(_mm256_set1_ps(Tri.E0[e] + Tri.B[e] * Row), ColsA[e]), Zero, _CMP_GT_OQ));
+
+        const __m256 NewDepth = _mm256_blendv_ps(Depth, Z, Mask);
+        _mm256_storeu_ps(pRow, NewDepth);
+        MaxDepth = _mm256_max_ps(MaxDepth, NewDepth);
+    }
+    __m128 MaxDepth4 = _mm_max_ps(_mm256_castps256_ps128(MaxDepth), _mm256_extractf128_ps(MaxDepth, 1));
+    MaxDepth4        = _mm_max_ps(MaxDepth4, _mm_shuffle_ps(MaxDepth4, MaxDepth4, _MM_SHUFFLE(1, 0, 3, 2)));
+    MaxDepth4        = _mm_max_ps(MaxDepth4, _mm_shuffle_ps(MaxDepth4, MaxDepth4, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtss_f32(MaxDepth4);
+}
+#endif
+
+#if DILIGENT_NEON_ENABLED
+float RasterizeTileNEON(const TileTriangle& Tri, float* pDepth)
+{
+    static const float ColValues[] = {0, 1, 2, 3, 4, 5, 6, 7};
+
+    const float32x4_t Zero     = vdupq_n_f32(0);
+    const float32x4_t Cols[]   = {vld1q_f32(ColValues), vld1q_f32(ColValues + 4)};
+    const float32x4_t MinZ     = vdupq_n_f32(Tri.MinZ);
+    float32x4_t       MaxDepth = Zero;
+    for (Uint32 r = 0; r < TileSize; ++r)
+    {
+        const float       Row    = static_cast<float>(r);
+        const float32x4_t RowE[] = {
+            vdupq_n_f32(Tri.E0[0] + Tri.B[0] * Row),
+            vdupq_n_f32(Tri.E0[1] + Tri.B[1] * Row),
+            vdupq_n_f32(Tri.E0[2] + Tri.B[2] * Row),
+        };
+        const float32x4_t RowZ = vdupq_n_f32(Tri.Z0 + Tri.ZB * Row);
+        for (Uint32 h = 0; h < 2; ++h)
+        {
+            float* const pRow = pDepth + r * TileSize + h * 4;
+
+            const float32x4_t Depth = vld1q_f32(pRow);
+            const float32x4_t Z     = vmaxq_f32(vaddq_f32(RowZ, vmulq_f32(vdupq_n_f32(Tri.ZA), Cols[h])), MinZ);
+
+            uint32x4_t Mask = vcltq_f32(Z, Depth);
+            for (int e = 0; e < 3; ++e)
+                Mask = vandq_u32(Mask, vcgtq_f32(vaddq_f32(RowE[e], vmulq_f32(vdupq_n_f32(Tri.A[e]), Cols[h])), Zero));
+
+            const float32x4_t NewDepth = vbslq_f32(Mask, Z, Depth);
+            vst1q_f32(pRow, NewDepth);
+            MaxDepth = vmaxq_f32(MaxDepth, NewDepth);
+        }
+    }
+    float Lanes[4];
+    vst1q_f32(Lanes, MaxDepth);
+    return std::max(std::max(Lanes[0], Lanes[1]), std::max(Lanes[2], Lanes[3]));
+}
+#endif
+
+RasterizeTileFn SelectRasterizeTileKernel()
+{
+    RasterizeTileFn Kernel = RasterizeTileScalar;
+#if DILIGENT_SSE2_ENABLED
+    Kernel = RasterizeTileSSE2;
+#elif DILIGENT_NEON_ENABLED
+    Kernel = RasterizeTileNEON;
+#endif
+
+#if DILIGENT_AVX2_SUPPORTED
+    if (PlatformMisc::GetCPUFeatures().AVX2)
+        Kernel = RasterizeTileAVX2;
+#endif
+
+    return Kernel;
+}
+
+RasterizeTileFn GetRasterizeTileKernel()
+{
+    static const RasterizeTileFn Kernel = SelectRasterizeTileKernel();
+    return Kernel;
+}
+
+// Distance to the near plane, which is non-negative for the visible vertices
+float GetNearPlaneDistance(const float4& ClipPos, bool IsGL)
+{
+    return IsGL ? ClipPos.z + ClipPos.w : ClipPos.z;
+}
+
+// Clips the triangle by the near plane. Returns the number of polygon vertices (0, 3 or 4).
+Uint32 ClipByNearPlane(const float4 (&Tri)[3], bool IsGL, float4 (&Polygon)[4])
+{
+    Uint32 NumVerts = 0;
+    for (Uint32 i = 0; i < 3; ++i)
+    {
+        const float4& V0 = Tri[i];
+        const float4& V1 = Tri[(i + 1) % 3];
+        const float   D0 = GetNearPlaneDistance(V0, IsGL);
+        const float   D1 = GetNearPlaneDistance(V1, IsGL);
+        if (D0 >= 0)
+            Polygon[NumVerts++] = V0;
+        if ((D0 >= 0) != (D1 >= 0))
+            Polygon[NumVerts++] = V0 + (V1 - V0) * (D0 / (D0 - D1));
+    }
+    VERIFY_EXPR(NumVerts == 0 || NumVerts == 3 || NumVerts == 4);
+    return NumVerts;
+}
+
+// Sets up the screen-space triangle. Returns false if the triangle is culled or covers no pixel centers.
+bool SetupTriangle(const float4& C0, const float4& C1, const float4& C2, bool IsGL, bool CullBackFaces, Uint32 Width, Uint32 Height, ScreenTriangle& Tri)
+{
+    const float4* ClipVerts[] = {&C0, &C1, &C2};
+
+    double X[3], Y[3], Z[3];
+    for (Uint32 i = 0; i < 3; ++i)
+    {
+        const float4& C = *ClipVerts[i];
+        if (!(C.w > 0))
+            return false;
+
+        const double InvW = 1.0 / C.w;
+        X[i]              = (C.x * InvW * 0.5 + 0.5) * Width;
+        Y[i]              = (0.5 - C.y * InvW * 0.5) * Height;
+        Z[i]              = IsGL ? C.z * InvW * 0.5 + 0.5 : C.z * InvW;
+    }
+
+    // Positive for triangles that are clockwise on the screen (y axis points down)
+    double Area = (X[1] - X[0]) * (Y[2] - Y[0]) - (X[2] - X[0]) * (Y[1] - Y[0]);
+    if (Area == 0 || (CullBackFaces && Area < 0))
+        return false;
+
+    if (Area < 0)
+    {
+        std::swap(X[1], X[2]);
+        std::swap(Y[1], Y[2]);
+        std::swap(Z[1], Z[2]);
+        Area = -Area;
+    }
+
+    // Pixel centers are at half-integer coordinates. The bounds are clamped before
+    // the conversion to int as the vertices may be very far outside of the screen.
+    auto GetMinPixel = [](double v0, double v1, double v2, Uint32 Size) {
+        return static_cast<int>(std::ceil(std::min(std::max(std::min({v0, v1, v2}) - 0.5, -1.0), static_cast<double>(Size))));
+    };
+    auto GetMaxPixel = [](double v0, double v1, double v2, Uint32 Size) {
+        return static_cast<int>(std::floor(std::min(std::max(std::max({v0, v1, v2}) - 0.5, -1.0), static_cast<double>(Size))));
+    };
+    Tri.MinX = std::max(GetMinPixel(X[0], X[1], X[2], Width), 0);
+    Tri.MinY = std::max(GetMinPixel(Y[0], Y[1], Y[2], Height), 0);
+    Tri.MaxX = std::min(GetMaxPixel(X[0], X[1], X[2], Width), static_cast<int>(Width) - 1);
+    Tri.MaxY = std::min(GetMaxPixel(Y[0], Y[1], Y[2], Height), static_cast<int>(Height) - 1);
+    if (Tri.MinX > Tri.MaxX || Tri.MinY > Tri.MaxY)
+        return false;
+
+    for (Uint32 i = 0; i < 3; ++i)
+    {
+        const Uint32 j = (i + 1) % 3;
+        // E(x, y) = (Xj - Xi) * (y - Yi) - (Yj - Yi) * (x - Xi)
+        const double A = Y[i] - Y[j];
+        const double B = X[j] - X[i];
+        Tri.EdgeA[i]   = static_cast<float>(A);
+        Tri.EdgeB[i]   = static_cast<float>(B);
+        Tri.EdgeC[i]   = -(A * X[i] + B * Y[i]);
+    }
+
+    const double DepthA = ((Z[1] - Z[0]) * (Y[2] - Y[0]) - (Z[2] - Z[0]) * (Y[1] - Y[0])) / Area;
+    const double DepthB = ((Z[2] - Z[0]) * (X[1] - X[0]) - (Z[1] - Z[0]) * (X[2] - X[0])) / Area;
+    Tri.DepthA          = static_cast<float>(DepthA);
+    Tri.DepthB          = static_cast<float>(DepthB);
+    Tri.DepthC          = Z[0] - DepthA * X[0] - DepthB * Y[0];
+    Tri.MinDepth        = static_cast<float>(std::max(std::min({Z[0], Z[1], Z[2]}), 0.0));
+
+    return true;
+}
+
+} // namespace
+
+OcclusionRasterizer::OcclusionRasterizer(Uint32 Width, Uint32 Height)
+{
+    Resize(Width, Height);
+}
+
+void OcclusionRasterizer::Resize(Uint32 Width, Uint32 Height)
+{
+    DEV_CHECK_ERR(Width > 0 && Height > 0, "Depth buffer size must not be zero");
+
+    m_NumTilesX = std::max((Width + TileSize - 1) / TileSize, 1u);
+    m_NumTilesY = std::max((Height + TileSize - 1) / TileSize, 1u);
+    m_Width     = m_NumTilesX * TileSize;
+    m_Height    = m_NumTilesY * TileSize;
+    m_NumBinsX  = (m_NumTilesX + BinSizeInTiles - 1) / BinSizeInTiles;
+    m_NumBinsY  = (m_NumTilesY + BinSizeInTiles - 1) / BinSizeInTiles;
+
+    m_Depth.resize(size_t{m_NumTilesX} * m_NumTilesY * TilePixels);
+    m_TileMaxDepth.resize(size_t{m_NumTilesX} * m_NumTilesY);
+    m_Batches.clear();
+
+    Clear();
+}
+
+void OcclusionRasterizer::Clear()
+{
+    std::fill(m_Depth.begin(), m_Depth.end(), 1.f);
+    std::fill(m_TileMaxDepth.begin(), m_TileMaxDepth.end(), 1.f);
+}
+
+void OcclusionRasterizer::RasterizeOccluders(const OccluderMeshDesc* pMeshes,
+                                             Uint32                  NumMeshes,
+                                             bool                    IsGL,
+                                             IThreadPool*            pThreadPool)
+{
+    if (NumMeshes == 0)
+        return;
+
+    DEV_CHECK_ERR(pMeshes != nullptr, "Mesh array must not be null");
+    if (pMeshes == nullptr)
+        return;
+
+    // Offsets of the first vertex and the first triangle of every mesh
+    std::vector<size_t> VertexOffsets(NumMeshes + 1);
+    std::vector<size_t> TriangleOffsets(NumMeshes + 1);
+    for (Uint32 m = 0; m < NumMeshes; ++m)
+    {
+        const OccluderMeshDesc& Mesh = pMeshes[m];
+        DEV_CHECK_ERR(Mesh.NumIndices % 3 == 0, "The number of indices (", Mesh.NumIndices, ") must be a multiple of 3");
+        DEV_CHECK_ERR((Mesh.pVertices != nullptr || Mesh.NumVertices == 0) && (Mesh.pIndices != nullptr || Mesh.NumIndices == 0),
+                      "Vertex and index arrays must not be null");
+
+        const bool IsValid      = Mesh.pVertices != nullptr && Mesh.pIndices != nullptr;
+        VertexOffsets[m + 1]    = VertexOffsets[m] + (IsValid ? Mesh.NumVertices : 0);
+        TriangleOffsets[m + 1]  = TriangleOffsets[m] + (IsValid ? Mesh.NumIndices / 3 : 0);
+    }
+    const size_t NumTriangles = TriangleOffsets[NumMeshes];
+    if (NumTriangles == 0)
+        return;
+
+    auto FindMesh = [NumMeshes](const std::vector<size_t>& Offsets, size_t Idx) {
+        return static_cast<Uint32>(std::upper_bound(Offsets.begin(), Offsets.begin() + NumMeshes + 1, Idx) - Offsets.begin()) - 1;
+    };
+
+    // Transform the vertices to clip space
+    m_ClipVerts.resize(VertexOffsets[NumMeshes]);
+    ParallelFor(pThreadPool, 0, m_ClipVerts.size(), MinVerticesPerThread,
+                [&](size_t ChunkBegin, size_t ChunkEnd) {
+                    for (Uint32 m = FindMesh(VertexOffsets, ChunkBegin); ChunkBegin < ChunkEnd; ++m)
+                    {
+                        const OccluderMeshDesc& Mesh = pMeshes[m];
+
+                        const size_t MeshEnd = std::min(VertexOffsets[m + 1], ChunkEnd);
+                        for (size_t v = ChunkBegin; v < MeshEnd; ++v)
+                            m_ClipVerts[v] = float4{Mesh.pVertices[v - VertexOffsets[m]], 1} * Mesh.WorldViewProj;
+                        ChunkBegin = MeshEnd;
+                    }
+                });
+
+    // Set up and bin the triangles
+    const Uint32 NumBins = m_NumBinsX * m_NumBinsY;
+
+    m_NumUsedBatches = static_cast<Uint32>((NumTriangles + TrianglesPerBatch - 1) / TrianglesPerBatch);
+    if (m_Batches.size() < m_NumUsedBatches)
+        m_Batches.resize(m_NumUsedBatches);
+
+    ParallelFor(pThreadPool, 0, m_NumUsedBatches, 1,
+                [&](size_t FirstBatch, size_t EndBatch) {
+                    for (size_t BatchIdx = FirstBatch; BatchIdx < EndBatch; ++BatchIdx)
+                    {
+                        TriangleBatch& Batch = m_Batches[BatchIdx];
+                        Batch.Triangles.clear();
+                        Batch.BinTriangles.resize(NumBins);
+                        for (auto& BinTris : Batch.BinTriangles)
+                            BinTris.clear();
+
+                        auto AddTriangle = [&](const float4& C0, const float4& C1, const float4& C2, bool CullBackFaces) {
+                            ScreenTriangle Tri;
+                            if (!SetupTriangle(C0, C1, C2, IsGL, CullBackFaces, m_Width, m_Height, Tri))
+                                return;
+
+                            const Uint32 TriIdx = static_cast<Uint32>(Batch.Triangles.size());
+                            Batch.Triangles.push_back(Tri);
+                            for (Uint32 by = Tri.MinY / BinSize; by <= Tri.MaxY / BinSize; ++by)
+                            {
+                                for (Uint32 bx = Tri.MinX / BinSize; bx <= Tri.MaxX / BinSize; ++bx)
+                                    Batch.BinTriangles[by * m_NumBinsX + bx].push_back(TriIdx);
+                            }
+                        };
+
+                        const size_t FirstTri = BatchIdx * TrianglesPerBatch;
+                        const size_t EndTri   = std::min(FirstTri + TrianglesPerBatch, NumTriangles);
+                        for (size_t GlobalTri = FirstTri, m = FindMesh(TriangleOffsets, FirstTri); GlobalTri < EndTri; ++m)
+                        {
+                            const OccluderMeshDesc& Mesh  = pMeshes[m];
+                            const float4*           Verts = m_ClipVerts.data() + VertexOffsets[m];
+
+                            const size_t MeshEnd = std::min(TriangleOffsets[m + 1], EndTri);
+                            for (; GlobalTri < MeshEnd; ++GlobalTri)
+                            {
+                                const Uint32* Idx = Mesh.pIndices + (GlobalTri - TriangleOffsets[m]) * 3;
+                                if (Idx[0] >= Mesh.NumVertices || Idx[1] >= Mesh.NumVertices || Idx[2] >= Mesh.NumVertices)
+                                {
+                                    UNEXPECTED("Vertex index is out of range");
+                                    continue;
+                                }
+
+                                const float4 Tri[] = {Verts[Idx[0]], Verts[Idx[1]], Verts[Idx[2]]};
+
+                                // Trivially reject the triangles outside of the frustum side planes
+                                // and behind the far or the near plane.
+                                bool IsOutside = false;
+                                for (int c = 0; c < 2 && !IsOutside; ++c)
+                                {
+                                    IsOutside = (Tri[0][c] > Tri[0].w && Tri[1][c] > Tri[1].w && Tri[2][c] > Tri[2].w) ||
+                                        (Tri[0][c] < -Tri[0].w && Tri[1][c] < -Tri[1].w && Tri[2][c] < -Tri[2].w);
+                                }
+                                IsOutside = IsOutside || (Tri[0].z > Tri[0].w && Tri[1].z > Tri[1].w && Tri[2].z > Tri[2].w);
+                                if (IsOutside)
+                                    continue;
+
+                                if (GetNearPlaneDistance(Tri[0], IsGL) >= 0 && GetNearPlaneDistance(Tri[1], IsGL) >= 0 && GetNearPlaneDistance(Tri[2], IsGL) >= 0)
+                                {
+                                    AddTriangle(Tri[0], Tri[1], Tri[2], Mesh.CullBackFaces);
+                                }
+                                else
+                                {
+                                    float4       Polygon[4];
+                                    const Uint32 NumVerts = ClipByNearPlane(Tri, IsGL, Polygon);
+                                    for (Uint32 v = 2; v < NumVerts; ++v)
+                                        AddTriangle(Polygon[0], Polygon[v - 1], Polygon[v], Mesh.CullBackFaces);
+                                }
+                            }
+                        }
+                    }
+                });
+
+    // Every bin is rasterized by one thread
+    ParallelFor(pThreadPool, 0, NumBins, 1,
+                [this](size_t FirstBin, size_t EndBin) {
+                    for (size_t BinIdx = FirstBin; BinIdx < EndBin; ++BinIdx)
+                        RasterizeBin(static_cast<Uint32>(BinIdx));
+                });
+}
+
+void OcclusionRasterizer::RasterizeBin(Uint32 BinIdx)
+{
+    const RasterizeTileFn RasterizeTile = GetRasterizeTileKernel();
+
+    const Uint32 BinX = BinIdx % m_NumBinsX;
+    const Uint32 BinY = BinIdx / m_NumBinsX;
+
+    const int BinMinTileX = static_cast<int>(BinX * BinSizeInTiles);
+    const int BinMinTileY = static_cast<int>(BinY * BinSizeInTiles);
+    const int BinMaxTileX = static_cast<int>(std::min((BinX + 1) * BinSizeInTiles, m_NumTilesX)) - 1;
+    const int BinMaxTileY = static_cast<int>(std::min((BinY + 1) * BinSizeInTiles, m_NumTilesY)) - 1;
+
+    constexpr float MaxTileOffset = static_cast<float>(TileSize - 1);
+
+    for (Uint32 BatchIdx = 0; BatchIdx < m_NumUsedBatches; ++BatchIdx)
+    {
+        const TriangleBatch& Batch = m_Batches[BatchIdx];
+        for (Uint32 TriIdx : Batch.BinTriangles[BinIdx])
+        {
+            const ScreenTriangle& Tri = Batch.Triangles[TriIdx];
+
+            const int MinTileX = std::max(Tri.MinX / static_cast<int>(TileSize), BinMinTileX);
+            const int MinTileY = std::max(Tri.MinY / static_cast<int>(TileSize), BinMinTileY);
+            const int MaxTileX = std::min(Tri.MaxX / static_cast<int>(TileSize), BinMaxTileX);
+            const int MaxTileY = std::min(Tri.MaxY / static_cast<int>(TileSize), BinMaxTileY);
+            for (int TileY = MinTileY; TileY <= MaxTileY; ++TileY)
+            {
+                for (int TileX = MinTileX; TileX <= MaxTileX; ++TileX)
+                {
+                    const size_t TileIdx = size_t{static_cast<Uint32>(TileY)} * m_NumTilesX + static_cast<Uint32>(TileX);
+
+                    // Hierarchical depth test: the triangle is behind all pixels of the tile
+                    if (Tri.MinDepth >= m_TileMaxDepth[TileIdx])
+                        continue;
+
+                    // Center of the top-left pixel of the tile
+                    const double PixelX = TileX * static_cast<double>(TileSize) + 0.5;
+                    const double PixelY = TileY * static_cast<double>(TileSize) + 0.5;
+
+                    TileTriangle TileTri;
+                    bool         IsOutside = false;
+                    for (Uint32 e = 0; e < 3 && !IsOutside; ++e)
+                    {
+                        TileTri.E0[e] = static_cast<float>(Tri.EdgeA[e] * PixelX + Tri.EdgeB[e] * PixelY + Tri.EdgeC[e]);
+                        TileTri.A[e]  = Tri.EdgeA[e];
+                        TileTri.B[e]  = Tri.EdgeB[e];
+
+                        // The maximum of the edge function over the pixel centers of the tile
+                        IsOutside = TileTri.E0[e] + std::max(TileTri.A[e], 0.f) * MaxTileOffset + std::max(TileTri.B[e], 0.f) * MaxTileOffset <= 0;
+                    }
+                    if (IsOutside)
+                        continue;
+
+                    TileTri.Z0   = static_cast<float>(Tri.DepthA * PixelX + Tri.DepthB * PixelY + Tri.DepthC);
+                    TileTri.ZA   = Tri.DepthA;
+                    TileTri.ZB   = Tri.DepthB;
+                    TileTri.MinZ = Tri.MinDepth;
+
+                    m_TileMaxDepth[TileIdx] = RasterizeTile(TileTri, &m_Depth[TileIdx * TilePixels]);
+                }
+            }
+        }
+    }
+}
+
+bool OcclusionRasterizer::IsRectVisible(float MinX, float MinY, float MaxX, float MaxY, float MinDepth) const
+{
+    if (!(MinX <= MaxX && MinY <= MaxY))
+        return false;
+    if (MaxX < 0 || MaxY < 0 || MinX >= static_cast<float>(m_Width) || MinY >= static_cast<float>(m_Height))
+        return false;
+
+    // Pixels overlapped by the rectangle
+    const Uint32 X0 = static_cast<Uint32>(std::max(MinX, 0.f));
+    const Uint32 Y0 = static_cast<Uint32>(std::max(MinY, 0.f));
+    const Uint32 X1 = std::max(static_cast<Uint32>(std::min(std::ceil(MaxX), static_cast<float>(m_Width))), X0 + 1) - 1;
+    const Uint32 Y1 = std::max(static_cast<Uint32>(std::min(std::ceil(MaxY), static_cast<float>(m_Height))), Y0 + 1) - 1;
+
+    for (Uint32 TileY = Y0 / TileSize; TileY <= Y1 / TileSize; ++TileY)
+    {
+        for (Uint32 TileX = X0 / TileSize; TileX <= X1 / TileSize; ++TileX)
+        {
+            const size_t TileIdx = size_t{TileY} * m_NumTilesX + TileX;
+            if (MinDepth >= m_TileMaxDepth[TileIdx])
+                continue;
+
+            const Uint32 TileMinX = std::max(X0, TileX * TileSize) - TileX * TileSize;
+            const Uint32 TileMinY = std::max(Y0, TileY * TileSize) - TileY * TileSize;
+            const Uint32 TileMaxX = std::min(X1, TileX * TileSize + TileSize - 1) - TileX * TileSize;
+            const Uint32 TileMaxY = std::min(Y1, TileY * TileSize + TileSize - 1) - TileY * TileSize;
+
+            // The pixel with the maximum depth is covered when the rectangle covers the entire tile
+            if (TileMinX == 0 && TileMinY == 0 && TileMaxX == TileSize - 1 && TileMaxY == TileSize - 1)
+                return true;
+
+            const float* pTileDepth = &m_Depth[TileIdx * TilePixels];
+            for (Uint32 y = TileMinY; y <= TileMaxY; ++y)
+            {
+                for (Uint32 x = TileMinX; x <= TileMaxX; ++x)
+                {
+                    if (MinDepth < pTileDepth[y * TileSize + x])
+                        return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+bool OcclusionRasterizer::IsBoxVisible(const BoundBox& Box, const float4x4& ViewProj, bool IsGL) const
+{
+    float MinX = +FLT_MAX, MinY = +FLT_MAX, MinZ = +FLT_MAX;
+    float MaxX = -FLT_MAX, MaxY = -FLT_MAX;
+    for (Uint32 i = 0; i < 8; ++i)
+    {
+        const float3 Corner{
+            (i & 0x01) ? Box.Max.x : Box.Min.x,
+            (i & 0x02) ? Box.Max.y : Box.Min.y,
+            (i & 0x04) ? Box.Max.z : Box.Min.z,
+        };
+        const float4 ClipPos = float4{Corner, 1} * ViewProj;
+
+        // The box crosses the near plane and may cover the entire screen
+        if (GetNearPlaneDistance(ClipPos, IsGL) < 0 || !(ClipPos.w > 0))
+            return true;
+
+        const float InvW = 1.f / ClipPos.w;
+        const float X    = (ClipPos.x * InvW * 0.5f + 0.5f) * static_cast<float>(m_Width);
+        const float Y    = (0.5f - ClipPos.y * InvW * 0.5f) * static_cast<float>(m_Height);
+        const float Z    = IsGL ? ClipPos.z * InvW * 0.5f + 0.5f : ClipPos.z * InvW;
+
+        MinX = std::min(MinX, X);
+        MinY = std::min(MinY, Y);
+        MaxX = std::max(MaxX, X);
+        MaxY = std::max(MaxY, Y);
+        MinZ = std::min(MinZ, Z);
+    }
+
+    return IsRectVisible(MinX, MinY, MaxX, MaxY, MinZ);
+}
+
+void OcclusionRasterizer::TestBoxes(const BoundBox* pBoxes,
+                                    size_t          NumBoxes,
+                                    const float4x4& ViewProj,
+                                    bool            IsGL,
+                                    Uint32*         pVisibleMask,
+                                    IThreadPool*    pThreadPool) const
+{
+    if (NumBoxes == 0)
+        return;
+
+    DEV_CHECK_ERR(pBoxes != nullptr && pVisibleMask != nullptr, "Box array and visible mask must not be null");
+    if (pBoxes == nullptr || pVisibleMask == nullptr)
+        return;
+
+    const size_t NumWords = (NumBoxes + 31) / 32;
+    ParallelFor(pThreadPool, 0, NumWords, MinMaskWordsPerThread,
+                [&](size_t FirstWord, size_t EndWord) {
+                    for (size_t Word = FirstWord; Word < EndWord; ++Word)
+                    {
+                        Uint32 VisibleBits = 0;
+                        for (size_t i = Word * 32; i < std::min(Word * 32 + 32, NumBoxes); ++i)
+                        {
+                            if (IsBoxVisible(pBoxes[i], ViewProj, IsGL))
+                                VisibleBits |= 1u << (i - Word * 32);
+                        }
+                        pVisibleMask[Word] = VisibleBits;
+                    }
+                });
+}
+
+void OcclusionRasterizer::ReadDepth(float* pDepth) const
+{
+    DEV_CHECK_ERR(pDepth != nullptr, "Destination must not be null");
+    if (pDepth == nullptr)
+        return;
+
+    for (Uint32 y = 0; y < m_Height; ++y)
+    {
+        for (Uint32 x = 0; x < m_Width; ++x)
+            pDepth[size_t{y} * m_Width + x] = m_Depth[GetPixelOffset(x, y)];
+    }
+}
+
+} // namespace Diligent
@@ -0,0 +1,131 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ParallelFor.hpp"
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+
+namespace Diligent
+{
+
+// The state is shared with the thread pool tasks, which may
+// outlive the group if they are started after Wait() returns.
+struct TaskGroup::State
+{
+    std::mutex                        Mtx;
+    std::condition_variable           AllFinishedCond;
+    std::deque<std::function<void()>> Functions;
+
+    // The number of functions that are queued or running
+    size_t NumUnfinished = 0;
+
+    // Executes one function that has not been started yet.
+    // Returns false if there are no such functions.
+    bool ExecuteNext()
+    {
+        std::function<void()> Func;
+        {
+            std::lock_guard<std::mutex> Lock{Mtx};
+            if (Functions.empty())
+                return false;
+            Func = std::move(Functions.front());
+            Functions.pop_front();
+        }
+
+        Func();
+
+        bool AllFinished = false;
+        {
+            std::lock_guard<std::mutex> Lock{Mtx};
+            VERIFY_EXPR(NumUnfinished > 0);
+            AllFinished = --NumUnfinished == 0;
+        }
+        if (AllFinished)
+            AllFinishedCond.notify_all();
+
+        return true;
+    }
+};
+
+TaskGroup::TaskGroup(IThreadPool* pThreadPool, float fPriority) :
+    m_pThreadPool{pThreadPool},
+    m_fPriority{fPriority},
+    m_pState{std::make_shared<State>()}
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+    Wait();
+}
+
+void TaskGroup::Run(std::function<void()> Func)
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_pState->Mtx};
+        m_pState->Functions.emplace_back(std::move(Func));
+        ++m_pState->NumUnfinished;
+    }
+
+    if (m_pThreadPool)
+    {
+        // Every task executes one function, but it does not have to be the same function that
+        // was added by this call: the functions are executed in the order they were added.
+        m_Tasks.emplace_back(EnqueueAsyncWork(
+            m_pThreadPool,
+            [pState = m_pState](Uint32 ThreadId) {
+                pState->ExecuteNext();
+                return ASYNC_TASK_STATUS_COMPLETE;
+            },
+            m_fPriority));
+    }
+}
+
+void TaskGroup::Wait()
+{
+    // Help the worker threads instead of blocking
+    while (m_pState->ExecuteNext())
+    {
+    }
+
+    // Wait for the functions that are being executed by the worker threads
+    std::unique_lock<std::mutex> Lock{m_pState->Mtx};
+    m_pState->AllFinishedCond.wait(Lock, [this]() { return m_pState->NumUnfinished == 0; });
+    Lock.unlock();
+
+    // The tasks that have not started yet have nothing to do. Remove them so that
+    // they do not occupy the worker threads and do not linger in a pool without threads.
+    for (auto& pTask : m_Tasks)
+    {
+        if (pTask->GetStatus() == ASYNC_TASK_STATUS_NOT_STARTED)
+            m_pThreadPool->RemoveTask(pTask);
+    }
+    m_Tasks.clear();
+}
+
+} // namespace Diligent
@@ -26,7 +26,11 @@
 
 #include "Serializer.hpp"
 
+#include <algorithm>
+
 #include "HashUtils.hpp"
+#include "FileStream.h"
+#include "BasicFileSystem.hpp"
 
 namespace Diligent
 {
@@ -115,4 +119,122 @@ SerializedData SerializedData::MakeCopy(IMemoryAllocator& Allocator) const
     return Copy;
 }
 
+SerializerStreamState<SerializerMode::Stream>::SerializerStreamState(IFileStream* pStream, size_t BufferSize) :
+    m_pStream{pStream}
+{
+    if (m_pStream == nullptr)
+    {
+        DEV_ERROR("File stream must not be null");
+        m_StreamFailed = true;
+        return;
+    }
+
+    m_StreamStartPos = m_pStream->GetPos();
+    m_StreamBuffer.reserve(std::max(BufferSize, size_t{1}));
+}
+
+SerializerStreamState<SerializerMode::Stream>::~SerializerStreamState()
+{
+    StreamFlush();
+}
+
+bool SerializerStreamState<SerializerMode::Stream>::StreamWrite(const void* pData, size_t Size)
+{
+    if (m_StreamFailed)
+        return false;
+
+    if (Size == 0)
+        return true;
+
+    if (m_StreamBuffer.size() + Size > m_StreamBuffer.capacity())
+    {
+        if (!StreamFlush())
+            return false;
+
+        if (Size > m_StreamBuffer.capacity() && pData != nullptr)
+        {
+            // Large blocks bypass the intermediate buffer
+            if (!m_pStream->Write(pData, Size))
+            {
+                LOG_ERROR_MESSAGE("Failed to write ", Size, " bytes to the stream");
+                m_StreamFailed = true;
+                return false;
+            }
+            m_StreamBufferOffset += Size;
+            return true;
+        }
+    }
+
+    const size_t BufferSize = m_StreamBuffer.size();
+    m_StreamBuffer.resize(BufferSize + Size);
+    if (pData != nullptr)
+        std::memcpy(&m_StreamBuffer[BufferSize], pData, Size);
+    // resize() zero-initializes the new elements, so null data is written as zeros
+
+    return true;
+}
+
+bool SerializerStreamState<SerializerMode::Stream>::StreamFlush()
+{
+    if (m_StreamFailed)
+        return false;
+
+    if (m_StreamBuffer.empty())
+        return true;
+
+    if (!m_pStream->Write(m_StreamBuffer.data(), m_StreamBuffer.size()))
+    {
+        LOG_ERROR_MESSAGE("Failed to write ", m_StreamBuffer.size(), " bytes to the stream");
+        m_StreamFailed = true;
+        return false;
+    }
+
+    m_StreamBufferOffset += m_StreamBuffer.size();
+    // clear() keeps the capacity
+    m_StreamBuffer.clear();
+
+    return true;
+}
+
+bool SerializerStreamState<SerializerMode::Stream>::StreamPatch(size_t Offset, const void* pData, size_t Size)
+{
+    if (m_StreamFailed)
+        return false;
+
+    const size_t DataSize = m_StreamBufferOffset + m_StreamBuffer.size();
+    if (Offset + Size > DataSize)
+    {
+        UNEXPECTED("Patched range [", Offset, ", ", Offset + Size, ") is outside of the serialized data (", DataSize, " bytes)");
+        return false;
+    }
+
+    if (Size == 0)
+        return true;
+
+    const Uint8* pSrc = static_cast<const Uint8*>(pData);
+
+    // Part of the range that is still in the buffer
+    if (Offset + Size > m_StreamBufferOffset)
+    {
+        const size_t Start = std::max(Offset, m_StreamBufferOffset);
+        std::memcpy(&m_StreamBuffer[Start - m_StreamBufferOffset], pSrc + (Start - Offset), Offset + Size - Start);
+    }
+
+    // Part of the range that has already been written to the stream
+    if (Offset < m_StreamBufferOffset)
+    {
+        const size_t FlushedSize = std::min(Offset + Size, m_StreamBufferOffset) - Offset;
+        if (!m_pStream->SetPos(m_StreamStartPos + Offset, static_cast<int>(FilePosOrigin::Start)) ||
+            !m_pStream->Write(pSrc, FlushedSize) ||
+            !m_pStream->SetPos(m_StreamStartPos + m_StreamBufferOffset, static_cast<int>(FilePosOrigin::Start)))
+        {
+            LOG_ERROR_MESSAGE("Failed to patch ", FlushedSize, " bytes at offset ", Offset, " of the stream. The stream may not support seeking.");
+            m_StreamFailed = true;
+            return false;
+        }
+    }
+
+    return true;
+}
+
 } // namespace Diligent
@@ -32,15 +32,23 @@
 #include <map>
 #include <vector>
 #include <condition_variable>
+#include <memory>
+#include <chrono>
 #include <cfloat>
+#include <tuple>
 
 #include "PlatformMisc.hpp"
+#include "WorkStealingThreadPool.hpp"
+#include "AsyncTaskDependencyTracker.hpp"
+#include "ThreadPoolProfiler.hpp"
 
 namespace Diligent
 {
 
 AsyncTaskBase::~AsyncTaskBase()
 {
+    // Tasks that depend on this one must not wait forever
+    InvokeCompletionCallbacks();
 }
 
 class ThreadPoolImpl final : public ObjectBase<IThreadPool>
@@ -50,14 +58,35 @@ public:
 
     ThreadPoolImpl(IReferenceCounters*         pRefCounters,
                    const ThreadPoolCreateInfo& PoolCI) :
-        TBase{pRefCounters}
+        TBase{pRefCounters},
+        m_pProfiler{PoolCI.pProfiler},
+        m_NumThreads{StaticCast<Uint32>(PoolCI.NumThreads)},
+        m_DependencyTracker{
+            [this](QueuedTaskInfo&& TaskInfo) {
+                {
+                    std::unique_lock<std::mutex> lock = PushTask(std::move(TaskInfo));
+                    // NB: the task must stop being pending while the queue mutex is locked. Otherwise,
+                    //     a worker may run the task and check the number of pending tasks before it is
+                    //     decremented, and nobody would notify WaitForAllTasks().
+                    //     The queue is not empty, so WaitForAllTasks() does not need to be notified here.
+                    m_DependencyTracker.OnReadyTaskQueued();
+                }
+                m_NextTaskCond.notify_one();
+            }}
     {
+        std::vector<std::vector<Uint32>> WorkerAffinity;
+        if (PoolCI.Affinity.Mode != THREAD_POOL_AFFINITY_MODE_NONE)
+            WorkerAffinity = GetThreadPoolWorkerAffinity(PlatformMisc::GetProcessorTopology(), PoolCI.Affinity, PoolCI.NumThreads);
+
         m_WorkerThreads.reserve(PoolCI.NumThreads);
         for (Uint32 i = 0; i < PoolCI.NumThreads; ++i)
         {
             m_WorkerThreads.emplace_back(
-                [this, PoolCI, i] //
+                [this, PoolCI, i, Processors = !WorkerAffinity.empty() ? std::move(WorkerAffinity[i]) : std::vector<Uint32>{}] //
                 {
+                    if (!Processors.empty() && !PlatformMisc::SetCurrentThreadProcessorSet(Processors.data(), Processors.size()))
+                        LOG_WARNING_MESSAGE("Failed to set the affinity of worker thread ", i);
+
                     if (PoolCI.OnThreadStarted)
                         PoolCI.OnThreadStarted(i);
 
@@ -77,9 +106,11 @@ public:
     {
         QueuedTaskInfo TaskInfo;
         {
-            std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
+            std::unique_lock<std::mutex> lock = ThreadPoolProfiler::LockMutex(m_TasksQueueMtx, m_pProfiler.RawPtr());
             if (WaitForTask)
             {
+                const Int64 IdleStartTime = m_pProfiler ? m_pProfiler->GetTimestamp() : 0;
+
                 // The effects of notify_one()/notify_all() and each of the three atomic parts of
                 // wait()/wait_for()/wait_until() (unlock+wait, wakeup, and lock) take place in a
                 // single total order that can be viewed as modification order of an atomic variable:
@@ -92,6 +123,9 @@ public:
                                         return m_Stop.load() || !m_TasksQueue.empty();
                                     } //
                 );
+
+                if (m_pProfiler)
+                    m_pProfiler->RecordIdleTime(ThreadId, IdleStartTime, m_pProfiler->GetTimestamp());
             }
 
             // m_Stop must be accessed under the mutex
@@ -130,8 +164,14 @@ public:
             bool TaskFinished = false;
             if (PrerequisitesMet)
             {
+                const Int64 StartTime = m_pProfiler ? m_pProfiler->GetTimestamp() : 0;
+
                 TaskInfo.pTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
                 ASYNC_TASK_STATUS ReturnStatus = TaskInfo.pTask->Run(ThreadId);
+
+                if (m_pProfiler)
+                    m_pProfiler->RecordTaskRun(ThreadId, TaskInfo.EnqueueTime, StartTime, m_pProfiler->GetTimestamp(), TaskInfo.pTask->GetPriority(), ReturnStatus);
+
                 // NB: It is essential to set the task status after the Run() method returns.
                 //     This way if the GetStatus() method returns any value other than ASYNC_TASK_STATUS_RUNNING,
                 //     it is guaranteed that the task is not executed by any thread.
@@ -142,23 +182,29 @@ public:
             }
 
             {
-                std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
+                std::unique_lock<std::mutex> lock = ThreadPoolProfiler::LockMutex(m_TasksQueueMtx, m_pProfiler.RawPtr());
 
                 const int NumRunningTasks = m_NumRunningTasks.fetch_add(-1) - 1;
 
                 if (TaskFinished)
                 {
-                    if (m_TasksQueue.empty() && NumRunningTasks == 0)
+                    if (m_TasksQueue.empty() && NumRunningTasks == 0 && m_DependencyTracker.GetNumPendingTasks() == 0)
                     {
                         m_TasksFinishedCond.notify_one();
                     }
                 }
                 else
                 {
-                    // If prerequisites are not met or the task requested to be re-run,
-                    // re-enqueue the task with the minimum prerequisite priority
+                    // If prerequisites that are not tracked by the dependency tracker are not met,
+                    // or the task requested to be re-run, re-enqueue the task with the minimum
+                    // prerequisite priority.
                     if (TaskInfo.pTask->GetPriority() > MinPrereqPriority)
                         TaskInfo.pTask->SetPriority(MinPrereqPriority);
+                    if (m_pProfiler)
+                    {
+                        m_pProfiler->RecordTaskReenqueue();
+                        TaskInfo.EnqueueTime = m_pProfiler->GetTimestamp();
+                    }
                     m_TasksQueue.emplace(TaskInfo.pTask->GetPriority(), std::move(TaskInfo));
                 }
             }
@@ -180,47 +226,29 @@ public:
         if (pTask == nullptr)
             return;
 
-        {
-            std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
-            DEV_CHECK_ERR(!m_Stop, "Enqueue on a stopped ThreadPool");
+        DEV_CHECK_ERR(!m_Stop, "Enqueue on a stopped ThreadPool");
 
-            QueuedTaskInfo TaskInfo;
-            TaskInfo.pTask = pTask;
-            if (ppPrerequisites != nullptr && NumPrerequisites > 0)
-            {
-                TaskInfo.Prerequisites.reserve(NumPrerequisites);
-                float MinPrereqPriority = +FLT_MAX;
-                for (Uint32 i = 0; i < NumPrerequisites; ++i)
-                {
-                    if (ppPrerequisites[i] != nullptr)
-                    {
-                        TaskInfo.Prerequisites.emplace_back(ppPrerequisites[i]);
-                        MinPrereqPriority = std::min(MinPrereqPriority, ppPrerequisites[i]->GetPriority());
-                    }
-                }
-                if (pTask->GetPriority() > MinPrereqPriority)
-                {
-                    TaskInfo.pTask->SetPriority(MinPrereqPriority);
-                }
-            }
+        // A task with unfinished prerequisites is not put into the queue until all of them finish.
+        // The dependency tracker will enqueue the task when the last prerequisite is finished.
+        QueuedTaskInfo TaskInfo;
+        if (!m_DependencyTracker.AddTask(pTask, ppPrerequisites, NumPrerequisites, TaskInfo))
+            return;
 
-            m_TasksQueue.emplace(pTask->GetPriority(), std::move(TaskInfo));
-        }
+        PushTask(std::move(TaskInfo));
         m_NextTaskCond.notify_one();
     }
 
     virtual void DILIGENT_CALL_TYPE WaitForAllTasks() override final
     {
         std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
-        if (!m_TasksQueue.empty() || m_NumRunningTasks.load() > 0)
-        {
-            m_TasksFinishedCond.wait(lock,
-                                     [this] //
-                                     {
-                                         return m_TasksQueue.empty() && m_NumRunningTasks.load() == 0;
-                                     } //
-            );
-        }
+        m_TasksFinishedCond.wait(lock,
+                                 [this] //
+                                 {
+                                     return (m_TasksQueue.empty() &&
+                                             m_NumRunningTasks.load() == 0 &&
+                                             m_DependencyTracker.GetNumPendingTasks() == 0);
+                                 } //
+        );
     }
 
     virtual void DILIGENT_CALL_TYPE StopThreads() override final
@@ -243,14 +271,28 @@ public:
 
     virtual bool DILIGENT_CALL_TYPE RemoveTask(IAsyncTask* pTask) override final
     {
-        std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
+        // Releasing the task may start the tasks that depend on it,
+        // so it must be released after the mutex is unlocked.
+        QueuedTaskInfo RemovedTask;
+        {
+            std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
 
-        auto it = m_TasksQueue.begin();
-        while (it != m_TasksQueue.end() && it->second.pTask != pTask)
-            ++it;
-        if (it != m_TasksQueue.end())
+            auto it = m_TasksQueue.begin();
+            while (it != m_TasksQueue.end() && it->second.pTask != pTask)
+                ++it;
+            if (it != m_TasksQueue.end())
+            {
+                RemovedTask = std::move(it->second);
+                m_TasksQueue.erase(it);
+                return true;
+            }
+        }
+
+        if (m_DependencyTracker.RemoveTask(pTask))
         {
-            m_TasksQueue.erase(it);
+            std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
+            if (m_TasksQueue.empty() && m_NumRunningTasks.load() == 0 && m_DependencyTracker.GetNumPendingTasks() == 0)
+                m_TasksFinishedCond.notify_one();
             return true;
         }
 
@@ -277,7 +319,10 @@ public:
 
             return true;
         }
-        return false;
+        lock.unlock();
+
+        // Pending tasks are put into the queue with their current priority
+        return m_DependencyTracker.IsTaskPending(pTask);
     }
 
     virtual void DILIGENT_CALL_TYPE ReprioritizeAllTasks() override final
@@ -311,7 +356,7 @@ public:
     Uint32 DILIGENT_CALL_TYPE GetQueueSize() override final
     {
         std::unique_lock<std::mutex> lock{m_TasksQueueMtx};
-        return StaticCast<Uint32>(m_TasksQueue.size());
+        return StaticCast<Uint32>(m_TasksQueue.size()) + m_DependencyTracker.GetNumPendingTasks();
     }
 
     virtual Uint32 DILIGENT_CALL_TYPE GetRunningTaskCount() const override final
@@ -319,21 +364,40 @@ public:
         return m_NumRunningTasks.load();
     }
 
+    virtual Uint32 DILIGENT_CALL_TYPE GetThreadCount() const override final
+    {
+        return m_NumThreads;
+    }
+
     ~ThreadPoolImpl()
     {
         StopThreads();
         VERIFY_EXPR(m_TasksQueue.empty());
         VERIFY_EXPR(m_NumRunningTasks.load() == 0);
+        VERIFY_EXPR(m_DependencyTracker.GetNumPendingTasks() == 0);
     }
 
 private:
-    std::vector<std::thread> m_WorkerThreads;
+    using QueuedTaskInfo = AsyncTaskDependencyTracker::TaskInfo;
 
-    struct QueuedTaskInfo
+    // Returns the lock of the queue mutex
+    std::unique_lock<std::mutex> PushTask(QueuedTaskInfo&& TaskInfo)
     {
-        RefCntAutoPtr<IAsyncTask>              pTask;
-        std::vector<RefCntWeakPtr<IAsyncTask>> Prerequisites;
-    };
+        if (m_pProfiler)
+            TaskInfo.EnqueueTime = m_pProfiler->GetTimestamp();
+
+        std::unique_lock<std::mutex> lock     = ThreadPoolProfiler::LockMutex(m_TasksQueueMtx, m_pProfiler.RawPtr());
+        const float                  Priority = TaskInfo.pTask->GetPriority();
+        m_TasksQueue.emplace(Priority, std::move(TaskInfo));
+        return lock;
+    }
+
+private:
+    RefCntAutoPtr<ThreadPoolProfiler> m_pProfiler;
+
+    const Uint32             m_NumThreads;
+    std::vector<std::thread> m_WorkerThreads;
+
     // Priority queue
     std::mutex                                                m_TasksQueueMtx;
     std::multimap<float, QueuedTaskInfo, std::greater<float>> m_TasksQueue;
@@ -345,13 +409,208 @@ private:
     std::atomic<bool>       m_Stop{false};
 
     std::atomic<int> m_NumRunningTasks{0};
+
+    // NB: the tracker must be destroyed first as it may call back into the thread pool.
+    AsyncTaskDependencyTracker m_DependencyTracker;
 };
 
 RefCntAutoPtr<IThreadPool> CreateThreadPool(const ThreadPoolCreateInfo& ThreadPoolCI)
 {
+    static_assert(THREAD_POOL_SCHEDULER_COUNT == 2, "Did you add a new scheduler? Please handle it here.");
+    if (ThreadPoolCI.Scheduler == THREAD_POOL_SCHEDULER_WORK_STEALING)
+        return CreateWorkStealingThreadPool(ThreadPoolCI);
+
+    DEV_CHECK_ERR(ThreadPoolCI.Scheduler == THREAD_POOL_SCHEDULER_PRIORITY_QUEUE, "Unexpected thread pool scheduler");
     return RefCntAutoPtr<ThreadPoolImpl>{MakeNewRCObj<ThreadPoolImpl>()(ThreadPoolCI)};
 }
 
+void WaitForAllTasks(IAsyncTask* const* ppTasks, Uint32 NumTasks)
+{
+    for (Uint32 i = 0; i < NumTasks; ++i)
+    {
+        if (ppTasks[i] != nullptr)
+            ppTasks[i]->WaitForCompletion();
+    }
+}
+
+Uint32 WaitForAnyTask(IAsyncTask* const* ppTasks, Uint32 NumTasks)
+{
+    auto FindFinishedTask = [&]() {
+        for (Uint32 i = 0; i < NumTasks; ++i)
+        {
+            if (ppTasks[i] != nullptr && ppTasks[i]->IsFinished())
+                return i;
+        }
+        return NumTasks;
+    };
+
+    Uint32 FinishedTaskIdx = FindFinishedTask();
+    if (FinishedTaskIdx < NumTasks)
+        return FinishedTaskIdx;
+
+    struct WaitState
+    {
+        std::mutex              Mtx;
+        std::condition_variable Cond;
+        bool                    Signaled = false;
+    };
+    // The state is shared with the completion callbacks that may be called
+    // after this function returns.
+    std::shared_ptr<WaitState> pState = std::make_shared<WaitState>();
+
+    // All callbacks that have not been called must be removed before the function
+    // returns, otherwise repeated waits on a long-running task would pile them up.
+    struct CallbackRegistrations
+    {
+        std::vector<std::pair<RefCntAutoPtr<AsyncTaskBase>, AsyncTaskBase::CompletionCallbackHandle>> Callbacks;
+
+        ~CallbackRegistrations()
+        {
+            for (auto& Callback : Callbacks)
+                Callback.first->RemoveCompletionCallback(Callback.second);
+        }
+    } Registrations;
+
+    bool HasTasks         = false;
+    bool HasUntrackedTask = false;
+    for (Uint32 i = 0; i < NumTasks; ++i)
+    {
+        if (ppTasks[i] == nullptr)
+            continue;
+        HasTasks = true;
+
+        RefCntAutoPtr<AsyncTaskBase> pTaskImpl{ppTasks[i], AsyncTaskBase::IID_InternalImpl};
+        if (!pTaskImpl)
+        {
+            HasUntrackedTask = true;
+            continue;
+        }
+
+        const AsyncTaskBase::CompletionCallbackHandle hCallback = pTaskImpl->AddCompletionCallback(
+            [pState]() {
+                {
+                    std::lock_guard<std::mutex> Lock{pState->Mtx};
+                    pState->Signaled = true;
+                }
+                pState->Cond.notify_all();
+            });
+        if (hCallback == AsyncTaskBase::InvalidCompletionCallbackHandle)
+        {
+            // The task has finished since we checked its status
+            return i;
+        }
+        Registrations.Callbacks.emplace_back(std::move(pTaskImpl), hCallback);
+    }
+
+    if (!HasTasks)
+        return NumTasks;
+
+    while (true)
+    {
+        FinishedTaskIdx = FindFinishedTask();
+        if (FinishedTaskIdx < NumTasks)
+            return FinishedTaskIdx;
+
+        std::unique_lock<std::mutex> Lock{pState->Mtx};
+        if (HasUntrackedTask)
+        {
+            // Tasks that are not derived from AsyncTaskBase can't notify us, so we have to poll them
+            constexpr std::chrono::milliseconds PollingInterval{1};
+            pState->Cond.wait_for(Lock, PollingInterval, [&pState]() { return pState->Signaled; });
+        }
+        else
+        {
+            pState->Cond.wait(Lock, [&pState]() { return pState->Signaled; });
+        }
+        pState->Signaled = false;
+    }
+}
+
+std::vector<std::vector<Uint32>> GetThreadPoolWorkerAffinity(const ProcessorTopology&      Topology,
+                                                             const ThreadPoolAffinityInfo& Affinity,
+                                                             size_t                        NumThreads)
+{
+    static_assert(THREAD_POOL_AFFINITY_MODE_COUNT == 3, "Did you add a new affinity mode? Please handle it here.");
+
+    std::vector<std::vector<Uint32>> WorkerAffinity;
+    if (Affinity.Mode == THREAD_POOL_AFFINITY_MODE_NONE || NumThreads == 0)
+        return WorkerAffinity;
+
+    std::vector<LogicalProcessorInfo> Processors;
+    for (const LogicalProcessorInfo& Processor : Topology.LogicalProcessors)
+    {
+        if (Affinity.AllowedProcessors.empty() ||
+            std::find(Affinity.AllowedProcessors.begin(), Affinity.AllowedProcessors.end(), Processor.Id) != Affinity.AllowedProcessors.end())
+        {
+            Processors.push_back(Processor);
+        }
+    }
+
+    if (Processors.empty())
+    {
+        LOG_WARNING_MESSAGE("None of the allowed processors is present in the system. Worker thread affinity will not be set.");
+        return WorkerAffinity;
+    }
+
+    WorkerAffinity.resize(NumThreads);
+    if (Affinity.Mode == THREAD_POOL_AFFINITY_MODE_PROCESSOR)
+    {
+        // Keep the workers on the same node close to each other
+        auto ByCore = [](const LogicalProcessorInfo& P) {
+            return std::make_tuple(P.NUMANode, P.PackageId, P.CoreIndex, P.SMTIndex, P.Id);
+        };
+        if (Affinity.PreferPhysicalCores)
+        {
+            std::sort(Processors.begin(), Processors.end(),
+                      [&](const LogicalProcessorInfo& P0, const LogicalProcessorInfo& P1) {
+                          // Use the first sibling of every core first
+                          return P0.SMTIndex != P1.SMTIndex ? P0.SMTIndex < P1.SMTIndex : ByCore(P0) < ByCore(P1);
+                      });
+        }
+        else
+        {
+            std::sort(Processors.begin(), Processors.end(),
+                      [&](const LogicalProcessorInfo& P0, const LogicalProcessorInfo& P1) {
+                          return ByCore(P0) < ByCore(P1);
+                      });
+        }
+
+        for (size_t i = 0; i < NumThreads; ++i)
+            WorkerAffinity[i] = {Processors[i % Processors.size()].Id};
+    }
+    else
+    {
+        DEV_CHECK_ERR(Affinity.Mode == THREAD_POOL_AFFINITY_MODE_NUMA_NODE, "Unexpected affinity mode");
+
+        // Node -> allowed processors
+        std::map<Uint32, std::vector<Uint32>> Nodes;
+        for (const LogicalProcessorInfo& Processor : Processors)
+            Nodes[Processor.NUMANode].push_back(Processor.Id);
+
+        // Distribute the workers in proportion to the number of processors in each node:
+        // worker i goes to the node that contains processor number i * NumProcessors / NumThreads.
+        const size_t NumProcessors = Processors.size();
+        for (size_t i = 0; i < NumThreads; ++i)
+        {
+            const size_t ProcessorIdx = i * NumProcessors / NumThreads;
+
+            size_t FirstProcessorInNode = 0;
+            for (const auto& Node : Nodes)
+            {
+                if (ProcessorIdx < FirstProcessorInNode + Node.second.size())
+                {
+                    WorkerAffinity[i] = Node.second;
+                    break;
+                }
+                FirstProcessorInNode += Node.second.size();
+            }
+            VERIFY_EXPR(!WorkerAffinity[i].empty());
+        }
+    }
+
+    return WorkerAffinity;
+}
+
 Uint64 PinWorkerThread(Uint32 ThreadId, Uint64 AllowedCoresMask)
 {
     if (AllowedCoresMask == 0)
@@ -0,0 +1,228 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ThreadPoolProfiler.hpp"
+
+#include <algorithm>
+#include <set>
+#include <sstream>
+#include <iomanip>
+#include <thread>
+
+namespace Diligent
+{
+
+void ThreadPoolDurationHistogram::AddSample(Int64 DurationNs)
+{
+    // The task may have been enqueued before the profiler was reset
+    DurationNs = std::max(DurationNs, Int64{0});
+
+    const Uint64 DurationUs = static_cast<Uint64>(DurationNs) / 1000;
+
+    Uint32 Bucket = 0;
+    while (Bucket < NumBuckets - 1 && (Uint64{1} << Bucket) <= DurationUs)
+        ++Bucket;
+    ++Counts[Bucket];
+
+    const double Duration = static_cast<double>(DurationNs) * 1e-9;
+    MinTime               = NumSamples > 0 ? std::min(MinTime, Duration) : Duration;
+    MaxTime               = std::max(MaxTime, Duration);
+    TotalTime += Duration;
+    ++NumSamples;
+}
+
+ThreadPoolDurationHistogram& ThreadPoolDurationHistogram::operator+=(const ThreadPoolDurationHistogram& Rhs)
+{
+    if (Rhs.NumSamples == 0)
+        return *this;
+
+    for (Uint32 i = 0; i < NumBuckets; ++i)
+        Counts[i] += Rhs.Counts[i];
+
+    MinTime = NumSamples > 0 ? std::min(MinTime, Rhs.MinTime) : Rhs.MinTime;
+    MaxTime = std::max(MaxTime, Rhs.MaxTime);
+    TotalTime += Rhs.TotalTime;
+    NumSamples += Rhs.NumSamples;
+
+    return *this;
+}
+
+
+ThreadPoolProfiler::ThreadPoolProfiler(IReferenceCounters* pRefCounters, const ThreadPoolProfilerCreateInfo& CI) :
+    TBase{pRefCounters},
+    m_MaxTraceEventsPerThread{CI.MaxTraceEventsPerThread},
+    m_StartTime{GetClockTime()},
+    m_Slots(CI.NumThreadSlots > 0 ? CI.NumThreadSlots : std::max(std::thread::hardware_concurrency(), 1u))
+{
+}
+
+void ThreadPoolProfiler::RecordTaskRun(Uint32            ThreadId,
+                                       Int64             EnqueueTime,
+                                       Int64             StartTime,
+                                       Int64             EndTime,
+                                       float             fPriority,
+                                       ASYNC_TASK_STATUS Status)
+{
+    ThreadSlot& Slot = GetSlot(ThreadId);
+
+    std::lock_guard<std::mutex> Lock{Slot.Mtx};
+    Slot.Stats.BusyTime += static_cast<double>(EndTime - StartTime) * 1e-9;
+    ++Slot.Stats.NumTasksRun;
+    Slot.QueueLatency.AddSample(StartTime - EnqueueTime);
+    Slot.RunTime.AddSample(EndTime - StartTime);
+
+    if (m_MaxTraceEventsPerThread == 0)
+        return;
+
+    if (Slot.TraceEvents.size() < m_MaxTraceEventsPerThread)
+    {
+        TraceEvent Event;
+        Event.StartTime    = StartTime;
+        Event.Duration     = EndTime - StartTime;
+        Event.QueueLatency = StartTime - EnqueueTime;
+        Event.fPriority    = fPriority;
+        Event.ThreadId     = ThreadId;
+        Event.Status       = Status;
+        Slot.TraceEvents.emplace_back(Event);
+    }
+    else
+    {
+        ++Slot.NumDroppedTraceEvents;
+    }
+}
+
+void ThreadPoolProfiler::RecordIdleTime(Uint32 ThreadId, Int64 StartTime, Int64 EndTime)
+{
+    ThreadSlot& Slot = GetSlot(ThreadId);
+
+    std::lock_guard<std::mutex> Lock{Slot.Mtx};
+    Slot.Stats.IdleTime += static_cast<double>(EndTime - StartTime) * 1e-9;
+}
+
+ThreadPoolStatistics ThreadPoolProfiler::GetStatistics() const
+{
+    ThreadPoolStatistics Stats;
+    Stats.ElapsedTime = static_cast<double>(GetTimestamp()) * 1e-9;
+
+    Stats.Threads.reserve(m_Slots.size());
+    for (const ThreadSlot& Slot : m_Slots)
+    {
+        std::lock_guard<std::mutex> Lock{Slot.Mtx};
+        Stats.Threads.emplace_back(Slot.Stats);
+        Stats.QueueLatency += Slot.QueueLatency;
+        Stats.RunTime += Slot.RunTime;
+        Stats.NumDroppedTraceEvents += Slot.NumDroppedTraceEvents;
+    }
+
+    Stats.NumTasksReenqueued = m_NumTasksReenqueued.load(std::memory_order_relaxed);
+    Stats.LockWaitTime       = static_cast<double>(m_LockWaitTimeNs.load(std::memory_order_relaxed)) * 1e-9;
+    Stats.NumContendedLocks  = m_NumContendedLocks.load(std::memory_order_relaxed);
+
+    return Stats;
+}
+
+static const char* GetTaskStatusString(ASYNC_TASK_STATUS Status)
+{
+    switch (Status)
+    {
+        case ASYNC_TASK_STATUS_UNKNOWN: return "unknown";
+        case ASYNC_TASK_STATUS_NOT_STARTED: return "reenqueued";
+        case ASYNC_TASK_STATUS_RUNNING: return "running";
+        case ASYNC_TASK_STATUS_CANCELLED: return "cancelled";
+        case ASYNC_TASK_STATUS_COMPLETE: return "complete";
+        default: return "invalid";
+    }
+}
+
+std::string ThreadPoolProfiler::GetChromeTrace() const
+{
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+    ss << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    // Timestamps and durations are in microseconds
+    auto WriteTime = [&ss](Int64 TimeNs) {
+        ss << static_cast<double>(TimeNs) * 1e-3;
+    };
+
+    std::set<Uint32> ThreadIds;
+
+    bool IsFirstEvent = true;
+    for (const ThreadSlot& Slot : m_Slots)
+    {
+        std::lock_guard<std::mutex> Lock{Slot.Mtx};
+        for (const TraceEvent& Event : Slot.TraceEvents)
+        {
+            ss << (IsFirstEvent ? "\n" : ",\n");
+            IsFirstEvent = false;
+
+            ss << "{\"name\":\"Task\",\"cat\":\"ThreadPool\",\"ph\":\"X\",\"pid\":0,\"tid\":" << Event.ThreadId << ",\"ts\":";
+            WriteTime(Event.StartTime);
+            ss << ",\"dur\":";
+            WriteTime(Event.Duration);
+            ss << ",\"args\":{\"priority\":" << Event.fPriority << ",\"queue_latency_us\":";
+            WriteTime(Event.QueueLatency);
+            ss << ",\"status\":\"" << GetTaskStatusString(Event.Status) << "\"}}";
+
+            ThreadIds.insert(Event.ThreadId);
+        }
+    }
+
+    for (Uint32 ThreadId : ThreadIds)
+    {
+        ss << (IsFirstEvent ? "\n" : ",\n");
+        IsFirstEvent = false;
+        ss << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << ThreadId << ",\"args\":{\"name\":\"Thread " << ThreadId << "\"}}";
+    }
+
+    ss << "\n]}\n";
+    return ss.str();
+}
+
+void ThreadPoolProfiler::Reset()
+{
+    for (ThreadSlot& Slot : m_Slots)
+    {
+        std::lock_guard<std::mutex> Lock{Slot.Mtx};
+        Slot.Stats        = {};
+        Slot.QueueLatency = {};
+        Slot.RunTime      = {};
+        Slot.TraceEvents.clear();
+        Slot.NumDroppedTraceEvents = 0;
+    }
+
+    m_NumTasksReenqueued.store(0);
+    m_LockWaitTimeNs.store(0);
+    m_NumContendedLocks.store(0);
+    m_StartTime.store(GetClockTime());
+}
+
+RefCntAutoPtr<ThreadPoolProfiler> CreateThreadPoolProfiler(const ThreadPoolProfilerCreateInfo& CI)
+{
+    return RefCntAutoPtr<ThreadPoolProfiler>{MakeNewRCObj<ThreadPoolProfiler>()(CI)};
+}
+
+} // namespace Diligent
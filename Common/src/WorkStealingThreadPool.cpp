@@ -0,0 +1,560 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "WorkStealingThreadPool.hpp"
+#include "AsyncTaskDependencyTracker.hpp"
+#include "ThreadPoolProfiler.hpp"
+#include "PlatformMisc.hpp"
+#include "HashUtils.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <deque>
+#include <vector>
+#include <condition_variable>
+#include <cfloat>
+
+namespace Diligent
+{
+
+namespace
+{
+
+class WorkStealingThreadPoolImpl final : public ObjectBase<IThreadPool>
+{
+public:
+    using TBase = ObjectBase<IThreadPool>;
+
+    WorkStealingThreadPoolImpl(IReferenceCounters*         pRefCounters,
+                               const ThreadPoolCreateInfo& PoolCI) :
+        TBase{pRefCounters},
+        m_pProfiler{PoolCI.pProfiler},
+        m_NumThreads{StaticCast<Uint32>(PoolCI.NumThreads)},
+        m_NumBands{std::max(PoolCI.NumPriorityBands, 1u)},
+        // When the pool has no threads, the application calls ProcessTask() from its own threads.
+        // We don't know how many threads it will use, so create one queue per hardware thread.
+        m_Queues(PoolCI.NumThreads > 0 ? PoolCI.NumThreads : std::max(std::thread::hardware_concurrency(), 1u)),
+        m_NumTasksInBand(m_NumBands),
+        m_DependencyTracker{
+            [this](QueuedTaskInfo&& TaskInfo) {
+                // The task is ready when its last prerequisite finishes. If the prerequisite
+                // was run by a worker thread of this pool, put the task into the same queue.
+                PushTask(GetEnqueueQueueIdx(), std::move(TaskInfo), /*PushFront = */ false);
+                // NB: the task may have already been run by another thread that saw it as pending
+                //     and did not notify WaitForAllTasks(), so check the counters again.
+                if (m_DependencyTracker.OnReadyTaskQueued() == 0 && m_NumQueuedTasks.load() == 0 && m_NumRunningTasks.load() == 0)
+                    NotifyTasksFinished();
+                WakeWorker();
+            }}
+    {
+        for (TaskQueue& Queue : m_Queues)
+            Queue.Bands.resize(m_NumBands);
+
+        std::vector<std::vector<Uint32>> WorkerAffinity;
+        if (PoolCI.Affinity.Mode != THREAD_POOL_AFFINITY_MODE_NONE)
+            WorkerAffinity = GetThreadPoolWorkerAffinity(PlatformMisc::GetProcessorTopology(), PoolCI.Affinity, PoolCI.NumThreads);
+
+        m_WorkerThreads.reserve(PoolCI.NumThreads);
+        for (Uint32 i = 0; i < PoolCI.NumThreads; ++i)
+        {
+            m_WorkerThreads.emplace_back(
+                [this, PoolCI, i, Processors = !WorkerAffinity.empty() ? std::move(WorkerAffinity[i]) : std::vector<Uint32>{}] //
+                {
+                    if (!Processors.empty() && !PlatformMisc::SetCurrentThreadProcessorSet(Processors.data(), Processors.size()))
+                        LOG_WARNING_MESSAGE("Failed to set the affinity of worker thread ", i);
+
+                    if (PoolCI.OnThreadStarted)
+                        PoolCI.OnThreadStarted(i);
+
+                    while (ProcessTask(i, /*WaitForTask =*/true))
+                    {
+                    }
+
+                    if (PoolCI.OnThreadExiting)
+                        PoolCI.OnThreadExiting(i);
+                });
+        }
+    }
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_ThreadPool, TBase)
+
+    virtual bool DILIGENT_CALL_TYPE ProcessTask(Uint32 ThreadId, bool WaitForTask) override final
+    {
+        const Uint32 QueueIdx = ThreadId % static_cast<Uint32>(m_Queues.size());
+
+        // Seed the victim selection with the queue index so that different threads
+        // probe the queues in different orders.
+        if (t_WorkerContext.StealSeed == 0)
+            t_WorkerContext.StealSeed = static_cast<Uint32>(ComputeHash(QueueIdx + 1)) | 1u;
+
+        QueuedTaskInfo TaskInfo;
+        while (!PopTask(QueueIdx, TaskInfo))
+        {
+            if (!WaitForTask)
+                return !m_Stop.load() || m_NumQueuedTasks.load() > 0;
+
+            const Int64 IdleStartTime = m_pProfiler ? m_pProfiler->GetTimestamp() : 0;
+
+            std::unique_lock<std::mutex> lock{m_WakeMtx};
+            // NB: the number of sleeping threads must be incremented before the queue size is checked.
+            //     EnqueueTask() increments the queue size first and then checks the number of sleeping
+            //     threads, so at least one of the threads is guaranteed to see the other's update.
+            m_NumSleepingThreads.fetch_add(1);
+            m_WakeCond.wait(lock,
+                            [this] //
+                            {
+                                return m_Stop.load() || m_NumQueuedTasks.load() > 0;
+                            } //
+            );
+            m_NumSleepingThreads.fetch_add(-1);
+
+            if (m_pProfiler)
+                m_pProfiler->RecordIdleTime(ThreadId, IdleStartTime, m_pProfiler->GetTimestamp());
+
+            if (m_Stop.load() && m_NumQueuedTasks.load() == 0)
+                return false;
+        }
+
+        // Check prerequisites
+        bool  PrerequisitesMet  = true;
+        float MinPrereqPriority = +FLT_MAX;
+        for (auto& pPrereq : TaskInfo.Prerequisites)
+        {
+            if (auto pPrereqTask = pPrereq.Lock())
+            {
+                if (!pPrereqTask->IsFinished())
+                {
+                    PrerequisitesMet  = false;
+                    MinPrereqPriority = std::min(MinPrereqPriority, pPrereqTask->GetPriority());
+                }
+            }
+        }
+
+        bool TaskFinished = false;
+        if (PrerequisitesMet)
+        {
+            // Tasks enqueued by this task go to the queue of this thread
+            const WorkerContext PrevContext = t_WorkerContext;
+            t_WorkerContext                 = {this, QueueIdx, PrevContext.StealSeed};
+
+            const Int64 StartTime = m_pProfiler ? m_pProfiler->GetTimestamp() : 0;
+
+            TaskInfo.pTask->SetStatus(ASYNC_TASK_STATUS_RUNNING);
+            ASYNC_TASK_STATUS ReturnStatus = TaskInfo.pTask->Run(ThreadId);
+
+            if (m_pProfiler)
+                m_pProfiler->RecordTaskRun(ThreadId, TaskInfo.EnqueueTime, StartTime, m_pProfiler->GetTimestamp(), TaskInfo.pTask->GetPriority(), ReturnStatus);
+
+            // NB: It is essential to set the task status after the Run() method returns.
+            //     This way if the GetStatus() method returns any value other than ASYNC_TASK_STATUS_RUNNING,
+            //     it is guaranteed that the task is not executed by any thread.
+            TaskInfo.pTask->SetStatus(ReturnStatus);
+            TaskFinished = TaskInfo.pTask->IsFinished();
+            DEV_CHECK_ERR((TaskFinished || TaskInfo.pTask->GetStatus() == ASYNC_TASK_STATUS_NOT_STARTED),
+                          "Finished tasks must be in COMPLETE, CANCELLED or NOT_STARTED state");
+
+            t_WorkerContext = PrevContext;
+        }
+
+        if (TaskFinished)
+        {
+            const int NumRunningTasks = m_NumRunningTasks.fetch_add(-1) - 1;
+            if (NumRunningTasks == 0 && m_NumQueuedTasks.load() == 0 && m_DependencyTracker.GetNumPendingTasks() == 0)
+                NotifyTasksFinished();
+        }
+        else
+        {
+            // If prerequisites that are not tracked by the dependency tracker are not met,
+            // or the task requested to be re-run, re-enqueue the task with the minimum
+            // prerequisite priority.
+            if (TaskInfo.pTask->GetPriority() > MinPrereqPriority)
+                TaskInfo.pTask->SetPriority(MinPrereqPriority);
+            if (m_pProfiler)
+                m_pProfiler->RecordTaskReenqueue();
+            // Put the task to the front of the deque so that this thread
+            // processes other tasks before trying this one again.
+            PushTask(QueueIdx, std::move(TaskInfo), /*PushFront = */ true);
+            // NB: the task must be in the queue before the running task counter
+            //     is decremented, otherwise WaitForAllTasks() may miss the task.
+            m_NumRunningTasks.fetch_add(-1);
+            WakeWorker();
+        }
+
+        return true;
+    }
+
+    virtual void DILIGENT_CALL_TYPE EnqueueTask(IAsyncTask*  pTask,
+                                                IAsyncTask** ppPrerequisites,
+                                                Uint32       NumPrerequisites) override final
+    {
+        VERIFY_EXPR(pTask != nullptr);
+        if (pTask == nullptr)
+            return;
+
+        DEV_CHECK_ERR(!m_Stop, "Enqueue on a stopped ThreadPool");
+
+        // A task with unfinished prerequisites is not put into the queue until all of them finish.
+        // The dependency tracker will enqueue the task when the last prerequisite is finished.
+        QueuedTaskInfo TaskInfo;
+        if (!m_DependencyTracker.AddTask(pTask, ppPrerequisites, NumPrerequisites, TaskInfo))
+            return;
+
+        PushTask(GetEnqueueQueueIdx(), std::move(TaskInfo), /*PushFront = */ false);
+        WakeWorker();
+    }
+
+    virtual void DILIGENT_CALL_TYPE WaitForAllTasks() override final
+    {
+        std::unique_lock<std::mutex> lock{m_TasksFinishedMtx};
+        m_TasksFinishedCond.wait(lock,
+                                 [this] //
+                                 {
+                                     return (m_NumQueuedTasks.load() == 0 &&
+                                             m_NumRunningTasks.load() == 0 &&
+                                             m_DependencyTracker.GetNumPendingTasks() == 0);
+                                 } //
+        );
+    }
+
+    virtual void DILIGENT_CALL_TYPE StopThreads() override final
+    {
+        {
+            std::unique_lock<std::mutex> lock{m_WakeMtx};
+            // NB: even if the shared variable is atomic, it must be modified under the mutex
+            //     in order to correctly publish the modification to the waiting thread.
+            m_Stop.store(true);
+        }
+        m_WakeCond.notify_all();
+        for (std::thread& worker : m_WorkerThreads)
+            worker.join();
+
+        m_WorkerThreads.clear();
+    }
+
+    virtual bool DILIGENT_CALL_TYPE RemoveTask(IAsyncTask* pTask) override final
+    {
+        bool Removed = false;
+        for (TaskQueue& Queue : m_Queues)
+        {
+            // Releasing the task may start the tasks that depend on it,
+            // so it must be released after the mutex is unlocked.
+            QueuedTaskInfo RemovedTask;
+
+            std::unique_lock<std::mutex> lock{Queue.Mtx};
+            for (Uint32 Band = 0; Band < m_NumBands && !Removed; ++Band)
+            {
+                std::deque<QueuedTaskInfo>& Tasks = Queue.Bands[Band];
+
+                auto it = FindTask(Tasks, pTask);
+                if (it != Tasks.end())
+                {
+                    RemovedTask = std::move(*it);
+                    Tasks.erase(it);
+                    m_NumTasksInBand[Band].fetch_add(-1);
+                    m_NumQueuedTasks.fetch_add(-1);
+                    Removed = true;
+                }
+            }
+            lock.unlock();
+
+            if (Removed)
+                break;
+        }
+
+        if (!Removed)
+            Removed = m_DependencyTracker.RemoveTask(pTask);
+
+        if (Removed && m_NumQueuedTasks.load() == 0 && m_NumRunningTasks.load() == 0 && m_DependencyTracker.GetNumPendingTasks() == 0)
+            NotifyTasksFinished();
+
+        return Removed;
+    }
+
+    virtual bool DILIGENT_CALL_TYPE ReprioritizeTask(IAsyncTask* pTask) override final
+    {
+        const Uint32 NewBand = GetPriorityBand(pTask->GetPriority());
+
+        for (TaskQueue& Queue : m_Queues)
+        {
+            std::lock_guard<std::mutex> lock{Queue.Mtx};
+            for (Uint32 Band = 0; Band < m_NumBands; ++Band)
+            {
+                std::deque<QueuedTaskInfo>& Tasks = Queue.Bands[Band];
+
+                auto it = FindTask(Tasks, pTask);
+                if (it != Tasks.end())
+                {
+                    if (Band != NewBand)
+                    {
+                        // Increment the new band counter first so that the total number
+                        // of tasks in all bands never drops to zero.
+                        m_NumTasksInBand[NewBand].fetch_add(1);
+                        Queue.Bands[NewBand].emplace_back(std::move(*it));
+                        Tasks.erase(it);
+                        m_NumTasksInBand[Band].fetch_add(-1);
+                    }
+                    return true;
+                }
+            }
+        }
+
+        // Pending tasks are put into the queue with their current priority
+        return m_DependencyTracker.IsTaskPending(pTask);
+    }
+
+    virtual void DILIGENT_CALL_TYPE ReprioritizeAllTasks() override final
+    {
+        std::vector<std::pair<Uint32, QueuedTaskInfo>> ReprioritizationList;
+        for (TaskQueue& Queue : m_Queues)
+        {
+            std::lock_guard<std::mutex> lock{Queue.Mtx};
+            for (Uint32 Band = 0; Band < m_NumBands; ++Band)
+            {
+                std::deque<QueuedTaskInfo>& Tasks = Queue.Bands[Band];
+                for (auto it = Tasks.begin(); it != Tasks.end();)
+                {
+                    const Uint32 NewBand = GetPriorityBand(it->pTask->GetPriority());
+                    if (NewBand != Band)
+                    {
+                        m_NumTasksInBand[NewBand].fetch_add(1);
+                        ReprioritizationList.emplace_back(NewBand, std::move(*it));
+                        it = Tasks.erase(it);
+                        m_NumTasksInBand[Band].fetch_add(-1);
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+            }
+
+            for (auto& it : ReprioritizationList)
+                Queue.Bands[it.first].emplace_back(std::move(it.second));
+            ReprioritizationList.clear();
+        }
+    }
+
+    Uint32 DILIGENT_CALL_TYPE GetQueueSize() override final
+    {
+        return static_cast<Uint32>(m_NumQueuedTasks.load()) + m_DependencyTracker.GetNumPendingTasks();
+    }
+
+    virtual Uint32 DILIGENT_CALL_TYPE GetRunningTaskCount() const override final
+    {
+        return m_NumRunningTasks.load();
+    }
+
+    virtual Uint32 DILIGENT_CALL_TYPE GetThreadCount() const override final
+    {
+        return m_NumThreads;
+    }
+
+    ~WorkStealingThreadPoolImpl()
+    {
+        StopThreads();
+        VERIFY_EXPR(m_NumQueuedTasks.load() == 0);
+        VERIFY_EXPR(m_NumRunningTasks.load() == 0);
+        VERIFY_EXPR(m_DependencyTracker.GetNumPendingTasks() == 0);
+    }
+
+private:
+    using QueuedTaskInfo = AsyncTaskDependencyTracker::TaskInfo;
+
+    static std::deque<QueuedTaskInfo>::iterator FindTask(std::deque<QueuedTaskInfo>& Tasks, IAsyncTask* pTask)
+    {
+        return std::find_if(Tasks.begin(), Tasks.end(),
+                            [pTask](const QueuedTaskInfo& TaskInfo) {
+                                return TaskInfo.pTask == pTask;
+                            });
+    }
+
+    // Tasks enqueued from a worker thread go to its own queue, where they are likely
+    // to be processed while the data is still in the cache. Tasks enqueued from other
+    // threads are distributed between the queues in a round-robin fashion.
+    Uint32 GetEnqueueQueueIdx()
+    {
+        return t_WorkerContext.pPool == this ?
+            t_WorkerContext.QueueIdx :
+            m_NextQueueIdx.fetch_add(1) % static_cast<Uint32>(m_Queues.size());
+    }
+
+    Uint32 GetPriorityBand(float fPriority) const
+    {
+        // NB: the comparison is false for NaNs, so they go to the lowest band
+        if (!(fPriority > 0.f))
+            return 0;
+        if (fPriority >= static_cast<float>(m_NumBands - 1))
+            return m_NumBands - 1;
+        return static_cast<Uint32>(fPriority);
+    }
+
+    void PushTask(Uint32 QueueIdx, QueuedTaskInfo&& TaskInfo, bool PushFront)
+    {
+        const Uint32 Band = GetPriorityBand(TaskInfo.pTask->GetPriority());
+
+        if (m_pProfiler)
+            TaskInfo.EnqueueTime = m_pProfiler->GetTimestamp();
+
+        TaskQueue&                   Queue = m_Queues[QueueIdx];
+        std::unique_lock<std::mutex> lock  = ThreadPoolProfiler::LockMutex(Queue.Mtx, m_pProfiler.RawPtr());
+        if (PushFront)
+            Queue.Bands[Band].emplace_front(std::move(TaskInfo));
+        else
+            Queue.Bands[Band].emplace_back(std::move(TaskInfo));
+        m_NumTasksInBand[Band].fetch_add(1);
+        m_NumQueuedTasks.fetch_add(1);
+    }
+
+    bool TryPopTask(Uint32 QueueIdx, Uint32 Band, bool Steal, QueuedTaskInfo& TaskInfo)
+    {
+        TaskQueue&                   Queue = m_Queues[QueueIdx];
+        std::unique_lock<std::mutex> lock  = ThreadPoolProfiler::LockMutex(Queue.Mtx, m_pProfiler.RawPtr());
+
+        std::deque<QueuedTaskInfo>& Tasks = Queue.Bands[Band];
+        if (Tasks.empty())
+            return false;
+
+        // The owner thread takes the most recently added task (LIFO), which is
+        // likely to be hot in the cache, while thieves take the oldest one (FIFO).
+        if (Steal)
+        {
+            TaskInfo = std::move(Tasks.front());
+            Tasks.pop_front();
+        }
+        else
+        {
+            TaskInfo = std::move(Tasks.back());
+            Tasks.pop_back();
+        }
+
+        // NB: we must increment the running task counter before decrementing
+        //     the queued task counter, otherwise WaitForAllTasks() may miss the task.
+        m_NumRunningTasks.fetch_add(1);
+        m_NumTasksInBand[Band].fetch_add(-1);
+        m_NumQueuedTasks.fetch_add(-1);
+        return true;
+    }
+
+    bool PopTask(Uint32 QueueIdx, QueuedTaskInfo& TaskInfo)
+    {
+        const Uint32 NumQueues = static_cast<Uint32>(m_Queues.size());
+        for (Uint32 Band = m_NumBands; Band-- > 0;)
+        {
+            // Skip empty bands without touching any queue locks
+            if (m_NumTasksInBand[Band].load() == 0)
+                continue;
+
+            if (TryPopTask(QueueIdx, Band, /*Steal = */ false, TaskInfo))
+                return true;
+
+            // Start from a random victim so that idle threads do not all
+            // contend for the same queue.
+            Uint32&      Seed   = t_WorkerContext.StealSeed;
+            const Uint32 Offset = (Seed = Seed * 1664525u + 1013904223u) >> 16;
+            for (Uint32 i = 0; i < NumQueues; ++i)
+            {
+                const Uint32 VictimIdx = (Offset + i) % NumQueues;
+                if (VictimIdx != QueueIdx && TryPopTask(VictimIdx, Band, /*Steal = */ true, TaskInfo))
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
+    void WakeWorker()
+    {
+        if (m_NumSleepingThreads.load() > 0)
+        {
+            {
+                // Acquiring the mutex guarantees that a thread that has checked the
+                // queue size but has not yet started waiting will not miss the notification.
+                std::lock_guard<std::mutex> lock{m_WakeMtx};
+            }
+            m_WakeCond.notify_one();
+        }
+    }
+
+    void NotifyTasksFinished()
+    {
+        {
+            std::lock_guard<std::mutex> lock{m_TasksFinishedMtx};
+        }
+        m_TasksFinishedCond.notify_all();
+    }
+
+private:
+    struct alignas(64) TaskQueue
+    {
+        std::mutex                              Mtx;
+        std::vector<std::deque<QueuedTaskInfo>> Bands;
+    };
+
+    struct WorkerContext
+    {
+        const WorkStealingThreadPoolImpl* pPool     = nullptr;
+        Uint32                            QueueIdx  = 0;
+        Uint32                            StealSeed = 0;
+    };
+    static thread_local WorkerContext t_WorkerContext;
+
+    RefCntAutoPtr<ThreadPoolProfiler> m_pProfiler;
+
+    const Uint32 m_NumThreads;
+    const Uint32 m_NumBands;
+
+    std::vector<TaskQueue>        m_Queues;
+    std::vector<std::atomic<int>> m_NumTasksInBand;
+
+    std::atomic<int>    m_NumQueuedTasks{0};
+    std::atomic<int>    m_NumRunningTasks{0};
+    std::atomic<Uint32> m_NextQueueIdx{0};
+
+    std::vector<std::thread> m_WorkerThreads;
+
+    std::mutex              m_WakeMtx;
+    std::condition_variable m_WakeCond;
+    std::atomic<int>        m_NumSleepingThreads{0};
+    std::atomic<bool>       m_Stop{false};
+
+    std::mutex              m_TasksFinishedMtx;
+    std::condition_variable m_TasksFinishedCond;
+
+    // NB: the tracker must be destroyed first as it may call back into the thread pool.
+    AsyncTaskDependencyTracker m_DependencyTracker;
+};
+
+thread_local WorkStealingThreadPoolImpl::WorkerContext WorkStealingThreadPoolImpl::t_WorkerContext;
+
+} // namespace
+
+RefCntAutoPtr<IThreadPool> CreateWorkStealingThreadPool(const ThreadPoolCreateInfo& ThreadPoolCI)
+{
+    return RefCntAutoPtr<WorkStealingThreadPoolImpl>{MakeNewRCObj<WorkStealingThreadPoolImpl>()(ThreadPoolCI)};
+}
+
+} // namespace Diligent
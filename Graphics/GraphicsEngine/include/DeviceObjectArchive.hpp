@@ -302,6 +302,10 @@ public:
 
     void Clear() noexcept;
 
+private:
+    template <SerializerMode Mode>
+    void SerializeImpl(Serializer<Mode>& Ser) const;
+
 private:
     // Named resources
     std::unordered_map<NamedResourceKey, ResourceData, NamedResourceKey::Hasher> m_NamedResources;
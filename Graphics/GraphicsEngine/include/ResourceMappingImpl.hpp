@@ -37,6 +37,7 @@
 #include "HashUtils.hpp"
 #include "STDAllocator.hpp"
 #include "RefCntAutoPtr.hpp"
+#include "InternedStringPool.hpp"
 
 namespace Diligent
 {
@@ -50,9 +51,11 @@ public:
     typedef ObjectBase<IResourceMapping> TObjectBase;
 
     /// \param pRefCounters - reference counters object that controls the lifetime of this resource mapping
-    /// \param RawMemAllocator - raw memory allocator that is used by the m_HashTable member
+    /// \param RawMemAllocator - raw memory allocator that is used by the m_pNamePool and m_HashTable members
     ResourceMappingImpl(IReferenceCounters* pRefCounters, IMemoryAllocator& RawMemAllocator) :
         TObjectBase{pRefCounters},
+        m_RawMemAllocator{RawMemAllocator},
+        m_pNamePool{CreateNamePool()},
         m_HashTable{STD_ALLOCATOR_RAW_MEM(HashTableElem, RawMemAllocator, "Allocator for unordered_map<ResMappingHashKey, RefCntAutoPtr<IDeviceObject>>")}
     {}
 
@@ -94,6 +97,13 @@ private:
             Ownership_Hash = (ComputeHash(GetHash(), ArrInd) & HashMask) | (Ownership_Hash & StrOwnershipMask);
         }
 
+        ResMappingHashKey(const InternedString& Str, Uint32 ArrInd) noexcept :
+            HashMapStringKey{Str.GetStr(), Str.GetHash()},
+            ArrayIndex{ArrInd}
+        {
+            Ownership_Hash = ComputeHash(GetHash(), ArrInd) & HashMask;
+        }
+
         ResMappingHashKey(ResMappingHashKey&& rhs) noexcept :
             HashMapStringKey{std::move(rhs)},
             ArrayIndex{rhs.ArrayIndex}
@@ -122,15 +132,27 @@ private:
         const Uint32 ArrayIndex;
     };
 
+    std::unique_ptr<InternedStringPool> CreateNamePool() const;
+
+    // Rebuilds the name pool so that it only contains the names of the resources in the hash table.
+    void CompactNamePool();
+
+    IMemoryAllocator& m_RawMemAllocator;
+
     Threading::SpinLock m_Lock;
 
+    // Resource names are interned once so that all array elements of a resource
+    // share the same string. The pool must outlive the hash table keys.
+    // The pool does not release strings, so it is compacted when resources are removed.
+    std::unique_ptr<InternedStringPool> m_pNamePool;
+
     using HashTableElem = std::pair<const ResMappingHashKey, RefCntAutoPtr<IDeviceObject>>;
-    std::unordered_map<ResMappingHashKey,
-                       RefCntAutoPtr<IDeviceObject>,
-                       ResMappingHashKey::Hasher,
-                       std::equal_to<ResMappingHashKey>,
-                       STDAllocatorRawMem<HashTableElem>>
-        m_HashTable;
+    using HashTableType = std::unordered_map<ResMappingHashKey,
+                                             RefCntAutoPtr<IDeviceObject>,
+                                             ResMappingHashKey::Hasher,
+                                             std::equal_to<ResMappingHashKey>,
+                                             STDAllocatorRawMem<HashTableElem>>;
+    HashTableType m_HashTable;
 };
 
 } // namespace Diligent
@@ -31,7 +31,7 @@
 
 #include "Shader.h"
 #include "EngineMemory.h"
-#include "DataBlobImpl.hpp"
+#include "AlignedDataBlob.hpp"
 #include "PSOSerializer.hpp"
 
 namespace Diligent
@@ -112,7 +112,7 @@ struct ArchiveSerializer
 template <SerializerMode Mode>
 bool ArchiveSerializer<Mode>::SerializeShaders(ConstQual<ShadersVector>& Shaders) const
 {
-    static_assert(Mode == SerializerMode::Measure || Mode == SerializerMode::Write, "Measure or Write mode is expected.");
+    static_assert(Mode == SerializerMode::Measure || Mode == SerializerMode::Write || Mode == SerializerMode::Stream, "Measure, Write or Stream mode is expected.");
 
     Uint32 NumShaders = static_cast<Uint32>(Shaders.size());
     if (!Ser(NumShaders))
@@ -178,7 +178,7 @@ bool DeviceObjectArchive::Deserialize(const CreateInfo& CI) noexcept
     CHECK_ARCHIVE(CI.pData != nullptr, "pData must not be null");
 
     m_pArchiveData = CI.MakeCopy ?
-        DataBlobImpl::MakeCopy(CI.pData) :
+        AlignedDataBlob::MakeCopy(CI.pData) :
         const_cast<IDataBlob*>(CI.pData); // Need to remove const for AddRef/Release
 
     Serializer<SerializerMode::Read> Reader{
@@ -236,55 +236,61 @@ bool DeviceObjectArchive::Deserialize(const CreateInfo& CI) noexcept
     return true;
 }
 
-void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob) const
+template <SerializerMode Mode>
+void DeviceObjectArchive::SerializeImpl(Serializer<Mode>& Ser) const
 {
-    if (ppDataBlob == nullptr)
-    {
-        DEV_ERROR("Pointer to the data blob object must not be null");
-        return;
-    }
-    DEV_CHECK_ERR(*ppDataBlob == nullptr, "Data blob object must be null");
+    const auto ArchiveSer = ArchiveSerializer<Mode>{Ser};
 
-    auto SerializeThis = [this](auto& Ser) {
-        constexpr auto SerMode    = std::remove_reference<decltype(Ser)>::type::GetMode();
-        const auto     ArchiveSer = ArchiveSerializer<SerMode>{Ser};
+    ArchiveHeader Header;
+    Header.ContentVersion = m_ContentVersion;
 
-        ArchiveHeader Header;
-        Header.ContentVersion = m_ContentVersion;
+    auto res = ArchiveSer.SerializeHeader(Header);
+    VERIFY(res, "Failed to serialize header");
 
-        auto res = ArchiveSer.SerializeHeader(Header);
-        VERIFY(res, "Failed to serialize header");
+    Uint32 NumResources = StaticCast<Uint32>(m_NamedResources.size());
+    res                 = Ser(NumResources);
+    VERIFY(res, "Failed to serialize the number of resources");
 
-        Uint32 NumResources = StaticCast<Uint32>(m_NamedResources.size());
-        res                 = Ser(NumResources);
-        VERIFY(res, "Failed to serialize the number of resources");
+    for (const auto& res_it : m_NamedResources)
+    {
+        const char*        Name    = res_it.first.GetName();
+        const ResourceType ResType = res_it.first.GetType();
 
-        for (const auto& res_it : m_NamedResources)
-        {
-            const char*        Name    = res_it.first.GetName();
-            const ResourceType ResType = res_it.first.GetType();
+        res = Ser(ResType, Name);
+        VERIFY(res, "Failed to serialize resource type and name");
 
-            res = Ser(ResType, Name);
-            VERIFY(res, "Failed to serialize resource type and name");
+        res = ArchiveSer.SerializeResourceData(res_it.second);
+        VERIFY(res, "Failed to serialize resource data");
+    }
 
-            res = ArchiveSer.SerializeResourceData(res_it.second);
-            VERIFY(res, "Failed to serialize resource data");
-        }
+    for (const std::vector<SerializedData>& Shaders : m_DeviceShaders)
+    {
+        res = ArchiveSer.SerializeShaders(Shaders);
+        VERIFY(res, "Failed to serialize shaders");
+    }
+}
 
-        for (const std::vector<SerializedData>& Shaders : m_DeviceShaders)
-        {
-            res = ArchiveSer.SerializeShaders(Shaders);
-            VERIFY(res, "Failed to serialize shaders");
-        }
-    };
+void DeviceObjectArchive::Serialize(IDataBlob** ppDataBlob) const
+{
+    if (ppDataBlob == nullptr)
+    {
+        DEV_ERROR("Pointer to the data blob object must not be null");
+        return;
+    }
+    DEV_CHECK_ERR(*ppDataBlob == nullptr, "Data blob object must be null");
 
     Serializer<SerializerMode::Measure> Measurer;
-    SerializeThis(Measurer);
+    SerializeImpl(Measurer);
+
+    // The blob is written once, so it is not initialized. Large archives use huge pages
+    // to reduce the number of page faults.
+    const size_t ArchiveSize = Measurer.GetSize();
+    const size_t Alignment   = ArchiveSize >= (size_t{64} << 20) ? AlignedDataBlob::HugePageAlignment : AlignedDataBlob::DefaultAlignment;
 
-    RefCntAutoPtr<DataBlobImpl> pDataBlob = DataBlobImpl::Create(Measurer.GetSize());
+    RefCntAutoPtr<AlignedDataBlob> pDataBlob = AlignedDataBlob::Create(ArchiveSize, nullptr, Alignment);
 
     Serializer<SerializerMode::Write> Writer{SerializedData{pDataBlob->GetDataPtr(), pDataBlob->GetSize()}};
-    SerializeThis(Writer);
+    SerializeImpl(Writer);
     VERIFY_EXPR(Writer.IsEnded());
 
     *ppDataBlob = pDataBlob.Detach();
@@ -667,10 +673,12 @@ void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
 void DeviceObjectArchive::Serialize(IFileStream* pStream) const
 {
     DEV_CHECK_ERR(pStream != nullptr, "File stream must not be null");
-    RefCntAutoPtr<IDataBlob> pDataBlob;
-    Serialize(&pDataBlob);
-    VERIFY_EXPR(pDataBlob);
-    pStream->Write(pDataBlob->GetConstDataPtr(), pDataBlob->GetSize());
+
+    // Serialize the archive in a single pass without keeping the entire archive in memory
+    Serializer<SerializerMode::Stream> Streamer{pStream};
+    SerializeImpl(Streamer);
+    if (!Streamer.Flush())
+        LOG_ERROR_MESSAGE("Failed to write the device object archive to the stream");
 }
 
 } // namespace Diligent
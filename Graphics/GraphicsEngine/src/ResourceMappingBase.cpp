@@ -41,12 +41,15 @@ void ResourceMappingImpl::AddResourceArray(const Char* Name, Uint32 StartIndex,
         return;
 
     Threading::SpinLockGuard Guard{m_Lock};
+
+    // NB: the pool may be replaced by CompactNamePool(), so the name must be interned under the lock
+    const InternedString InternedName = m_pNamePool->Intern(Name);
     for (Uint32 Elem = 0; Elem < NumElements; ++Elem)
     {
         IDeviceObject* pObject = ppObjects[Elem];
 
-        // Try to construct new element in place
-        auto Elems = m_HashTable.emplace(ResMappingHashKey{Name, true /*Make copy*/, StartIndex + Elem}, pObject);
+        // Try to construct new element in place. The key references the interned string.
+        auto Elems = m_HashTable.emplace(ResMappingHashKey{InternedName, StartIndex + Elem}, pObject);
         // If there is already element with the same name, replace it
         if (!Elems.second && Elems.first->second != pObject)
         {
@@ -76,7 +79,34 @@ void ResourceMappingImpl::RemoveResourceByName(const Char* Name, Uint32 ArrayInd
     Threading::SpinLockGuard Guard{m_Lock};
     // Remove object with the given name
     // Name will be implicitly converted to HashMapStringKey without making a copy
-    m_HashTable.erase(ResMappingHashKey{Name, false, ArrayIndex});
+    if (m_HashTable.erase(ResMappingHashKey{Name, false, ArrayIndex}) == 0)
+        return;
+
+    // Every name in the table is used by at least one element, so the pool is rebuilt
+    // once most of its strings are unused. This keeps its size proportional to the table
+    // size at an amortized constant cost per removal.
+    constexpr size_t MinNamesToCompact = 64;
+    if (m_pNamePool->GetStats().NumStrings > m_HashTable.size() * 2 + MinNamesToCompact)
+        CompactNamePool();
+}
+
+std::unique_ptr<InternedStringPool> ResourceMappingImpl::CreateNamePool() const
+{
+    // The pool is only accessed under m_Lock, so one shard is enough
+    return std::make_unique<InternedStringPool>(m_RawMemAllocator, 4 << 10, 1);
+}
+
+void ResourceMappingImpl::CompactNamePool()
+{
+    std::unique_ptr<InternedStringPool> pNewPool = CreateNamePool();
+
+    HashTableType NewTable{m_HashTable.bucket_count(), m_HashTable.hash_function(), m_HashTable.key_eq(), m_HashTable.get_allocator()};
+    for (HashTableElem& Elem : m_HashTable)
+        NewTable.emplace(ResMappingHashKey{pNewPool->Intern(Elem.first.GetStr()), Elem.first.ArrayIndex}, std::move(Elem.second));
+
+    // The old table is destroyed before the old pool that its keys reference
+    m_HashTable.swap(NewTable);
+    m_pNamePool.swap(pNewPool);
 }
 
 IDeviceObject* ResourceMappingImpl::GetResource(const Char* Name, Uint32 ArrayIndex)
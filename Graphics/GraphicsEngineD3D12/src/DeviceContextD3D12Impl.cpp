@@ -51,6 +51,7 @@
 #include "DXGITypeConversions.hpp"
 
 #include "D3D12TileMappingHelper.hpp"
+#include "FrameArena.hpp"
 
 namespace Diligent
 {
@@ -1125,6 +1126,10 @@ void DeviceContextD3D12Impl::FinishFrame()
     for (size_t i = 0; i < _countof(m_DynamicGPUDescriptorAllocator); ++i)
         m_DynamicGPUDescriptorAllocator[i].ReleaseAllocations(QueueMask);
 
+    // Temporary allocations made by this thread are released, and the arena memory is reused in the next frame.
+    if (!IsDeferred())
+        FrameArena::GetThreadArena().EndFrame();
+
     EndFrame();
 }
 
@@ -2757,13 +2762,18 @@ void DeviceContextD3D12Impl::BuildBLAS(const BuildBLASAttribs& Attribs)
     TransitionOrVerifyBLASState(CmdCtx, *pBLASD3D12, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
     TransitionOrVerifyBufferState(CmdCtx, *pScratchD3D12, Attribs.ScratchBufferTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
 
+    FrameArena&            Arena = FrameArena::GetThreadArena();
+    FrameArena::Checkpoint ArenaScope{Arena};
+
     D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC    d3d12BuildASDesc   = {};
     D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS& d3d12BuildASInputs = d3d12BuildASDesc.Inputs;
-    std::vector<D3D12_RAYTRACING_GEOMETRY_DESC>           Geometries;
+    D3D12_RAYTRACING_GEOMETRY_DESC*                       Geometries         = nullptr;
+    UINT                                                  GeometryCount      = 0;
 
     if (Attribs.pTriangleData != nullptr)
     {
-        Geometries.resize(Attribs.TriangleDataCount);
+        GeometryCount = Attribs.TriangleDataCount;
+        Geometries    = Arena.ConstructArray<D3D12_RAYTRACING_GEOMETRY_DESC>(GeometryCount);
         pBLASD3D12->SetActualGeometryCount(Attribs.TriangleDataCount);
 
         for (Uint32 i = 0; i < Attribs.TriangleDataCount; ++i)
@@ -2835,7 +2845,8 @@ void DeviceContextD3D12Impl::BuildBLAS(const BuildBLASAttribs& Attribs)
     }
     else if (Attribs.pBoxData != nullptr)
     {
-        Geometries.resize(Attribs.BoxDataCount);
+        GeometryCount = Attribs.BoxDataCount;
+        Geometries    = Arena.ConstructArray<D3D12_RAYTRACING_GEOMETRY_DESC>(GeometryCount);
         pBLASD3D12->SetActualGeometryCount(Attribs.BoxDataCount);
 
         for (Uint32 i = 0; i < Attribs.BoxDataCount; ++i)
@@ -2871,8 +2882,8 @@ void DeviceContextD3D12Impl::BuildBLAS(const BuildBLASAttribs& Attribs)
     d3d12BuildASInputs.Type           = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL;
     d3d12BuildASInputs.Flags          = BuildASFlagsToD3D12ASBuildFlags(BLASDesc.Flags);
     d3d12BuildASInputs.DescsLayout    = D3D12_ELEMENTS_LAYOUT_ARRAY;
-    d3d12BuildASInputs.NumDescs       = static_cast<UINT>(Geometries.size());
-    d3d12BuildASInputs.pGeometryDescs = Geometries.data();
+    d3d12BuildASInputs.NumDescs       = GeometryCount;
+    d3d12BuildASInputs.pGeometryDescs = Geometries;
 
     d3d12BuildASDesc.DestAccelerationStructureData    = pBLASD3D12->GetGPUAddress();
     d3d12BuildASDesc.ScratchAccelerationStructureData = pScratchD3D12->GetGPUAddress() + Attribs.ScratchBufferOffset;
@@ -57,6 +57,7 @@
 #include "D3D12TypeConversions.hpp"
 #include "DXGITypeConversions.hpp"
 #include "QueryManagerD3D12.hpp"
+#include "FrameArena.hpp"
 
 
 namespace Diligent
@@ -374,10 +375,13 @@ Uint64 RenderDeviceD3D12Impl::CloseAndExecuteCommandContexts(SoftwareQueueIndex
 {
     VERIFY_EXPR(NumContexts > 0 && pContexts != 0);
 
+    FrameArena&            Arena = FrameArena::GetThreadArena();
+    FrameArena::Checkpoint ArenaScope{Arena};
+
+    ID3D12CommandList** const d3d12CmdLists = Arena.ConstructArray<ID3D12CommandList*>(NumContexts);
+
     // TODO: use small_vector
-    std::vector<ID3D12CommandList*>              d3d12CmdLists;
     std::vector<CComPtr<ID3D12CommandAllocator>> CmdAllocators;
-    d3d12CmdLists.reserve(NumContexts);
     CmdAllocators.reserve(NumContexts);
 
     CommandListManager& CmdListMngr = GetCmdListManager(CommandQueueId);
@@ -387,7 +391,7 @@ Uint64 RenderDeviceD3D12Impl::CloseAndExecuteCommandContexts(SoftwareQueueIndex
         VERIFY_EXPR(pCtx);
         VERIFY_EXPR(CmdListMngr.GetCommandListType() == pCtx->GetCommandListType());
         CComPtr<ID3D12CommandAllocator> pAllocator;
-        d3d12CmdLists.emplace_back(pCtx->Close(pAllocator));
+        d3d12CmdLists[i] = pCtx->Close(pAllocator);
         CmdAllocators.emplace_back(std::move(pAllocator));
     }
 
@@ -413,7 +417,7 @@ Uint64 RenderDeviceD3D12Impl::CloseAndExecuteCommandContexts(SoftwareQueueIndex
         //                  |     with number N                      |                                   |
         if (pWaitFences != nullptr)
             WaitFences(CommandQueueId, *pWaitFences);
-        SubmittedCommandBufferInfo SubmittedCmdBuffInfo = TRenderDeviceBase::SubmitCommandBuffer(CommandQueueId, true, NumContexts, d3d12CmdLists.data());
+        SubmittedCommandBufferInfo SubmittedCmdBuffInfo = TRenderDeviceBase::SubmitCommandBuffer(CommandQueueId, true, NumContexts, d3d12CmdLists);
         FenceValue                                      = SubmittedCmdBuffInfo.FenceValue;
         if (pSignalFences != nullptr)
             SignalFences(CommandQueueId, *pSignalFences);
@@ -46,6 +46,7 @@
 #include "GenerateMipsVkHelper.hpp"
 #include "QueryManagerVk.hpp"
 #include "CommandQueueVkImpl.hpp"
+#include "FrameArena.hpp"
 
 namespace Diligent
 {
@@ -1424,6 +1425,10 @@ void DeviceContextVkImpl::FinishFrame()
     // be destroyed before the pools are actually returned to the global pool manager.
     m_DynamicDescrSetAllocator.ReleasePools(QueueMask);
 
+    // Temporary allocations made by this thread are released, and the arena memory is reused in the next frame.
+    if (!IsDeferred())
+        FrameArena::GetThreadArena().EndFrame();
+
     EndFrame();
 }
 
@@ -1444,10 +1449,14 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
     DEV_CHECK_ERR(m_pActiveRenderPass == nullptr,
                   "Flushing device context inside an active render pass.");
 
+    FrameArena&            Arena = FrameArena::GetThreadArena();
+    FrameArena::Checkpoint ArenaScope{Arena};
+
+    VkCommandBuffer* const vkCmdBuffs    = Arena.ConstructArray<VkCommandBuffer>(size_t{NumCommandLists} + 1);
+    uint32_t               NumVkCmdBuffs = 0;
+
     // TODO: replace with small_vector
-    std::vector<VkCommandBuffer>               vkCmdBuffs;
     std::vector<RefCntAutoPtr<IDeviceContext>> DeferredCtxs;
-    vkCmdBuffs.reserve(size_t{NumCommandLists} + 1);
     DeferredCtxs.reserve(size_t{NumCommandLists} + 1);
 
     VkCommandBuffer vkCmdBuff = m_CommandBuffer.GetVkCmdBuffer();
@@ -1473,7 +1482,7 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
             m_CommandBuffer.FlushBarriers();
             m_CommandBuffer.EndCommandBuffer();
 
-            vkCmdBuffs.push_back(vkCmdBuff);
+            vkCmdBuffs[NumVkCmdBuffs++] = vkCmdBuff;
         }
     }
 
@@ -1484,9 +1493,9 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
         DEV_CHECK_ERR(pCmdListVk != nullptr, "Command list must not be null");
         DEV_CHECK_ERR(pCmdListVk->GetQueueId() == GetDesc().QueueId, "Command list recorded for QueueId ", pCmdListVk->GetQueueId(), ", but executed on QueueId ", GetDesc().QueueId, ".");
         DeferredCtxs.emplace_back();
-        vkCmdBuffs.emplace_back();
-        pCmdListVk->Close(DeferredCtxs.back(), vkCmdBuffs.back());
-        VERIFY(vkCmdBuffs.back() != VK_NULL_HANDLE, "Trying to execute empty command buffer");
+        VkCommandBuffer& vkDeferredCmdBuff = vkCmdBuffs[NumVkCmdBuffs++];
+        pCmdListVk->Close(DeferredCtxs.back(), vkDeferredCmdBuff);
+        VERIFY(vkDeferredCmdBuff != VK_NULL_HANDLE, "Trying to execute empty command buffer");
         VERIFY_EXPR(DeferredCtxs.back() != nullptr);
     }
 
@@ -1548,8 +1557,8 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
     VkSubmitInfo SubmitInfo{};
     SubmitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
     SubmitInfo.pNext                = nullptr;
-    SubmitInfo.commandBufferCount   = static_cast<uint32_t>(vkCmdBuffs.size());
-    SubmitInfo.pCommandBuffers      = vkCmdBuffs.data();
+    SubmitInfo.commandBufferCount   = NumVkCmdBuffs;
+    SubmitInfo.pCommandBuffers      = NumVkCmdBuffs != 0 ? vkCmdBuffs : nullptr;
     SubmitInfo.waitSemaphoreCount   = static_cast<uint32_t>(m_VkWaitSemaphores.size());
     SubmitInfo.pWaitSemaphores      = SubmitInfo.waitSemaphoreCount != 0 ? m_VkWaitSemaphores.data() : nullptr;
     SubmitInfo.pWaitDstStageMask    = SubmitInfo.waitSemaphoreCount != 0 ? m_WaitDstStageMasks.data() : nullptr;
@@ -1608,9 +1617,9 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
         pDeferredCtxVkImpl->UpdateSubmittedBuffersCmdQueueMask(GetCommandQueueId());
         // It is OK to dispose command buffer from another thread. We are not going to
         // record any commands and only need to add the buffer to the queue
-        pDeferredCtxVkImpl->DisposeVkCmdBuffer(GetCommandQueueId(), std::move(vkCmdBuffs[buff_idx]), SubmittedFenceValue);
+        pDeferredCtxVkImpl->DisposeVkCmdBuffer(GetCommandQueueId(), vkCmdBuffs[buff_idx], SubmittedFenceValue);
     }
-    VERIFY_EXPR(buff_idx == vkCmdBuffs.size());
+    VERIFY_EXPR(buff_idx == NumVkCmdBuffs);
 
     m_State    = {};
     m_BindInfo = {};
@@ -3516,14 +3525,19 @@ void DeviceContextVkImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
     TransitionOrVerifyBLASState(*pBLASVk, Attribs.BLASTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, OpName);
     TransitionOrVerifyBufferState(*pScratchVk, Attribs.ScratchBufferTransitionMode, RESOURCE_STATE_BUILD_AS_WRITE, VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR, OpName);
 
-    VkAccelerationStructureBuildGeometryInfoKHR           vkASBuildInfo = {};
-    std::vector<VkAccelerationStructureBuildRangeInfoKHR> vkRanges;
-    std::vector<VkAccelerationStructureGeometryKHR>       vkGeometries;
+    FrameArena&            Arena = FrameArena::GetThreadArena();
+    FrameArena::Checkpoint ArenaScope{Arena};
+
+    VkAccelerationStructureBuildGeometryInfoKHR vkASBuildInfo = {};
+    VkAccelerationStructureBuildRangeInfoKHR*   vkRanges      = nullptr;
+    VkAccelerationStructureGeometryKHR*         vkGeometries  = nullptr;
+    uint32_t                                    GeometryCount = 0;
 
     if (Attribs.pTriangleData != nullptr)
     {
-        vkGeometries.resize(Attribs.TriangleDataCount);
-        vkRanges.resize(Attribs.TriangleDataCount);
+        GeometryCount = Attribs.TriangleDataCount;
+        vkGeometries  = Arena.ConstructArray<VkAccelerationStructureGeometryKHR>(GeometryCount);
+        vkRanges      = Arena.ConstructArray<VkAccelerationStructureBuildRangeInfoKHR>(GeometryCount);
         pBLASVk->SetActualGeometryCount(Attribs.TriangleDataCount);
 
         for (Uint32 i = 0; i < Attribs.TriangleDataCount; ++i)
@@ -3608,8 +3622,9 @@ void DeviceContextVkImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
     }
     else if (Attribs.pBoxData != nullptr)
     {
-        vkGeometries.resize(Attribs.BoxDataCount);
-        vkRanges.resize(Attribs.BoxDataCount);
+        GeometryCount = Attribs.BoxDataCount;
+        vkGeometries  = Arena.ConstructArray<VkAccelerationStructureGeometryKHR>(GeometryCount);
+        vkRanges      = Arena.ConstructArray<VkAccelerationStructureBuildRangeInfoKHR>(GeometryCount);
         pBLASVk->SetActualGeometryCount(Attribs.BoxDataCount);
 
         for (Uint32 i = 0; i < Attribs.BoxDataCount; ++i)
@@ -3652,7 +3667,7 @@ void DeviceContextVkImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
         }
     }
 
-    VkAccelerationStructureBuildRangeInfoKHR const* VkRangePtr = vkRanges.data();
+    VkAccelerationStructureBuildRangeInfoKHR const* VkRangePtr = vkRanges;
 
     vkASBuildInfo.sType                     = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR;
     vkASBuildInfo.type                      = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR;                 // type must be compatible with create info
@@ -3660,8 +3675,8 @@ void DeviceContextVkImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
     vkASBuildInfo.mode                      = Attribs.Update ? VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR : VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR;
     vkASBuildInfo.srcAccelerationStructure  = Attribs.Update ? pBLASVk->GetVkBLAS() : VK_NULL_HANDLE;
     vkASBuildInfo.dstAccelerationStructure  = pBLASVk->GetVkBLAS();
-    vkASBuildInfo.geometryCount             = static_cast<uint32_t>(vkGeometries.size());
-    vkASBuildInfo.pGeometries               = vkGeometries.data();
+    vkASBuildInfo.geometryCount             = GeometryCount;
+    vkASBuildInfo.pGeometries               = vkGeometries;
     vkASBuildInfo.ppGeometries              = nullptr;
     vkASBuildInfo.scratchData.deviceAddress = pScratchVk->GetVkDeviceAddress() + Attribs.ScratchBufferOffset;
 
@@ -27,12 +27,11 @@
 #include <unordered_map>
 
 #include "RefCntAutoPtr.hpp"
-#include "DataBlobImpl.hpp"
+#include "AlignedDataBlob.hpp"
 #include "ObjectBase.hpp"
 #include "Serializer.hpp"
 #include "BytecodeCache.h"
 #include "XXH128Hasher.hpp"
-#include "DefaultRawMemoryAllocator.hpp"
 
 namespace Diligent
 {
@@ -90,7 +89,7 @@ public:
             return false;
         }
 
-        Serializer<SerializerMode::Read> Stream{SerializedData{pDataBlob->GetDataPtr(), pDataBlob->GetSize()}};
+        Serializer<SerializerMode::Read> Stream{SerializedData{const_cast<void*>(pDataBlob->GetConstDataPtr()), pDataBlob->GetSize()}};
 
         BytecodeCacheHeader Header;
         Header.Serialize(Stream);
@@ -111,7 +110,7 @@ public:
             BytecodeCacheElementHeader ElementHeader;
             ElementHeader.Serialize(Stream);
 
-            RefCntAutoPtr<DataBlobImpl> pBytecode = DataBlobImpl::Create(ElementHeader.DataSize);
+            RefCntAutoPtr<AlignedDataBlob> pBytecode = AlignedDataBlob::Create(ElementHeader.DataSize);
             Stream.CopyBytes(pBytecode->GetDataPtr(), ElementHeader.DataSize);
             m_HashMap.emplace(ElementHeader.Hash, pBytecode);
         }
@@ -176,13 +175,14 @@ public:
         Serializer<SerializerMode::Measure> MeasureStream{};
         WriteData(MeasureStream);
 
-        const SerializedData Memory = MeasureStream.AllocateData(DefaultRawMemoryAllocator::GetAllocator());
+        // Serialize directly into the blob to avoid an extra copy
+        RefCntAutoPtr<AlignedDataBlob> pDataBlob = AlignedDataBlob::Create(MeasureStream.GetSize());
 
-        Serializer<SerializerMode::Write> WriteStream{Memory};
+        Serializer<SerializerMode::Write> WriteStream{SerializedData{pDataBlob->GetDataPtr(), pDataBlob->GetSize()}};
         WriteData(WriteStream);
         VERIFY_EXPR(WriteStream.IsEnded());
 
-        *ppDataBlob = DataBlobImpl::Create(Memory.Size(), Memory.Ptr()).Detach();
+        *ppDataBlob = pDataBlob.Detach();
     }
 
     virtual void DILIGENT_CALL_TYPE Clear() override final
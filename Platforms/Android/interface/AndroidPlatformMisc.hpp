@@ -39,6 +39,16 @@ struct AndroidMisc : public LinuxMisc
     /// Sets the current thread affinity mask and on success returns the previous mask.
     /// On failure, returns 0.
     static Uint64 SetCurrentThreadAffinity(Uint64 Mask);
+
+    static ProcessorTopology GetProcessorTopology()
+    {
+        return BasicPlatformMisc::GetProcessorTopology();
+    }
+
+    static bool SetCurrentThreadProcessorSet(const Uint32* pProcessorIds, size_t NumProcessors)
+    {
+        return BasicPlatformMisc::SetCurrentThreadProcessorSet(pProcessorIds, NumProcessors);
+    }
 };
 
 } // namespace Diligent
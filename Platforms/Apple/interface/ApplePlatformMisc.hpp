@@ -37,6 +37,16 @@ namespace Diligent
 struct AppleMisc : public LinuxMisc
 {
     static Uint64 SetCurrentThreadAffinity(Uint64 Mask);
+
+    static ProcessorTopology GetProcessorTopology()
+    {
+        return BasicPlatformMisc::GetProcessorTopology();
+    }
+
+    static bool SetCurrentThreadProcessorSet(const Uint32* pProcessorIds, size_t NumProcessors)
+    {
+        return BasicPlatformMisc::SetCurrentThreadProcessorSet(pProcessorIds, NumProcessors);
+    }
 };
 
 } // namespace Diligent
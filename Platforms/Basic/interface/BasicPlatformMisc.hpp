@@ -27,6 +27,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "../../../Primitives/interface/BasicTypes.h"
 
 namespace Diligent
@@ -42,6 +44,66 @@ enum class ThreadPriority
     Highest
 };
 
+/// Logical processor information
+struct LogicalProcessorInfo
+{
+    /// The logical processor index used by the OS, e.g. the CPU number on Linux.
+    Uint32 Id = 0;
+
+    /// The index of the physical core in the processor topology.
+    /// Logical processors with the same core index are SMT siblings.
+    Uint32 CoreIndex = 0;
+
+    /// The index of the logical processor among its SMT siblings, ordered by Id.
+    /// Every physical core has exactly one logical processor with SMTIndex 0.
+    Uint32 SMTIndex = 0;
+
+    /// The physical package (socket) ID.
+    Uint32 PackageId = 0;
+
+    /// The NUMA node ID.
+    Uint32 NUMANode = 0;
+};
+
+/// Processor topology, see PlatformMisc::GetProcessorTopology().
+struct ProcessorTopology
+{
+    /// Online logical processors sorted by Id.
+    std::vector<LogicalProcessorInfo> LogicalProcessors;
+
+    /// The number of physical cores.
+    Uint32 NumCores = 0;
+
+    /// The number of physical packages.
+    Uint32 NumPackages = 0;
+
+    /// The number of NUMA nodes.
+    Uint32 NumNUMANodes = 0;
+};
+
+/// CPU instruction set extensions that are available at run time,
+/// see PlatformMisc::GetCPUFeatures().
+struct CPUFeatures
+{
+    /// x86 SSE2
+    bool SSE2 = false;
+
+    /// x86 SSE4.1
+    bool SSE41 = false;
+
+    /// x86 AVX2. Only reported if the OS saves the AVX registers.
+    bool AVX2 = false;
+
+    /// x86 FMA3
+    bool FMA = false;
+
+    /// x86 half-precision conversion instructions (F16C)
+    bool F16C = false;
+
+    /// ARM Advanced SIMD (NEON)
+    bool NEON = false;
+};
+
 /// Basic platform-specific miscellaneous functions
 struct BasicPlatformMisc
 {
@@ -111,6 +173,27 @@ struct BasicPlatformMisc
     /// Sets the current thread affinity mask and on success returns the previous mask.
     static Uint64 SetCurrentThreadAffinity(Uint64 Mask);
 
+    /// Returns the processor topology.
+
+    /// The basic implementation does not have access to the topology and reports
+    /// std::thread::hardware_concurrency() logical processors, each on its own core.
+    static ProcessorTopology GetProcessorTopology();
+
+    /// Restricts the current thread to the set of logical processors.
+
+    /// \param [in] pProcessorIds - An array of logical processor IDs, see LogicalProcessorInfo::Id.
+    /// \param [in] NumProcessors - The number of elements in the array.
+    /// \return     true if the affinity was set successfully, and false otherwise.
+    ///
+    /// Unlike SetCurrentThreadAffinity(), this function is not limited to the first 64 logical processors.
+    static bool SetCurrentThreadProcessorSet(const Uint32* pProcessorIds, size_t NumProcessors);
+
+    /// Returns the instruction set extensions supported by the CPU and the OS.
+
+    /// The features are queried with CPUID on x86. On ARM, NEON is reported
+    /// when the compiler targets it, as it is mandatory on AArch64.
+    static CPUFeatures GetCPUFeatures();
+
 private:
     static void SwapBytes16(Uint16& Val)
     {
@@ -27,6 +27,18 @@
 #include "BasicPlatformMisc.hpp"
 #include "DebugUtilities.hpp"
 
+#include <algorithm>
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#    include <intrin.h>
+#    include <immintrin.h>
+#    define DILIGENT_X86_CPUID 1
+#elif (defined(__clang__) || defined(__GNUC__)) && (defined(__i386__) || defined(__x86_64__))
+#    include <cpuid.h>
+#    define DILIGENT_X86_CPUID 1
+#endif
+
 namespace Diligent
 {
 
@@ -48,4 +60,98 @@ Uint64 BasicPlatformMisc::SetCurrentThreadAffinity(Uint64 Mask)
     return 0;
 }
 
+ProcessorTopology BasicPlatformMisc::GetProcessorTopology()
+{
+    const Uint32 NumProcessors = std::max(std::thread::hardware_concurrency(), 1u);
+
+    ProcessorTopology Topology;
+    Topology.LogicalProcessors.resize(NumProcessors);
+    for (Uint32 i = 0; i < NumProcessors; ++i)
+    {
+        LogicalProcessorInfo& Processor = Topology.LogicalProcessors[i];
+
+        Processor.Id        = i;
+        Processor.CoreIndex = i;
+    }
+    Topology.NumCores     = NumProcessors;
+    Topology.NumPackages  = 1;
+    Topology.NumNUMANodes = 1;
+
+    return Topology;
+}
+
+bool BasicPlatformMisc::SetCurrentThreadProcessorSet(const Uint32* pProcessorIds, size_t NumProcessors)
+{
+    LOG_WARNING_MESSAGE_ONCE("SetCurrentThreadProcessorSet is not implemented on this platform.");
+    return false;
+}
+
+#if DILIGENT_X86_CPUID
+namespace
+{
+
+void GetCPUID(Uint32 Leaf, Uint32 SubLeaf, Uint32 Regs[4])
+{
+#    if defined(_MSC_VER)
+    int Info[4] = {};
+    __cpuidex(Info, static_cast<int>(Leaf), static_cast<int>(SubLeaf));
+    for (int i = 0; i < 4; ++i)
+        Regs[i] = static_cast<Uint32>(Info[i]);
+#    else
+    __cpuid_count(Leaf, SubLeaf, Regs[0], Regs[1], Regs[2], Regs[3]);
+#    endif
+}
+
+Uint64 GetXCR0()
+{
+#    if defined(_MSC_VER)
+    return _xgetbv(0);
+#    else
+    Uint32 Lo = 0, Hi = 0;
+    __asm__ volatile("xgetbv"
+                     : "=a"(Lo), "=d"(Hi)
+                     : "c"(0));
+    return (Uint64{Hi} << 32) | Lo;
+#    endif
+}
+
+} // namespace
+#endif
+
+CPUFeatures BasicPlatformMisc::GetCPUFeatures()
+{
+    CPUFeatures Features;
+
+#if DILIGENT_X86_CPUID
+    Uint32 Regs[4] = {}; // EAX, EBX, ECX, EDX
+    GetCPUID(0, 0, Regs);
+    const Uint32 MaxLeaf = Regs[0];
+    if (MaxLeaf >= 1)
+    {
+        GetCPUID(1, 0, Regs);
+        Features.SSE2  = (Regs[3] & (1u << 26)) != 0;
+        Features.SSE41 = (Regs[2] & (1u << 19)) != 0;
+
+        const bool OSXSAVE = (Regs[2] & (1u << 27)) != 0;
+        const bool AVX     = (Regs[2] & (1u << 28)) != 0;
+        // The OS must save the XMM and YMM registers on context switches
+        const bool OSSavesYMM = OSXSAVE && (GetXCR0() & 0x6) == 0x6;
+        if (AVX && OSSavesYMM)
+        {
+            Features.FMA  = (Regs[2] & (1u << 12)) != 0;
+            Features.F16C = (Regs[2] & (1u << 29)) != 0;
+            if (MaxLeaf >= 7)
+            {
+                GetCPUID(7, 0, Regs);
+                Features.AVX2 = (Regs[1] & (1u << 5)) != 0;
+            }
+        }
+    }
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    Features.NEON = true;
+#endif
+
+    return Features;
+}
+
 } // namespace Diligent
@@ -33,6 +33,16 @@ namespace Diligent
 {
 
 struct EmscriptenMisc : public LinuxMisc
-{};
+{
+    static ProcessorTopology GetProcessorTopology()
+    {
+        return BasicPlatformMisc::GetProcessorTopology();
+    }
+
+    static bool SetCurrentThreadProcessorSet(const Uint32* pProcessorIds, size_t NumProcessors)
+    {
+        return BasicPlatformMisc::SetCurrentThreadProcessorSet(pProcessorIds, NumProcessors);
+    }
+};
 
 } // namespace Diligent
@@ -33,6 +33,7 @@
 
 #include "../../Basic/interface/BasicFileSystem.hpp"
 #include "../../Basic/interface/StandardFile.hpp"
+#include "LinuxMappedFile.hpp"
 
 namespace Diligent
 {
@@ -44,6 +45,9 @@ struct LinuxFileSystem : public BasicFileSystem
 public:
     static LinuxFile* OpenFile(const FileOpenAttribs& OpenAttribs);
 
+    /// Maps the entire file into memory for reading. Returns null if the file can't be mapped.
+    static LinuxMappedFile* MapFile(const Char* strFilePath, MappedFileAccessHint Hint = MappedFileAccessHint::Normal);
+
     static bool FileExists(const Char* strFilePath);
     static bool PathExists(const Char* strPath);
 
@@ -0,0 +1,93 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+#include "../../../Primitives/interface/BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Access pattern hint for the memory-mapped file, see madvise().
+enum class MappedFileAccessHint
+{
+    /// No special treatment (MADV_NORMAL).
+    Normal,
+
+    /// Pages will be accessed sequentially; read ahead aggressively (MADV_SEQUENTIAL).
+    Sequential,
+
+    /// Pages will be accessed in random order; disable read-ahead (MADV_RANDOM).
+    Random,
+
+    /// Pages will be needed soon; start reading them in (MADV_WILLNEED).
+    WillNeed,
+
+    /// Pages will not be needed soon; they may be dropped from the page cache (MADV_DONTNEED).
+    DontNeed
+};
+
+/// Read-only memory mapping of an entire file.
+
+/// The file size and all offsets are 64-bit, so files larger than 2 GB are supported
+/// on 32-bit and 64-bit platforms alike. The constructor throws an exception if the file
+/// can't be opened or mapped; use LinuxFileSystem::MapFile to get nullptr instead.
+class LinuxMappedFile
+{
+public:
+    LinuxMappedFile(const Char* Path, MappedFileAccessHint Hint = MappedFileAccessHint::Normal) noexcept(false);
+    ~LinuxMappedFile();
+
+    // clang-format off
+    LinuxMappedFile           (const LinuxMappedFile&)  = delete;
+    LinuxMappedFile           (      LinuxMappedFile&&) = delete;
+    LinuxMappedFile& operator=(const LinuxMappedFile&)  = delete;
+    LinuxMappedFile& operator=(      LinuxMappedFile&&) = delete;
+    // clang-format on
+
+    /// Returns the pointer to the mapped data, or null if the file is empty.
+    const Uint8* GetData() const { return m_pData; }
+
+    /// Returns the file size, in bytes.
+    Uint64 GetSize() const { return m_Size; }
+
+    const String& GetPath() const { return m_Path; }
+
+    /// Gives the kernel an access pattern hint for the range [Offset, Offset + Size).
+
+    /// The range is clamped to the file size and expanded to page boundaries.
+    /// Returns false if madvise() fails.
+    bool Advise(MappedFileAccessHint Hint, Uint64 Offset = 0, Uint64 Size = ~Uint64{0});
+
+private:
+    const String m_Path;
+
+    Uint8* m_pData = nullptr;
+    Uint64 m_Size  = 0;
+};
+
+} // namespace Diligent
@@ -111,6 +111,25 @@ struct LinuxMisc : public BasicPlatformMisc
     /// Sets the current thread affinity mask and on success returns the previous mask.
     /// On failure, returns 0.
     static Uint64 SetCurrentThreadAffinity(Uint64 Mask);
+
+    /// Returns the processor topology read from /sys.
+    /// If the topology can't be read, falls back to BasicPlatformMisc::GetProcessorTopology().
+    static ProcessorTopology GetProcessorTopology();
+
+    /// Reads the processor topology from the sysfs tree at the given root, e.g. "/sys".
+
+    /// The following files are read:
+    ///   - devices/system/cpu/online
+    ///   - devices/system/cpu/cpu<N>/topology/core_id
+    ///   - devices/system/cpu/cpu<N>/topology/physical_package_id
+    ///   - devices/system/node/node<N>/cpulist
+    ///
+    /// Returns an empty topology if the list of online processors can't be read.
+    static ProcessorTopology ReadProcessorTopology(const char* SysFsRoot);
+
+    /// Restricts the current thread to the set of logical processors.
+    /// The number of processors is not limited to 64.
+    static bool SetCurrentThreadProcessorSet(const Uint32* pProcessorIds, size_t NumProcessors);
 };
 
 } // namespace Diligent
@@ -58,6 +58,19 @@ LinuxFile* LinuxFileSystem::OpenFile(const FileOpenAttribs& OpenAttribs)
     }
     return pFile;
 }
+
+LinuxMappedFile* LinuxFileSystem::MapFile(const Char* strFilePath, MappedFileAccessHint Hint)
+{
+    LinuxMappedFile* pFile = nullptr;
+    try
+    {
+        pFile = new LinuxMappedFile{strFilePath, Hint};
+    }
+    catch (const std::runtime_error& err)
+    {
+    }
+    return pFile;
+}
 #endif
 
 bool LinuxFileSystem::FileExists(const Char* strFilePath)
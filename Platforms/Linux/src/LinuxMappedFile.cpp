@@ -0,0 +1,131 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <string.h>
+#include <stdint.h>
+#include <algorithm>
+
+#include "../interface/LinuxMappedFile.hpp"
+#include "Errors.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+int GetMadviseFlag(MappedFileAccessHint Hint)
+{
+    switch (Hint)
+    {
+        // clang-format off
+        case MappedFileAccessHint::Normal:     return MADV_NORMAL;
+        case MappedFileAccessHint::Sequential: return MADV_SEQUENTIAL;
+        case MappedFileAccessHint::Random:     return MADV_RANDOM;
+        case MappedFileAccessHint::WillNeed:   return MADV_WILLNEED;
+        case MappedFileAccessHint::DontNeed:   return MADV_DONTNEED;
+        // clang-format on
+        default:
+            UNEXPECTED("Unknown access hint");
+            return MADV_NORMAL;
+    }
+}
+
+} // namespace
+
+LinuxMappedFile::LinuxMappedFile(const Char* Path, MappedFileAccessHint Hint) noexcept(false) :
+    m_Path{Path != nullptr ? Path : ""}
+{
+    const int fd = open(m_Path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        LOG_ERROR_AND_THROW("Failed to open file ", m_Path, "\nThe following error occurred: ", strerror(errno));
+    }
+
+    struct stat Stat = {};
+    if (fstat(fd, &Stat) != 0)
+    {
+        const int Error = errno;
+        close(fd);
+        LOG_ERROR_AND_THROW("Failed to get the size of file ", m_Path, "\nThe following error occurred: ", strerror(Error));
+    }
+
+    m_Size = static_cast<Uint64>(Stat.st_size);
+    if (m_Size > static_cast<Uint64>(SIZE_MAX))
+    {
+        close(fd);
+        LOG_ERROR_AND_THROW("File ", m_Path, " is too large to be mapped into the address space");
+    }
+
+    if (m_Size > 0)
+    {
+        void* pData = mmap(nullptr, static_cast<size_t>(m_Size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (pData == MAP_FAILED)
+        {
+            const int Error = errno;
+            close(fd);
+            LOG_ERROR_AND_THROW("Failed to map file ", m_Path, "\nThe following error occurred: ", strerror(Error));
+        }
+        m_pData = static_cast<Uint8*>(pData);
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+
+    if (Hint != MappedFileAccessHint::Normal)
+        Advise(Hint);
+}
+
+LinuxMappedFile::~LinuxMappedFile()
+{
+    if (m_pData != nullptr)
+    {
+        munmap(m_pData, static_cast<size_t>(m_Size));
+        m_pData = nullptr;
+    }
+}
+
+bool LinuxMappedFile::Advise(MappedFileAccessHint Hint, Uint64 Offset, Uint64 Size)
+{
+    if (m_pData == nullptr || Offset >= m_Size)
+        return true;
+
+    Size = std::min(Size, m_Size - Offset);
+
+    static const Uint64 PageSize  = static_cast<Uint64>(sysconf(_SC_PAGESIZE));
+    const Uint64        StartPage = Offset / PageSize * PageSize;
+
+    return madvise(m_pData + StartPage, static_cast<size_t>(Offset + Size - StartPage), GetMadviseFlag(Hint)) == 0;
+}
+
+} // namespace Diligent
@@ -27,6 +27,12 @@
 #include "LinuxPlatformMisc.hpp"
 
 #include <pthread.h>
+#include <sched.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <map>
+#include <algorithm>
 
 namespace Diligent
 {
@@ -60,4 +66,192 @@ Uint64 LinuxMisc::SetCurrentThreadAffinity(Uint64 Mask)
         return 0;
 }
 
+bool LinuxMisc::SetCurrentThreadProcessorSet(const Uint32* pProcessorIds, size_t NumProcessors)
+{
+    if (pProcessorIds == nullptr || NumProcessors == 0)
+        return false;
+
+    const Uint32 MaxId = *std::max_element(pProcessorIds, pProcessorIds + NumProcessors);
+
+    // The static cpu_set_t is limited to CPU_SETSIZE (1024) processors
+    cpu_set_t* pCPUSet = CPU_ALLOC(MaxId + 1);
+    if (pCPUSet == nullptr)
+        return false;
+
+    const size_t CPUSetSize = CPU_ALLOC_SIZE(MaxId + 1);
+    CPU_ZERO_S(CPUSetSize, pCPUSet);
+    for (size_t i = 0; i < NumProcessors; ++i)
+        CPU_SET_S(pProcessorIds[i], CPUSetSize, pCPUSet);
+
+    const bool Res = pthread_setaffinity_np(pthread_self(), CPUSetSize, pCPUSet) == 0;
+    CPU_FREE(pCPUSet);
+
+    return Res;
+}
+
+namespace
+{
+
+bool ReadSysFsFile(const std::string& Path, std::string& Contents)
+{
+    FILE* pFile = fopen(Path.c_str(), "r");
+    if (pFile == nullptr)
+        return false;
+
+    Contents.clear();
+    char   Buffer[256];
+    size_t NumRead = 0;
+    while ((NumRead = fread(Buffer, 1, sizeof(Buffer), pFile)) > 0)
+        Contents.append(Buffer, NumRead);
+    fclose(pFile);
+
+    return true;
+}
+
+bool ReadSysFsUint(const std::string& Path, Uint32& Value)
+{
+    std::string Contents;
+    if (!ReadSysFsFile(Path, Contents))
+        return false;
+
+    char* pEnd = nullptr;
+    // Some files contain -1 when the value is not available
+    const long Val = strtol(Contents.c_str(), &pEnd, 10);
+    if (pEnd == Contents.c_str() || Val < 0)
+        return false;
+
+    Value = static_cast<Uint32>(Val);
+    return true;
+}
+
+// Parses the CPU list format used by sysfs, e.g. "0-3,8,10-11"
+std::vector<Uint32> ParseCPUList(const std::string& List)
+{
+    std::vector<Uint32> CPUs;
+
+    const char* pCurr = List.c_str();
+    while (*pCurr != '\0')
+    {
+        char*               pEnd  = nullptr;
+        const unsigned long First = strtoul(pCurr, &pEnd, 10);
+        if (pEnd == pCurr)
+            break;
+
+        unsigned long Last = First;
+        pCurr              = pEnd;
+        if (*pCurr == '-')
+        {
+            ++pCurr;
+            Last = strtoul(pCurr, &pEnd, 10);
+            if (pEnd == pCurr)
+                break;
+            pCurr = pEnd;
+        }
+
+        for (unsigned long CPU = First; CPU <= Last; ++CPU)
+            CPUs.push_back(static_cast<Uint32>(CPU));
+
+        if (*pCurr != ',')
+            break;
+        ++pCurr;
+    }
+
+    return CPUs;
+}
+
+} // namespace
+
+ProcessorTopology LinuxMisc::ReadProcessorTopology(const char* SysFsRoot)
+{
+    const std::string CPUDir  = std::string{SysFsRoot} + "/devices/system/cpu/";
+    const std::string NodeDir = std::string{SysFsRoot} + "/devices/system/node/";
+
+    ProcessorTopology Topology;
+
+    std::string OnlineCPUs;
+    if (!ReadSysFsFile(CPUDir + "online", OnlineCPUs))
+        return Topology;
+
+    std::vector<Uint32> CPUs = ParseCPUList(OnlineCPUs);
+    std::sort(CPUs.begin(), CPUs.end());
+    CPUs.erase(std::unique(CPUs.begin(), CPUs.end()), CPUs.end());
+
+    // NUMA nodes. If the kernel is built without NUMA support, the node directory does not exist.
+    std::map<Uint32, Uint32> CPUToNode;
+    {
+        std::string OnlineNodes;
+        if (ReadSysFsFile(NodeDir + "online", OnlineNodes))
+        {
+            for (Uint32 Node : ParseCPUList(OnlineNodes))
+            {
+                std::string NodeCPUs;
+                if (ReadSysFsFile(NodeDir + "node" + std::to_string(Node) + "/cpulist", NodeCPUs))
+                {
+                    for (Uint32 CPU : ParseCPUList(NodeCPUs))
+                        CPUToNode[CPU] = Node;
+                }
+            }
+        }
+    }
+
+    // (Package ID, core ID) -> core index
+    std::map<std::pair<Uint32, Uint32>, Uint32> CoreIndices;
+    std::map<Uint32, Uint32>                    NumSiblings;
+
+    std::vector<Uint32> Packages;
+    std::vector<Uint32> Nodes;
+
+    Topology.LogicalProcessors.reserve(CPUs.size());
+    for (Uint32 CPU : CPUs)
+    {
+        const std::string TopologyDir = CPUDir + "cpu" + std::to_string(CPU) + "/topology/";
+
+        LogicalProcessorInfo Processor;
+        Processor.Id = CPU;
+
+        Uint32 CoreId = CPU;
+        if (!ReadSysFsUint(TopologyDir + "core_id", CoreId))
+        {
+            // Treat every processor as a separate core
+            CoreId = CPU;
+        }
+        if (!ReadSysFsUint(TopologyDir + "physical_package_id", Processor.PackageId))
+            Processor.PackageId = 0;
+
+        auto NodeIt        = CPUToNode.find(CPU);
+        Processor.NUMANode = NodeIt != CPUToNode.end() ? NodeIt->second : 0;
+
+        // Core IDs are only unique within the package
+        auto CoreIt         = CoreIndices.emplace(std::make_pair(Processor.PackageId, CoreId), static_cast<Uint32>(CoreIndices.size())).first;
+        Processor.CoreIndex = CoreIt->second;
+        // CPUs are sorted, so siblings are enumerated in the order of their IDs
+        Processor.SMTIndex = NumSiblings[Processor.CoreIndex]++;
+
+        Packages.push_back(Processor.PackageId);
+        Nodes.push_back(Processor.NUMANode);
+
+        Topology.LogicalProcessors.push_back(Processor);
+    }
+
+    auto CountUnique = [](std::vector<Uint32>& Ids) {
+        std::sort(Ids.begin(), Ids.end());
+        return static_cast<Uint32>(std::unique(Ids.begin(), Ids.end()) - Ids.begin());
+    };
+
+    Topology.NumCores     = static_cast<Uint32>(CoreIndices.size());
+    Topology.NumPackages  = CountUnique(Packages);
+    Topology.NumNUMANodes = CountUnique(Nodes);
+
+    return Topology;
+}
+
+ProcessorTopology LinuxMisc::GetProcessorTopology()
+{
+    ProcessorTopology Topology = ReadProcessorTopology("/sys");
+    if (Topology.LogicalProcessors.empty())
+        Topology = BasicPlatformMisc::GetProcessorTopology();
+
+    return Topology;
+}
+
 } // namespace Diligent
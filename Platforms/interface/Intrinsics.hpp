@@ -34,3 +34,28 @@
 #if DILIGENT_AVX2_SUPPORTED && defined(__AVX2__)
 #    define DILIGENT_AVX2_ENABLED 1
 #endif
+
+// Functions that use AVX2 intrinsics without requiring AVX2 for the entire translation unit
+// must be marked with DILIGENT_TARGET_AVX2 and only called after checking
+// PlatformMisc::GetCPUFeatures() at run time.
+// FMA is not enabled: the compiler would otherwise contract multiplications and additions,
+// which requires a separate CPU feature check and changes the results compared to scalar code.
+// Functions that also use F16C conversions must be marked with DILIGENT_TARGET_AVX2_F16C.
+#if DILIGENT_AVX2_SUPPORTED
+#    if defined(__clang__) || defined(__GNUC__)
+#        define DILIGENT_TARGET_AVX2      __attribute__((target("avx2")))
+#        define DILIGENT_TARGET_AVX2_F16C __attribute__((target("avx2,f16c")))
+#    else
+#        define DILIGENT_TARGET_AVX2
+#        define DILIGENT_TARGET_AVX2_F16C
+#    endif
+#endif
+
+#if defined(__SSE2__) || (defined(_MSC_VER) && ((_M_IX86_FP >= 2) || defined(_M_X64)))
+#    define DILIGENT_SSE2_ENABLED 1
+#endif
+
+#if defined(__ARM_NEON) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define DILIGENT_NEON_ENABLED 1
+#endif
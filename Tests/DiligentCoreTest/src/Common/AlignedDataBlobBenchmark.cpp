@@ -0,0 +1,114 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "AlignedDataBlob.hpp"
+#include "DataBlobImpl.hpp"
+#include "Serializer.hpp"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Serializes a large archive-like structure the same way DeviceObjectArchive::Serialize does:
+// measures the size, creates the blob and writes the data into it.
+class ArchiveSerializationBenchmark
+{
+public:
+    static constexpr size_t NumResources = 1024;
+    static constexpr size_t ResourceSize = 64 << 10;
+    static constexpr Uint32 NumRuns      = 3;
+
+    ArchiveSerializationBenchmark() :
+        m_Bytecode(ResourceSize)
+    {
+        for (size_t i = 0; i < m_Bytecode.size(); ++i)
+            m_Bytecode[i] = static_cast<Uint8>(i);
+    }
+
+    template <typename CreateBlobType>
+    double Run(CreateBlobType&& CreateBlob) const
+    {
+        return MeasureMinTime(NumRuns, [&]() {
+            Serializer<SerializerMode::Measure> Measurer;
+            SerializeThis(Measurer);
+
+            RefCntAutoPtr<IDataBlob> pDataBlob = CreateBlob(Measurer.GetSize());
+
+            Serializer<SerializerMode::Write> Writer{SerializedData{pDataBlob->GetDataPtr(), pDataBlob->GetSize()}};
+            SerializeThis(Writer);
+            VERIFY_EXPR(Writer.IsEnded());
+        });
+    }
+
+private:
+    template <SerializerMode Mode>
+    void SerializeThis(Serializer<Mode>& Ser) const
+    {
+        for (Uint32 i = 0; i < NumResources; ++i)
+        {
+            const Uint8* pData = m_Bytecode.data();
+            size_t       Size  = m_Bytecode.size();
+            Ser(i);
+            Ser.SerializeBytes(pData, Size);
+        }
+    }
+
+    std::vector<Uint8> m_Bytecode;
+};
+
+TEST(Common_AlignedDataBlobBenchmark, DISABLED_ArchiveSerialization)
+{
+    ArchiveSerializationBenchmark Benchmark;
+
+    const double DataBlobImplTime = Benchmark.Run([](size_t Size) {
+        return RefCntAutoPtr<IDataBlob>{DataBlobImpl::Create(Size)};
+    });
+    const double AlignedDataBlobTime = Benchmark.Run([](size_t Size) {
+        return RefCntAutoPtr<IDataBlob>{AlignedDataBlob::Create(Size)};
+    });
+    const double HugePageDataBlobTime = Benchmark.Run([](size_t Size) {
+        return RefCntAutoPtr<IDataBlob>{AlignedDataBlob::Create(Size, nullptr, AlignedDataBlob::HugePageAlignment)};
+    });
+
+    constexpr size_t ArchiveSizeMB = ArchiveSerializationBenchmark::NumResources * ArchiveSerializationBenchmark::ResourceSize >> 20;
+
+    BenchmarkTable Table{"Archive serialization (" + std::to_string(ArchiveSizeMB) + " MB)", {"Blob", "Time, ms", "Speedup"}};
+    Table.AddRow({"DataBlobImpl", BenchmarkTable::Number(DataBlobImplTime * 1000, 1), BenchmarkTable::Ratio(1, 1)});
+    Table.AddRow({"AlignedDataBlob", BenchmarkTable::Number(AlignedDataBlobTime * 1000, 1), BenchmarkTable::Ratio(DataBlobImplTime, AlignedDataBlobTime)});
+    Table.AddRow({"AlignedDataBlob, 2 MB alignment", BenchmarkTable::Number(HugePageDataBlobTime * 1000, 1), BenchmarkTable::Ratio(DataBlobImplTime, HugePageDataBlobTime)});
+    Table.Print();
+}
+
+} // namespace
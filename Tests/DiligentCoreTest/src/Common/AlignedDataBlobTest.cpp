@@ -0,0 +1,183 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "AlignedDataBlob.hpp"
+
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+bool IsAlignedPtr(const void* Ptr, size_t Alignment)
+{
+    return (reinterpret_cast<uintptr_t>(Ptr) & (Alignment - 1)) == 0;
+}
+
+std::vector<Uint8> GetTestData(size_t Size)
+{
+    std::vector<Uint8> Data(Size);
+    for (size_t i = 0; i < Size; ++i)
+        Data[i] = static_cast<Uint8>(i * 7 + 3);
+    return Data;
+}
+
+TEST(Common_AlignedDataBlob, Create)
+{
+    {
+        RefCntAutoPtr<AlignedDataBlob> pBlob = AlignedDataBlob::Create();
+        ASSERT_TRUE(pBlob);
+        EXPECT_EQ(pBlob->GetSize(), size_t{0});
+        EXPECT_EQ(pBlob->GetCapacity(), size_t{0});
+        EXPECT_EQ(pBlob->GetAlignment(), AlignedDataBlob::DefaultAlignment);
+    }
+
+    for (size_t Alignment : {size_t{1}, size_t{16}, size_t{64}, size_t{4096}, AlignedDataBlob::HugePageAlignment})
+    {
+        RefCntAutoPtr<AlignedDataBlob> pBlob = AlignedDataBlob::Create(1000, nullptr, Alignment);
+        ASSERT_TRUE(pBlob);
+        EXPECT_EQ(pBlob->GetSize(), size_t{1000});
+        EXPECT_EQ(pBlob->GetCapacity(), size_t{1000});
+        EXPECT_TRUE(IsAlignedPtr(pBlob->GetDataPtr(), Alignment)) << "Alignment: " << Alignment;
+    }
+
+    {
+        const std::vector<Uint8> Data = GetTestData(333);
+
+        RefCntAutoPtr<AlignedDataBlob> pBlob = AlignedDataBlob::Create(Data.size(), Data.data());
+        ASSERT_EQ(pBlob->GetSize(), Data.size());
+        EXPECT_EQ(memcmp(pBlob->GetConstDataPtr(), Data.data(), Data.size()), 0);
+        EXPECT_EQ(pBlob->GetConstDataPtr<Uint8>(10)[0], Data[10]);
+
+        RefCntAutoPtr<AlignedDataBlob> pCopy = AlignedDataBlob::MakeCopy(pBlob, 256);
+        ASSERT_EQ(pCopy->GetSize(), Data.size());
+        EXPECT_TRUE(IsAlignedPtr(pCopy->GetConstDataPtr(), 256));
+        EXPECT_EQ(memcmp(pCopy->GetConstDataPtr(), Data.data(), Data.size()), 0);
+    }
+
+    {
+        RefCntAutoPtr<IDataBlob> pBlob{AlignedDataBlob::Create(16), IID_DataBlob};
+        EXPECT_TRUE(pBlob);
+    }
+}
+
+TEST(Common_AlignedDataBlob, Resize)
+{
+    const std::vector<Uint8> Data = GetTestData(100);
+
+    RefCntAutoPtr<AlignedDataBlob> pBlob = AlignedDataBlob::Create(Data.size(), Data.data(), 128);
+
+    // Shrinking does not reallocate
+    const void* pOrigData = pBlob->GetConstDataPtr();
+    pBlob->Resize(50);
+    EXPECT_EQ(pBlob->GetSize(), size_t{50});
+    EXPECT_EQ(pBlob->GetCapacity(), size_t{100});
+    EXPECT_EQ(pBlob->GetConstDataPtr(), pOrigData);
+
+    // Growing within the capacity does not reallocate
+    pBlob->Resize(100);
+    EXPECT_EQ(pBlob->GetConstDataPtr(), pOrigData);
+    EXPECT_EQ(memcmp(pBlob->GetConstDataPtr(), Data.data(), 50), 0);
+
+    // Growing a non-empty blob grows the capacity geometrically
+    pBlob->Resize(101);
+    EXPECT_EQ(pBlob->GetSize(), size_t{101});
+    EXPECT_EQ(pBlob->GetCapacity(), size_t{150});
+    EXPECT_TRUE(IsAlignedPtr(pBlob->GetConstDataPtr(), 128));
+    EXPECT_EQ(memcmp(pBlob->GetConstDataPtr(), Data.data(), 50), 0);
+
+    pBlob->Resize(1000);
+    EXPECT_EQ(pBlob->GetCapacity(), size_t{1000});
+    EXPECT_EQ(memcmp(pBlob->GetConstDataPtr(), Data.data(), 50), 0);
+
+    pBlob->Reserve(5000);
+    EXPECT_EQ(pBlob->GetSize(), size_t{1000});
+    EXPECT_EQ(pBlob->GetCapacity(), size_t{5000});
+    EXPECT_EQ(memcmp(pBlob->GetConstDataPtr(), Data.data(), 50), 0);
+
+    pBlob->Resize(0);
+    EXPECT_EQ(pBlob->GetSize(), size_t{0});
+    EXPECT_EQ(pBlob->GetCapacity(), size_t{5000});
+}
+
+TEST(Common_AlignedDataBlob, Adopt)
+{
+    const std::vector<Uint8> Data = GetTestData(256);
+
+    std::vector<void*> DeletedPtrs;
+    auto               Deleter = [&DeletedPtrs](void* pData) {
+        DeletedPtrs.push_back(pData);
+        delete[] static_cast<Uint64*>(pData);
+    };
+
+    {
+        Uint64* pMem = new Uint64[64];
+        std::memcpy(pMem, Data.data(), Data.size());
+
+        RefCntAutoPtr<AlignedDataBlob> pBlob = AlignedDataBlob::Adopt(pMem, 200, Deleter, 256, sizeof(Uint64));
+        EXPECT_EQ(pBlob->GetConstDataPtr(), pMem);
+        EXPECT_EQ(pBlob->GetSize(), size_t{200});
+        EXPECT_EQ(pBlob->GetCapacity(), size_t{256});
+
+        // Growing within the capacity uses the adopted memory
+        pBlob->Resize(256);
+        EXPECT_EQ(pBlob->GetConstDataPtr(), pMem);
+        EXPECT_TRUE(DeletedPtrs.empty());
+    }
+    ASSERT_EQ(DeletedPtrs.size(), size_t{1});
+    DeletedPtrs.clear();
+
+    {
+        Uint64* pMem = new Uint64[32];
+        std::memcpy(pMem, Data.data(), 256);
+
+        RefCntAutoPtr<AlignedDataBlob> pBlob = AlignedDataBlob::Adopt(pMem, 256, Deleter, 0, sizeof(Uint64));
+        EXPECT_EQ(pBlob->GetCapacity(), size_t{256});
+
+        // The adopted memory is released when the data is reallocated
+        pBlob->Resize(1024);
+        ASSERT_EQ(DeletedPtrs.size(), size_t{1});
+        EXPECT_EQ(DeletedPtrs[0], pMem);
+        EXPECT_NE(pBlob->GetConstDataPtr(), pMem);
+        EXPECT_EQ(memcmp(pBlob->GetConstDataPtr(), Data.data(), 256), 0);
+    }
+    EXPECT_EQ(DeletedPtrs.size(), size_t{1});
+
+    {
+        // Memory that does not need to be released
+        alignas(64) static Uint8 StaticData[64] = {};
+
+        RefCntAutoPtr<AlignedDataBlob> pBlob = AlignedDataBlob::Adopt(StaticData, sizeof(StaticData), nullptr);
+        EXPECT_EQ(pBlob->GetConstDataPtr(), StaticData);
+    }
+}
+
+} // namespace
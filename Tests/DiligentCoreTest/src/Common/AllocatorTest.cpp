@@ -26,15 +26,21 @@
  */
 
 #include <array>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 #include "DefaultRawMemoryAllocator.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
 #include "FixedLinearAllocator.hpp"
 #include "DynamicLinearAllocator.hpp"
 
+#include "TestingEnvironment.hpp"
+
 #include "gtest/gtest.h"
 
 using namespace Diligent;
+using namespace Diligent::Testing;
 
 namespace
 {
@@ -124,6 +130,98 @@ TEST(Common_FixedBlockMemoryAllocator, UnalignedSize)
     }
 }
 
+TEST(Common_FixedBlockMemoryAllocator, InvalidFree)
+{
+    constexpr Uint32 AllocSize             = 16;
+    constexpr Uint32 NumAllocationsPerPage = 8;
+
+    FixedBlockMemoryAllocator TestAllocator{DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage};
+
+    void* pRawMem0 = TestAllocator.Allocate(AllocSize, "Invalid free test", __FILE__, __LINE__);
+    TestAllocator.Free(pRawMem0);
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"double freeing memory"};
+        TestAllocator.Free(pRawMem0);
+    }
+
+    // The block must only be handed out once
+    void* pRawMem1 = TestAllocator.Allocate(AllocSize, "Invalid free test", __FILE__, __LINE__);
+    void* pRawMem2 = TestAllocator.Allocate(AllocSize, "Invalid free test", __FILE__, __LINE__);
+    EXPECT_NE(pRawMem1, pRawMem2);
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"not allocated by this allocator"};
+        Uint64 ForeignMem[2] = {};
+        TestAllocator.Free(ForeignMem);
+    }
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"beginning of a block"};
+        TestAllocator.Free(static_cast<Uint8*>(pRawMem1) + 4);
+    }
+
+    TestAllocator.Free(pRawMem1);
+    TestAllocator.Free(pRawMem2);
+}
+
+TEST(Common_FixedBlockMemoryAllocator, Multithreaded)
+{
+    constexpr Uint32 AllocSize             = 24;
+    constexpr Uint32 NumAllocationsPerPage = 32;
+    constexpr size_t NumThreads            = 8;
+    constexpr size_t NumAllocations        = 2000;
+
+    FixedBlockMemoryAllocator TestAllocator{DefaultRawMemoryAllocator::GetAllocator(), AllocSize, NumAllocationsPerPage};
+
+    // Every thread allocates blocks, and frees half of them as well as the blocks allocated by the previous thread
+    std::vector<std::vector<void*>> Allocations(NumThreads);
+    std::vector<std::thread>        Threads;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&, t]() {
+            auto& ThreadAllocations = Allocations[t];
+            for (size_t i = 0; i < NumAllocations; ++i)
+            {
+                void* Ptr = TestAllocator.Allocate(AllocSize, "Fixed block allocator test", __FILE__, __LINE__);
+                ASSERT_NE(Ptr, nullptr);
+                memset(Ptr, static_cast<int>(t), AllocSize);
+                ThreadAllocations.push_back(Ptr);
+                if (i % 2 == 1)
+                {
+                    TestAllocator.Free(ThreadAllocations[ThreadAllocations.size() - 2]);
+                    ThreadAllocations.erase(ThreadAllocations.end() - 2);
+                }
+            }
+
+            for (void* Ptr : ThreadAllocations)
+            {
+                const Uint8* pBytes = static_cast<const Uint8*>(Ptr);
+                for (Uint32 b = 0; b < AllocSize; ++b)
+                    ASSERT_EQ(pBytes[b], t) << "Block was allocated twice";
+            }
+        });
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+    Threads.clear();
+
+    std::unordered_set<void*> UniqueAllocations;
+    for (const auto& ThreadAllocations : Allocations)
+        UniqueAllocations.insert(ThreadAllocations.begin(), ThreadAllocations.end());
+    EXPECT_EQ(UniqueAllocations.size(), NumThreads * NumAllocations / 2);
+
+    // Free the blocks from different threads
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&, t]() {
+            for (void* Ptr : Allocations[(t + 1) % NumThreads])
+                TestAllocator.Free(Ptr);
+        });
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+}
+
 TEST(Common_FixedLinearAllocator, EmptyAllocator)
 {
     FixedLinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
@@ -289,4 +387,37 @@ TEST(Common_DynamicLinearAllocator, ObjectConstruction)
     EXPECT_TRUE(reinterpret_cast<size_t>(Allocator.Allocate(200, 64)) % 64 == 0);
 }
 
+TEST(Common_DynamicLinearAllocator, Rewind)
+{
+    DynamicLinearAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), 256};
+
+    void* pFirst = Allocator.Allocate(64, 16);
+    ASSERT_NE(pFirst, nullptr);
+
+    const DynamicLinearAllocator::Marker Marker   = Allocator.GetMarker();
+    const size_t                         UsedSize = Allocator.GetUsedSize();
+
+    void* pSecond = Allocator.Allocate(128, 16);
+    // Allocate a large block that does not fit into the first one
+    void* pLarge = Allocator.Allocate(1024, 16);
+    ASSERT_NE(pSecond, nullptr);
+    ASSERT_NE(pLarge, nullptr);
+    EXPECT_EQ(Allocator.GetBlockCount(), size_t{2});
+    EXPECT_GT(Allocator.GetUsedSize(), UsedSize);
+
+    Allocator.Rewind(Marker);
+    EXPECT_EQ(Allocator.GetUsedSize(), UsedSize);
+    EXPECT_EQ(Allocator.GetBlockCount(), size_t{2});
+
+    // The memory must be reused
+    EXPECT_EQ(Allocator.Allocate(128, 16), pSecond);
+    EXPECT_EQ(Allocator.Allocate(1024, 16), pLarge);
+    EXPECT_EQ(Allocator.GetBlockCount(), size_t{2});
+    EXPECT_GE(Allocator.GetReservedSize(), size_t{256 + 1024});
+
+    Allocator.Rewind({});
+    EXPECT_EQ(Allocator.GetUsedSize(), size_t{0});
+    EXPECT_EQ(Allocator.Allocate(64, 16), pFirst);
+}
+
 } // namespace
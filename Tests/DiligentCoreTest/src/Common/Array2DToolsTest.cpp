@@ -27,10 +27,13 @@
 #include "Array2DTools.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "FastRand.hpp"
+#include "ThreadPool.hpp"
 
 using namespace Diligent;
 
@@ -111,4 +114,265 @@ TEST(Common_Array2DTools, GetArray2DMinMaxValue)
     }
 }
 
+double HalfBitsToDouble(Uint16 Half)
+{
+    const int    Exponent = (Half >> 10) & 0x1F;
+    const int    Mantissa = Half & 0x3FF;
+    const double Value    = Exponent == 0 ?
+        std::ldexp(Mantissa, -24) :
+        std::ldexp(1024 + Mantissa, Exponent - 25);
+    return (Half & 0x8000) != 0 ? -Value : Value;
+}
+
+template <typename T>
+struct Array2DTestData
+{
+    Array2DDesc    Desc;
+    std::vector<T> Data;
+    double (*ToDouble)(T) = nullptr;
+
+    double Get(Uint32 x, Uint32 y) const
+    {
+        return ToDouble(Data[x + y * (Desc.Stride / sizeof(T))]);
+    }
+};
+
+template <typename T, typename GeneratorType>
+Array2DTestData<T> MakeArray2DTestData(VALUE_TYPE Type, Uint32 Width, Uint32 Height, Uint32 Padding, GeneratorType&& Generator, double (*ToDouble)(T))
+{
+    Array2DTestData<T> TestData;
+    TestData.Data.resize((size_t{Width} + Padding) * Height);
+    for (T& Val : TestData.Data)
+        Val = Generator();
+    TestData.ToDouble         = ToDouble;
+    TestData.Desc.pData       = TestData.Data.data();
+    TestData.Desc.Stride      = (size_t{Width} + Padding) * sizeof(T);
+    TestData.Desc.Width       = Width;
+    TestData.Desc.Height      = Height;
+    TestData.Desc.ElementType = Type;
+    return TestData;
+}
+
+template <typename T>
+void TestArray2DReductions(const Array2DTestData<T>& TestData, double Threshold)
+{
+    const Array2DDesc& Desc = TestData.Desc;
+
+    Array2DMinMax RefMinMax;
+    RefMinMax.MinValue = RefMinMax.MaxValue = TestData.Get(0, 0);
+
+    double RefSum      = 0;
+    double RefAbsSum   = 0;
+    Uint64 RefNumAbove = 0;
+
+    for (Uint32 y = 0; y < Desc.Height; ++y)
+    {
+        for (Uint32 x = 0; x < Desc.Width; ++x)
+        {
+            const double Val = TestData.Get(x, y);
+            if (Val < RefMinMax.MinValue)
+            {
+                RefMinMax.MinValue = Val;
+                RefMinMax.MinX     = x;
+                RefMinMax.MinY     = y;
+            }
+            if (Val > RefMinMax.MaxValue)
+            {
+                RefMinMax.MaxValue = Val;
+                RefMinMax.MaxX     = x;
+                RefMinMax.MaxY     = y;
+            }
+            RefSum += Val;
+            RefAbsSum += std::abs(Val);
+            RefNumAbove += Val > Threshold ? 1 : 0;
+        }
+    }
+
+    // Leave some values below and above the histogram range
+    constexpr Uint32    NumBins = 7;
+    const double        Range   = RefMinMax.MaxValue - RefMinMax.MinValue;
+    const double        HistMin = RefMinMax.MinValue + Range * 0.1;
+    const double        HistMax = RefMinMax.MaxValue - Range * 0.1 + 1;
+    std::vector<Uint64> RefBins(NumBins);
+    for (Uint32 y = 0; y < Desc.Height; ++y)
+    {
+        for (Uint32 x = 0; x < Desc.Width; ++x)
+        {
+            const double Bin = (TestData.Get(x, y) - HistMin) * (NumBins / (HistMax - HistMin));
+            ++RefBins[static_cast<size_t>(std::min(std::max(Bin, 0.0), static_cast<double>(NumBins - 1)))];
+        }
+    }
+
+    const Array2DMinMax MinMax = GetArray2DMinMax(Desc);
+    EXPECT_EQ(MinMax.MinValue, RefMinMax.MinValue);
+    EXPECT_EQ(MinMax.MaxValue, RefMinMax.MaxValue);
+    EXPECT_EQ(MinMax.MinX, RefMinMax.MinX);
+    EXPECT_EQ(MinMax.MinY, RefMinMax.MinY);
+    EXPECT_EQ(MinMax.MaxX, RefMinMax.MaxX);
+    EXPECT_EQ(MinMax.MaxY, RefMinMax.MaxY);
+
+    const double Tolerance = RefAbsSum * 1e-12;
+    EXPECT_NEAR(GetArray2DSum(Desc), RefSum, Tolerance);
+    EXPECT_NEAR(GetArray2DMean(Desc), RefSum / (static_cast<double>(Desc.Width) * Desc.Height), Tolerance);
+
+    EXPECT_EQ(GetArray2DCountAbove(Desc, Threshold), RefNumAbove);
+
+    std::vector<Uint64> Bins(NumBins, ~Uint64{0});
+    ComputeArray2DHistogram(Desc, HistMin, HistMax, NumBins, Bins.data());
+    EXPECT_EQ(Bins, RefBins);
+}
+
+template <typename T, typename GeneratorType>
+void TestArray2DReductions(VALUE_TYPE Type, GeneratorType&& Generator, double (*ToDouble)(T))
+{
+    for (Uint32 Width = 1; Width <= 40; Width += 3)
+    {
+        for (Uint32 Height = 1; Height <= 5; Height += 2)
+        {
+            for (Uint32 Padding = 0; Padding < 3; Padding += 2)
+            {
+                const Array2DTestData<T> TestData = MakeArray2DTestData(Type, Width, Height, Padding, Generator, ToDouble);
+
+                // Use a value from the array to test the threshold that is equal to some values
+                const double Threshold = TestData.Get(Width / 2, Height / 2);
+                TestArray2DReductions(TestData, Threshold);
+                TestArray2DReductions(TestData, Threshold + 0.3);
+                TestArray2DReductions(TestData, Threshold - 0.3);
+            }
+        }
+    }
+
+    // Rows longer than the conversion block
+    const Array2DTestData<T> TestData = MakeArray2DTestData(Type, 2500, 3, 5, Generator, ToDouble);
+    TestArray2DReductions(TestData, TestData.Get(1234, 1));
+}
+
+TEST(Common_Array2DTools, ReductionsFloat32)
+{
+    FastRandFloat Rnd{0, -100, +100};
+    TestArray2DReductions<float>(
+        VT_FLOAT32, Rnd, [](float Val) { return static_cast<double>(Val); });
+}
+
+TEST(Common_Array2DTools, ReductionsFloat16)
+{
+    FastRand Rnd{0};
+    TestArray2DReductions<Uint16>(
+        VT_FLOAT16,
+        [&Rnd]() {
+            // Skip infinities and NaNs
+            const Uint16 Half = static_cast<Uint16>((Rnd() << 1u) ^ Rnd());
+            return (Half & 0x7C00) == 0x7C00 ? static_cast<Uint16>(Half & ~0x4000) : Half;
+        },
+        HalfBitsToDouble);
+}
+
+TEST(Common_Array2DTools, ReductionsInt)
+{
+    // FastRand generates 15-bit values
+    FastRand Rnd{0};
+    auto     Rnd16 = [&Rnd]() {
+        return static_cast<Uint16>((Rnd() << 1u) ^ Rnd());
+    };
+    auto Rnd32 = [&Rnd]() {
+        return (Uint32{Rnd()} << 17u) ^ (Uint32{Rnd()} << 2u) ^ Uint32 { Rnd() };
+    };
+
+    TestArray2DReductions<Uint8>(
+        VT_UINT8, [&]() { return static_cast<Uint8>(Rnd()); }, [](Uint8 Val) { return static_cast<double>(Val); });
+    TestArray2DReductions<Int8>(
+        VT_INT8, [&]() { return static_cast<Int8>(Rnd()); }, [](Int8 Val) { return static_cast<double>(Val); });
+    TestArray2DReductions<Uint16>(
+        VT_UINT16, Rnd16, [](Uint16 Val) { return static_cast<double>(Val); });
+    TestArray2DReductions<Int16>(
+        VT_INT16, [&]() { return static_cast<Int16>(Rnd16()); }, [](Int16 Val) { return static_cast<double>(Val); });
+    TestArray2DReductions<Uint32>(
+        VT_UINT32, Rnd32, [](Uint32 Val) { return static_cast<double>(Val); });
+    TestArray2DReductions<Int32>(
+        VT_INT32, [&]() { return static_cast<Int32>(Rnd32()); }, [](Int32 Val) { return static_cast<double>(Val); });
+}
+
+TEST(Common_Array2DTools, ReductionsEdgeCases)
+{
+    // Min and max at the first and the last position, repeated values
+    std::vector<float> Data(64, 1.f);
+    Data[3]  = -5;
+    Data[10] = -5;
+    Data[20] = 7;
+    Data[63] = 7;
+
+    Array2DDesc Desc;
+    Desc.pData       = Data.data();
+    Desc.Stride      = 8 * sizeof(float);
+    Desc.Width       = 8;
+    Desc.Height      = 8;
+    Desc.ElementType = VT_FLOAT32;
+
+    const Array2DMinMax MinMax = GetArray2DMinMax(Desc);
+    EXPECT_EQ(MinMax.MinValue, -5.0);
+    EXPECT_EQ(MinMax.MinX, 3u);
+    EXPECT_EQ(MinMax.MinY, 0u);
+    EXPECT_EQ(MinMax.MaxValue, 7.0);
+    EXPECT_EQ(MinMax.MaxX, 4u);
+    EXPECT_EQ(MinMax.MaxY, 2u);
+
+    // The threshold is not representable as float
+    EXPECT_EQ(GetArray2DCountAbove(Desc, 6.9999999999), 2u);
+    EXPECT_EQ(GetArray2DCountAbove(Desc, 7.0000000001), 0u);
+    EXPECT_EQ(GetArray2DCountAbove(Desc, 1e100), 0u);
+    EXPECT_EQ(GetArray2DCountAbove(Desc, -1e100), 64u);
+
+    // Out-of-range values are counted in the first and the last bins
+    Uint64 Bins[2] = {};
+    ComputeArray2DHistogram(Desc, 0, 2, 2, Bins);
+    EXPECT_EQ(Bins[0], 2u);
+    EXPECT_EQ(Bins[1], 62u);
+
+    // Empty array
+    Desc.Width = 0;
+    EXPECT_EQ(GetArray2DSum(Desc), 0.0);
+    EXPECT_EQ(GetArray2DMean(Desc), 0.0);
+    EXPECT_EQ(GetArray2DCountAbove(Desc, 0), 0u);
+    ComputeArray2DHistogram(Desc, 0, 2, 2, Bins);
+    EXPECT_EQ(Bins[0], 0u);
+    EXPECT_EQ(Bins[1], 0u);
+}
+
+TEST(Common_Array2DTools, ReductionsThreadPool)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_TRUE(pThreadPool);
+
+    FastRandInt Rnd{0, 0, 0x3BFF}; // Positive halves below 1
+    const auto  TestData = MakeArray2DTestData<Uint16>(
+        VT_FLOAT16, 1024, 700, 16, [&Rnd]() { return static_cast<Uint16>(Rnd()); }, HalfBitsToDouble);
+
+    const Array2DDesc& Desc = TestData.Desc;
+
+    const Array2DMinMax MinMax   = GetArray2DMinMax(Desc);
+    const Array2DMinMax MinMaxMT = GetArray2DMinMax(Desc, pThreadPool);
+    EXPECT_EQ(MinMaxMT.MinValue, MinMax.MinValue);
+    EXPECT_EQ(MinMaxMT.MaxValue, MinMax.MaxValue);
+    EXPECT_EQ(MinMaxMT.MinX, MinMax.MinX);
+    EXPECT_EQ(MinMaxMT.MinY, MinMax.MinY);
+    EXPECT_EQ(MinMaxMT.MaxX, MinMax.MaxX);
+    EXPECT_EQ(MinMaxMT.MaxY, MinMax.MaxY);
+
+    const double Sum = GetArray2DSum(Desc);
+    EXPECT_NEAR(GetArray2DSum(Desc, pThreadPool), Sum, Sum * 1e-12);
+    EXPECT_NEAR(GetArray2DMean(Desc, pThreadPool), Sum / (1024.0 * 700.0), 1e-12);
+
+    EXPECT_EQ(GetArray2DCountAbove(Desc, 0.5, pThreadPool), GetArray2DCountAbove(Desc, 0.5));
+
+    std::vector<Uint64> Bins(16), BinsMT(16);
+    ComputeArray2DHistogram(Desc, 0, 1, 16, Bins.data());
+    ComputeArray2DHistogram(Desc, 0, 1, 16, BinsMT.data(), pThreadPool);
+    EXPECT_EQ(BinsMT, Bins);
+
+    Uint64 NumValues = 0;
+    for (Uint64 Count : Bins)
+        NumValues += Count;
+    EXPECT_EQ(NumValues, Uint64{1024} * 700);
+}
+
 } // namespace
@@ -0,0 +1,175 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "AsyncFileReader.hpp"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "TestingEnvironment.hpp"
+#include "TempDirectory.hpp"
+#include "FileWrapper.hpp"
+#include "FastRand.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+class AsyncFileReaderTest : public ::testing::Test
+{
+protected:
+    static constexpr Uint32 NumFiles = 16;
+
+    virtual void SetUp() override
+    {
+        FastRandInt Rnd{0, 0, 255};
+        for (Uint32 i = 0; i < NumFiles; ++i)
+        {
+            std::vector<Uint8> Data(1000 + i * 4096);
+            for (Uint8& Byte : Data)
+                Byte = static_cast<Uint8>(Rnd());
+
+            const std::string Path = m_TmpDir.Get() + FileSystem::SlashSymbol + "File" + std::to_string(i) + ".bin";
+
+            FileWrapper File{Path.c_str(), EFileAccessMode::Overwrite};
+            ASSERT_TRUE(File);
+            ASSERT_TRUE(File->Write(Data.data(), Data.size()));
+
+            m_Paths.emplace_back(Path);
+            m_Data.emplace_back(std::move(Data));
+        }
+    }
+
+    void CheckData(const AsyncFileReadTask* pTask, Uint32 FileIdx) const
+    {
+        ASSERT_NE(pTask, nullptr);
+        ASSERT_EQ(pTask->GetStatus(), ASYNC_TASK_STATUS_COMPLETE);
+        const IDataBlob* pData = pTask->GetData();
+        ASSERT_NE(pData, nullptr);
+        ASSERT_EQ(pData->GetSize(), m_Data[FileIdx].size());
+        EXPECT_EQ(memcmp(pData->GetConstDataPtr(), m_Data[FileIdx].data(), m_Data[FileIdx].size()), 0);
+    }
+
+    TempDirectory                   m_TmpDir;
+    std::vector<std::string>        m_Paths;
+    std::vector<std::vector<Uint8>> m_Data;
+};
+
+TEST_F(AsyncFileReaderTest, ReadFile)
+{
+    AsyncFileReader Reader;
+
+    std::vector<RefCntAutoPtr<AsyncFileReadTask>> Tasks;
+    for (const std::string& Path : m_Paths)
+    {
+        Tasks.emplace_back(Reader.ReadFile(Path.c_str()));
+        ASSERT_TRUE(Tasks.back());
+        EXPECT_EQ(Tasks.back()->GetPath(), Path);
+    }
+
+    for (Uint32 i = 0; i < NumFiles; ++i)
+    {
+        Tasks[i]->WaitForCompletion();
+        CheckData(Tasks[i], i);
+    }
+}
+
+TEST_F(AsyncFileReaderTest, MissingFile)
+{
+    AsyncFileReader Reader;
+
+    const std::string Path = m_TmpDir.Get() + FileSystem::SlashSymbol + "Missing.bin";
+
+    TestingEnvironment::ErrorScope ExpectedErrors{"Failed to open file"};
+
+    RefCntAutoPtr<AsyncFileReadTask> pTask = Reader.ReadFile(Path.c_str());
+    ASSERT_TRUE(pTask);
+    pTask->WaitForCompletion();
+    EXPECT_EQ(pTask->GetStatus(), ASYNC_TASK_STATUS_COMPLETE);
+    EXPECT_EQ(pTask->GetData(), nullptr);
+}
+
+TEST_F(AsyncFileReaderTest, Prefetch)
+{
+    AsyncFileReader Reader{AsyncFileReaderCreateInfo{1}};
+
+    std::vector<const Char*> Paths;
+    for (const std::string& Path : m_Paths)
+        Paths.push_back(Path.c_str());
+
+    Reader.Prefetch(Paths.data(), static_cast<Uint32>(Paths.size()));
+    // Prefetching the same files again has no effect
+    Reader.Prefetch(Paths.data(), static_cast<Uint32>(Paths.size()));
+    EXPECT_EQ(Reader.GetPrefetchCacheSize(), size_t{NumFiles});
+
+    // Claim the last file first: if it has not started yet, it is moved to the front of the queue
+    RefCntAutoPtr<AsyncFileReadTask> pLastTask = Reader.ReadFile(Paths.back(), 1);
+    ASSERT_TRUE(pLastTask);
+    EXPECT_EQ(Reader.GetPrefetchCacheSize(), size_t{NumFiles - 1});
+    pLastTask->WaitForCompletion();
+    CheckData(pLastTask, NumFiles - 1);
+
+    Reader.WaitForAllReads();
+    for (Uint32 i = 0; i < NumFiles - 1; ++i)
+    {
+        RefCntAutoPtr<AsyncFileReadTask> pTask = Reader.ReadFile(Paths[i]);
+        // Prefetched data is returned without reading the file again
+        EXPECT_TRUE(pTask->IsFinished());
+        CheckData(pTask, i);
+    }
+    EXPECT_EQ(Reader.GetPrefetchCacheSize(), size_t{0});
+}
+
+TEST_F(AsyncFileReaderTest, ClearPrefetchCache)
+{
+    std::vector<const Char*> Paths;
+    for (const std::string& Path : m_Paths)
+        Paths.push_back(Path.c_str());
+
+    {
+        AsyncFileReader Reader{AsyncFileReaderCreateInfo{1}};
+        Reader.Prefetch(Paths.data(), static_cast<Uint32>(Paths.size()));
+        Reader.ClearPrefetchCache();
+        EXPECT_EQ(Reader.GetPrefetchCacheSize(), size_t{0});
+
+        // The files are read again
+        RefCntAutoPtr<AsyncFileReadTask> pTask = Reader.ReadFile(Paths[0]);
+        pTask->WaitForCompletion();
+        CheckData(pTask, 0);
+    }
+
+    {
+        // Pending prefetch requests are cancelled by the destructor
+        AsyncFileReader Reader{AsyncFileReaderCreateInfo{1}};
+        Reader.Prefetch(Paths.data(), static_cast<Uint32>(Paths.size()));
+    }
+}
+
+} // namespace
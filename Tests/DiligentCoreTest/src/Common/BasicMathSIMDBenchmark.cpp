@@ -0,0 +1,161 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BasicMathSIMD.hpp"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "FastRand.hpp"
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Compares BasicMathSIMD functions with the scalar BasicMath code on large arrays.
+class BasicMathSIMDBenchmark
+{
+public:
+    static constexpr size_t NumElements = size_t{1} << 18;
+    static constexpr Uint32 NumRuns     = 16;
+
+    BasicMathSIMDBenchmark() :
+        m_Points(NumElements),
+        m_Vectors(NumElements),
+        m_Matrices(NumElements),
+        m_OutPoints(NumElements),
+        m_OutVectors(NumElements),
+        m_OutMatrices(NumElements)
+    {
+        FastRandFloat Rnd{0, -10, 10};
+        for (size_t i = 0; i < NumElements; ++i)
+        {
+            m_Points[i]  = float3{Rnd(), Rnd(), Rnd()};
+            m_Vectors[i] = float4{Rnd(), Rnd(), Rnd(), Rnd()};
+            for (int r = 0; r < 4; ++r)
+            {
+                for (int c = 0; c < 4; ++c)
+                    m_Matrices[i].m[r][c] = Rnd() + (r == c ? 40.f : 0.f);
+            }
+        }
+        m_Transform = float4x4::RotationY(0.5f) * float4x4::Translation(1, 2, 3);
+    }
+
+    // Returns the number of elements processed per second
+    template <typename FuncType>
+    static double Run(FuncType&& Func)
+    {
+        return GetRate(static_cast<double>(NumElements), MeasureMinTime(NumRuns, Func));
+    }
+
+    template <typename ScalarFuncType, typename SIMDFuncType>
+    static void AddResult(BenchmarkTable& Table, const char* Name, ScalarFuncType&& ScalarFunc, SIMDFuncType&& SIMDFunc)
+    {
+        constexpr double M = 1e6;
+
+        const double ScalarRate = Run(ScalarFunc);
+        const double SIMDRate   = Run(SIMDFunc);
+        Table.AddRow({Name, BenchmarkTable::Number(ScalarRate / M), BenchmarkTable::Number(SIMDRate / M), BenchmarkTable::Ratio(SIMDRate, ScalarRate)});
+    }
+
+    std::vector<float3>   m_Points;
+    std::vector<float4>   m_Vectors;
+    std::vector<float4x4> m_Matrices;
+
+    std::vector<float3>   m_OutPoints;
+    std::vector<float4>   m_OutVectors;
+    std::vector<float4x4> m_OutMatrices;
+
+    float4x4 m_Transform;
+};
+
+TEST(Common_BasicMathSIMDBenchmark, DISABLED_Throughput)
+{
+    BasicMathSIMDBenchmark B;
+
+    const float4x4& m = B.m_Transform;
+
+    BenchmarkTable Table{"BasicMath throughput, millions of elements per second", {"Operation", "Scalar", "SIMD", "Ratio"}};
+
+    BasicMathSIMDBenchmark::AddResult(
+        Table, "TransformPoints",
+        [&]() {
+            for (size_t i = 0; i < B.m_Points.size(); ++i)
+                B.m_OutPoints[i] = B.m_Points[i] * m;
+        },
+        [&]() { TransformPoints(B.m_Points.data(), B.m_Points.size(), m, B.m_OutPoints.data()); });
+
+    BasicMathSIMDBenchmark::AddResult(
+        Table, "TransformVectors",
+        [&]() {
+            for (size_t i = 0; i < B.m_Vectors.size(); ++i)
+                B.m_OutVectors[i] = B.m_Vectors[i] * m;
+        },
+        [&]() { TransformVectors(B.m_Vectors.data(), B.m_Vectors.size(), m, B.m_OutVectors.data()); });
+
+    BasicMathSIMDBenchmark::AddResult(
+        Table, "MulMatrices",
+        [&]() {
+            for (size_t i = 0; i < B.m_Matrices.size(); ++i)
+                B.m_OutMatrices[i] = B.m_Matrices[i] * m;
+        },
+        [&]() { MulMatrices(B.m_Matrices.data(), B.m_Matrices.size(), m, B.m_OutMatrices.data()); });
+
+    BasicMathSIMDBenchmark::AddResult(
+        Table, "Transpose",
+        [&]() {
+            for (size_t i = 0; i < B.m_Matrices.size(); ++i)
+                B.m_OutMatrices[i] = B.m_Matrices[i].Transpose();
+        },
+        [&]() {
+            for (size_t i = 0; i < B.m_Matrices.size(); ++i)
+                B.m_OutMatrices[i] = TransposeSIMD(B.m_Matrices[i]);
+        });
+
+    BasicMathSIMDBenchmark::AddResult(
+        Table, "Inverse",
+        [&]() {
+            for (size_t i = 0; i < B.m_Matrices.size(); ++i)
+                B.m_OutMatrices[i] = B.m_Matrices[i].Inverse();
+        },
+        [&]() {
+            for (size_t i = 0; i < B.m_Matrices.size(); ++i)
+                B.m_OutMatrices[i] = InverseSIMD(B.m_Matrices[i]);
+        });
+
+    Table.Print();
+
+    // Prevent the compiler from optimizing the loops away
+    EXPECT_NE(B.m_OutMatrices[0], float4x4{});
+    EXPECT_NE(B.m_OutPoints[0], float3{});
+    EXPECT_NE(B.m_OutVectors[0], float4{});
+}
+
+} // namespace
@@ -0,0 +1,186 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BoundingVolumeHierarchy.hpp"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "FastRand.hpp"
+#include "ThreadPool.hpp"
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Compares BoundingVolumeHierarchy queries with testing every triangle or box.
+class BVHBenchmark
+{
+public:
+    static constexpr Uint32 NumTriangles = 200000;
+    static constexpr int    NumRays      = 250;
+    static constexpr int    NumPoints    = 250;
+
+    BVHBenchmark() :
+        m_Verts(size_t{NumTriangles} * 3),
+        m_Boxes(NumTriangles)
+    {
+        FastRandFloat Rnd{0, -1, 1};
+        for (Uint32 t = 0; t < NumTriangles; ++t)
+        {
+            const float3 Center = float3{Rnd(), Rnd(), Rnd()} * 100.f;
+            for (Uint32 v = 0; v < 3; ++v)
+                m_Verts[t * 3 + v] = Center + float3{Rnd(), Rnd(), Rnd()};
+
+            m_Boxes[t].Min = (std::min)((std::min)(m_Verts[t * 3], m_Verts[t * 3 + 1]), m_Verts[t * 3 + 2]);
+            m_Boxes[t].Max = (std::max)((std::max)(m_Verts[t * 3], m_Verts[t * 3 + 1]), m_Verts[t * 3 + 2]);
+        }
+
+        for (int r = 0; r < NumRays; ++r)
+        {
+            const float3 Origin = float3{Rnd(), Rnd(), Rnd()} * 150.f;
+            m_Rays.emplace_back(Origin, normalize(float3{Rnd(), Rnd(), Rnd()} * 50.f - Origin));
+        }
+
+        for (int p = 0; p < NumPoints; ++p)
+            m_Points.emplace_back(float3{Rnd(), Rnd(), Rnd()} * 120.f);
+    }
+
+    // Returns the build time in seconds
+    double Build(IThreadPool* pThreadPool)
+    {
+        BVHBuildAttribs Attribs;
+        Attribs.pThreadPool = pThreadPool;
+
+        return MeasureMinTime(1, [&]() { m_BVH.Build(m_Boxes.data(), NumTriangles, Attribs); });
+    }
+
+    // Returns the number of rays per second. Sum accumulates the hit distances to compare the results.
+    double CastRaysBruteForce(double& Sum) const
+    {
+        Timer T;
+        for (const auto& Ray : m_Rays)
+        {
+            float HitDist = +FLT_MAX;
+            for (Uint32 t = 0; t < NumTriangles; ++t)
+            {
+                const float Dist = IntersectTriangle(Ray, t);
+                if (Dist >= 0 && Dist < HitDist)
+                    HitDist = Dist;
+            }
+            Sum += HitDist != +FLT_MAX ? HitDist : 0;
+        }
+        return GetRate(NumRays, T.GetElapsedTime());
+    }
+
+    double CastRaysBVH(double& Sum) const
+    {
+        Timer T;
+        for (const auto& Ray : m_Rays)
+        {
+            float HitDist = 0;
+            m_BVH.CastRay(
+                Ray.first, Ray.second, [&](Uint32 t) { return IntersectTriangle(Ray, t); }, HitDist);
+            Sum += HitDist != +FLT_MAX ? HitDist : 0;
+        }
+        return GetRate(NumRays, T.GetElapsedTime());
+    }
+
+    // Returns the number of points per second
+    double FindNearestBruteForce(double& Sum) const
+    {
+        Timer T;
+        for (const auto& Pos : m_Points)
+        {
+            float MinDistSqr = +FLT_MAX;
+            for (const auto& Box : m_Boxes)
+                MinDistSqr = std::min(MinDistSqr, GetPointToBoxDistanceSqr(Box, Pos));
+            Sum += std::sqrt(MinDistSqr);
+        }
+        return GetRate(NumPoints, T.GetElapsedTime());
+    }
+
+    double FindNearestBVH(double& Sum) const
+    {
+        Timer T;
+        for (const auto& Pos : m_Points)
+        {
+            float Dist = 0;
+            m_BVH.FindNearestBox(Pos, Dist);
+            Sum += Dist;
+        }
+        return GetRate(NumPoints, T.GetElapsedTime());
+    }
+
+private:
+    using Ray = std::pair<float3, float3>;
+
+    float IntersectTriangle(const Ray& R, Uint32 t) const
+    {
+        return IntersectRayTriangle(m_Verts[t * 3], m_Verts[t * 3 + 1], m_Verts[t * 3 + 2], R.first, R.second);
+    }
+
+    std::vector<float3>   m_Verts;
+    std::vector<BoundBox> m_Boxes;
+    std::vector<Ray>      m_Rays;
+    std::vector<float3>   m_Points;
+
+    BoundingVolumeHierarchy m_BVH;
+};
+
+TEST(Common_BoundingVolumeHierarchyBenchmark, DISABLED_Queries)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_TRUE(pThreadPool);
+
+    BVHBenchmark Benchmark;
+
+    const double BuildTime   = Benchmark.Build(nullptr);
+    const double BuildTimeMT = Benchmark.Build(pThreadPool);
+
+    double       RefRaySum = 0, RaySum = 0;
+    const double RayRefRate = Benchmark.CastRaysBruteForce(RefRaySum);
+    const double RayRate    = Benchmark.CastRaysBVH(RaySum);
+    EXPECT_EQ(RaySum, RefRaySum);
+
+    double       RefDistSum = 0, DistSum = 0;
+    const double NearestRefRate = Benchmark.FindNearestBruteForce(RefDistSum);
+    const double NearestRate    = Benchmark.FindNearestBVH(DistSum);
+    EXPECT_EQ(DistSum, RefDistSum);
+
+    BenchmarkTable Table{"BVH of 200K triangles. Build time: " + BenchmarkTable::Number(BuildTime * 1000, 1) +
+                             " ms, 4 threads: " + BenchmarkTable::Number(BuildTimeMT * 1000, 1) + " ms",
+                         {"Query", "Brute force, 1/s", "BVH, 1/s", "Ratio"}};
+    Table.AddRow({"Ray closest hit", BenchmarkTable::Number(RayRefRate), BenchmarkTable::Number(RayRate), BenchmarkTable::Ratio(RayRate, RayRefRate, 0)});
+    Table.AddRow({"Nearest box", BenchmarkTable::Number(NearestRefRate), BenchmarkTable::Number(NearestRate), BenchmarkTable::Ratio(NearestRate, NearestRefRate, 0)});
+    Table.Print();
+}
+
+} // namespace
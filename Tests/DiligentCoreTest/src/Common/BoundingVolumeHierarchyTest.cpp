@@ -0,0 +1,381 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "BoundingVolumeHierarchy.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "FastRand.hpp"
+#include "ThreadPool.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+std::vector<BoundBox> GenerateBoxes(size_t NumBoxes, unsigned int Seed, float MaxSize = 2.f)
+{
+    FastRandFloat Rnd{Seed, 0, 1};
+
+    std::vector<BoundBox> Boxes(NumBoxes);
+    for (auto& Box : Boxes)
+    {
+        const float3 Center = float3{Rnd(), Rnd(), Rnd()} * 100.f - float3{50, 50, 50};
+        const float3 Size   = float3{Rnd(), Rnd(), Rnd()} * MaxSize;
+        Box                 = BoundBox{Center - Size * 0.5f, Center + Size * 0.5f};
+    }
+    return Boxes;
+}
+
+bool BoxContains(const BoundBox& Outer, const BoundBox& Inner)
+{
+    return Outer.Min.x <= Inner.Min.x && Outer.Min.y <= Inner.Min.y && Outer.Min.z <= Inner.Min.z &&
+        Outer.Max.x >= Inner.Max.x && Outer.Max.y >= Inner.Max.y && Outer.Max.z >= Inner.Max.z;
+}
+
+// Checks that every node contains its children and every primitive is referenced once
+void VerifyHierarchy(const BoundingVolumeHierarchy& BVH, const std::vector<BoundBox>& Boxes, Uint32 MaxPrimsInLeaf)
+{
+    const auto& Nodes       = BVH.GetNodes();
+    const auto& PrimIndices = BVH.GetPrimIndices();
+    ASSERT_EQ(PrimIndices.size(), Boxes.size());
+
+    std::vector<int> PrimRefs(Boxes.size());
+
+    size_t NumReachedNodes = 0;
+    struct Entry
+    {
+        Uint32 NodeIdx;
+        Uint32 Depth;
+    };
+    std::vector<Entry> Stack{{0, 0}};
+    while (!Stack.empty())
+    {
+        const Entry E = Stack.back();
+        Stack.pop_back();
+        ++NumReachedNodes;
+
+        ASSERT_LT(E.NodeIdx, Nodes.size());
+        ASSERT_LT(E.Depth, BoundingVolumeHierarchy::MaxDepth);
+        const auto& N = Nodes[E.NodeIdx];
+        if (N.IsLeaf())
+        {
+            EXPECT_TRUE(N.NumPrims <= MaxPrimsInLeaf || E.Depth + 1 == BoundingVolumeHierarchy::MaxDepth || N.NumPrims == Boxes.size() ||
+                        std::all_of(PrimIndices.begin() + N.FirstChildOrPrim, PrimIndices.begin() + N.FirstChildOrPrim + N.NumPrims, [&](Uint32 i) {
+                            return Boxes[i].Min + Boxes[i].Max == Boxes[PrimIndices[N.FirstChildOrPrim]].Min + Boxes[PrimIndices[N.FirstChildOrPrim]].Max;
+                        }));
+            for (Uint32 i = N.FirstChildOrPrim; i < N.FirstChildOrPrim + N.NumPrims; ++i)
+            {
+                ++PrimRefs[PrimIndices[i]];
+                EXPECT_TRUE(BoxContains(N.GetBox(), Boxes[PrimIndices[i]]));
+            }
+        }
+        else
+        {
+            ASSERT_GT(N.FirstChildOrPrim, E.NodeIdx);
+            for (Uint32 Child = N.FirstChildOrPrim; Child < N.FirstChildOrPrim + 2; ++Child)
+            {
+                EXPECT_TRUE(BoxContains(N.GetBox(), Nodes[Child].GetBox()));
+                Stack.push_back({Child, E.Depth + 1});
+            }
+        }
+    }
+    EXPECT_EQ(NumReachedNodes, Nodes.size());
+    for (size_t i = 0; i < PrimRefs.size(); ++i)
+        EXPECT_EQ(PrimRefs[i], 1) << "Primitive " << i;
+}
+
+float IntersectRayBox(const float3& RayOrigin, const float3& RayDir, const BoundBox& Box)
+{
+    float EnterDist = 0, ExitDist = 0;
+    return IntersectRayAABB(RayOrigin, RayDir, Box, EnterDist, ExitDist) ? std::max(EnterDist, 0.f) : -1.f;
+}
+
+void TestQueries(const BoundingVolumeHierarchy& BVH, const std::vector<BoundBox>& Boxes, unsigned int Seed)
+{
+    FastRandFloat Rnd{Seed, -1, 1};
+
+    // Rays
+    for (int r = 0; r < 200; ++r)
+    {
+        const float3 RayOrigin = float3{Rnd(), Rnd(), Rnd()} * 80.f;
+        const float3 RayDir    = normalize(float3{Rnd(), Rnd(), Rnd()} + float3{0, 0, 0.01f});
+        const float  MaxDist   = r % 2 == 0 ? +FLT_MAX : 40.f;
+
+        auto IntersectPrim = [&](Uint32 PrimIdx) {
+            return IntersectRayBox(RayOrigin, RayDir, Boxes[PrimIdx]);
+        };
+
+        float RefDist = MaxDist;
+        for (Uint32 i = 0; i < Boxes.size(); ++i)
+        {
+            const float Dist = IntersectPrim(i);
+            if (Dist >= 0 && Dist < RefDist)
+                RefDist = Dist;
+        }
+
+        float        HitDist = 0;
+        const Uint32 HitPrim = BVH.CastRay(RayOrigin, RayDir, IntersectPrim, HitDist, MaxDist);
+        EXPECT_EQ(HitDist, RefDist);
+        if (RefDist < MaxDist)
+        {
+            ASSERT_NE(HitPrim, BoundingVolumeHierarchy::InvalidIndex);
+            EXPECT_EQ(IntersectPrim(HitPrim), RefDist);
+        }
+        else
+        {
+            EXPECT_EQ(HitPrim, BoundingVolumeHierarchy::InvalidIndex);
+        }
+
+        const Uint32 AnyHitPrim = BVH.CastRayAnyHit(RayOrigin, RayDir, IntersectPrim, MaxDist);
+        EXPECT_EQ(AnyHitPrim != BoundingVolumeHierarchy::InvalidIndex, RefDist < MaxDist);
+        if (AnyHitPrim != BoundingVolumeHierarchy::InvalidIndex)
+        {
+            const float Dist = IntersectPrim(AnyHitPrim);
+            EXPECT_TRUE(Dist >= 0 && Dist < MaxDist);
+        }
+    }
+
+    // Nearest box
+    for (int p = 0; p < 200; ++p)
+    {
+        const float3 Pos     = float3{Rnd(), Rnd(), Rnd()} * 70.f;
+        const float  MaxDist = p % 2 == 0 ? +FLT_MAX : 2.f;
+
+        float RefDistSqr = MaxDist * MaxDist;
+        for (const auto& Box : Boxes)
+            RefDistSqr = std::min(RefDistSqr, GetPointToBoxDistanceSqr(Box, Pos));
+
+        float        Dist    = 0;
+        const Uint32 Nearest = BVH.FindNearestBox(Pos, Dist, MaxDist);
+        if (RefDistSqr < MaxDist * MaxDist)
+        {
+            ASSERT_NE(Nearest, BoundingVolumeHierarchy::InvalidIndex);
+            EXPECT_EQ(GetPointToBoxDistanceSqr(Boxes[Nearest], Pos), RefDistSqr);
+            EXPECT_EQ(Dist, std::sqrt(RefDistSqr));
+        }
+        else
+        {
+            EXPECT_EQ(Nearest, BoundingVolumeHierarchy::InvalidIndex);
+            EXPECT_EQ(Dist, MaxDist);
+        }
+    }
+
+    // Frustum
+    size_t NumVisible = 0;
+    for (int f = 0; f < 8; ++f)
+    {
+        const float4x4 ViewProj = float4x4::RotationY(Rnd() * PI_F) * float4x4::RotationX(Rnd()) * float4x4::Translation(Rnd() * 10, Rnd() * 10, 20) *
+            float4x4::Projection(PI_F / 4.f, 1.5f, 1.f, 50.f, false);
+
+        ViewFrustumExt Frustum;
+        ExtractViewFrustumPlanesFromMatrix(ViewProj, Frustum, false);
+
+        auto TestFrustum = [&](const auto& TestedFrustum, FRUSTUM_PLANE_FLAGS PlaneFlags) {
+            std::vector<int> Visibility(Boxes.size(), -1);
+            BVH.QueryFrustum(
+                TestedFrustum, [&](Uint32 PrimIdx, BoxVisibility Vis) {
+                    EXPECT_EQ(Visibility[PrimIdx], -1) << "Primitive " << PrimIdx << " is reported twice";
+                    Visibility[PrimIdx] = static_cast<int>(Vis);
+                },
+                PlaneFlags);
+
+            for (Uint32 i = 0; i < Boxes.size(); ++i)
+            {
+                const BoxVisibility RefVis = GetBoxVisibility(TestedFrustum, Boxes[i], PlaneFlags);
+                if (RefVis == BoxVisibility::Invisible)
+                {
+                    EXPECT_EQ(Visibility[i], -1) << "Primitive " << i;
+                }
+                else
+                {
+                    EXPECT_EQ(Visibility[i], static_cast<int>(RefVis)) << "Primitive " << i;
+                    ++NumVisible;
+                }
+            }
+        };
+        TestFrustum(static_cast<const ViewFrustum&>(Frustum), FRUSTUM_PLANE_FLAG_FULL_FRUSTUM);
+        TestFrustum(static_cast<const ViewFrustum&>(Frustum), FRUSTUM_PLANE_FLAG_OPEN_NEAR);
+        TestFrustum(Frustum, FRUSTUM_PLANE_FLAG_FULL_FRUSTUM);
+    }
+    if (Boxes.size() >= 100)
+    {
+        EXPECT_GT(NumVisible, size_t{0});
+    }
+}
+
+TEST(Common_BoundingVolumeHierarchy, Empty)
+{
+    BoundingVolumeHierarchy BVH;
+    BVH.Build(nullptr, 0);
+    EXPECT_TRUE(BVH.IsEmpty());
+
+    float Dist = 0;
+    EXPECT_EQ(BVH.CastRay(
+                  float3{0, 0, 0}, float3{1, 0, 0}, [](Uint32) { return 0.f; }, Dist),
+              BoundingVolumeHierarchy::InvalidIndex);
+    EXPECT_EQ(BVH.CastRayAnyHit(float3{0, 0, 0}, float3{1, 0, 0}, [](Uint32) { return 0.f; }), BoundingVolumeHierarchy::InvalidIndex);
+    EXPECT_EQ(BVH.FindNearestBox(float3{0, 0, 0}, Dist), BoundingVolumeHierarchy::InvalidIndex);
+
+    BVH.QueryFrustum(ViewFrustum{}, [](Uint32, BoxVisibility) { ADD_FAILURE(); });
+    BVH.Refit(nullptr);
+}
+
+TEST(Common_BoundingVolumeHierarchy, Build)
+{
+    for (Uint32 NumBoxes : {1u, 2u, 3u, 5u, 17u, 100u, 1000u, 10000u})
+    {
+        const auto Boxes = GenerateBoxes(NumBoxes, NumBoxes);
+        for (Uint32 MaxPrimsInLeaf : {1u, 4u, 8u})
+        {
+            BVHBuildAttribs Attribs;
+            Attribs.MaxPrimsInLeaf = MaxPrimsInLeaf;
+
+            BoundingVolumeHierarchy BVH{Boxes.data(), NumBoxes, Attribs};
+            EXPECT_EQ(BVH.GetNumPrims(), NumBoxes);
+            VerifyHierarchy(BVH, Boxes, MaxPrimsInLeaf);
+        }
+    }
+
+    // All boxes have the same center and can't be split by SAH
+    {
+        std::vector<BoundBox> Boxes;
+        for (int i = 0; i < 100; ++i)
+            Boxes.push_back(BoundBox{float3{-1, -1, -1} * static_cast<float>(i + 1), float3{1, 1, 1} * static_cast<float>(i + 1)});
+
+        BoundingVolumeHierarchy BVH{Boxes.data(), static_cast<Uint32>(Boxes.size())};
+        VerifyHierarchy(BVH, Boxes, 4);
+        TestQueries(BVH, Boxes, 1);
+    }
+}
+
+TEST(Common_BoundingVolumeHierarchy, Queries)
+{
+    for (Uint32 NumBoxes : {1u, 7u, 100u, 5000u})
+    {
+        const auto Boxes = GenerateBoxes(NumBoxes, NumBoxes + 1, NumBoxes < 100 ? 20.f : 2.f);
+
+        BoundingVolumeHierarchy BVH{Boxes.data(), NumBoxes};
+        TestQueries(BVH, Boxes, NumBoxes);
+    }
+}
+
+TEST(Common_BoundingVolumeHierarchy, Triangles)
+{
+    constexpr Uint32 NumTriangles = 2000;
+
+    FastRandFloat         Rnd{0, -1, 1};
+    std::vector<float3>   Verts(NumTriangles * 3);
+    std::vector<BoundBox> Boxes(NumTriangles);
+    for (Uint32 t = 0; t < NumTriangles; ++t)
+    {
+        const float3 Center = float3{Rnd(), Rnd(), Rnd()} * 50.f;
+        for (Uint32 v = 0; v < 3; ++v)
+            Verts[t * 3 + v] = Center + float3{Rnd(), Rnd(), Rnd()} * 2.f;
+
+        Boxes[t].Min = (std::min)((std::min)(Verts[t * 3], Verts[t * 3 + 1]), Verts[t * 3 + 2]);
+        Boxes[t].Max = (std::max)((std::max)(Verts[t * 3], Verts[t * 3 + 1]), Verts[t * 3 + 2]);
+    }
+
+    BoundingVolumeHierarchy BVH{Boxes.data(), NumTriangles};
+
+    Uint32 NumHits = 0;
+    for (int r = 0; r < 500; ++r)
+    {
+        const float3 RayOrigin = float3{Rnd(), Rnd(), Rnd()} * 60.f;
+        const float3 RayDir    = normalize(-RayOrigin + float3{Rnd(), Rnd(), Rnd()} * 20.f);
+
+        auto IntersectTriangle = [&](Uint32 TriIdx) {
+            return IntersectRayTriangle(Verts[TriIdx * 3], Verts[TriIdx * 3 + 1], Verts[TriIdx * 3 + 2], RayOrigin, RayDir);
+        };
+
+        float RefDist = +FLT_MAX;
+        for (Uint32 t = 0; t < NumTriangles; ++t)
+        {
+            const float Dist = IntersectTriangle(t);
+            if (Dist >= 0 && Dist < RefDist)
+                RefDist = Dist;
+        }
+
+        float        HitDist = 0;
+        const Uint32 HitTri  = BVH.CastRay(RayOrigin, RayDir, IntersectTriangle, HitDist);
+        EXPECT_EQ(HitDist, RefDist);
+        EXPECT_EQ(HitTri != BoundingVolumeHierarchy::InvalidIndex, RefDist != +FLT_MAX);
+        EXPECT_EQ(BVH.CastRayAnyHit(RayOrigin, RayDir, IntersectTriangle) != BoundingVolumeHierarchy::InvalidIndex, RefDist != +FLT_MAX);
+        NumHits += HitTri != BoundingVolumeHierarchy::InvalidIndex ? 1 : 0;
+    }
+    EXPECT_GT(NumHits, 0u);
+}
+
+TEST(Common_BoundingVolumeHierarchy, Refit)
+{
+    constexpr Uint32 NumBoxes = 3000;
+
+    auto Boxes = GenerateBoxes(NumBoxes, 7);
+
+    BoundingVolumeHierarchy BVH{Boxes.data(), NumBoxes};
+
+    FastRandFloat Rnd{8, -1, 1};
+    for (int Frame = 0; Frame < 3; ++Frame)
+    {
+        for (auto& Box : Boxes)
+        {
+            const float3 Offset = float3{Rnd(), Rnd(), Rnd()} * 5.f;
+            Box.Min += Offset;
+            Box.Max += Offset;
+        }
+        BVH.Refit(Boxes.data());
+        VerifyHierarchy(BVH, Boxes, 4);
+        TestQueries(BVH, Boxes, Frame);
+    }
+}
+
+TEST(Common_BoundingVolumeHierarchy, ThreadPool)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_TRUE(pThreadPool);
+
+    constexpr Uint32 NumBoxes = 80000;
+
+    const auto Boxes = GenerateBoxes(NumBoxes, 9, 0.5f);
+
+    BVHBuildAttribs         Attribs;
+    BoundingVolumeHierarchy BVH{Boxes.data(), NumBoxes, Attribs};
+
+    Attribs.pThreadPool = pThreadPool;
+    BoundingVolumeHierarchy BVHMT{Boxes.data(), NumBoxes, Attribs};
+    VerifyHierarchy(BVHMT, Boxes, Attribs.MaxPrimsInLeaf);
+
+    // The hierarchies have the same topology, but the nodes may be ordered differently
+    EXPECT_EQ(BVHMT.GetNodes().size(), BVH.GetNodes().size());
+    EXPECT_EQ(BVHMT.GetPrimIndices(), BVH.GetPrimIndices());
+    TestQueries(BVHMT, Boxes, 10);
+}
+
+} // namespace
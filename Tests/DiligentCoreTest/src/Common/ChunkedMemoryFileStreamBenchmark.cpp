@@ -0,0 +1,86 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "ChunkedMemoryFileStream.hpp"
+#include "MemoryFileStream.hpp"
+#include "DataBlobImpl.hpp"
+
+#include "gtest/gtest.h"
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Streams a large number of small records, which resembles an archive writer
+// that emits the data through IFileStream.
+class StreamWriteBenchmark
+{
+public:
+    static constexpr size_t RecordSize = 48;
+    static constexpr size_t NumRecords = size_t{4} << 20;
+    static constexpr Uint32 NumRuns    = 3;
+
+    template <typename CreateStreamType>
+    static double Run(CreateStreamType&& CreateStream)
+    {
+        Uint8 Record[RecordSize] = {};
+
+        return MeasureMinTime(NumRuns, [&]() {
+            RefCntAutoPtr<IFileStream> pStream = CreateStream();
+            for (size_t i = 0; i < NumRecords; ++i)
+            {
+                Record[0] = static_cast<Uint8>(i);
+                pStream->Write(Record, sizeof(Record));
+            }
+            VERIFY_EXPR(pStream->GetSize() == RecordSize * NumRecords);
+        });
+    }
+};
+
+TEST(Common_ChunkedMemoryFileStreamBenchmark, DISABLED_SmallWrites)
+{
+    const double MemoryStreamTime = StreamWriteBenchmark::Run([]() {
+        return RefCntAutoPtr<IFileStream>{MemoryFileStream::Create(DataBlobImpl::Create())};
+    });
+    const double ChunkedStreamTime = StreamWriteBenchmark::Run([]() {
+        return RefCntAutoPtr<IFileStream>{ChunkedMemoryFileStream::Create()};
+    });
+
+    constexpr size_t StreamSizeMB = StreamWriteBenchmark::RecordSize * StreamWriteBenchmark::NumRecords >> 20;
+    BenchmarkTable Table{"Writing " + std::to_string(StreamWriteBenchmark::NumRecords) + " records of " +
+                             std::to_string(StreamWriteBenchmark::RecordSize) + " bytes (" + std::to_string(StreamSizeMB) + " MB)",
+                         {"Stream", "Time, ms", "Speedup"}};
+    Table.AddRow({"MemoryFileStream", BenchmarkTable::Number(MemoryStreamTime * 1000, 1), BenchmarkTable::Ratio(1, 1)});
+    Table.AddRow({"ChunkedMemoryFileStream", BenchmarkTable::Number(ChunkedStreamTime * 1000, 1), BenchmarkTable::Ratio(MemoryStreamTime, ChunkedStreamTime)});
+    Table.Print();
+}
+
+} // namespace
@@ -0,0 +1,201 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "ChunkedMemoryFileStream.hpp"
+#include "MemoryFileStream.hpp"
+#include "DataBlobImpl.hpp"
+#include "FileSystem.hpp"
+
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+std::vector<Uint8> GetTestData(size_t Size)
+{
+    std::vector<Uint8> Data(Size);
+    for (size_t i = 0; i < Size; ++i)
+        Data[i] = static_cast<Uint8>((i * 31) ^ (i >> 8));
+    return Data;
+}
+
+std::vector<Uint8> GatherChunks(const ChunkedMemoryFileStream& Stream)
+{
+    std::vector<Uint8> Data;
+    for (Uint32 i = 0; i < Stream.GetChunkCount(); ++i)
+    {
+        const ChunkedMemoryFileStream::Chunk Chunk = Stream.GetChunk(i);
+        const Uint8*                         pData = static_cast<const Uint8*>(Chunk.pData);
+        Data.insert(Data.end(), pData, pData + Chunk.Size);
+    }
+    return Data;
+}
+
+TEST(Common_ChunkedMemoryFileStream, Write)
+{
+    const std::vector<Uint8> Data = GetTestData(100000);
+
+    RefCntAutoPtr<ChunkedMemoryFileStream> pStream = ChunkedMemoryFileStream::Create(256, 4096);
+    ASSERT_TRUE(pStream);
+    EXPECT_TRUE(pStream->IsValid());
+    EXPECT_EQ(pStream->GetSize(), size_t{0});
+    EXPECT_EQ(pStream->GetChunkCount(), Uint32{0});
+
+    // Write records of varying size
+    size_t Offset = 0;
+    for (size_t RecordSize = 1; Offset < Data.size(); RecordSize = RecordSize % 97 + 1)
+    {
+        RecordSize = std::min(RecordSize, Data.size() - Offset);
+        EXPECT_TRUE(pStream->Write(&Data[Offset], RecordSize));
+        Offset += RecordSize;
+    }
+    EXPECT_EQ(pStream->GetSize(), Data.size());
+    EXPECT_EQ(pStream->GetPos(), Data.size());
+
+    // Chunk sizes grow geometrically up to the maximum size
+    EXPECT_GT(pStream->GetChunkCount(), Uint32{1});
+    EXPECT_EQ(pStream->GetChunk(0).Size, size_t{256});
+    EXPECT_EQ(pStream->GetChunk(1).Size, size_t{256});
+    EXPECT_EQ(pStream->GetChunk(2).Size, size_t{512});
+    for (Uint32 i = 0; i < pStream->GetChunkCount(); ++i)
+        EXPECT_LE(pStream->GetChunk(i).Size, size_t{4096});
+
+    EXPECT_EQ(GatherChunks(*pStream), Data);
+
+    // A large write is not split
+    const Uint32 NumChunks = pStream->GetChunkCount();
+    EXPECT_TRUE(pStream->Write(Data.data(), 10000));
+    EXPECT_LE(pStream->GetChunkCount(), NumChunks + 2);
+    EXPECT_EQ(pStream->GetSize(), Data.size() + 10000);
+}
+
+TEST(Common_ChunkedMemoryFileStream, ReadAndOverwrite)
+{
+    std::vector<Uint8> Data = GetTestData(10000);
+
+    RefCntAutoPtr<ChunkedMemoryFileStream> pStream = ChunkedMemoryFileStream::Create(100, 1000);
+    for (size_t Offset = 0; Offset < Data.size(); Offset += 10)
+        pStream->Write(&Data[Offset], 10);
+
+    // Read across chunk boundaries
+    EXPECT_TRUE(pStream->SetPos(50, static_cast<int>(FilePosOrigin::Start)));
+    std::vector<Uint8> ReadData(3000);
+    EXPECT_TRUE(pStream->Read(ReadData.data(), ReadData.size()));
+    EXPECT_TRUE(std::equal(ReadData.begin(), ReadData.end(), Data.begin() + 50));
+    EXPECT_EQ(pStream->GetPos(), size_t{3050});
+
+    // Reading past the end returns the remaining data
+    EXPECT_TRUE(pStream->SetPos(static_cast<size_t>(-100), static_cast<int>(FilePosOrigin::End)));
+    EXPECT_FALSE(pStream->Read(ReadData.data(), ReadData.size()));
+    EXPECT_TRUE(std::equal(ReadData.begin(), ReadData.begin() + 100, Data.end() - 100));
+
+    EXPECT_FALSE(pStream->SetPos(Data.size() + 1, static_cast<int>(FilePosOrigin::Start)));
+
+    // Overwrite across chunk boundaries and extend the stream
+    const std::vector<Uint8> NewData = GetTestData(500);
+    EXPECT_TRUE(pStream->SetPos(Data.size() - 200, static_cast<int>(FilePosOrigin::Start)));
+    EXPECT_TRUE(pStream->Write(NewData.data(), NewData.size()));
+    std::copy(NewData.begin(), NewData.begin() + 200, Data.end() - 200);
+    Data.insert(Data.end(), NewData.begin() + 200, NewData.end());
+
+    EXPECT_TRUE(pStream->SetPos(150, static_cast<int>(FilePosOrigin::Start)));
+    EXPECT_TRUE(pStream->Write(NewData.data(), NewData.size()));
+    std::copy(NewData.begin(), NewData.end(), Data.begin() + 150);
+
+    EXPECT_EQ(pStream->GetSize(), Data.size());
+    EXPECT_EQ(GatherChunks(*pStream), Data);
+
+    EXPECT_TRUE(pStream->SetPos(1000, static_cast<int>(FilePosOrigin::Start)));
+    RefCntAutoPtr<DataBlobImpl> pBlob = DataBlobImpl::Create();
+    pStream->ReadBlob(pBlob);
+    ASSERT_EQ(pBlob->GetSize(), Data.size() - 1000);
+    EXPECT_EQ(memcmp(pBlob->GetConstDataPtr(), &Data[1000], pBlob->GetSize()), 0);
+}
+
+TEST(Common_ChunkedMemoryFileStream, DetachDataAndWriteTo)
+{
+    const std::vector<Uint8> Data = GetTestData(5000);
+
+    RefCntAutoPtr<ChunkedMemoryFileStream> pStream = ChunkedMemoryFileStream::Create(64, 512);
+    for (size_t Offset = 0; Offset < Data.size(); Offset += 50)
+        pStream->Write(&Data[Offset], 50);
+    EXPECT_GT(pStream->GetChunkCount(), Uint32{1});
+
+    {
+        RefCntAutoPtr<DataBlobImpl>      pDstBlob   = DataBlobImpl::Create();
+        RefCntAutoPtr<MemoryFileStream> pDstStream = MemoryFileStream::Create(pDstBlob);
+        EXPECT_TRUE(pStream->WriteTo(pDstStream));
+        ASSERT_EQ(pDstBlob->GetSize(), Data.size());
+        EXPECT_EQ(memcmp(pDstBlob->GetConstDataPtr(), Data.data(), Data.size()), 0);
+    }
+
+    RefCntAutoPtr<IDataBlob> pFlat = pStream->DetachData();
+    ASSERT_TRUE(pFlat);
+    ASSERT_EQ(pFlat->GetSize(), Data.size());
+    EXPECT_EQ(memcmp(pFlat->GetConstDataPtr(), Data.data(), Data.size()), 0);
+
+    // The data is handed over to the blob and the stream is left empty
+    EXPECT_EQ(pStream->GetSize(), size_t{0});
+    EXPECT_EQ(pStream->GetChunkCount(), Uint32{0});
+
+    // Writing to the stream after the data is detached does not affect the returned blob
+    pStream->Write(&Data[100], 100);
+    EXPECT_EQ(pStream->GetSize(), size_t{100});
+    EXPECT_EQ(GatherChunks(*pStream), std::vector<Uint8>(Data.begin() + 100, Data.begin() + 200));
+    EXPECT_EQ(memcmp(pFlat->GetConstDataPtr(), Data.data(), Data.size()), 0);
+
+    // A single chunk is handed over without copying
+    RefCntAutoPtr<ChunkedMemoryFileStream> pStream2 = ChunkedMemoryFileStream::Create(64, 512);
+    pStream2->Write(Data.data(), 100);
+    ASSERT_EQ(pStream2->GetChunkCount(), Uint32{1});
+    const void*              pChunkData = pStream2->GetChunk(0).pData;
+    RefCntAutoPtr<IDataBlob> pFlat2     = pStream2->DetachData();
+    ASSERT_TRUE(pFlat2);
+    EXPECT_EQ(pFlat2->GetConstDataPtr(), pChunkData);
+    ASSERT_EQ(pFlat2->GetSize(), size_t{100});
+    EXPECT_EQ(pStream2->GetChunkCount(), Uint32{0});
+
+    pStream2->Write(Data.data() + 100, 100);
+    EXPECT_EQ(pStream2->GetSize(), size_t{100});
+    EXPECT_EQ(GatherChunks(*pStream2), std::vector<Uint8>(Data.begin() + 100, Data.begin() + 200));
+    EXPECT_EQ(memcmp(pFlat2->GetConstDataPtr(), Data.data(), 100), 0);
+
+    pStream2->Reset();
+    EXPECT_EQ(pStream2->GetSize(), size_t{0});
+    EXPECT_EQ(pStream2->GetChunkCount(), Uint32{0});
+
+    RefCntAutoPtr<IDataBlob> pEmpty = pStream2->DetachData();
+    ASSERT_TRUE(pEmpty);
+    EXPECT_EQ(pEmpty->GetSize(), size_t{0});
+}
+
+} // namespace
@@ -0,0 +1,133 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FilteringTools.hpp"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "FastRand.hpp"
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Compares the throughput of FilterTexture2DBilinearBatch with calling
+// FilterTexture2DBilinear for every sample.
+class FilteringToolsBenchmark
+{
+public:
+    static constexpr Uint32 TextureSize = 1024;
+    static constexpr size_t NumSamples  = size_t{1} << 20;
+    static constexpr Uint32 NumRuns     = 8;
+
+    FilteringToolsBenchmark() :
+        m_U(NumSamples),
+        m_V(NumSamples),
+        m_Samples(NumSamples)
+    {
+        FastRandFloat Rnd{0, -2, 2};
+        for (size_t i = 0; i < NumSamples; ++i)
+        {
+            m_U[i] = Rnd();
+            m_V[i] = Rnd();
+        }
+    }
+
+    // Returns the number of samples per second
+    template <typename SrcType, TEXTURE_ADDRESS_MODE AddressMode>
+    double RunScalar(const std::vector<SrcType>& Data)
+    {
+        const double Time = MeasureMinTime(NumRuns, [&]() {
+            for (size_t i = 0; i < NumSamples; ++i)
+            {
+                m_Samples[i] = FilterTexture2DBilinear<SrcType, float, AddressMode, AddressMode, true>(
+                    TextureSize, TextureSize, Data.data(), TextureSize, m_U[i], m_V[i]);
+            }
+        });
+        return GetRate(static_cast<double>(NumSamples), Time);
+    }
+
+    template <typename SrcType, TEXTURE_ADDRESS_MODE AddressMode>
+    double RunBatch(const std::vector<SrcType>& Data)
+    {
+        const double Time = MeasureMinTime(NumRuns, [&]() {
+            FilterTexture2DBilinearBatch<SrcType, float, AddressMode, AddressMode, true>(
+                TextureSize, TextureSize, Data.data(), TextureSize, m_U.data(), m_V.data(), NumSamples, m_Samples.data());
+        });
+
+        const float Ref = FilterTexture2DBilinear<SrcType, float, AddressMode, AddressMode, true>(
+            TextureSize, TextureSize, Data.data(), TextureSize, m_U[0], m_V[0]);
+        EXPECT_NEAR(m_Samples[0], Ref, 1e-3f);
+
+        return GetRate(static_cast<double>(NumSamples), Time);
+    }
+
+private:
+    std::vector<float> m_U;
+    std::vector<float> m_V;
+    std::vector<float> m_Samples;
+};
+
+template <typename SrcType, TEXTURE_ADDRESS_MODE AddressMode>
+void RunFilteringBenchmark(FilteringToolsBenchmark& Benchmark, BenchmarkTable& Table, const std::vector<SrcType>& Data, const char* Name)
+{
+    constexpr double M = 1e6;
+
+    const double ScalarRate = Benchmark.RunScalar<SrcType, AddressMode>(Data);
+    const double BatchRate  = Benchmark.RunBatch<SrcType, AddressMode>(Data);
+    Table.AddRow({Name, BenchmarkTable::Number(ScalarRate / M), BenchmarkTable::Number(BatchRate / M), BenchmarkTable::Ratio(BatchRate, ScalarRate)});
+}
+
+TEST(Common_FilteringToolsBenchmark, DISABLED_FilterTexture2DBilinearBatch)
+{
+    constexpr size_t NumTexels = size_t{FilteringToolsBenchmark::TextureSize} * FilteringToolsBenchmark::TextureSize;
+
+    FastRandFloat      Rnd{1, 0, 255};
+    std::vector<float> FloatData(NumTexels);
+    std::vector<Uint8> Uint8Data(NumTexels);
+    for (size_t i = 0; i < NumTexels; ++i)
+    {
+        FloatData[i] = Rnd();
+        Uint8Data[i] = static_cast<Uint8>(FloatData[i]);
+    }
+
+    FilteringToolsBenchmark Benchmark;
+
+    BenchmarkTable Table{"Bilinear sampling throughput, 1024x1024 texture, millions of samples per second", {"Texture", "Scalar", "Batch", "Ratio"}};
+    RunFilteringBenchmark<float, TEXTURE_ADDRESS_CLAMP>(Benchmark, Table, FloatData, "float, clamp");
+    RunFilteringBenchmark<float, TEXTURE_ADDRESS_WRAP>(Benchmark, Table, FloatData, "float, wrap");
+    RunFilteringBenchmark<float, TEXTURE_ADDRESS_MIRROR>(Benchmark, Table, FloatData, "float, mirror");
+    RunFilteringBenchmark<Uint8, TEXTURE_ADDRESS_CLAMP>(Benchmark, Table, Uint8Data, "uint8, clamp");
+    RunFilteringBenchmark<Uint8, TEXTURE_ADDRESS_WRAP>(Benchmark, Table, Uint8Data, "uint8, wrap");
+    Table.Print();
+}
+
+} // namespace
@@ -27,8 +27,13 @@
 
 #include "FilteringTools.hpp"
 
+#include <vector>
+#include <random>
+
 #include "gtest/gtest.h"
 
+#include "FastRand.hpp"
+
 using namespace Diligent;
 
 namespace Diligent
@@ -292,4 +297,121 @@ TEST(Common_FilteringTools, FilterTexture2DBilinear)
     }
 }
 
+template <TEXTURE_ADDRESS_MODE AddressMode, bool IsNormalizedCoord>
+void TestGetLinearTexFilterSampleInfoBatch(Uint32 Width, const std::vector<float>& Coords)
+{
+    const size_t       NumSamples = Coords.size();
+    std::vector<Int32> I0(NumSamples), I1(NumSamples);
+    std::vector<float> W(NumSamples);
+    GetLinearTexFilterSampleInfoBatch(AddressMode, IsNormalizedCoord, Width, Coords.data(), NumSamples, {I0.data(), I1.data(), W.data()});
+
+    for (size_t i = 0; i < NumSamples; ++i)
+    {
+        const LinearTexFilterSampleInfo RefSampleInfo = GetLinearTexFilterSampleInfo<AddressMode, IsNormalizedCoord>(Width, Coords[i]);
+        EXPECT_EQ(LinearTexFilterSampleInfo(I0[i], I1[i], W[i]), RefSampleInfo) << "u=" << Coords[i] << " width=" << Width;
+    }
+}
+
+template <TEXTURE_ADDRESS_MODE AddressMode>
+void TestGetLinearTexFilterSampleInfoBatch(Uint32 Width)
+{
+    // Use coordinates that are exactly representable so that results do not depend on the rounding
+    std::vector<float> Coords;
+    for (int k = -static_cast<int>(Width) * 3 * 16; k <= static_cast<int>(Width) * 3 * 16; ++k)
+        Coords.push_back(static_cast<float>(k) / 16.f);
+    TestGetLinearTexFilterSampleInfoBatch<AddressMode, false>(Width, Coords);
+
+    if ((Width & (Width - 1)) == 0)
+    {
+        for (float& u : Coords)
+            u /= static_cast<float>(Width);
+        TestGetLinearTexFilterSampleInfoBatch<AddressMode, true>(Width, Coords);
+    }
+}
+
+TEST(Common_FilteringTools, GetLinearTexFilterSampleInfoBatch)
+{
+    for (Uint32 Width : {1u, 2u, 3u, 7u, 8u, 100u, 128u})
+    {
+        TestGetLinearTexFilterSampleInfoBatch<TEXTURE_ADDRESS_CLAMP>(Width);
+        TestGetLinearTexFilterSampleInfoBatch<TEXTURE_ADDRESS_WRAP>(Width);
+        TestGetLinearTexFilterSampleInfoBatch<TEXTURE_ADDRESS_MIRROR>(Width);
+    }
+
+    // Coordinates inside the texture
+    std::vector<float> Coords;
+    for (int k = 8; k <= 16 * 128 - 8; ++k)
+        Coords.push_back(static_cast<float>(k) / 16.f);
+    TestGetLinearTexFilterSampleInfoBatch<TEXTURE_ADDRESS_UNKNOWN, false>(128, Coords);
+}
+
+template <TEXTURE_ADDRESS_MODE AddressMode>
+void TestGetLinearTexFilterSampleInfoBatchRandom(Uint32 Width, std::mt19937& Rnd)
+{
+    // Arbitrary coordinates are not exactly representable after scaling, so the batched
+    // version must round every operation the same way as the scalar one (e.g. no FMA).
+    constexpr size_t   NumSamples = 100003;
+    std::vector<float> Coords(NumSamples);
+
+    std::uniform_real_distribution<float> NormCoordDistr{-3.f, 3.f};
+    for (float& u : Coords)
+        u = NormCoordDistr(Rnd);
+    TestGetLinearTexFilterSampleInfoBatch<AddressMode, true>(Width, Coords);
+
+    const float                           MaxCoord = 3.f * static_cast<float>(Width);
+    std::uniform_real_distribution<float> CoordDistr{-MaxCoord, MaxCoord};
+    for (float& u : Coords)
+        u = CoordDistr(Rnd);
+    TestGetLinearTexFilterSampleInfoBatch<AddressMode, false>(Width, Coords);
+}
+
+TEST(Common_FilteringTools, GetLinearTexFilterSampleInfoBatchRandom)
+{
+    std::mt19937 Rnd{0};
+    for (Uint32 Width : {1u, 3u, 100u, 128u, 1000u, 4093u})
+    {
+        TestGetLinearTexFilterSampleInfoBatchRandom<TEXTURE_ADDRESS_CLAMP>(Width, Rnd);
+        TestGetLinearTexFilterSampleInfoBatchRandom<TEXTURE_ADDRESS_WRAP>(Width, Rnd);
+        TestGetLinearTexFilterSampleInfoBatchRandom<TEXTURE_ADDRESS_MIRROR>(Width, Rnd);
+    }
+}
+
+template <typename SrcType, TEXTURE_ADDRESS_MODE AddressModeU, TEXTURE_ADDRESS_MODE AddressModeV>
+void TestFilterTexture2DBilinearBatch(Uint32 Width, Uint32 Height, float MinCoord, float MaxCoord)
+{
+    const size_t Stride = size_t{Width} + 3;
+
+    FastRandFloat        Rnd{0, 0, 255};
+    std::vector<SrcType> Data(Stride * Height);
+    for (SrcType& Val : Data)
+        Val = static_cast<SrcType>(Rnd());
+
+    constexpr size_t   NumSamples = 1000;
+    FastRandFloat      RndCoord{1, MinCoord, MaxCoord};
+    std::vector<float> U(NumSamples), V(NumSamples);
+    for (size_t i = 0; i < NumSamples; ++i)
+    {
+        U[i] = RndCoord();
+        V[i] = RndCoord();
+    }
+
+    std::vector<float> Samples(NumSamples);
+    FilterTexture2DBilinearBatch<SrcType, float, AddressModeU, AddressModeV, true>(Width, Height, Data.data(), Stride, U.data(), V.data(), NumSamples, Samples.data());
+    for (size_t i = 0; i < NumSamples; ++i)
+    {
+        const float Ref = FilterTexture2DBilinear<SrcType, float, AddressModeU, AddressModeV, true>(Width, Height, Data.data(), Stride, U[i], V[i]);
+        EXPECT_NEAR(Samples[i], Ref, 1e-3f) << "u=" << U[i] << " v=" << V[i];
+    }
+}
+
+TEST(Common_FilteringTools, FilterTexture2DBilinearBatch)
+{
+    TestFilterTexture2DBilinearBatch<float, TEXTURE_ADDRESS_CLAMP, TEXTURE_ADDRESS_CLAMP>(64, 32, -0.5f, 1.5f);
+    TestFilterTexture2DBilinearBatch<float, TEXTURE_ADDRESS_WRAP, TEXTURE_ADDRESS_MIRROR>(64, 32, -2.5f, 2.5f);
+    TestFilterTexture2DBilinearBatch<float, TEXTURE_ADDRESS_MIRROR, TEXTURE_ADDRESS_WRAP>(37, 19, -2.5f, 2.5f);
+    TestFilterTexture2DBilinearBatch<float, TEXTURE_ADDRESS_UNKNOWN, TEXTURE_ADDRESS_UNKNOWN>(64, 64, 0.01f, 0.99f);
+    TestFilterTexture2DBilinearBatch<Uint8, TEXTURE_ADDRESS_CLAMP, TEXTURE_ADDRESS_WRAP>(100, 50, -1.5f, 1.5f);
+    TestFilterTexture2DBilinearBatch<Uint16, TEXTURE_ADDRESS_MIRROR, TEXTURE_ADDRESS_CLAMP>(16, 16, -1.5f, 1.5f);
+}
+
 } // namespace
@@ -0,0 +1,120 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FixedBlockMemoryAllocator.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Measures the allocation throughput of the fixed block allocator for 1 to N threads
+// and compares it with the default raw memory allocator.
+class FixedBlockAllocatorBenchmark
+{
+public:
+    static constexpr size_t BlockSize     = 96;
+    static constexpr Uint32 NumIterations = 2000;
+    static constexpr Uint32 BatchSize     = 64;
+
+    // Every thread repeatedly allocates a batch of blocks and releases them,
+    // which resembles creating and destroying a set of objects.
+    static double Run(IMemoryAllocator& Allocator, Uint32 NumThreads)
+    {
+        std::atomic<Uint32> NumReadyThreads{0};
+        std::atomic<bool>   Start{false};
+
+        std::vector<std::thread> Threads;
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back([&]() {
+                std::vector<void*> Blocks(BatchSize);
+
+                NumReadyThreads.fetch_add(1);
+                while (!Start.load())
+                    std::this_thread::yield();
+
+                for (Uint32 i = 0; i < NumIterations; ++i)
+                {
+                    for (void*& pBlock : Blocks)
+                    {
+                        pBlock                        = Allocator.Allocate(BlockSize, "Fixed block allocator benchmark", __FILE__, __LINE__);
+                        *static_cast<Uint32*>(pBlock) = i;
+                    }
+                    // Release the blocks in a different order
+                    for (size_t b = 0; b < Blocks.size(); b += 2)
+                        Allocator.Free(Blocks[b]);
+                    for (size_t b = 1; b < Blocks.size(); b += 2)
+                        Allocator.Free(Blocks[b]);
+                }
+            });
+        }
+
+        while (NumReadyThreads.load() < NumThreads)
+            std::this_thread::yield();
+
+        Timer T;
+        Start.store(true);
+        for (auto& Thread : Threads)
+            Thread.join();
+        const double ElapsedTime = T.GetElapsedTime();
+
+        return GetRate(static_cast<double>(NumThreads) * NumIterations * BatchSize, ElapsedTime);
+    }
+};
+
+TEST(Common_FixedBlockAllocatorBenchmark, DISABLED_Multithreaded)
+{
+    BenchmarkTable Table{"Fixed block allocator scaling (" + std::to_string(FixedBlockAllocatorBenchmark::BlockSize) + "-byte blocks, batches of " +
+                             std::to_string(FixedBlockAllocatorBenchmark::BatchSize) + ")",
+                         {"Threads", "Fixed block, allocs/s", "Default raw, allocs/s", "Ratio"}};
+    for (Uint32 NumThreads : GetBenchmarkThreadCounts())
+    {
+        double FixedBlockThroughput = 0;
+        {
+            FixedBlockMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), FixedBlockAllocatorBenchmark::BlockSize, 128};
+            FixedBlockThroughput = FixedBlockAllocatorBenchmark::Run(Allocator, NumThreads);
+        }
+        const double RawThroughput = FixedBlockAllocatorBenchmark::Run(DefaultRawMemoryAllocator::GetAllocator(), NumThreads);
+
+        Table.AddRow({std::to_string(NumThreads), BenchmarkTable::Number(FixedBlockThroughput), BenchmarkTable::Number(RawThroughput),
+                      BenchmarkTable::Ratio(FixedBlockThroughput, RawThroughput)});
+    }
+    Table.Print();
+}
+
+} // namespace
@@ -0,0 +1,157 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrameArena.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(Common_FrameArena, Checkpoint)
+{
+    FrameArena Arena{DefaultRawMemoryAllocator::GetAllocator(), 1024};
+
+    Uint32* pPersistent = Arena.ConstructArray<Uint32>(16, 7u);
+    ASSERT_NE(pPersistent, nullptr);
+    const size_t UsedSize = Arena.GetUsedSize();
+
+    void* pScratch = nullptr;
+    {
+        FrameArena::Checkpoint Scope{Arena};
+        pScratch = Arena.Allocate(256, 64);
+        ASSERT_NE(pScratch, nullptr);
+        EXPECT_EQ(reinterpret_cast<size_t>(pScratch) % 64, size_t{0});
+        {
+            FrameArena::Checkpoint InnerScope{Arena};
+            // Does not fit into the first block
+            double* pLarge = Arena.Allocate<double>(512);
+            ASSERT_NE(pLarge, nullptr);
+        }
+        EXPECT_EQ(Arena.Allocate(256, 64), static_cast<Uint8*>(pScratch) + 256);
+    }
+    EXPECT_EQ(Arena.GetUsedSize(), UsedSize);
+
+    {
+        FrameArena::Checkpoint Scope{Arena};
+        // Memory released by the checkpoint must be reused
+        EXPECT_EQ(Arena.Allocate(256, 64), pScratch);
+    }
+
+    for (size_t i = 0; i < 16; ++i)
+        EXPECT_EQ(pPersistent[i], 7u);
+
+    const FrameArenaStats Stats = Arena.GetStats();
+    EXPECT_GE(Stats.PeakSize, UsedSize + 256 + 512 * sizeof(double));
+    EXPECT_GE(Stats.ReservedSize, size_t{1024} + 512 * sizeof(double));
+}
+
+TEST(Common_FrameArena, EndFrame)
+{
+    FrameArena Arena{DefaultRawMemoryAllocator::GetAllocator(), 1024};
+
+    for (Uint32 Frame = 0; Frame < 4; ++Frame)
+    {
+        // Use more memory in even frames
+        const size_t Size = (Frame % 2 == 0) ? 4096 : 512;
+
+        Uint8* pData = Arena.Allocate<Uint8>(Size);
+        ASSERT_NE(pData, nullptr);
+        pData[Size - 1] = 1;
+
+        Arena.EndFrame();
+        EXPECT_EQ(Arena.GetUsedSize(), size_t{0});
+
+        const FrameArenaStats Stats = Arena.GetStats();
+        EXPECT_EQ(Stats.NumFrames, Uint64{Frame} + 1);
+        EXPECT_GE(Stats.LastFramePeakSize, Size);
+        EXPECT_LT(Stats.LastFramePeakSize, Size + 64);
+        EXPECT_GE(Stats.PeakSize, size_t{4096});
+    }
+
+    // Allocations made in an active checkpoint must not be released
+    {
+        FrameArena::Checkpoint Scope{Arena};
+        Uint32*                pData = Arena.ConstructArray<Uint32>(4, 5u);
+        Arena.EndFrame();
+        for (size_t i = 0; i < 4; ++i)
+            EXPECT_EQ(pData[i], 5u);
+    }
+    EXPECT_EQ(Arena.GetUsedSize(), size_t{0});
+}
+
+TEST(Common_FrameArena, ThreadArenas)
+{
+    constexpr Uint32 NumThreads = 4;
+
+    FrameArena* pMainArena = &FrameArena::GetThreadArena();
+    EXPECT_EQ(pMainArena, &FrameArena::GetThreadArena());
+
+    std::vector<FrameArena*> Arenas(NumThreads);
+    std::vector<std::thread> Threads(NumThreads);
+    for (Uint32 i = 0; i < NumThreads; ++i)
+    {
+        Threads[i] = std::thread{
+            [&Arenas, i]() {
+                FrameArena& Arena = FrameArena::GetThreadArena();
+                Arenas[i]         = &Arena;
+                {
+                    FrameArena::Checkpoint Scope{Arena};
+                    Uint32*                pData = Arena.ConstructArray<Uint32>(1024, i);
+                    for (size_t j = 0; j < 1024; ++j)
+                        EXPECT_EQ(pData[j], i);
+                }
+                Arena.EndFrame();
+            }};
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    for (Uint32 i = 0; i < NumThreads; ++i)
+    {
+        EXPECT_NE(Arenas[i], pMainArena);
+        for (Uint32 j = i + 1; j < NumThreads; ++j)
+            EXPECT_NE(Arenas[i], Arenas[j]);
+    }
+
+    {
+        FrameArena::Checkpoint Scope{*pMainArena};
+        Uint32*                pData = pMainArena->Allocate<Uint32>(256);
+        ASSERT_NE(pData, nullptr);
+    }
+    // Thread arenas are destroyed when their threads exit, so only the main thread's arena is left
+    const FrameArenaStats Stats = FrameArena::GetThreadArenasStats();
+    EXPECT_GE(Stats.PeakSize, 256 * sizeof(Uint32));
+    EXPECT_EQ(Stats.ReservedSize, pMainArena->GetStats().ReservedSize);
+}
+
+} // namespace
@@ -0,0 +1,142 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrustumCulling.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "FastRand.hpp"
+#include "ThreadPool.hpp"
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Compares the throughput of GetBoxesVisibility with calling GetBoxVisibility for every box.
+class FrustumCullingBenchmark
+{
+public:
+    static constexpr size_t NumBoxes   = 500000;
+    static constexpr Uint32 NumRuns    = 8;
+
+    FrustumCullingBenchmark() :
+        m_Boxes(NumBoxes),
+        m_Coords(6, std::vector<float>(NumBoxes)),
+        m_VisibleMask((NumBoxes + 31) / 32)
+    {
+        const float4x4 ViewProj = float4x4::Translation(0, 0, 5) * float4x4::Projection(PI_F / 3.f, 1.5f, 1.f, 100.f, false);
+        ExtractViewFrustumPlanesFromMatrix(ViewProj, m_Frustum, false);
+
+        FastRandFloat Rnd{0, -100, 100};
+        for (size_t i = 0; i < NumBoxes; ++i)
+        {
+            const float3 Center{Rnd(), Rnd(), Rnd()};
+            const float3 HalfSize = float3{1, 1, 1} + abs(float3{Rnd(), Rnd(), Rnd()}) * 0.02f;
+
+            m_Boxes[i] = BoundBox{Center - HalfSize, Center + HalfSize};
+            for (int c = 0; c < 3; ++c)
+            {
+                m_Coords[c][i]     = m_Boxes[i].Min[c];
+                m_Coords[3 + c][i] = m_Boxes[i].Max[c];
+            }
+        }
+
+        m_BoxesSoA.pMinX    = m_Coords[0].data();
+        m_BoxesSoA.pMinY    = m_Coords[1].data();
+        m_BoxesSoA.pMinZ    = m_Coords[2].data();
+        m_BoxesSoA.pMaxX    = m_Coords[3].data();
+        m_BoxesSoA.pMaxY    = m_Coords[4].data();
+        m_BoxesSoA.pMaxZ    = m_Coords[5].data();
+        m_BoxesSoA.NumBoxes = NumBoxes;
+    }
+
+    // Returns the number of boxes per second
+    double RunScalar()
+    {
+        const double Time = MeasureMinTime(NumRuns, [&]() {
+            for (size_t i = 0; i < NumBoxes; i += 32)
+            {
+                Uint32 VisibleBits = 0;
+                for (size_t j = i; j < std::min(i + 32, NumBoxes); ++j)
+                {
+                    if (GetBoxVisibility(m_Frustum, m_Boxes[j]) != BoxVisibility::Invisible)
+                        VisibleBits |= 1u << (j - i);
+                }
+                m_VisibleMask[i / 32] = VisibleBits;
+            }
+        });
+        return GetRate(static_cast<double>(NumBoxes), Time);
+    }
+
+    double RunBatch(IThreadPool* pThreadPool)
+    {
+        const Uint32 RefBits = m_VisibleMask[0];
+
+        const double Time = MeasureMinTime(NumRuns, [&]() {
+            GetBoxesVisibility(m_Frustum, m_BoxesSoA, m_VisibleMask.data(), nullptr, FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, pThreadPool);
+        });
+
+        EXPECT_EQ(m_VisibleMask[0], RefBits);
+
+        return GetRate(static_cast<double>(NumBoxes), Time);
+    }
+
+private:
+    ViewFrustum m_Frustum;
+
+    std::vector<BoundBox>           m_Boxes;
+    std::vector<std::vector<float>> m_Coords;
+    BoundBoxesSoA                   m_BoxesSoA;
+
+    std::vector<Uint32> m_VisibleMask;
+};
+
+TEST(Common_FrustumCullingBenchmark, DISABLED_GetBoxesVisibility)
+{
+    constexpr double M = 1e6;
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_TRUE(pThreadPool);
+
+    FrustumCullingBenchmark Benchmark;
+
+    const double ScalarRate  = Benchmark.RunScalar();
+    const double BatchRate   = Benchmark.RunBatch(nullptr);
+    const double BatchMTRate = Benchmark.RunBatch(pThreadPool);
+
+    BenchmarkTable Table{"AABB frustum culling throughput, 500K boxes, millions of boxes per second", {"Scalar", "Batch", "Ratio", "Batch, 4 threads", "Ratio"}};
+    Table.AddRow({BenchmarkTable::Number(ScalarRate / M), BenchmarkTable::Number(BatchRate / M), BenchmarkTable::Ratio(BatchRate, ScalarRate),
+                  BenchmarkTable::Number(BatchMTRate / M), BenchmarkTable::Ratio(BatchMTRate, ScalarRate)});
+    Table.Print();
+}
+
+} // namespace
@@ -0,0 +1,224 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrustumCulling.hpp"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "FastRand.hpp"
+#include "ThreadPool.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+ViewFrustumExt MakeTestFrustum()
+{
+    const float4x4 ViewProj = float4x4::RotationY(0.3f) * float4x4::RotationX(-0.2f) * float4x4::Translation(1, -2, 3) *
+        float4x4::Projection(PI_F / 3.f, 1.5f, 1.f, 100.f, false);
+
+    ViewFrustumExt Frustum;
+    ExtractViewFrustumPlanesFromMatrix(ViewProj, Frustum, false);
+    return Frustum;
+}
+
+// Random boxes around the frustum, many of them intersecting the frustum planes
+class TestBoxes
+{
+public:
+    TestBoxes(size_t NumBoxes, unsigned int Seed) :
+        m_Data(21, std::vector<float>(NumBoxes))
+    {
+        FastRandFloat RndPos{Seed, -60.f, 60.f};
+        FastRandFloat RndSize{Seed + 1, 0.01f, 10.f};
+        FastRandFloat RndAngle{Seed + 2, -PI_F, PI_F};
+
+        for (size_t i = 0; i < NumBoxes; ++i)
+        {
+            const float3 Center{RndPos(), RndPos(), RndPos() + 50.f};
+            const float3 HalfSize{RndSize(), RndSize(), RndSize()};
+
+            BoundBox BB{Center - HalfSize, Center + HalfSize};
+
+            OrientedBoundingBox OBB;
+            OBB.Center = Center;
+
+            const float4x4 Rotation = float4x4::RotationArbitrary(normalize(float3{RndPos(), RndPos(), RndPos()} + float3{0, 0, 0.1f}), RndAngle());
+            for (int a = 0; a < 3; ++a)
+            {
+                OBB.Axes[a]        = float3::MakeVector(Rotation[a]);
+                OBB.HalfExtents[a] = HalfSize[a];
+            }
+
+            m_AABBs.push_back(BB);
+            m_OBBs.push_back(OBB);
+
+            m_Data[0][i] = BB.Min.x;
+            m_Data[1][i] = BB.Min.y;
+            m_Data[2][i] = BB.Min.z;
+            m_Data[3][i] = BB.Max.x;
+            m_Data[4][i] = BB.Max.y;
+            m_Data[5][i] = BB.Max.z;
+            for (int c = 0; c < 3; ++c)
+            {
+                m_Data[6 + c][i] = OBB.Center[c];
+                for (int a = 0; a < 3; ++a)
+                    m_Data[9 + a * 3 + c][i] = OBB.Axes[a][c];
+                m_Data[18 + c][i] = OBB.HalfExtents[c];
+            }
+        }
+
+        m_AABBsSoA.pMinX    = m_Data[0].data();
+        m_AABBsSoA.pMinY    = m_Data[1].data();
+        m_AABBsSoA.pMinZ    = m_Data[2].data();
+        m_AABBsSoA.pMaxX    = m_Data[3].data();
+        m_AABBsSoA.pMaxY    = m_Data[4].data();
+        m_AABBsSoA.pMaxZ    = m_Data[5].data();
+        m_AABBsSoA.NumBoxes = NumBoxes;
+
+        m_OBBsSoA.pCenterX = m_Data[6].data();
+        m_OBBsSoA.pCenterY = m_Data[7].data();
+        m_OBBsSoA.pCenterZ = m_Data[8].data();
+        for (int a = 0; a < 3; ++a)
+        {
+            for (int c = 0; c < 3; ++c)
+                m_OBBsSoA.pAxes[a][c] = m_Data[9 + a * 3 + c].data();
+            m_OBBsSoA.pHalfExtents[a] = m_Data[18 + a].data();
+        }
+        m_OBBsSoA.NumBoxes = NumBoxes;
+    }
+
+    const std::vector<BoundBox>&            GetAABBs() const { return m_AABBs; }
+    const std::vector<OrientedBoundingBox>& GetOBBs() const { return m_OBBs; }
+    const BoundBoxesSoA&                    GetAABBsSoA() const { return m_AABBsSoA; }
+    const OrientedBoundingBoxesSoA&         GetOBBsSoA() const { return m_OBBsSoA; }
+
+private:
+    std::vector<std::vector<float>> m_Data;
+
+    std::vector<BoundBox>            m_AABBs;
+    std::vector<OrientedBoundingBox> m_OBBs;
+
+    BoundBoxesSoA            m_AABBsSoA;
+    OrientedBoundingBoxesSoA m_OBBsSoA;
+};
+
+bool IsBitSet(const std::vector<Uint32>& Mask, size_t Idx)
+{
+    return (Mask[Idx / 32] & (1u << (Idx % 32))) != 0;
+}
+
+template <typename FrustumType, typename BoxType, typename BoxesSoAType>
+void TestBoxesVisibility(const FrustumType&          Frustum,
+                         const std::vector<BoxType>& Boxes,
+                         const BoxesSoAType&         BoxesSoA,
+                         FRUSTUM_PLANE_FLAGS         PlaneFlags,
+                         IThreadPool*                pThreadPool = nullptr)
+{
+    const size_t NumWords = (Boxes.size() + 31) / 32;
+
+    // Fill the masks with garbage to check that all bits are written
+    std::vector<Uint32> VisibleMask(NumWords + 1, 0xDEADBEEF);
+    std::vector<Uint32> FullyVisibleMask(NumWords + 1, 0xDEADBEEF);
+    GetBoxesVisibility(Frustum, BoxesSoA, VisibleMask.data(), FullyVisibleMask.data(), PlaneFlags, pThreadPool);
+
+    size_t NumVisible = 0;
+    for (size_t i = 0; i < Boxes.size(); ++i)
+    {
+        const BoxVisibility RefVisibility = GetBoxVisibility(Frustum, Boxes[i], PlaneFlags);
+        EXPECT_EQ(IsBitSet(VisibleMask, i), RefVisibility != BoxVisibility::Invisible) << "Box " << i;
+        EXPECT_EQ(IsBitSet(FullyVisibleMask, i), RefVisibility == BoxVisibility::FullyVisible) << "Box " << i;
+        NumVisible += RefVisibility != BoxVisibility::Invisible ? 1 : 0;
+    }
+    // Bits past the last box must be zero
+    for (size_t i = Boxes.size(); i < NumWords * 32; ++i)
+    {
+        EXPECT_FALSE(IsBitSet(VisibleMask, i));
+        EXPECT_FALSE(IsBitSet(FullyVisibleMask, i));
+    }
+    // Words past the end must not be touched
+    EXPECT_EQ(VisibleMask[NumWords], 0xDEADBEEF);
+    EXPECT_EQ(FullyVisibleMask[NumWords], 0xDEADBEEF);
+
+    // The fully visible mask is optional
+    std::vector<Uint32> VisibleMask2(NumWords);
+    GetBoxesVisibility(Frustum, BoxesSoA, VisibleMask2.data(), nullptr, PlaneFlags, pThreadPool);
+    VisibleMask.pop_back();
+    EXPECT_EQ(VisibleMask2, VisibleMask);
+
+    if (Boxes.size() > 100 && PlaneFlags != FRUSTUM_PLANE_FLAG_NONE)
+    {
+        // Make sure the test data covers all cases
+        EXPECT_GT(NumVisible, size_t{0});
+        EXPECT_LT(NumVisible, Boxes.size());
+    }
+}
+
+TEST(Common_FrustumCulling, AABBs)
+{
+    const ViewFrustumExt Frustum = MakeTestFrustum();
+    for (size_t NumBoxes : {0, 1, 7, 31, 32, 33, 64, 100, 4099})
+    {
+        const TestBoxes Boxes{NumBoxes, static_cast<unsigned int>(NumBoxes)};
+        for (FRUSTUM_PLANE_FLAGS PlaneFlags : {FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, FRUSTUM_PLANE_FLAG_OPEN_NEAR, FRUSTUM_PLANE_FLAG_LEFT_PLANE | FRUSTUM_PLANE_FLAG_TOP_PLANE, FRUSTUM_PLANE_FLAG_NONE})
+        {
+            TestBoxesVisibility(static_cast<const ViewFrustum&>(Frustum), Boxes.GetAABBs(), Boxes.GetAABBsSoA(), PlaneFlags);
+            TestBoxesVisibility(Frustum, Boxes.GetAABBs(), Boxes.GetAABBsSoA(), PlaneFlags);
+        }
+    }
+}
+
+TEST(Common_FrustumCulling, OBBs)
+{
+    const ViewFrustumExt Frustum = MakeTestFrustum();
+    for (size_t NumBoxes : {0, 1, 7, 31, 32, 33, 64, 100, 4099})
+    {
+        const TestBoxes Boxes{NumBoxes, static_cast<unsigned int>(NumBoxes) + 100};
+        for (FRUSTUM_PLANE_FLAGS PlaneFlags : {FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, FRUSTUM_PLANE_FLAG_OPEN_NEAR, FRUSTUM_PLANE_FLAG_LEFT_PLANE | FRUSTUM_PLANE_FLAG_TOP_PLANE, FRUSTUM_PLANE_FLAG_NONE})
+        {
+            TestBoxesVisibility(static_cast<const ViewFrustum&>(Frustum), Boxes.GetOBBs(), Boxes.GetOBBsSoA(), PlaneFlags);
+            TestBoxesVisibility(Frustum, Boxes.GetOBBs(), Boxes.GetOBBsSoA(), PlaneFlags);
+        }
+    }
+}
+
+TEST(Common_FrustumCulling, ThreadPool)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_TRUE(pThreadPool);
+
+    const ViewFrustumExt Frustum = MakeTestFrustum();
+    const TestBoxes      Boxes{100005, 0};
+    TestBoxesVisibility(static_cast<const ViewFrustum&>(Frustum), Boxes.GetAABBs(), Boxes.GetAABBsSoA(), FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, pThreadPool);
+    TestBoxesVisibility(Frustum, Boxes.GetAABBs(), Boxes.GetAABBsSoA(), FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, pThreadPool);
+    TestBoxesVisibility(static_cast<const ViewFrustum&>(Frustum), Boxes.GetOBBs(), Boxes.GetOBBsSoA(), FRUSTUM_PLANE_FLAG_OPEN_NEAR, pThreadPool);
+    TestBoxesVisibility(Frustum, Boxes.GetOBBs(), Boxes.GetOBBsSoA(), FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, pThreadPool);
+}
+
+} // namespace
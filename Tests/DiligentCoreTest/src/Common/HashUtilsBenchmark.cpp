@@ -0,0 +1,122 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "HashUtils.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Measures the throughput of ComputeHashRaw for different input sizes and compares it
+// with the previous implementation that called HashCombine once per 32-bit word.
+class HashUtilsBenchmark
+{
+public:
+    // Total number of bytes hashed for every input size
+    static constexpr size_t BytesPerRun = size_t{64} << 20;
+
+    // The previous implementation of ComputeHashRaw (aligned input only)
+    static size_t HashCombineRaw(const void* pData, size_t Size) noexcept
+    {
+        size_t        Hash     = 0;
+        const Uint32* DwordPtr = static_cast<const Uint32*>(pData);
+        const Uint32* EndPtr   = DwordPtr + Size / sizeof(Uint32);
+        while (DwordPtr < EndPtr)
+            HashCombine(Hash, *(DwordPtr++));
+        return Hash;
+    }
+
+    // Returns the throughput in bytes per second
+    template <typename HashFuncType>
+    static double Run(const std::vector<Uint8>& Data, size_t InputSize, HashFuncType&& HashFunc)
+    {
+        const size_t NumInputs   = Data.size() / InputSize;
+        const size_t NumRepeats  = std::max(BytesPerRun / Data.size(), size_t{1});
+        size_t       Accumulated = 0;
+
+        Timer T;
+        for (size_t r = 0; r < NumRepeats; ++r)
+        {
+            for (size_t i = 0; i < NumInputs; ++i)
+                Accumulated += HashFunc(&Data[i * InputSize], InputSize);
+        }
+        const double ElapsedTime = T.GetElapsedTime();
+
+        // Prevent the compiler from optimizing the loop away
+        EXPECT_NE(Accumulated, size_t{0});
+
+        return GetRate(static_cast<double>(NumRepeats * NumInputs * InputSize), ElapsedTime);
+    }
+
+    // Returns the throughput of the strided batch function in bytes per second
+    static double RunBatch(const std::vector<Uint8>& Data, size_t InputSize)
+    {
+        const size_t        NumInputs  = Data.size() / InputSize;
+        const size_t        NumRepeats = std::max(BytesPerRun / Data.size(), size_t{1});
+        std::vector<Uint64> Hashes(NumInputs);
+
+        Timer T;
+        for (size_t r = 0; r < NumRepeats; ++r)
+            ComputeHashRawBatch(Data.data(), InputSize, InputSize, NumInputs, Hashes.data());
+        const double ElapsedTime = T.GetElapsedTime();
+
+        EXPECT_EQ(Hashes[NumInputs - 1], ComputeHashRaw64(&Data[(NumInputs - 1) * InputSize], InputSize));
+
+        return GetRate(static_cast<double>(NumRepeats * NumInputs * InputSize), ElapsedTime);
+    }
+};
+
+TEST(Common_HashUtilsBenchmark, DISABLED_ComputeHashRaw)
+{
+    std::vector<Uint8> Data(size_t{4} << 20);
+    for (size_t i = 0; i < Data.size(); ++i)
+        Data[i] = static_cast<Uint8>((i * 2654435761u) >> 13);
+
+    constexpr double MB = 1 << 20;
+    BenchmarkTable Table{"Raw memory hashing throughput, MB/s", {"Input size", "HashCombine", "ComputeHashRaw", "Batch", "Ratio"}};
+    for (size_t InputSize : {size_t{8}, size_t{16}, size_t{64}, size_t{256}, size_t{4} << 10, size_t{1} << 20})
+    {
+        const double CombineThroughput = HashUtilsBenchmark::Run(Data, InputSize, HashUtilsBenchmark::HashCombineRaw);
+        const double RawThroughput     = HashUtilsBenchmark::Run(Data, InputSize, ComputeHashRaw);
+        const double BatchThroughput   = HashUtilsBenchmark::RunBatch(Data, InputSize);
+
+        Table.AddRow({std::to_string(InputSize), BenchmarkTable::Number(CombineThroughput / MB), BenchmarkTable::Number(RawThroughput / MB),
+                      BenchmarkTable::Number(BatchThroughput / MB), BenchmarkTable::Ratio(RawThroughput, CombineThroughput)});
+    }
+    Table.Print();
+}
+
+} // namespace
@@ -187,6 +187,75 @@ TEST(Common_HashUtils, ComputeHashRaw)
 }
 
 
+TEST(Common_HashUtils, ComputeHashRaw64)
+{
+    // Reference values of the XXH3 algorithm
+    EXPECT_EQ(ComputeHashRaw64("", 0), Uint64{0x2D06800538D394C2ull});
+    EXPECT_EQ(ComputeHashRaw64("abc", 3), Uint64{0x78AF5F94892F3950ull});
+    EXPECT_EQ(ComputeHashRaw64("", 0, 1), Uint64{0x4DC5B0CC826F6703ull});
+
+    std::vector<Uint8> Data(1024);
+    for (size_t i = 0; i < Data.size(); ++i)
+        Data[i] = static_cast<Uint8>(i * 7 + 3);
+
+    // Test all size classes: 0-16, 17-128, 129-240 bytes and the long input path
+    std::unordered_set<Uint64> Hashes;
+    for (size_t size = 0; size <= 300; ++size)
+    {
+        const Uint64 Hash     = ComputeHashRaw64(Data.data(), size);
+        const auto   inserted = Hashes.insert(Hash).second;
+        EXPECT_TRUE(inserted) << size;
+        EXPECT_NE(ComputeHashRaw64(Data.data(), size, 1), Hash) << size;
+
+        // Changing any byte must change the hash
+        for (size_t i = 0; i < size; ++i)
+        {
+            Data[i] ^= 0x10;
+            EXPECT_NE(ComputeHashRaw64(Data.data(), size), Hash) << size << " " << i;
+            Data[i] ^= 0x10;
+        }
+    }
+}
+
+TEST(Common_HashUtils, ComputeHashRawBatch)
+{
+    constexpr size_t Stride  = 128;
+    constexpr size_t NumKeys = 300;
+    constexpr Uint64 Seed    = 123;
+
+    std::vector<Uint8> Data(Stride * NumKeys);
+    for (size_t i = 0; i < Data.size(); ++i)
+        Data[i] = static_cast<Uint8>(i * 13 + 1);
+
+    std::vector<Uint64> Hashes(NumKeys);
+    // Sizes with a specialized code path and a few others
+    for (size_t KeySize : {1, 4, 8, 12, 16, 20, 32, 64, 100})
+    {
+        ComputeHashRawBatch(Data.data(), KeySize, Stride, NumKeys, Hashes.data());
+        for (size_t i = 0; i < NumKeys; ++i)
+            EXPECT_EQ(Hashes[i], ComputeHashRaw64(&Data[i * Stride], KeySize)) << "Key size: " << KeySize << ", key: " << i;
+
+        ComputeHashRawBatch(Data.data(), KeySize, Stride, NumKeys, Hashes.data(), Seed);
+        for (size_t i = 0; i < NumKeys; ++i)
+            EXPECT_EQ(Hashes[i], ComputeHashRaw64(&Data[i * Stride], KeySize, Seed)) << "Key size: " << KeySize << ", key: " << i;
+    }
+
+    // Keys of all XXH3 size classes
+    std::vector<const void*> Keys(NumKeys);
+    std::vector<size_t>      Sizes(NumKeys);
+    for (size_t i = 0; i < NumKeys; ++i)
+    {
+        Keys[i]  = &Data[i];
+        Sizes[i] = i;
+    }
+    ComputeHashRawBatch(Keys.data(), Sizes.data(), NumKeys, Hashes.data(), Seed);
+    for (size_t i = 0; i < NumKeys; ++i)
+        EXPECT_EQ(Hashes[i], ComputeHashRaw64(&Data[i], i, Seed)) << i;
+
+    ComputeHashRawBatch(nullptr, 16, Stride, 0, nullptr);
+    ComputeHashRawBatch(nullptr, nullptr, 0, nullptr);
+}
+
 template <typename Type>
 class StdHasherTestHelper
 {
@@ -25,11 +25,14 @@
  */
 
 #include "ImageTools.h"
+#include "ThreadPool.hpp"
+#include "FastRand.hpp"
 
 #include <cmath>
 
 #include "gtest/gtest.h"
 #include <array>
+#include <vector>
 
 using namespace Diligent;
 
@@ -85,6 +88,8 @@ TEST(Common_ImageTools, ComputeImageDifference)
         EXPECT_EQ(Diff.MaxDiff, 0u);
         EXPECT_EQ(Diff.AvgDiff, 0.f);
         EXPECT_EQ(Diff.RmsDiff, 0.f);
+        EXPECT_TRUE(std::isinf(Diff.PSNR));
+        EXPECT_EQ(Diff.SSIM, 1.f);
 
         constexpr std::array<Uint8, Width * Height * 3> RefDiffImage{};
 
@@ -115,6 +120,10 @@ TEST(Common_ImageTools, ComputeImageDifference)
         EXPECT_EQ(Diff.MaxDiff, 5u);
         EXPECT_FLOAT_EQ(Diff.AvgDiff, 4.f);
         EXPECT_FLOAT_EQ(Diff.RmsDiff, std::sqrt((9.f + 16.f + 25.f) / 3.f));
+        // Sum of squared channel differences is 96 over 18 samples
+        EXPECT_FLOAT_EQ(Diff.PSNR, static_cast<float>(10.0 * std::log10(255.0 * 255.0 * 18.0 / 96.0)));
+        EXPECT_GT(Diff.SSIM, 0.f);
+        EXPECT_LT(Diff.SSIM, 1.f);
 
 
         // clang-format off
@@ -243,4 +252,216 @@ TEST(Common_ImageTools, ComputeImageDifference)
     }
 }
 
+template <typename T>
+std::vector<T> ConvertImage(const std::vector<Uint8>& Src, float Scale)
+{
+    std::vector<T> Dst(Src.size());
+    for (size_t i = 0; i < Src.size(); ++i)
+        Dst[i] = static_cast<T>(Src[i] * Scale);
+    return Dst;
+}
+
+TEST(Common_ImageTools, ComputeImageDifferenceComponentTypes)
+{
+    constexpr Uint32 Width       = 37;
+    constexpr Uint32 Height      = 19;
+    constexpr Uint32 NumChannels = 3;
+
+    std::vector<Uint8> Image1(Width * Height * NumChannels);
+    std::vector<Uint8> Image2(Width * Height * NumChannels);
+    FastRandInt        Rnd{2, 0, 255};
+    for (size_t i = 0; i < Image1.size(); ++i)
+    {
+        Image1[i] = static_cast<Uint8>(Rnd());
+        Image2[i] = (i % 5 == 0) ? static_cast<Uint8>(Rnd()) : Image1[i];
+        // Float rounding may move differences that are equal to the threshold to either side
+        if (std::abs(Image1[i] - Image2[i]) == 100)
+            Image2[i] ^= 1;
+    }
+
+    auto Compute = [&](const void* pImage1, const void* pImage2, VALUE_TYPE ComponentType, Uint32 ComponentSize) {
+        ComputeImageDifferenceAttribs Attribs;
+        Attribs.Width         = Width;
+        Attribs.Height        = Height;
+        Attribs.pImage1       = pImage1;
+        Attribs.NumChannels1  = NumChannels;
+        Attribs.Stride1       = Width * NumChannels * ComponentSize;
+        Attribs.pImage2       = pImage2;
+        Attribs.NumChannels2  = NumChannels;
+        Attribs.Stride2       = Width * NumChannels * ComponentSize;
+        Attribs.Threshold     = 100;
+        Attribs.ComponentType = ComponentType;
+
+        ImageDiffInfo Diff;
+        ComputeImageDifference(Attribs, Diff);
+        return Diff;
+    };
+
+    const ImageDiffInfo RefDiff = Compute(Image1.data(), Image2.data(), VT_UINT8, 1);
+    EXPECT_GT(RefDiff.NumDiffPixels, 0u);
+    EXPECT_GT(RefDiff.NumDiffPixelsAboveThreshold, 0u);
+    EXPECT_LT(RefDiff.SSIM, 1.f);
+
+    {
+        // 16-bit values scaled by 257 map the 8-bit range to the full 16-bit range,
+        // so the PSNR and the SSIM must not change.
+        const std::vector<Uint16> Image1U16 = ConvertImage<Uint16>(Image1, 257);
+        const std::vector<Uint16> Image2U16 = ConvertImage<Uint16>(Image2, 257);
+
+        const ImageDiffInfo Diff = Compute(Image1U16.data(), Image2U16.data(), VT_UINT16, 2);
+        EXPECT_EQ(Diff.NumDiffPixels, RefDiff.NumDiffPixels);
+        EXPECT_EQ(Diff.MaxDiff, RefDiff.MaxDiff * 257);
+        EXPECT_FLOAT_EQ(Diff.AvgDiff, RefDiff.AvgDiff * 257);
+        EXPECT_NEAR(Diff.PSNR, RefDiff.PSNR, 1e-3f);
+        EXPECT_NEAR(Diff.SSIM, RefDiff.SSIM, 1e-4f);
+    }
+
+    {
+        // Float components are compared in 1/255 units
+        const std::vector<float> Image1F = ConvertImage<float>(Image1, 1.f / 255.f);
+        const std::vector<float> Image2F = ConvertImage<float>(Image2, 1.f / 255.f);
+
+        const ImageDiffInfo Diff = Compute(Image1F.data(), Image2F.data(), VT_FLOAT32, 4);
+        EXPECT_EQ(Diff.NumDiffPixels, RefDiff.NumDiffPixels);
+        EXPECT_EQ(Diff.NumDiffPixelsAboveThreshold, RefDiff.NumDiffPixelsAboveThreshold);
+        EXPECT_EQ(Diff.MaxDiff, RefDiff.MaxDiff);
+        EXPECT_NEAR(Diff.AvgDiff, RefDiff.AvgDiff, 1e-3f);
+        EXPECT_NEAR(Diff.RmsDiff, RefDiff.RmsDiff, 1e-3f);
+        EXPECT_NEAR(Diff.PSNR, RefDiff.PSNR, 1e-3f);
+        EXPECT_NEAR(Diff.SSIM, RefDiff.SSIM, 1e-4f);
+    }
+}
+
+// Compares the vectorized 8-bit path, the generic path and the multithreaded execution
+TEST(Common_ImageTools, ComputeImageDifferenceLarge)
+{
+    constexpr Uint32 Width  = 1031;
+    constexpr Uint32 Height = 263;
+
+    std::vector<Uint8> Image1(Width * Height * 4);
+    std::vector<Uint8> Image2(Width * Height * 4);
+    FastRandInt        Rnd{1, 0, 255};
+    for (size_t i = 0; i < Image1.size(); ++i)
+    {
+        Image1[i] = static_cast<Uint8>(Rnd());
+        Image2[i] = static_cast<Uint8>(std::min(std::max(Image1[i] + (Rnd() % 16) - 8, 0), 255));
+    }
+
+    // Brute-force reference values
+    Uint32 RefNumDiffPixels = 0;
+    Uint32 RefMaxDiff       = 0;
+    double RefSumDiff       = 0;
+    double RefSumSqErr      = 0;
+    for (size_t i = 0; i < size_t{Width} * Height; ++i)
+    {
+        Uint32 PixelDiff = 0;
+        for (size_t ch = 0; ch < 4; ++ch)
+        {
+            const Uint32 Diff = static_cast<Uint32>(std::abs(Image1[i * 4 + ch] - Image2[i * 4 + ch]));
+            PixelDiff         = std::max(PixelDiff, Diff);
+            RefSumSqErr += Diff * Diff;
+        }
+        if (PixelDiff != 0)
+        {
+            ++RefNumDiffPixels;
+            RefSumDiff += PixelDiff;
+            RefMaxDiff = std::max(RefMaxDiff, PixelDiff);
+        }
+    }
+    const float RefPSNR = static_cast<float>(10.0 * std::log10(255.0 * 255.0 * Width * Height * 4 / RefSumSqErr));
+
+    std::vector<Uint8> RefDiffImage(Width * Height * 4);
+
+    ComputeImageDifferenceAttribs Attribs;
+    Attribs.Width        = Width;
+    Attribs.Height       = Height;
+    Attribs.pImage1      = Image1.data();
+    Attribs.NumChannels1 = 4;
+    Attribs.Stride1      = Width * 4;
+    Attribs.pImage2      = Image2.data();
+    Attribs.NumChannels2 = 4;
+    Attribs.Stride2      = Width * 4;
+    Attribs.pDiffImage   = RefDiffImage.data();
+    Attribs.DiffStride   = Width * 4;
+    Attribs.Threshold    = 4;
+
+    ImageDiffInfo RefDiff;
+    ComputeImageDifference(Attribs, RefDiff);
+    EXPECT_EQ(RefDiff.NumDiffPixels, RefNumDiffPixels);
+    EXPECT_EQ(RefDiff.MaxDiff, RefMaxDiff);
+    EXPECT_FLOAT_EQ(RefDiff.AvgDiff, static_cast<float>(RefSumDiff / RefNumDiffPixels));
+    EXPECT_FLOAT_EQ(RefDiff.PSNR, RefPSNR);
+    EXPECT_GT(RefDiff.SSIM, 0.5f);
+    EXPECT_LT(RefDiff.SSIM, 1.f);
+
+    {
+        // Different channel counts disable the vectorized path; the fourth channel of the
+        // second image is ignored.
+        std::vector<Uint8> Image2RGBA_X(Width * Height * 5);
+        for (size_t i = 0; i < size_t{Width} * Height; ++i)
+        {
+            for (size_t ch = 0; ch < 4; ++ch)
+                Image2RGBA_X[i * 5 + ch] = Image2[i * 4 + ch];
+            Image2RGBA_X[i * 5 + 4] = 77;
+        }
+
+        std::vector<Uint8> DiffImage(Width * Height * 4);
+
+        ComputeImageDifferenceAttribs GenericAttribs = Attribs;
+        GenericAttribs.pImage2                       = Image2RGBA_X.data();
+        GenericAttribs.NumChannels2                  = 5;
+        GenericAttribs.Stride2                       = Width * 5;
+        GenericAttribs.pDiffImage                    = DiffImage.data();
+
+        ImageDiffInfo Diff;
+        ComputeImageDifference(GenericAttribs, Diff);
+        EXPECT_EQ(Diff.NumDiffPixels, RefDiff.NumDiffPixels);
+        EXPECT_EQ(Diff.NumDiffPixelsAboveThreshold, RefDiff.NumDiffPixelsAboveThreshold);
+        EXPECT_EQ(Diff.MaxDiff, RefDiff.MaxDiff);
+        EXPECT_FLOAT_EQ(Diff.AvgDiff, RefDiff.AvgDiff);
+        EXPECT_FLOAT_EQ(Diff.RmsDiff, RefDiff.RmsDiff);
+        EXPECT_FLOAT_EQ(Diff.PSNR, RefDiff.PSNR);
+        EXPECT_FLOAT_EQ(Diff.SSIM, RefDiff.SSIM);
+        EXPECT_EQ(DiffImage, RefDiffImage);
+    }
+
+    {
+        RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+        ASSERT_TRUE(pThreadPool);
+
+        std::vector<Uint8> DiffImage(Width * Height * 4);
+
+        ComputeImageDifferenceAttribs MTAttribs = Attribs;
+        MTAttribs.pDiffImage                    = DiffImage.data();
+        MTAttribs.pThreadPool                   = pThreadPool;
+
+        ImageDiffInfo Diff;
+        ComputeImageDifference(MTAttribs, Diff);
+        EXPECT_EQ(Diff.NumDiffPixels, RefDiff.NumDiffPixels);
+        EXPECT_EQ(Diff.NumDiffPixelsAboveThreshold, RefDiff.NumDiffPixelsAboveThreshold);
+        EXPECT_EQ(Diff.MaxDiff, RefDiff.MaxDiff);
+        EXPECT_FLOAT_EQ(Diff.AvgDiff, RefDiff.AvgDiff);
+        EXPECT_FLOAT_EQ(Diff.RmsDiff, RefDiff.RmsDiff);
+        EXPECT_FLOAT_EQ(Diff.PSNR, RefDiff.PSNR);
+        EXPECT_FLOAT_EQ(Diff.SSIM, RefDiff.SSIM);
+        EXPECT_EQ(DiffImage, RefDiffImage);
+    }
+
+    {
+        // An inverted image is structurally very different
+        std::vector<Uint8> Inverted(Image1.size());
+        for (size_t i = 0; i < Image1.size(); ++i)
+            Inverted[i] = static_cast<Uint8>(255 - Image1[i]);
+
+        ComputeImageDifferenceAttribs InvAttribs = Attribs;
+        InvAttribs.pImage2                       = Inverted.data();
+        InvAttribs.pDiffImage                    = nullptr;
+
+        ImageDiffInfo Diff;
+        ComputeImageDifference(InvAttribs, Diff);
+        EXPECT_LT(Diff.SSIM, 0.f);
+        EXPECT_LT(Diff.PSNR, RefDiff.PSNR);
+    }
+}
+
 } // namespace
@@ -0,0 +1,192 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "InternedStringPool.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "HashUtils.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(Common_InternedStringPool, Intern)
+{
+    InternedStringPool Pool{DefaultRawMemoryAllocator::GetAllocator()};
+
+    EXPECT_FALSE(Pool.Intern(nullptr));
+    EXPECT_FALSE(Pool.Find("g_Texture"));
+
+    const InternedString Str1 = Pool.Intern("g_Texture");
+    ASSERT_TRUE(Str1);
+    EXPECT_STREQ(Str1.GetStr(), "g_Texture");
+    EXPECT_EQ(Str1.GetLength(), size_t{9});
+    EXPECT_EQ(Str1.GetHash(), CStringHash<Char>{}("g_Texture"));
+
+    const std::string    Name{"g_Texture"};
+    const InternedString Str2 = Pool.Intern(Name);
+    EXPECT_EQ(Str1, Str2);
+    EXPECT_EQ(Str1.GetStr(), Str2.GetStr());
+    EXPECT_EQ(Pool.Find(Name.c_str()), Str1);
+
+    // The string does not need to be null-terminated
+    const InternedString Str3 = Pool.Intern("g_Texture_sampler", 9);
+    EXPECT_EQ(Str3, Str1);
+
+    const InternedString Str4 = Pool.Intern("g_Texture_sampler");
+    EXPECT_NE(Str4, Str1);
+    EXPECT_STREQ(Str4.GetStr(), "g_Texture_sampler");
+
+    const InternedString Empty = Pool.Intern("");
+    ASSERT_TRUE(Empty);
+    EXPECT_STREQ(Empty.GetStr(), "");
+    EXPECT_EQ(Empty, Pool.Intern(std::string{}));
+
+    const InternedStringPoolStats Stats = Pool.GetStats();
+    EXPECT_EQ(Stats.NumStrings, size_t{3});
+    EXPECT_EQ(Stats.NumRequests, size_t{6});
+    EXPECT_EQ(Stats.StoredSize, size_t{10 + 18 + 1});
+}
+
+TEST(Common_InternedStringPool, Growth)
+{
+    InternedStringPool Pool{DefaultRawMemoryAllocator::GetAllocator(), 256, 1};
+
+    constexpr size_t            NumStrings = 4096;
+    std::vector<InternedString> Strings(NumStrings);
+    for (size_t i = 0; i < NumStrings; ++i)
+        Strings[i] = Pool.Intern("Resource" + std::to_string(i));
+
+    for (size_t i = 0; i < NumStrings; ++i)
+    {
+        const std::string Name = "Resource" + std::to_string(i);
+        EXPECT_STREQ(Strings[i].GetStr(), Name.c_str());
+        EXPECT_EQ(Pool.Intern(Name), Strings[i]);
+    }
+    EXPECT_EQ(Pool.GetStats().NumStrings, NumStrings);
+}
+
+TEST(Common_InternedStringPool, Multithreaded)
+{
+    InternedStringPool Pool{DefaultRawMemoryAllocator::GetAllocator()};
+
+    constexpr Uint32 NumThreads = 8;
+    constexpr Uint32 NumNames   = 1024;
+
+    std::vector<std::vector<InternedString>> ThreadStrings(NumThreads);
+    std::vector<std::thread>                 Threads(NumThreads);
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads[t] = std::thread{
+            [&, t]() {
+                auto& Strings = ThreadStrings[t];
+                Strings.resize(NumNames);
+                // Intern the same names in a different order in every thread
+                for (Uint32 i = 0; i < NumNames; ++i)
+                {
+                    const Uint32 Idx = (i + t * 37) % NumNames;
+                    Strings[Idx]     = Pool.Intern("g_Variable" + std::to_string(Idx));
+                }
+            }};
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    for (Uint32 t = 1; t < NumThreads; ++t)
+    {
+        for (Uint32 i = 0; i < NumNames; ++i)
+            EXPECT_EQ(ThreadStrings[t][i], ThreadStrings[0][i]);
+    }
+
+    const InternedStringPoolStats Stats = Pool.GetStats();
+    EXPECT_EQ(Stats.NumStrings, size_t{NumNames});
+    EXPECT_EQ(Stats.NumRequests, size_t{NumNames} * NumThreads);
+}
+
+// Interns the resource names of a typical scene: every material uses the same set of
+// texture and buffer variables, and some of them are arrays. Every array element is
+// a separate entry in a resource mapping.
+TEST(Common_InternedStringPool, MemorySavings)
+{
+    InternedStringPool Pool{DefaultRawMemoryAllocator::GetAllocator()};
+
+    static constexpr struct
+    {
+        const char* Name;
+        Uint32      ArraySize;
+    } Variables[] = {
+        {"g_ColorMap", 1},
+        {"g_NormalMap", 1},
+        {"g_PhysicalDescriptorMap", 1},
+        {"g_OcclusionMap", 1},
+        {"g_EmissiveMap", 1},
+        {"g_ColorMap_sampler", 1},
+        {"g_NormalMap_sampler", 1},
+        {"cbMaterialAttribs", 1},
+        {"cbFrameAttribs", 1},
+        {"cbPrimitiveAttribs", 1},
+        {"g_IrradianceMap", 1},
+        {"g_PrefilteredEnvMap", 1},
+        {"g_BRDF_LUT", 1},
+        {"g_ShadowMap", 4},
+        {"g_JointTransforms", 64},
+        {"g_LightAttribs", 16},
+    };
+    constexpr Uint32 NumMaterials = 256;
+
+    size_t NumMappingEntries = 0;
+    for (Uint32 Material = 0; Material < NumMaterials; ++Material)
+    {
+        for (const auto& Var : Variables)
+        {
+            for (Uint32 Elem = 0; Elem < Var.ArraySize; ++Elem)
+            {
+                const InternedString Name = Pool.Intern(Var.Name);
+                EXPECT_TRUE(Name);
+                ++NumMappingEntries;
+            }
+        }
+    }
+
+    const InternedStringPoolStats Stats = Pool.GetStats();
+    EXPECT_EQ(Stats.NumStrings, _countof(Variables));
+    EXPECT_EQ(Stats.NumRequests, NumMappingEntries);
+    EXPECT_LT(Stats.ReservedSize, Stats.RequestedSize);
+
+    LOG_INFO_MESSAGE("Interned ", NumMappingEntries, " resource names (", Stats.NumStrings, " unique): ",
+                     Stats.RequestedSize, " bytes if copied, ", Stats.StoredSize, " bytes of unique strings, ",
+                     Stats.ReservedSize, " bytes reserved by the pool. Saved ",
+                     Stats.RequestedSize - Stats.ReservedSize, " bytes, not counting per-copy heap overhead.");
+}
+
+} // namespace
@@ -0,0 +1,128 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "LRUCache.hpp"
+#include "FastRand.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Measures the throughput of LRUCache::Get() under contention for 1 to N threads
+// and compares a single-shard cache with a sharded one.
+class LRUCacheBenchmark
+{
+public:
+    static constexpr size_t NumKeys       = 4096;
+    static constexpr size_t MaxCacheSize  = 2048;
+    static constexpr Uint32 NumIterations = 20000;
+
+    struct CacheData
+    {
+        Uint32 Value = 0;
+    };
+
+    // Every thread requests random keys. Half of the key space fits into the cache,
+    // so the benchmark exercises both hits and evictions.
+    static double Run(size_t NumShards, Uint32 NumThreads)
+    {
+        LRUCache<Uint32, CacheData> Cache{MaxCacheSize, NumShards};
+
+        std::atomic<Uint32> NumReadyThreads{0};
+        std::atomic<bool>   Start{false};
+        std::atomic<Uint32> NumErrors{0};
+
+        std::vector<std::thread> Threads;
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back([&, t]() {
+                FastRandInt Rnd{t + 1, 0, static_cast<int>(NumKeys - 1)};
+
+                NumReadyThreads.fetch_add(1);
+                while (!Start.load())
+                    std::this_thread::yield();
+
+                for (Uint32 i = 0; i < NumIterations; ++i)
+                {
+                    const Uint32 Key  = static_cast<Uint32>(Rnd());
+                    const auto   Data = Cache.Get(Key,
+                                                [Key](CacheData& Data, size_t& Size) //
+                                                {
+                                                    Data.Value = Key;
+                                                    Size       = 1;
+                                                });
+                    if (Data.Value != Key)
+                        NumErrors.fetch_add(1);
+                }
+            });
+        }
+
+        while (NumReadyThreads.load() < NumThreads)
+            std::this_thread::yield();
+
+        Timer T;
+        Start.store(true);
+        for (auto& Thread : Threads)
+            Thread.join();
+        const double ElapsedTime = T.GetElapsedTime();
+
+        EXPECT_EQ(NumErrors.load(), 0u);
+        EXPECT_LE(Cache.GetCurrSize(), MaxCacheSize);
+
+        return GetRate(static_cast<double>(NumThreads) * NumIterations, ElapsedTime);
+    }
+};
+
+TEST(Common_LRUCacheBenchmark, DISABLED_Contention)
+{
+    constexpr size_t NumShards = 16;
+
+    BenchmarkTable Table{"LRU cache contention (" + std::to_string(LRUCacheBenchmark::NumKeys) + " keys, max size " +
+                             std::to_string(LRUCacheBenchmark::MaxCacheSize) + ")",
+                         {"Threads", "1 shard, gets/s", std::to_string(NumShards) + " shards, gets/s", "Ratio"}};
+    for (Uint32 NumThreads : GetBenchmarkThreadCounts())
+    {
+        const double SingleShardThroughput = LRUCacheBenchmark::Run(1, NumThreads);
+        const double ShardedThroughput     = LRUCacheBenchmark::Run(NumShards, NumThreads);
+
+        Table.AddRow({std::to_string(NumThreads), BenchmarkTable::Number(SingleShardThroughput), BenchmarkTable::Number(ShardedThroughput),
+                      BenchmarkTable::Ratio(ShardedThroughput, SingleShardThroughput)});
+    }
+    Table.Print();
+}
+
+} // namespace
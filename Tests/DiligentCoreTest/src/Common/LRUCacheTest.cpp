@@ -30,6 +30,8 @@
 
 #include <thread>
 #include <functional>
+#include <atomic>
+#include <vector>
 
 #include "ThreadSignal.hpp"
 
@@ -183,4 +185,90 @@ TEST(Common_LRUCache, Exceptions)
     }
 }
 
+TEST(Common_LRUCache, EvictionOrder)
+{
+    LRUCache<int, CacheData> Cache{3};
+
+    std::vector<int> InitKeys;
+
+    auto GetData = [&](int Key) {
+        return Cache.Get(Key,
+                         [&](CacheData& Data, size_t& Size) //
+                         {
+                             InitKeys.push_back(Key);
+                             Data.Value = static_cast<Uint32>(Key);
+                             Size       = 1;
+                         });
+    };
+
+    for (int Key : {0, 1, 2})
+        EXPECT_EQ(GetData(Key).Value, static_cast<Uint32>(Key));
+    EXPECT_EQ(Cache.GetCurrSize(), size_t{3});
+
+    // Touch key 0 so that key 1 becomes the least recently used one
+    EXPECT_EQ(GetData(0).Value, 0u);
+    EXPECT_EQ(InitKeys, (std::vector<int>{0, 1, 2}));
+
+    // Adding key 3 must evict key 1
+    EXPECT_EQ(GetData(3).Value, 3u);
+    EXPECT_EQ(Cache.GetCurrSize(), size_t{3});
+
+    InitKeys.clear();
+    for (int Key : {0, 2, 3})
+        EXPECT_EQ(GetData(Key).Value, static_cast<Uint32>(Key));
+    EXPECT_TRUE(InitKeys.empty());
+
+    // Key 1 must be initialized again and key 0 must be evicted
+    EXPECT_EQ(GetData(1).Value, 1u);
+    EXPECT_EQ(GetData(0).Value, 0u);
+    EXPECT_EQ(InitKeys, (std::vector<int>{1, 0}));
+    EXPECT_EQ(Cache.GetCurrSize(), size_t{3});
+}
+
+
+TEST(Common_LRUCache, Shards)
+{
+    constexpr size_t NumShards = 8;
+    constexpr size_t MaxSize   = 64;
+
+    LRUCache<int, CacheData> Cache{MaxSize, NumShards};
+    EXPECT_EQ(Cache.GetNumShards(), NumShards);
+
+    constexpr Uint32         NumThreads = 16;
+    std::vector<std::thread> Threads(NumThreads);
+
+    Threading::Signal   StartSignal;
+    std::atomic<Uint32> NumErrors{0};
+    for (Uint32 i = 0; i < NumThreads; ++i)
+    {
+        Threads[i] = std::thread(
+            [&](Uint32 ThreadId) {
+                StartSignal.Wait();
+                for (Uint32 j = 0; j < 1024; ++j)
+                {
+                    // Mix shared keys and keys unique to this thread
+                    const int  Key  = static_cast<int>((j % 2 == 0) ? j % 128 : 1024 + ThreadId * 1024 + j);
+                    const auto Data = Cache.Get(Key,
+                                                [&](CacheData& Data, size_t& Size) //
+                                                {
+                                                    Data.Value = static_cast<Uint32>(Key);
+                                                    Size       = 1;
+                                                });
+                    if (Data.Value != static_cast<Uint32>(Key))
+                        NumErrors.fetch_add(1);
+                }
+            },
+            i);
+    }
+    StartSignal.Trigger(true);
+
+    for (auto& T : Threads)
+        T.join();
+
+    EXPECT_EQ(NumErrors.load(), 0u);
+    // Every shard is limited by its own share of the maximum size
+    EXPECT_LE(Cache.GetCurrSize(), MaxSize);
+    EXPECT_GT(Cache.GetCurrSize(), size_t{0});
+}
+
 } // namespace
@@ -0,0 +1,176 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "MappedFileStream.hpp"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "TestingEnvironment.hpp"
+#include "TempDirectory.hpp"
+#include "FileWrapper.hpp"
+#include "FastRand.hpp"
+#include "DataBlobImpl.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+std::string WriteTestFile(const TempDirectory& TmpDir, const char* Name, const std::vector<Uint8>& Data)
+{
+    const std::string FilePath = TmpDir.Get() + FileSystem::SlashSymbol + Name;
+
+    FileWrapper File{FilePath.c_str(), EFileAccessMode::Overwrite};
+    EXPECT_TRUE(File);
+    if (File && !Data.empty())
+    {
+        EXPECT_TRUE(File->Write(Data.data(), Data.size()));
+    }
+
+    return FilePath;
+}
+
+std::vector<Uint8> GenerateData(size_t Size)
+{
+    std::vector<Uint8> Data(Size);
+    FastRandInt        Rnd{0, 0, 255};
+    for (Uint8& Byte : Data)
+        Byte = static_cast<Uint8>(Rnd());
+    return Data;
+}
+
+TEST(Common_MappedFileStream, Read)
+{
+    TempDirectory TmpDir;
+
+    const std::vector<Uint8> Data     = GenerateData(100000);
+    const std::string        FilePath = WriteTestFile(TmpDir, "MappedFile.bin", Data);
+
+    RefCntAutoPtr<MappedFileStream> pStream = MappedFileStream::Create(FilePath.c_str(), MappedFileAccessHint::Sequential);
+    ASSERT_TRUE(pStream);
+    ASSERT_TRUE(pStream->IsValid());
+    EXPECT_EQ(pStream->GetSize(), Data.size());
+    EXPECT_EQ(pStream->GetPos(), size_t{0});
+    ASSERT_NE(pStream->GetData(), nullptr);
+    EXPECT_EQ(memcmp(pStream->GetData(), Data.data(), Data.size()), 0);
+
+    std::vector<Uint8> Chunk(1000);
+    EXPECT_TRUE(pStream->Read(Chunk.data(), Chunk.size()));
+    EXPECT_TRUE(std::equal(Chunk.begin(), Chunk.end(), Data.begin()));
+    EXPECT_EQ(pStream->GetPos(), Chunk.size());
+
+    EXPECT_TRUE(pStream->SetPos(500, static_cast<int>(FilePosOrigin::Curr)));
+    EXPECT_EQ(pStream->GetPos(), size_t{1500});
+    EXPECT_TRUE(pStream->Read(Chunk.data(), Chunk.size()));
+    EXPECT_TRUE(std::equal(Chunk.begin(), Chunk.end(), Data.begin() + 1500));
+
+    EXPECT_TRUE(pStream->SetPos(static_cast<size_t>(-100), static_cast<int>(FilePosOrigin::End)));
+    EXPECT_EQ(pStream->GetPos(), Data.size() - 100);
+    // Only 100 bytes are left
+    EXPECT_FALSE(pStream->Read(Chunk.data(), Chunk.size()));
+    EXPECT_TRUE(std::equal(Chunk.begin(), Chunk.begin() + 100, Data.end() - 100));
+    EXPECT_EQ(pStream->GetPos(), Data.size());
+
+    EXPECT_FALSE(pStream->SetPos(Data.size() + 1, static_cast<int>(FilePosOrigin::Start)));
+    EXPECT_EQ(pStream->GetPos(), Data.size());
+
+    RefCntAutoPtr<DataBlobImpl> pBlob = DataBlobImpl::Create();
+    pStream->ReadBlob(pBlob);
+    ASSERT_EQ(pBlob->GetSize(), Data.size());
+    EXPECT_EQ(memcmp(pBlob->GetConstDataPtr(), Data.data(), Data.size()), 0);
+
+    EXPECT_TRUE(pStream->Advise(MappedFileAccessHint::Random));
+    EXPECT_TRUE(pStream->Advise(MappedFileAccessHint::WillNeed, 5000, 10000));
+}
+
+TEST(Common_MappedFileStream, DataView)
+{
+    TempDirectory TmpDir;
+
+    const std::vector<Uint8> Data     = GenerateData(10000);
+    const std::string        FilePath = WriteTestFile(TmpDir, "MappedFile.bin", Data);
+
+    RefCntAutoPtr<IDataBlob> pView;
+    RefCntAutoPtr<IDataBlob> pTailView;
+    {
+        RefCntAutoPtr<MappedFileStream> pStream = MappedFileStream::Create(FilePath.c_str());
+        ASSERT_TRUE(pStream);
+
+        pView = pStream->GetDataView();
+        ASSERT_TRUE(pView);
+        EXPECT_EQ(pView->GetConstDataPtr(), pStream->GetData());
+
+        pTailView = pStream->GetDataView(9000, 5000);
+        ASSERT_TRUE(pTailView);
+    }
+
+    // The views keep the mapping alive after the stream is released
+    ASSERT_EQ(pView->GetSize(), Data.size());
+    EXPECT_EQ(memcmp(pView->GetConstDataPtr(), Data.data(), Data.size()), 0);
+
+    ASSERT_EQ(pTailView->GetSize(), size_t{1000});
+    EXPECT_EQ(memcmp(pTailView->GetConstDataPtr(), Data.data() + 9000, 1000), 0);
+}
+
+TEST(Common_MappedFileStream, EmptyFile)
+{
+    TempDirectory TmpDir;
+
+    const std::string FilePath = WriteTestFile(TmpDir, "Empty.bin", {});
+
+    RefCntAutoPtr<MappedFileStream> pStream = MappedFileStream::Create(FilePath.c_str());
+    ASSERT_TRUE(pStream);
+    EXPECT_TRUE(pStream->IsValid());
+    EXPECT_EQ(pStream->GetSize(), size_t{0});
+    EXPECT_EQ(pStream->GetData(), nullptr);
+
+    Uint8 Byte = 0;
+    EXPECT_FALSE(pStream->Read(&Byte, 1));
+
+    RefCntAutoPtr<IDataBlob> pView = pStream->GetDataView();
+    ASSERT_TRUE(pView);
+    EXPECT_EQ(pView->GetSize(), size_t{0});
+}
+
+TEST(Common_MappedFileStream, MissingFile)
+{
+    TempDirectory TmpDir;
+
+    const std::string FilePath = TmpDir.Get() + FileSystem::SlashSymbol + "Missing.bin";
+
+    TestingEnvironment::ErrorScope ExpectedErrors{"Failed to open file"};
+
+    RefCntAutoPtr<MappedFileStream> pStream = MappedFileStream::Create(FilePath.c_str());
+    ASSERT_TRUE(pStream);
+    EXPECT_FALSE(pStream->IsValid());
+    EXPECT_FALSE(pStream->GetDataView());
+}
+
+} // namespace
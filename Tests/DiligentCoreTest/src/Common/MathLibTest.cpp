@@ -29,7 +29,9 @@
 #include <sstream>
 
 #include "BasicMath.hpp"
+#include "BasicMathSIMD.hpp"
 #include "AdvancedMath.hpp"
+#include "FastRand.hpp"
 
 #include "gtest/gtest.h"
 
@@ -3362,4 +3364,110 @@ TEST(Common_AdvancedMath, TriangulatePolygon3D)
     }
 }
 
+// BasicMathSIMD performs the same operations in the same order as the scalar code. The results are
+// bit-identical unless the compiler fuses the scalar operations into FMA, which may change the result
+// by a few ULPs of the largest term. The test values are of the order of 10.
+template <typename VectorType>
+void ExpectNearSIMD(const VectorType& Val, const VectorType& Ref, float RelTolerance = 1e-5f)
+{
+    for (size_t i = 0; i < VectorType::GetComponentCount(); ++i)
+        EXPECT_NEAR(Val[i], Ref[i], std::max(std::abs(Ref[i]), 10.f) * RelTolerance) << "component " << i;
+}
+
+void ExpectNearSIMD(const float4x4& Val, const float4x4& Ref, float RelTolerance = 1e-5f)
+{
+    for (int r = 0; r < 4; ++r)
+        ExpectNearSIMD(float4::MakeVector(Val.m[r]), float4::MakeVector(Ref.m[r]), RelTolerance);
+}
+
+float4x4 MakeRandomMatrix(FastRandFloat& Rnd)
+{
+    float4x4 m;
+    for (int r = 0; r < 4; ++r)
+    {
+        for (int c = 0; c < 4; ++c)
+            m.m[r][c] = Rnd();
+    }
+    return m;
+}
+
+TEST(Common_BasicMathSIMD, MatrixOperations)
+{
+    FastRandFloat Rnd{0, -10, 10};
+    for (int test = 0; test < 100; ++test)
+    {
+        const float4x4 m1 = MakeRandomMatrix(Rnd);
+        const float4x4 m2 = MakeRandomMatrix(Rnd);
+        const float4   v{Rnd(), Rnd(), Rnd(), Rnd()};
+
+        ExpectNearSIMD(MulSIMD(v, m1), v * m1);
+        ExpectNearSIMD(MulSIMD(m1, m2), m1 * m2);
+        EXPECT_EQ(TransposeSIMD(m1), m1.Transpose());
+
+        // Make the matrix well-conditioned
+        float4x4 m = m1;
+        for (int i = 0; i < 4; ++i)
+            m.m[i][i] += 40.f;
+
+        const float4x4 Inv = InverseSIMD(m);
+        ExpectNearSIMD(Inv, m.Inverse());
+        ExpectNearSIMD(m * Inv, float4x4::Identity());
+    }
+
+    {
+        const float4x4 m   = float4x4::Translation(1, 2, 3) * float4x4::RotationY(0.5f) * float4x4::Scale(2, 3, 4);
+        const float4x4 Inv = InverseSIMD(m);
+        ExpectNearSIMD(Inv, m.Inverse());
+        ExpectNearSIMD(float4{1, 2, 3, 1} * m * Inv, float4{1, 2, 3, 1});
+    }
+}
+
+TEST(Common_BasicMathSIMD, BatchTransforms)
+{
+    FastRandFloat Rnd{1, -10, 10};
+
+    const float4x4 m = float4x4::Scale(1, 2, 3) * float4x4::RotationX(0.3f) * float4x4::Translation(4, -5, 50) *
+        float4x4::Projection(PI_F / 3.f, 1.5f, 1.f, 100.f, false);
+
+    for (size_t Count : {0, 1, 2, 3, 4, 5, 7, 8, 9, 13, 1000})
+    {
+        std::vector<float3>   Points(Count);
+        std::vector<float4>   Vectors4(Count);
+        std::vector<float4x4> Matrices(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            Points[i]   = float3{Rnd(), Rnd(), Rnd()};
+            Vectors4[i] = float4{Rnd(), Rnd(), Rnd(), Rnd()};
+            Matrices[i] = MakeRandomMatrix(Rnd);
+        }
+
+        std::vector<float3> Out3(Count);
+        TransformPoints(Points.data(), Count, m, Out3.data());
+        for (size_t i = 0; i < Count; ++i)
+            ExpectNearSIMD(Out3[i], Points[i] * m);
+
+        TransformVectors(Points.data(), Count, m, Out3.data());
+        for (size_t i = 0; i < Count; ++i)
+            ExpectNearSIMD(Out3[i], float3{float4{Points[i], 0} * m});
+
+        std::vector<float4> Out4(Count);
+        TransformVectors(Vectors4.data(), Count, m, Out4.data());
+        for (size_t i = 0; i < Count; ++i)
+            ExpectNearSIMD(Out4[i], Vectors4[i] * m);
+
+        std::vector<float4x4> OutMatrices(Count);
+        MulMatrices(Matrices.data(), Count, m, OutMatrices.data());
+        for (size_t i = 0; i < Count; ++i)
+            ExpectNearSIMD(OutMatrices[i], Matrices[i] * m);
+
+        // In-place transforms
+        const std::vector<float3> RefPoints = Out3;
+        TransformVectors(Points.data(), Count, m, Points.data());
+        EXPECT_EQ(Points, RefPoints);
+
+        MulMatrices(Matrices.data(), Count, m, Matrices.data());
+        EXPECT_EQ(Matrices, OutMatrices);
+    }
+}
+
 } // namespace
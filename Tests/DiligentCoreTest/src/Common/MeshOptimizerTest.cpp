@@ -0,0 +1,314 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "MeshOptimizer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "GeometryPrimitives.h"
+#include "RefCntAutoPtr.hpp"
+#include "FastRand.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+struct TestMesh
+{
+    std::vector<float3> Positions;
+    std::vector<Uint32> Indices;
+
+    Uint32 GetNumVertices() const { return static_cast<Uint32>(Positions.size()); }
+};
+
+TestMesh CreateSphere(Uint32 NumSubdivisions)
+{
+    RefCntAutoPtr<IDataBlob> pVertices;
+    RefCntAutoPtr<IDataBlob> pIndices;
+    GeometryPrimitiveInfo    Info;
+    CreateGeometryPrimitive(SphereGeometryPrimitiveAttributes{1, GEOMETRY_PRIMITIVE_VERTEX_FLAG_POSITION, NumSubdivisions}, &pVertices, &pIndices, &Info);
+
+    TestMesh Mesh;
+    Mesh.Positions.assign(pVertices->GetConstDataPtr<float3>(), pVertices->GetConstDataPtr<float3>() + Info.NumVertices);
+    Mesh.Indices.assign(pIndices->GetConstDataPtr<Uint32>(), pIndices->GetConstDataPtr<Uint32>() + Info.NumIndices);
+    return Mesh;
+}
+
+// Shuffles the triangles and the vertices
+void Shuffle(TestMesh& Mesh, unsigned int Seed)
+{
+    // FastRandInt's range is limited to FastRand::Max, which is too small for large meshes
+    std::mt19937 Rnd{Seed};
+
+    const auto RandIndex = [&Rnd](size_t Max) {
+        return std::uniform_int_distribution<size_t>{0, Max}(Rnd);
+    };
+
+    const size_t NumTriangles = Mesh.Indices.size() / 3;
+    for (size_t t = NumTriangles - 1; t > 0; --t)
+    {
+        const size_t j = RandIndex(t);
+        for (size_t i = 0; i < 3; ++i)
+            std::swap(Mesh.Indices[t * 3 + i], Mesh.Indices[j * 3 + i]);
+    }
+
+    std::vector<Uint32> Remap(Mesh.Positions.size());
+    for (Uint32 v = 0; v < Remap.size(); ++v)
+        Remap[v] = v;
+    for (size_t v = Remap.size() - 1; v > 0; --v)
+        std::swap(Remap[v], Remap[RandIndex(v)]);
+
+    std::vector<float3> Positions(Mesh.Positions.size());
+    for (size_t v = 0; v < Remap.size(); ++v)
+        Positions[Remap[v]] = Mesh.Positions[v];
+    Mesh.Positions.swap(Positions);
+    for (Uint32& Idx : Mesh.Indices)
+        Idx = Remap[Idx];
+}
+
+// Returns the sorted list of triangles, which is the same if one index buffer is a permutation of the other
+std::vector<std::array<Uint32, 3>> GetSortedTriangles(const std::vector<Uint32>& Indices)
+{
+    std::vector<std::array<Uint32, 3>> Triangles(Indices.size() / 3);
+    for (size_t t = 0; t < Triangles.size(); ++t)
+        Triangles[t] = {Indices[t * 3], Indices[t * 3 + 1], Indices[t * 3 + 2]};
+    std::sort(Triangles.begin(), Triangles.end());
+    return Triangles;
+}
+
+TEST(Common_MeshOptimizer, AnalyzeVertexCache)
+{
+    {
+        const Uint32 Indices[] = {0, 1, 2};
+        const auto   Stats     = AnalyzeVertexCache(Indices, 3, 3);
+        EXPECT_EQ(Stats.VerticesTransformed, 3u);
+        EXPECT_EQ(Stats.ACMR, 3.f);
+        EXPECT_EQ(Stats.ATVR, 1.f);
+    }
+
+    {
+        // Quad
+        const Uint32 Indices[] = {0, 1, 2, 2, 1, 3};
+        const auto   Stats     = AnalyzeVertexCache(Indices, 6, 4);
+        EXPECT_EQ(Stats.VerticesTransformed, 4u);
+        EXPECT_EQ(Stats.ACMR, 2.f);
+        EXPECT_EQ(Stats.ATVR, 1.f);
+    }
+
+    {
+        // With the cache of 3 vertices, vertex 3 evicts vertex 0, which then evicts vertex 1
+        const Uint32 Indices[] = {0, 1, 2, 1, 2, 3, 0, 1, 3};
+        EXPECT_EQ(AnalyzeVertexCache(Indices, 9, 4, 3).VerticesTransformed, 6u);
+        EXPECT_EQ(AnalyzeVertexCache(Indices, 9, 4, 4).VerticesTransformed, 4u);
+    }
+}
+
+TEST(Common_MeshOptimizer, OptimizeVertexCache)
+{
+    TestMesh Mesh = CreateSphere(16);
+    Shuffle(Mesh, 0);
+
+    const auto RefTriangles = GetSortedTriangles(Mesh.Indices);
+    const auto InputStats   = AnalyzeVertexCache(Mesh.Indices.data(), Mesh.Indices.size(), Mesh.GetNumVertices());
+
+    std::vector<Uint32> Forsyth(Mesh.Indices.size());
+    OptimizeVertexCache(Mesh.Indices.data(), Mesh.Indices.size(), Mesh.GetNumVertices(), Forsyth.data());
+    EXPECT_EQ(GetSortedTriangles(Forsyth), RefTriangles);
+    const auto ForsythStats = AnalyzeVertexCache(Forsyth.data(), Forsyth.size(), Mesh.GetNumVertices());
+
+    // In place
+    std::vector<Uint32> Tipsify = Mesh.Indices;
+    OptimizeVertexCacheFIFO(Tipsify.data(), Tipsify.size(), Mesh.GetNumVertices(), 16, Tipsify.data());
+    EXPECT_EQ(GetSortedTriangles(Tipsify), RefTriangles);
+    const auto TipsifyStats = AnalyzeVertexCache(Tipsify.data(), Tipsify.size(), Mesh.GetNumVertices());
+
+    LOG_INFO_MESSAGE("Sphere with ", Mesh.Indices.size() / 3, " triangles, FIFO cache of 16 vertices. ACMR / ATVR:",
+                     "\n    Shuffled: ", InputStats.ACMR, " / ", InputStats.ATVR,
+                     "\n    Forsyth:  ", ForsythStats.ACMR, " / ", ForsythStats.ATVR,
+                     "\n    Tipsify:  ", TipsifyStats.ACMR, " / ", TipsifyStats.ATVR);
+
+    EXPECT_GT(InputStats.ACMR, 2.f);
+    EXPECT_LT(ForsythStats.ACMR, 0.8f);
+    EXPECT_LT(TipsifyStats.ACMR, 0.8f);
+    EXPECT_LT(ForsythStats.ATVR, 1.4f);
+    EXPECT_LT(TipsifyStats.ATVR, 1.4f);
+}
+
+TEST(Common_MeshOptimizer, OptimizeOverdraw)
+{
+    TestMesh Mesh = CreateSphere(16);
+    Shuffle(Mesh, 1);
+
+    OptimizeVertexCacheFIFO(Mesh.Indices.data(), Mesh.Indices.size(), Mesh.GetNumVertices(), 16, Mesh.Indices.data());
+    const auto CacheStats = AnalyzeVertexCache(Mesh.Indices.data(), Mesh.Indices.size(), Mesh.GetNumVertices());
+
+    std::vector<Uint32> Indices(Mesh.Indices.size());
+    OptimizeOverdraw(Mesh.Indices.data(), Mesh.Indices.size(), Mesh.Positions.data(), sizeof(float3), Mesh.GetNumVertices(), Indices.data(), 1.05f);
+    EXPECT_EQ(GetSortedTriangles(Indices), GetSortedTriangles(Mesh.Indices));
+
+    const auto OverdrawStats = AnalyzeVertexCache(Indices.data(), Indices.size(), Mesh.GetNumVertices());
+    EXPECT_LE(OverdrawStats.ACMR, CacheStats.ACMR * 1.15f);
+
+    // Threshold of 1 keeps the hard clusters only
+    OptimizeOverdraw(Mesh.Indices.data(), Mesh.Indices.size(), Mesh.Positions.data(), sizeof(float3), Mesh.GetNumVertices(), Mesh.Indices.data(), 1.f);
+    EXPECT_EQ(GetSortedTriangles(Mesh.Indices), GetSortedTriangles(Indices));
+}
+
+TEST(Common_MeshOptimizer, VertexFetch)
+{
+    TestMesh Mesh = CreateSphere(16);
+    Shuffle(Mesh, 2);
+    OptimizeVertexCache(Mesh.Indices.data(), Mesh.Indices.size(), Mesh.GetNumVertices(), Mesh.Indices.data());
+
+    // Add a vertex that is not referenced
+    Mesh.Positions.push_back(float3{10, 10, 10});
+
+    const auto InputStats = AnalyzeVertexFetch(Mesh.Indices.data(), Mesh.Indices.size(), Mesh.GetNumVertices(), sizeof(float3));
+
+    std::vector<Uint32> Remap(Mesh.Positions.size());
+    const Uint32        NumUsed = OptimizeVertexFetchRemap(Mesh.Indices.data(), Mesh.Indices.size(), Mesh.GetNumVertices(), Remap.data());
+    EXPECT_EQ(NumUsed, Mesh.GetNumVertices() - 1);
+    EXPECT_EQ(Remap.back(), ~0u);
+
+    std::vector<Uint32> Indices(Mesh.Indices.size());
+    RemapIndexBuffer(Mesh.Indices.data(), Mesh.Indices.size(), Remap.data(), Indices.data());
+
+    std::vector<float3> Positions(NumUsed);
+    RemapVertexBuffer(Mesh.Positions.data(), Mesh.GetNumVertices(), sizeof(float3), Remap.data(), Positions.data());
+
+    // Vertices are in the order of the first use, and the triangles are the same
+    Uint32 NextVertex = 0;
+    for (size_t i = 0; i < Indices.size(); ++i)
+    {
+        EXPECT_LE(Indices[i], NextVertex);
+        NextVertex = std::max(NextVertex, Indices[i] + 1);
+        EXPECT_EQ(Positions[Indices[i]], Mesh.Positions[Mesh.Indices[i]]);
+    }
+    EXPECT_EQ(AnalyzeVertexCache(Indices.data(), Indices.size(), NumUsed).VerticesTransformed,
+              AnalyzeVertexCache(Mesh.Indices.data(), Mesh.Indices.size(), Mesh.GetNumVertices()).VerticesTransformed);
+
+    const auto OptimizedStats = AnalyzeVertexFetch(Indices.data(), Indices.size(), NumUsed, sizeof(float3));
+    LOG_INFO_MESSAGE("Vertex fetch overfetch: shuffled: ", InputStats.Overfetch, ", remapped: ", OptimizedStats.Overfetch);
+    EXPECT_LT(OptimizedStats.Overfetch, InputStats.Overfetch);
+    EXPECT_LT(OptimizedStats.Overfetch, 1.5f);
+}
+
+TEST(Common_MeshOptimizer, BuildMeshlets)
+{
+    TestMesh Mesh = CreateSphere(16);
+    OptimizeVertexCache(Mesh.Indices.data(), Mesh.Indices.size(), Mesh.GetNumVertices(), Mesh.Indices.data());
+
+    for (Uint32 MaxVertices : {3u, 64u, 256u})
+    {
+        MeshletBuildAttribs Attribs;
+        Attribs.MaxVertices  = MaxVertices;
+        Attribs.MaxTriangles = 124;
+
+        const MeshletData Data = BuildMeshlets(Mesh.Indices.data(), Mesh.Indices.size(), Mesh.GetNumVertices(), Attribs);
+        ASSERT_FALSE(Data.Meshlets.empty());
+
+        // Reconstruct the triangles
+        std::vector<Uint32> Indices;
+        for (const Meshlet& M : Data.Meshlets)
+        {
+            EXPECT_GT(M.TriangleCount, 0u);
+            EXPECT_LE(M.VertexCount, Attribs.MaxVertices);
+            EXPECT_LE(M.TriangleCount, Attribs.MaxTriangles);
+            for (Uint32 i = 0; i < M.TriangleCount * 3; ++i)
+            {
+                const Uint8 LocalIdx = Data.Triangles[size_t{M.TriangleOffset} * 3 + i];
+                ASSERT_LT(LocalIdx, M.VertexCount);
+                Indices.push_back(Data.Vertices[M.VertexOffset + LocalIdx]);
+            }
+        }
+        EXPECT_EQ(GetSortedTriangles(Indices), GetSortedTriangles(Mesh.Indices));
+
+        if (MaxVertices == 64)
+        {
+            // Meshlets of a closed mesh are well filled
+            const float AvgTriangles = static_cast<float>(Mesh.Indices.size() / 3) / static_cast<float>(Data.Meshlets.size());
+            EXPECT_GT(AvgTriangles, 60.f);
+        }
+    }
+}
+
+TEST(Common_MeshOptimizer, MeshletBounds)
+{
+    TestMesh Mesh = CreateSphere(16);
+    OptimizeVertexCache(Mesh.Indices.data(), Mesh.Indices.size(), Mesh.GetNumVertices(), Mesh.Indices.data());
+
+    const MeshletData Data = BuildMeshlets(Mesh.Indices.data(), Mesh.Indices.size(), Mesh.GetNumVertices());
+
+    FastRandFloat Rnd{0, -5, 5};
+    size_t        NumBackFacing = 0;
+    size_t        NumNarrowCones = 0;
+    for (const Meshlet& M : Data.Meshlets)
+    {
+        const MeshletBounds Bounds = ComputeMeshletBounds(Data, M, Mesh.Positions.data(), sizeof(float3), Mesh.GetNumVertices());
+        for (Uint32 i = 0; i < M.VertexCount; ++i)
+            EXPECT_LE(length(Mesh.Positions[Data.Vertices[M.VertexOffset + i]] - Bounds.Center), Bounds.Radius * 1.0001f);
+
+        // The sphere normals point outward
+        EXPECT_GT(dot(Bounds.ConeAxis, Bounds.Center), 0.f);
+        EXPECT_FALSE(IsMeshletBackFacing(Bounds, Bounds.Center + Bounds.ConeAxis * 100.f));
+        if (Bounds.ConeCutoff < 1)
+        {
+            EXPECT_TRUE(IsMeshletBackFacing(Bounds, Bounds.Center - Bounds.ConeAxis * 100.f));
+            ++NumNarrowCones;
+        }
+
+        // If the meshlet is reported back-facing, every triangle must be back-facing
+        for (int c = 0; c < 20; ++c)
+        {
+            const float3 CameraPos{Rnd(), Rnd(), Rnd()};
+            if (!IsMeshletBackFacing(Bounds, CameraPos))
+                continue;
+
+            ++NumBackFacing;
+            for (Uint32 t = 0; t < M.TriangleCount; ++t)
+            {
+                const Uint8*  Tri = &Data.Triangles[(size_t{M.TriangleOffset} + t) * 3];
+                const float3& P0  = Mesh.Positions[Data.Vertices[M.VertexOffset + Tri[0]]];
+                const float3& P1  = Mesh.Positions[Data.Vertices[M.VertexOffset + Tri[1]]];
+                const float3& P2  = Mesh.Positions[Data.Vertices[M.VertexOffset + Tri[2]]];
+                EXPECT_GE(dot(P0 - CameraPos, cross(P1 - P0, P2 - P0)), -1e-6f);
+            }
+        }
+
+        const MeshletBounds Flipped = ComputeMeshletBounds(Data, M, Mesh.Positions.data(), sizeof(float3), Mesh.GetNumVertices(), true);
+        EXPECT_LT(dot(Flipped.ConeAxis, Flipped.Center), 0.f);
+    }
+    EXPECT_GT(NumBackFacing, size_t{0});
+    EXPECT_GE(NumNarrowCones, Data.Meshlets.size() * 9 / 10);
+}
+
+} // namespace
@@ -25,11 +25,15 @@
  */
 
 #include "ObjectsRegistry.hpp"
+#include "ConcurrentObjectsRegistry.hpp"
 
 #include "gtest/gtest.h"
 
 #include <thread>
 #include <functional>
+#include <atomic>
+#include <vector>
+#include <algorithm>
 
 #include "ObjectBase.hpp"
 #include "ThreadSignal.hpp"
@@ -69,10 +73,10 @@ struct RegistryDataObj : public ObjectBase<IObject>
     }
 };
 
-template <template <typename T> class StrongPtrType, typename DataType>
+template <template <typename, typename, typename, typename> class RegistryType, template <typename T> class StrongPtrType, typename DataType>
 void TestObjectRegistryGet()
 {
-    ObjectsRegistry<int, StrongPtrType<DataType>> Registry;
+    RegistryType<int, StrongPtrType<DataType>, std::hash<int>, std::equal_to<int>> Registry;
 
     {
         int    Key    = 999;
@@ -123,19 +127,19 @@ void TestObjectRegistryGet()
 
 TEST(Common_ObjectsRegistry, Get_SharedPtr)
 {
-    TestObjectRegistryGet<std::shared_ptr, RegistryData>();
+    TestObjectRegistryGet<ObjectsRegistry, std::shared_ptr, RegistryData>();
 }
 
 TEST(Common_ObjectsRegistry, Get_RefCntAutoPtr)
 {
-    TestObjectRegistryGet<RefCntAutoPtr, RegistryDataObj>();
+    TestObjectRegistryGet<ObjectsRegistry, RefCntAutoPtr, RegistryDataObj>();
 }
 
 
-template <template <typename T> class StrongPtrType, typename DataType>
+template <template <typename, typename, typename, typename> class RegistryType, template <typename T> class StrongPtrType, typename DataType>
 void TestObjectRegistryCreateDestroyRace()
 {
-    ObjectsRegistry<int, StrongPtrType<DataType>> Registry{64};
+    RegistryType<int, StrongPtrType<DataType>, std::hash<int>, std::equal_to<int>> Registry{64};
 
     constexpr Uint32         NumThreads = 16;
     std::vector<std::thread> Threads(NumThreads);
@@ -160,19 +164,19 @@ void TestObjectRegistryCreateDestroyRace()
 
 TEST(Common_ObjectsRegistry, CreateDestroyRace_SharedPtr)
 {
-    TestObjectRegistryCreateDestroyRace<std::shared_ptr, RegistryData>();
+    TestObjectRegistryCreateDestroyRace<ObjectsRegistry, std::shared_ptr, RegistryData>();
 }
 
 TEST(Common_ObjectsRegistry, CreateDestroyRace_RefCntAutoPtr)
 {
-    TestObjectRegistryCreateDestroyRace<RefCntAutoPtr, RegistryDataObj>();
+    TestObjectRegistryCreateDestroyRace<ObjectsRegistry, RefCntAutoPtr, RegistryDataObj>();
 }
 
 
-template <template <typename T> class StrongPtrType, typename DataType>
+template <template <typename, typename, typename, typename> class RegistryType, template <typename T> class StrongPtrType, typename DataType>
 void TestObjectRegistryExceptions()
 {
-    ObjectsRegistry<int, StrongPtrType<DataType>> Registry{128};
+    RegistryType<int, StrongPtrType<DataType>, std::hash<int>, std::equal_to<int>> Registry{128};
 
     constexpr Uint32         NumThreads = 15; // Use odd number
     std::vector<std::thread> Threads(NumThreads);
@@ -236,12 +240,156 @@ void TestObjectRegistryExceptions()
 
 TEST(Common_ObjectsRegistry, Exceptions_SharedPtr)
 {
-    TestObjectRegistryExceptions<std::shared_ptr, RegistryData>();
+    TestObjectRegistryExceptions<ObjectsRegistry, std::shared_ptr, RegistryData>();
 }
 
 TEST(Common_ObjectsRegistry, Exceptions_RefCntAutoPtr)
 {
-    TestObjectRegistryExceptions<RefCntAutoPtr, RegistryDataObj>();
+    TestObjectRegistryExceptions<ObjectsRegistry, RefCntAutoPtr, RegistryDataObj>();
+}
+
+TEST(Common_ConcurrentObjectsRegistry, Get_SharedPtr)
+{
+    TestObjectRegistryGet<ConcurrentObjectsRegistry, std::shared_ptr, RegistryData>();
+}
+
+TEST(Common_ConcurrentObjectsRegistry, Get_RefCntAutoPtr)
+{
+    TestObjectRegistryGet<ConcurrentObjectsRegistry, RefCntAutoPtr, RegistryDataObj>();
+}
+
+TEST(Common_ConcurrentObjectsRegistry, CreateDestroyRace_SharedPtr)
+{
+    TestObjectRegistryCreateDestroyRace<ConcurrentObjectsRegistry, std::shared_ptr, RegistryData>();
+}
+
+TEST(Common_ConcurrentObjectsRegistry, CreateDestroyRace_RefCntAutoPtr)
+{
+    TestObjectRegistryCreateDestroyRace<ConcurrentObjectsRegistry, RefCntAutoPtr, RegistryDataObj>();
+}
+
+TEST(Common_ConcurrentObjectsRegistry, Exceptions_SharedPtr)
+{
+    TestObjectRegistryExceptions<ConcurrentObjectsRegistry, std::shared_ptr, RegistryData>();
+}
+
+TEST(Common_ConcurrentObjectsRegistry, Exceptions_RefCntAutoPtr)
+{
+    TestObjectRegistryExceptions<ConcurrentObjectsRegistry, RefCntAutoPtr, RegistryDataObj>();
+}
+
+TEST(Common_ConcurrentObjectsRegistry, ManyKeys)
+{
+    ConcurrentObjectsRegistry<int, std::shared_ptr<RegistryData>> Registry{16, 4};
+
+    constexpr Uint32         NumKeys    = 512;
+    constexpr Uint32         NumThreads = 8;
+    std::vector<std::thread> Threads(NumThreads);
+
+    std::vector<std::shared_ptr<RegistryData>> KeepAlive(NumKeys);
+    for (Uint32 i = 0; i < NumKeys; i += 2)
+        KeepAlive[i] = Registry.Get(static_cast<int>(i), std::bind(RegistryData::Create, i));
+
+    Threading::Signal   StartSignal;
+    std::atomic<Uint32> NumCreated{0};
+    std::atomic<Uint32> NumErrors{0};
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads[t] = std::thread(
+            [&]() {
+                StartSignal.Wait();
+                for (Uint32 i = 0; i < NumKeys; ++i)
+                {
+                    auto pData = Registry.Get(static_cast<int>(i),
+                                              [&]() {
+                                                  NumCreated.fetch_add(1);
+                                                  return RegistryData::Create(i);
+                                              });
+                    if (!pData || pData->Value != i)
+                        NumErrors.fetch_add(1);
+                    if (i % 2 == 0 && pData != KeepAlive[i])
+                        NumErrors.fetch_add(1);
+                }
+            });
+    }
+    StartSignal.Trigger(true);
+
+    for (auto& T : Threads)
+        T.join();
+
+    EXPECT_EQ(NumErrors.load(), 0u);
+    // Objects with odd keys are released immediately and may be created again by another thread,
+    // while objects with even keys must never be recreated.
+    EXPECT_GE(NumCreated.load(), NumKeys / 2);
+
+    Registry.Purge();
+
+    Uint32 NumElements = 0;
+    Registry.ProcessElements([&](int Key, const RegistryData& Data) {
+        EXPECT_EQ(Key % 2, 0);
+        EXPECT_EQ(Data.Value, static_cast<Uint32>(Key));
+        ++NumElements;
+    });
+    EXPECT_EQ(NumElements, NumKeys / 2);
+
+    KeepAlive.clear();
+    Registry.Purge();
+    NumElements = 0;
+    Registry.ProcessElements([&](int, const RegistryData&) { ++NumElements; });
+    EXPECT_EQ(NumElements, 0u);
+
+    Registry.Clear();
+    EXPECT_EQ(Registry.Get(0), nullptr);
+}
+
+TEST(Common_ConcurrentObjectsRegistry, RetiredSnapshotsWithContinuousReaders)
+{
+    // A single shard, so that every new key eventually triggers a rebuild of the table that is being read
+    ConcurrentObjectsRegistry<int, std::shared_ptr<RegistryData>> Registry{1024, 1};
+
+    constexpr Uint32 NumReadKeys  = 64;
+    constexpr Uint32 NumWriteKeys = 4096;
+    constexpr Uint32 NumReaders   = 4;
+
+    std::vector<std::shared_ptr<RegistryData>> KeepAlive;
+    for (Uint32 i = 0; i < NumReadKeys; ++i)
+        KeepAlive.emplace_back(Registry.Get(static_cast<int>(i), std::bind(RegistryData::Create, i)));
+
+    std::atomic<bool>        Stop{false};
+    std::atomic<Uint32>      NumErrors{0};
+    std::vector<std::thread> Readers(NumReaders);
+    for (Uint32 t = 0; t < NumReaders; ++t)
+    {
+        Readers[t] = std::thread(
+            [&]() {
+                // Keep the table under continuous overlapping reads
+                for (Uint32 i = 0; !Stop.load(); i = (i + 1) % NumReadKeys)
+                {
+                    auto pData = Registry.Get(static_cast<int>(i));
+                    if (!pData || pData->Value != i)
+                        NumErrors.fetch_add(1);
+                }
+            });
+    }
+
+    size_t MaxRetiredSnapshots = 0;
+    for (Uint32 i = NumReadKeys; i < NumReadKeys + NumWriteKeys; ++i)
+    {
+        KeepAlive.emplace_back(Registry.Get(static_cast<int>(i), std::bind(RegistryData::Create, i)));
+        MaxRetiredSnapshots = std::max(MaxRetiredSnapshots, Registry.GetNumRetiredSnapshots());
+    }
+
+    Stop.store(true);
+    for (auto& T : Readers)
+        T.join();
+
+    EXPECT_EQ(NumErrors.load(), 0u);
+    // Every reader protects at most one snapshot
+    EXPECT_LE(MaxRetiredSnapshots, size_t{NumReaders});
+
+    // Without readers, the next rebuild releases all retired snapshots
+    Registry.Purge();
+    EXPECT_EQ(Registry.GetNumRetiredSnapshots(), size_t{0});
 }
 
 } // namespace
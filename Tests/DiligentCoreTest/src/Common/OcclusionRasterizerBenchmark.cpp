@@ -0,0 +1,150 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "OcclusionRasterizer.hpp"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+#include "FastRand.hpp"
+#include "ThreadPool.hpp"
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Compares OcclusionRasterizer with a depth rasterizer built on the RasterizeTriangle callback.
+// The triangles are up to about 80x40 pixels, which is typical for simplified occluder meshes.
+class OcclusionRasterizerBenchmark
+{
+public:
+    static constexpr Uint32 Width        = 256;
+    static constexpr Uint32 Height       = 128;
+    static constexpr Uint32 NumTriangles = 20000;
+    static constexpr Uint32 NumRuns      = 10;
+
+    OcclusionRasterizerBenchmark() :
+        m_Verts(NumTriangles * 3),
+        m_Indices(NumTriangles * 3),
+        m_Depth(Width * Height)
+    {
+        FastRandFloat Rnd{0, -1, 1};
+        for (Uint32 t = 0; t < NumTriangles; ++t)
+        {
+            const float3 Center{Rnd() * 1.1f, Rnd() * 1.1f, Rnd() * 0.5f + 0.5f};
+            for (Uint32 v = 0; v < 3; ++v)
+            {
+                m_Verts[t * 3 + v]   = Center + float3{Rnd() * 0.3f, Rnd() * 0.3f, Rnd() * 0.01f};
+                m_Indices[t * 3 + v] = t * 3 + v;
+            }
+        }
+
+        m_Mesh.pVertices     = m_Verts.data();
+        m_Mesh.NumVertices   = static_cast<Uint32>(m_Verts.size());
+        m_Mesh.pIndices      = m_Indices.data();
+        m_Mesh.NumIndices    = static_cast<Uint32>(m_Indices.size());
+        m_Mesh.CullBackFaces = false;
+    }
+
+    // Returns the number of triangles per second
+    double RunRasterizeTriangle()
+    {
+        const double Time = MeasureMinTime(NumRuns, [&]() {
+            std::fill(m_Depth.begin(), m_Depth.end(), 1.f);
+            for (Uint32 t = 0; t < NumTriangles; ++t)
+            {
+                float3 V[3];
+                for (Uint32 v = 0; v < 3; ++v)
+                {
+                    const float3& Pos = m_Verts[m_Indices[t * 3 + v]];
+                    V[v]              = float3{(Pos.x * 0.5f + 0.5f) * Width, (0.5f - Pos.y * 0.5f) * Height, Pos.z};
+                }
+
+                const float Area = (V[1].x - V[0].x) * (V[2].y - V[0].y) - (V[2].x - V[0].x) * (V[1].y - V[0].y);
+                if (Area == 0)
+                    continue;
+
+                RasterizeTriangle(float2{V[0].x, V[0].y}, float2{V[1].x, V[1].y}, float2{V[2].x, V[2].y}, [&](const int2& Pixel) {
+                    if (Pixel.x < 0 || Pixel.y < 0 || Pixel.x >= static_cast<int>(Width) || Pixel.y >= static_cast<int>(Height))
+                        return;
+
+                    const float2 P{static_cast<float>(Pixel.x), static_cast<float>(Pixel.y)};
+
+                    const float W1 = ((P.x - V[0].x) * (V[2].y - V[0].y) - (V[2].x - V[0].x) * (P.y - V[0].y)) / Area;
+                    const float W2 = ((V[1].x - V[0].x) * (P.y - V[0].y) - (P.x - V[0].x) * (V[1].y - V[0].y)) / Area;
+                    const float Z  = V[0].z + (V[1].z - V[0].z) * W1 + (V[2].z - V[0].z) * W2;
+
+                    float& D = m_Depth[Pixel.y * Width + Pixel.x];
+                    D        = std::min(D, Z);
+                });
+            }
+        });
+        return GetRate(NumTriangles, Time);
+    }
+
+    double RunOcclusionRasterizer(IThreadPool* pThreadPool)
+    {
+        const double Time = MeasureMinTime(NumRuns, [&]() {
+            m_Rasterizer.Clear();
+            m_Rasterizer.RasterizeOccluders(&m_Mesh, 1, false, pThreadPool);
+        });
+        return GetRate(NumTriangles, Time);
+    }
+
+private:
+    std::vector<float3> m_Verts;
+    std::vector<Uint32> m_Indices;
+    std::vector<float>  m_Depth;
+
+    OccluderMeshDesc    m_Mesh;
+    OcclusionRasterizer m_Rasterizer{Width, Height};
+};
+
+TEST(Common_OcclusionRasterizerBenchmark, DISABLED_RasterizeOccluders)
+{
+    constexpr double K = 1e3;
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_TRUE(pThreadPool);
+
+    OcclusionRasterizerBenchmark Benchmark;
+
+    const double CallbackRate = Benchmark.RunRasterizeTriangle();
+    const double TiledRate    = Benchmark.RunOcclusionRasterizer(nullptr);
+    const double TiledMTRate  = Benchmark.RunOcclusionRasterizer(pThreadPool);
+
+    BenchmarkTable Table{"Occluder depth rasterization, 20K triangles, 256x128, thousands of triangles per second",
+                         {"RasterizeTriangle", "Tiled", "Ratio", "Tiled, 4 threads", "Ratio"}};
+    Table.AddRow({BenchmarkTable::Number(CallbackRate / K), BenchmarkTable::Number(TiledRate / K), BenchmarkTable::Ratio(TiledRate, CallbackRate),
+                  BenchmarkTable::Number(TiledMTRate / K), BenchmarkTable::Ratio(TiledMTRate, CallbackRate)});
+    Table.Print();
+}
+
+} // namespace
@@ -0,0 +1,353 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "OcclusionRasterizer.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "FastRand.hpp"
+#include "ThreadPool.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+constexpr Uint32 Width  = 128;
+constexpr Uint32 Height = 64;
+
+// Clip-space triangles with w = 1
+struct TriangleSoup
+{
+    std::vector<float3> Verts;
+    std::vector<Uint32> Indices;
+
+    void AddTriangle(const float3& V0, const float3& V1, const float3& V2)
+    {
+        for (const float3& V : {V0, V1, V2})
+        {
+            Indices.push_back(static_cast<Uint32>(Verts.size()));
+            Verts.push_back(V);
+        }
+    }
+
+    OccluderMeshDesc GetMesh(bool CullBackFaces = false) const
+    {
+        OccluderMeshDesc Mesh;
+        Mesh.pVertices     = Verts.data();
+        Mesh.NumVertices   = static_cast<Uint32>(Verts.size());
+        Mesh.pIndices      = Indices.data();
+        Mesh.NumIndices    = static_cast<Uint32>(Indices.size());
+        Mesh.CullBackFaces = CullBackFaces;
+        return Mesh;
+    }
+};
+
+TriangleSoup GenerateTriangles(Uint32 NumTriangles, unsigned int Seed)
+{
+    FastRandFloat Rnd{Seed, -1, 1};
+
+    TriangleSoup Soup;
+    for (Uint32 t = 0; t < NumTriangles; ++t)
+    {
+        const float3 Center{Rnd() * 1.2f, Rnd() * 1.2f, Rnd() * 0.5f + 0.5f};
+        const float  Size = Rnd() * 0.2f + 0.25f;
+
+        float3 V[3];
+        for (auto& v : V)
+            v = Center + float3{Rnd() * Size, Rnd() * Size, Rnd() * 0.2f};
+        Soup.AddTriangle(V[0], V[1], V[2]);
+    }
+    return Soup;
+}
+
+// Computes the depth of every pixel by testing every triangle, in double precision.
+// Pixels whose centers are too close to the edges of any triangle are marked with -1.
+std::vector<float> RasterizeReference(const TriangleSoup& Soup)
+{
+    std::vector<float> Depth(Width * Height, 1.f);
+    for (size_t t = 0; t < Soup.Indices.size(); t += 3)
+    {
+        double X[3], Y[3], Z[3];
+        for (Uint32 i = 0; i < 3; ++i)
+        {
+            const float3& V = Soup.Verts[Soup.Indices[t + i]];
+            X[i]            = (V.x * 0.5 + 0.5) * Width;
+            Y[i]            = (0.5 - V.y * 0.5) * Height;
+            Z[i]            = V.z;
+        }
+        const double Area = (X[1] - X[0]) * (Y[2] - Y[0]) - (X[2] - X[0]) * (Y[1] - Y[0]);
+        if (Area == 0)
+            continue;
+
+        for (Uint32 y = 0; y < Height; ++y)
+        {
+            for (Uint32 x = 0; x < Width; ++x)
+            {
+                const double Px = x + 0.5;
+                const double Py = y + 0.5;
+
+                double W[3];
+                bool   IsNearEdge = false;
+                for (Uint32 i = 0; i < 3; ++i)
+                {
+                    const Uint32 j = (i + 1) % 3;
+                    const double E = ((X[j] - X[i]) * (Py - Y[i]) - (Y[j] - Y[i]) * (Px - X[i])) / Area;
+                    W[(i + 2) % 3] = E;
+                    IsNearEdge     = IsNearEdge || std::abs(E) < 1e-3;
+                }
+                if (W[0] < 0 || W[1] < 0 || W[2] < 0)
+                    continue;
+
+                float& D = Depth[y * Width + x];
+                if (IsNearEdge)
+                {
+                    D = -1;
+                    continue;
+                }
+
+                const float PixelZ = static_cast<float>(W[0] * Z[0] + W[1] * Z[1] + W[2] * Z[2]);
+                if (D >= 0 && PixelZ < D)
+                    D = PixelZ;
+            }
+        }
+    }
+    return Depth;
+}
+
+std::vector<float> ReadDepth(const OcclusionRasterizer& Rasterizer)
+{
+    std::vector<float> Depth(size_t{Rasterizer.GetWidth()} * Rasterizer.GetHeight());
+    Rasterizer.ReadDepth(Depth.data());
+    return Depth;
+}
+
+TEST(Common_OcclusionRasterizer, Clear)
+{
+    OcclusionRasterizer Rasterizer{100, 50};
+    EXPECT_EQ(Rasterizer.GetWidth(), 104u);
+    EXPECT_EQ(Rasterizer.GetHeight(), 56u);
+
+    for (float D : ReadDepth(Rasterizer))
+        EXPECT_EQ(D, 1.f);
+
+    EXPECT_TRUE(Rasterizer.IsRectVisible(10, 10, 20, 20, 0.99f));
+    EXPECT_FALSE(Rasterizer.IsRectVisible(10, 10, 20, 20, 1.f));
+    EXPECT_FALSE(Rasterizer.IsRectVisible(-20, 10, -10, 20, 0.f));
+    EXPECT_FALSE(Rasterizer.IsRectVisible(10, 60, 20, 70, 0.f));
+    EXPECT_FALSE(Rasterizer.IsRectVisible(20, 10, 10, 20, 0.f));
+}
+
+TEST(Common_OcclusionRasterizer, FullScreenQuad)
+{
+    TriangleSoup Soup;
+    Soup.AddTriangle(float3{-1, 1, 0.5f}, float3{3, 1, 0.5f}, float3{-1, -3, 0.5f});
+
+    OcclusionRasterizer    Rasterizer{Width, Height};
+    const OccluderMeshDesc Mesh = Soup.GetMesh(true);
+    Rasterizer.RasterizeOccluders(&Mesh, 1, false);
+
+    for (float D : ReadDepth(Rasterizer))
+        EXPECT_EQ(D, 0.5f);
+    EXPECT_EQ(Rasterizer.GetTileMaxDepth(0, 0), 0.5f);
+
+    EXPECT_FALSE(Rasterizer.IsRectVisible(0, 0, Width, Height, 0.6f));
+    EXPECT_FALSE(Rasterizer.IsRectVisible(10.5f, 3.25f, 11.f, 4.f, 0.5f));
+    EXPECT_TRUE(Rasterizer.IsRectVisible(10.5f, 3.25f, 11.f, 4.f, 0.4f));
+
+    Rasterizer.Clear();
+    EXPECT_TRUE(Rasterizer.IsRectVisible(0, 0, Width, Height, 0.6f));
+}
+
+TEST(Common_OcclusionRasterizer, BackFaces)
+{
+    // Counter-clockwise on the screen
+    TriangleSoup Soup;
+    Soup.AddTriangle(float3{-1, 1, 0.5f}, float3{-1, -3, 0.5f}, float3{3, 1, 0.5f});
+
+    OcclusionRasterizer Rasterizer{Width, Height};
+
+    OccluderMeshDesc Mesh = Soup.GetMesh(true);
+    Rasterizer.RasterizeOccluders(&Mesh, 1, false);
+    EXPECT_EQ(Rasterizer.GetDepth(10, 10), 1.f);
+
+    Mesh.CullBackFaces = false;
+    Rasterizer.RasterizeOccluders(&Mesh, 1, false);
+    EXPECT_EQ(Rasterizer.GetDepth(10, 10), 0.5f);
+}
+
+TEST(Common_OcclusionRasterizer, CompareWithReference)
+{
+    const TriangleSoup       Soup   = GenerateTriangles(300, 1);
+    const std::vector<float> RefDepth = RasterizeReference(Soup);
+
+    OcclusionRasterizer    Rasterizer{Width, Height};
+    const OccluderMeshDesc Mesh = Soup.GetMesh();
+    Rasterizer.RasterizeOccluders(&Mesh, 1, false);
+
+    const std::vector<float> Depth = ReadDepth(Rasterizer);
+
+    Uint32 NumCovered = 0;
+    for (Uint32 y = 0; y < Height; ++y)
+    {
+        for (Uint32 x = 0; x < Width; ++x)
+        {
+            const float Ref = RefDepth[y * Width + x];
+            const float D   = Depth[y * Width + x];
+            if (Ref < 0)
+                continue;
+            EXPECT_NEAR(D, Ref, 1e-5f) << "x=" << x << " y=" << y;
+            NumCovered += Ref < 1 ? 1 : 0;
+        }
+    }
+    EXPECT_GT(NumCovered, Width * Height / 2);
+
+    // Tile maximum depths must be conservative
+    for (Uint32 y = 0; y < Height; ++y)
+    {
+        for (Uint32 x = 0; x < Width; ++x)
+            EXPECT_LE(Depth[y * Width + x], Rasterizer.GetTileMaxDepth(x, y));
+    }
+}
+
+TEST(Common_OcclusionRasterizer, ThreadPool)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_TRUE(pThreadPool);
+
+    // Several meshes with enough triangles for multiple batches
+    std::vector<TriangleSoup>     Soups;
+    std::vector<OccluderMeshDesc> Meshes;
+    for (Uint32 m = 0; m < 5; ++m)
+        Soups.push_back(GenerateTriangles(3000 + m * 10, m));
+    for (const auto& Soup : Soups)
+        Meshes.push_back(Soup.GetMesh(false));
+
+    OcclusionRasterizer Rasterizer{256, 128};
+    Rasterizer.RasterizeOccluders(Meshes.data(), static_cast<Uint32>(Meshes.size()), false);
+    const std::vector<float> Depth = ReadDepth(Rasterizer);
+
+    Rasterizer.Clear();
+    Rasterizer.RasterizeOccluders(Meshes.data(), static_cast<Uint32>(Meshes.size()), false, pThreadPool);
+    EXPECT_EQ(ReadDepth(Rasterizer), Depth);
+}
+
+// A wall that covers the view at distance 10
+TriangleSoup CreateWall()
+{
+    TriangleSoup Soup;
+    Soup.AddTriangle(float3{-5, 5, 10}, float3{5, 5, 10}, float3{-5, -5, 10});
+    Soup.AddTriangle(float3{5, 5, 10}, float3{5, -5, 10}, float3{-5, -5, 10});
+    return Soup;
+}
+
+TEST(Common_OcclusionRasterizer, Boxes)
+{
+    for (bool IsGL : {false, true})
+    {
+        const float4x4 ViewProj = float4x4::Projection(PI_F / 4.f, 2.f, 1.f, 100.f, IsGL);
+
+        const TriangleSoup Wall = CreateWall();
+        OccluderMeshDesc   Mesh = Wall.GetMesh(true);
+        Mesh.WorldViewProj      = ViewProj;
+
+        OcclusionRasterizer Rasterizer{Width, Height};
+        Rasterizer.RasterizeOccluders(&Mesh, 1, IsGL);
+        EXPECT_LT(Rasterizer.GetDepth(Width / 2, Height / 2), 1.f);
+
+        // Behind the wall
+        EXPECT_FALSE(Rasterizer.IsBoxVisible(BoundBox{float3{-1, -1, 15}, float3{1, 1, 20}}, ViewProj, IsGL));
+        // Touches the wall
+        EXPECT_FALSE(Rasterizer.IsBoxVisible(BoundBox{float3{-1, -1, 10}, float3{1, 1, 20}}, ViewProj, IsGL));
+        // In front of the wall
+        EXPECT_TRUE(Rasterizer.IsBoxVisible(BoundBox{float3{-1, -1, 5}, float3{1, 1, 6}}, ViewProj, IsGL));
+        // Behind the wall, but sticks out of it
+        EXPECT_TRUE(Rasterizer.IsBoxVisible(BoundBox{float3{4, -1, 15}, float3{8, 1, 20}}, ViewProj, IsGL));
+        // Crosses the near plane
+        EXPECT_TRUE(Rasterizer.IsBoxVisible(BoundBox{float3{-1, -1, -1}, float3{1, 1, 20}}, ViewProj, IsGL));
+        // Outside of the screen
+        EXPECT_FALSE(Rasterizer.IsBoxVisible(BoundBox{float3{100, -1, 15}, float3{101, 1, 20}}, ViewProj, IsGL));
+
+        FastRandFloat         Rnd{0, -1, 1};
+        std::vector<BoundBox> Boxes(1000);
+        for (auto& Box : Boxes)
+        {
+            const float3 Center{Rnd() * 10, Rnd() * 10, Rnd() * 10 + 12};
+            Box = BoundBox{Center - float3{0.5f, 0.5f, 0.5f}, Center + float3{0.5f, 0.5f, 0.5f}};
+        }
+
+        RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+        std::vector<Uint32>        VisibleMask((Boxes.size() + 31) / 32, ~0u);
+        Rasterizer.TestBoxes(Boxes.data(), Boxes.size(), ViewProj, IsGL, VisibleMask.data(), pThreadPool);
+
+        size_t NumVisible = 0;
+        for (size_t i = 0; i < Boxes.size(); ++i)
+        {
+            const bool IsVisible = (VisibleMask[i / 32] & (1u << (i % 32))) != 0;
+            EXPECT_EQ(IsVisible, Rasterizer.IsBoxVisible(Boxes[i], ViewProj, IsGL)) << "Box " << i;
+            NumVisible += IsVisible ? 1 : 0;
+        }
+        EXPECT_GT(NumVisible, size_t{0});
+        EXPECT_LT(NumVisible, Boxes.size());
+    }
+}
+
+TEST(Common_OcclusionRasterizer, NearPlaneClipping)
+{
+    // A floor that starts behind the camera
+    TriangleSoup Soup;
+    Soup.AddTriangle(float3{-50, -1, -10}, float3{-50, -1, 90}, float3{50, -1, -10});
+    Soup.AddTriangle(float3{50, -1, -10}, float3{-50, -1, 90}, float3{50, -1, 90});
+
+    for (bool IsGL : {false, true})
+    {
+        const float4x4 ViewProj = float4x4::Projection(PI_F / 4.f, 2.f, 1.f, 100.f, IsGL);
+
+        OccluderMeshDesc Mesh = Soup.GetMesh(false);
+        Mesh.WorldViewProj    = ViewProj;
+
+        OcclusionRasterizer Rasterizer{Width, Height};
+        Rasterizer.RasterizeOccluders(&Mesh, 1, IsGL);
+
+        // The bottom row is covered by the floor, the top row is not
+        for (Uint32 x = 0; x < Width; ++x)
+        {
+            EXPECT_LT(Rasterizer.GetDepth(x, Height - 1), 1.f);
+            EXPECT_GE(Rasterizer.GetDepth(x, Height - 1), 0.f);
+            EXPECT_EQ(Rasterizer.GetDepth(x, 0), 1.f);
+        }
+
+        // Below the floor
+        EXPECT_FALSE(Rasterizer.IsBoxVisible(BoundBox{float3{-1, -3, 10}, float3{1, -2, 12}}, ViewProj, IsGL));
+        // Above the floor
+        EXPECT_TRUE(Rasterizer.IsBoxVisible(BoundBox{float3{-1, 0, 10}, float3{1, 1, 12}}, ViewProj, IsGL));
+    }
+}
+
+} // namespace
@@ -0,0 +1,225 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ParallelFor.hpp"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+
+using namespace Diligent;
+
+namespace
+{
+
+RefCntAutoPtr<IThreadPool> CreateTestThreadPool(Uint32 NumThreads, THREAD_POOL_SCHEDULER Scheduler = THREAD_POOL_SCHEDULER_PRIORITY_QUEUE)
+{
+    ThreadPoolCreateInfo PoolCI;
+    PoolCI.NumThreads = NumThreads;
+    PoolCI.Scheduler  = Scheduler;
+    return CreateThreadPool(PoolCI);
+}
+
+void TestParallelForCoverage(IThreadPool* pThreadPool)
+{
+    struct RangeInfo
+    {
+        size_t Begin;
+        size_t End;
+        size_t Grain;
+    };
+    const RangeInfo Ranges[] = {
+        {0, 0, 1},
+        {5, 5, 0},
+        {0, 1, 1},
+        {0, 1, 16},
+        {3, 100, 0},
+        {0, 1000, 1},
+        {17, 1017, 7},
+        {0, 100000, 64},
+        {100, 50000, 100000},
+    };
+
+    for (const auto& Range : Ranges)
+    {
+        std::vector<std::atomic<int>> Counters(Range.End);
+        for (auto& Counter : Counters)
+            Counter.store(0);
+
+        std::atomic<size_t> NumCalls{0};
+        ParallelFor(pThreadPool, Range.Begin, Range.End, Range.Grain,
+                    [&](size_t ChunkBegin, size_t ChunkEnd) {
+                        EXPECT_LT(ChunkBegin, ChunkEnd);
+                        EXPECT_GE(ChunkBegin, Range.Begin);
+                        EXPECT_LE(ChunkEnd, Range.End);
+                        if (ChunkEnd != Range.End)
+                        {
+                            EXPECT_GE(ChunkEnd - ChunkBegin, std::max(Range.Grain, size_t{1}));
+                        }
+                        for (size_t i = ChunkBegin; i < ChunkEnd; ++i)
+                            Counters[i].fetch_add(1);
+                        NumCalls.fetch_add(1);
+                    });
+
+        for (size_t i = 0; i < Range.End; ++i)
+            EXPECT_EQ(Counters[i].load(), i >= Range.Begin ? 1 : 0) << "Index " << i;
+
+        if (Range.Begin >= Range.End)
+        {
+            EXPECT_EQ(NumCalls.load(), size_t{0});
+        }
+    }
+}
+
+TEST(Common_ParallelFor, NullThreadPool)
+{
+    TestParallelForCoverage(nullptr);
+
+    size_t NumCalls = 0;
+    ParallelFor(nullptr, 0, 1000, 1, [&](size_t ChunkBegin, size_t ChunkEnd) {
+        EXPECT_EQ(ChunkBegin, size_t{0});
+        EXPECT_EQ(ChunkEnd, size_t{1000});
+        ++NumCalls;
+    });
+    EXPECT_EQ(NumCalls, size_t{1});
+}
+
+TEST(Common_ParallelFor, Coverage)
+{
+    for (Uint32 NumThreads : {0u, 1u, 4u})
+    {
+        TestParallelForCoverage(CreateTestThreadPool(NumThreads));
+        TestParallelForCoverage(CreateTestThreadPool(NumThreads, THREAD_POOL_SCHEDULER_WORK_STEALING));
+    }
+}
+
+TEST(Common_ParallelFor, NumHelpers)
+{
+    for (THREAD_POOL_SCHEDULER Scheduler : {THREAD_POOL_SCHEDULER_PRIORITY_QUEUE, THREAD_POOL_SCHEDULER_WORK_STEALING})
+    {
+        constexpr Uint32 NumThreads  = 2;
+        auto             pThreadPool = CreateTestThreadPool(NumThreads, Scheduler);
+        EXPECT_EQ(pThreadPool->GetThreadCount(), NumThreads);
+
+        // No more helper tasks than worker threads must be enqueued, regardless of the number of cores
+        const std::thread::id MainThreadId = std::this_thread::get_id();
+        Uint32                MaxNumTasks  = 0;
+        ParallelFor(pThreadPool, 0, 1000, 1, [&](size_t, size_t) {
+            if (std::this_thread::get_id() == MainThreadId)
+                MaxNumTasks = std::max(MaxNumTasks, pThreadPool->GetQueueSize() + pThreadPool->GetRunningTaskCount());
+        });
+        EXPECT_LE(MaxNumTasks, NumThreads);
+    }
+
+    EXPECT_EQ(CreateTestThreadPool(0)->GetThreadCount(), 0u);
+}
+
+TEST(Common_ParallelFor, Nested)
+{
+    auto pThreadPool = CreateTestThreadPool(4, THREAD_POOL_SCHEDULER_WORK_STEALING);
+
+    constexpr size_t NumRows = 64;
+    constexpr size_t NumCols = 256;
+
+    std::vector<std::atomic<int>> Counters(NumRows * NumCols);
+    for (auto& Counter : Counters)
+        Counter.store(0);
+
+    // Inner loops must make progress even when all workers are busy with outer chunks
+    ParallelFor(pThreadPool, 0, NumRows, 1, [&](size_t RowBegin, size_t RowEnd) {
+        for (size_t row = RowBegin; row < RowEnd; ++row)
+        {
+            ParallelFor(pThreadPool, 0, NumCols, 16, [&](size_t ColBegin, size_t ColEnd) {
+                for (size_t col = ColBegin; col < ColEnd; ++col)
+                    Counters[row * NumCols + col].fetch_add(1);
+            });
+        }
+    });
+
+    for (size_t i = 0; i < Counters.size(); ++i)
+        EXPECT_EQ(Counters[i].load(), 1) << "Index " << i;
+}
+
+TEST(Common_TaskGroup, NoThreads)
+{
+    auto pThreadPool = CreateTestThreadPool(0);
+
+    std::vector<int> Results(16);
+    {
+        TaskGroup Group{pThreadPool};
+        for (size_t i = 0; i < Results.size(); ++i)
+            Group.Run([&Results, i]() { Results[i] = static_cast<int>(i); });
+
+        // The pool has no threads, so all functions are executed by Wait()
+        Group.Wait();
+    }
+    for (size_t i = 0; i < Results.size(); ++i)
+        EXPECT_EQ(Results[i], static_cast<int>(i));
+
+    // Wait() must have removed the pool tasks
+    EXPECT_EQ(pThreadPool->GetQueueSize(), Uint32{0});
+}
+
+TEST(Common_TaskGroup, Run)
+{
+    for (auto Scheduler : {THREAD_POOL_SCHEDULER_PRIORITY_QUEUE, THREAD_POOL_SCHEDULER_WORK_STEALING})
+    {
+        auto pThreadPool = CreateTestThreadPool(4, Scheduler);
+
+        std::atomic<int> Sum{0};
+        for (int iter = 0; iter < 8; ++iter)
+        {
+            TaskGroup Group{iter % 2 == 0 ? pThreadPool.RawPtr() : nullptr};
+            for (int i = 1; i <= 100; ++i)
+                Group.Run([&Sum, i]() { Sum.fetch_add(i); });
+            Group.Wait();
+            EXPECT_EQ(Sum.load(), 5050 * (iter + 1));
+
+            // Wait() may be called multiple times
+            Group.Wait();
+        }
+        pThreadPool->WaitForAllTasks();
+    }
+}
+
+TEST(Common_TaskGroup, Destructor)
+{
+    auto pThreadPool = CreateTestThreadPool(2);
+
+    std::atomic<int> NumExecuted{0};
+    {
+        TaskGroup Group{pThreadPool};
+        for (int i = 0; i < 32; ++i)
+            Group.Run([&NumExecuted]() { NumExecuted.fetch_add(1); });
+        // The destructor waits for all functions
+    }
+    EXPECT_EQ(NumExecuted.load(), 32);
+}
+
+} // namespace
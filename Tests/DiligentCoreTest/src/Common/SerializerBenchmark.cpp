@@ -0,0 +1,116 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Serializer.hpp"
+#include "AlignedDataBlob.hpp"
+#include "ChunkedMemoryFileStream.hpp"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Serializes a large number of named records with binary payloads, which resembles
+// a device object archive, and writes the result to a file stream.
+class SerializeToStreamBenchmark
+{
+public:
+    static constexpr size_t NumRecords  = size_t{1} << 18;
+    static constexpr size_t PayloadSize = 200;
+    static constexpr Uint32 NumRuns     = 3;
+
+    SerializeToStreamBenchmark() :
+        m_Payload(PayloadSize)
+    {
+        for (size_t i = 0; i < m_Payload.size(); ++i)
+            m_Payload[i] = static_cast<Uint8>(i * 7);
+    }
+
+    template <SerializerMode Mode>
+    void Serialize(Serializer<Mode>& Ser) const
+    {
+        const char* Name = "Record name";
+        for (Uint32 i = 0; i < NumRecords; ++i)
+        {
+            const bool res = Ser(i, Name) && Ser.SerializeBytes(m_Payload.data(), m_Payload.size());
+            VERIFY_EXPR(res);
+            (void)res;
+        }
+    }
+
+    template <typename SerializeType>
+    double Run(SerializeType&& SerializeToStream) const
+    {
+        return MeasureMinTime(NumRuns, [&]() {
+            RefCntAutoPtr<ChunkedMemoryFileStream> pStream = ChunkedMemoryFileStream::Create();
+            SerializeToStream(pStream.RawPtr());
+            VERIFY_EXPR(pStream->GetSize() > NumRecords * PayloadSize);
+        });
+    }
+
+private:
+    std::vector<Uint8> m_Payload;
+};
+
+TEST(Common_SerializerBenchmark, DISABLED_SerializeToStream)
+{
+    const SerializeToStreamBenchmark Benchmark;
+
+    const double TwoPassTime = Benchmark.Run([&](IFileStream* pStream) {
+        Serializer<SerializerMode::Measure> Measurer;
+        Benchmark.Serialize(Measurer);
+
+        RefCntAutoPtr<AlignedDataBlob> pData = AlignedDataBlob::Create(Measurer.GetSize());
+
+        Serializer<SerializerMode::Write> Writer{SerializedData{pData->GetDataPtr(), pData->GetSize()}};
+        Benchmark.Serialize(Writer);
+        VERIFY_EXPR(Writer.IsEnded());
+
+        pStream->Write(pData->GetConstDataPtr(), pData->GetSize());
+    });
+
+    const double StreamTime = Benchmark.Run([&](IFileStream* pStream) {
+        Serializer<SerializerMode::Stream> Streamer{pStream};
+        Benchmark.Serialize(Streamer);
+    });
+
+    BenchmarkTable Table{"Serializing " + std::to_string(SerializeToStreamBenchmark::NumRecords) + " records with " +
+                             std::to_string(SerializeToStreamBenchmark::PayloadSize) + "-byte payloads to a stream",
+                         {"Mode", "Time, ms", "Speedup"}};
+    Table.AddRow({"Measure + Write", BenchmarkTable::Number(TwoPassTime * 1000, 1), BenchmarkTable::Ratio(1, 1)});
+    Table.AddRow({"Stream", BenchmarkTable::Number(StreamTime * 1000, 1), BenchmarkTable::Ratio(TwoPassTime, StreamTime)});
+    Table.Print();
+}
+
+} // namespace
@@ -25,9 +25,11 @@
  */
 
 #include <cstring>
+#include <type_traits>
 
 #include "Serializer.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
+#include "ChunkedMemoryFileStream.hpp"
 
 #include "gtest/gtest.h"
 
@@ -36,6 +38,13 @@ using namespace Diligent;
 namespace
 {
 
+// Only the Stream mode serializer owns a stream buffer that must be flushed exactly once
+static_assert(std::is_copy_constructible<Serializer<SerializerMode::Read>>::value && std::is_move_constructible<Serializer<SerializerMode::Read>>::value, "Read serializer must be copyable and movable");
+static_assert(std::is_copy_constructible<Serializer<SerializerMode::Write>>::value && std::is_move_constructible<Serializer<SerializerMode::Write>>::value, "Write serializer must be copyable and movable");
+static_assert(std::is_copy_constructible<Serializer<SerializerMode::Measure>>::value && std::is_move_constructible<Serializer<SerializerMode::Measure>>::value, "Measure serializer must be copyable and movable");
+static_assert(!std::is_copy_constructible<Serializer<SerializerMode::Stream>>::value, "Stream serializer must not be copyable");
+static_assert(sizeof(Serializer<SerializerMode::Read>) == sizeof(void*) * 3, "Read serializer must not carry the stream state");
+
 TEST(SerializerTest, SerializerTest)
 {
     const char* const RefStr      = "serialized text";
@@ -170,6 +179,98 @@ TEST(SerializerTest, SerializerTest)
         EXPECT_TRUE(WSer.IsEnded());
         EXPECT_TRUE(Data == Data2);
     }
+
+    for (size_t BufferSize : {size_t{1}, size_t{4}, size_t{16}, Serializer<SerializerMode::Stream>::DefaultStreamBufferSize})
+    {
+        RefCntAutoPtr<ChunkedMemoryFileStream> pStream = ChunkedMemoryFileStream::Create(8);
+        {
+            Serializer<SerializerMode::Stream> SSer{pStream, BufferSize};
+            WriteData(SSer);
+            EXPECT_EQ(SSer.GetSize(), Data.Size());
+        }
+        RefCntAutoPtr<IDataBlob> pStreamData = pStream->DetachData();
+        ASSERT_EQ(pStreamData->GetSize(), Data.Size()) << "Buffer size: " << BufferSize;
+        EXPECT_EQ(std::memcmp(pStreamData->GetConstDataPtr(), Data.Ptr(), Data.Size()), 0) << "Buffer size: " << BufferSize;
+    }
+}
+
+TEST(SerializerTest, Patch)
+{
+    const Uint32 RefBytes[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+    const Uint32 RefSize    = 0x12345678u;
+    const Uint64 RefOffset  = 0xABCDEF0123456789ull;
+
+    const auto WriteData = [&](auto& Ser) {
+        // Placeholders for the values that are only known after the data is written
+        const Uint32 SizePlaceholder   = 0;
+        const Uint64 OffsetPlaceholder = 0;
+
+        const size_t SizeOffset = Ser.GetSize();
+        EXPECT_TRUE(Ser(SizePlaceholder));
+        EXPECT_TRUE(Ser.SerializeBytes(RefBytes, sizeof(RefBytes), 16));
+        const size_t OffsetOffset = Ser.GetSize();
+        EXPECT_TRUE(Ser(OffsetPlaceholder));
+        EXPECT_TRUE(Ser.CopyBytes(RefBytes, 6));
+
+        EXPECT_TRUE(Ser.Patch(SizeOffset, RefSize));
+        EXPECT_TRUE(Ser.Patch(OffsetOffset, RefOffset));
+    };
+
+    auto& RawAllocator{DefaultRawMemoryAllocator::GetAllocator()};
+
+    Serializer<SerializerMode::Measure> MSer;
+    WriteData(MSer);
+
+    SerializedData Data = MSer.AllocateData(RawAllocator);
+    {
+        Serializer<SerializerMode::Write> WSer{Data};
+        WriteData(WSer);
+        EXPECT_TRUE(WSer.IsEnded());
+    }
+
+    {
+        Serializer<SerializerMode::Read> RSer{Data};
+
+        Uint32 Size = 0;
+        EXPECT_TRUE(RSer(Size));
+        EXPECT_EQ(Size, RefSize);
+
+        size_t      NumBytes = 0;
+        const void* pBytes   = nullptr;
+        EXPECT_TRUE(RSer.SerializeBytes(pBytes, NumBytes, 16));
+        ASSERT_EQ(NumBytes, sizeof(RefBytes));
+        EXPECT_EQ(std::memcmp(pBytes, RefBytes, NumBytes), 0);
+        // Alignment padding must be zeroed
+        for (size_t i = sizeof(Uint32) * 2; i < 16; ++i)
+            EXPECT_EQ(Data.Ptr<const Uint8>()[i], 0) << i;
+
+        Uint64 Offset = 0;
+        EXPECT_TRUE(RSer(Offset));
+        EXPECT_EQ(Offset, RefOffset);
+    }
+
+    // Patched ranges may be in the intermediate buffer, in the stream, or span both
+    for (size_t BufferSize : {size_t{1}, size_t{3}, size_t{8}, size_t{24}, size_t{1024}})
+    {
+        RefCntAutoPtr<ChunkedMemoryFileStream> pStream = ChunkedMemoryFileStream::Create(16);
+
+        // The data must be written at the current position of the stream
+        const char Prefix[] = "prefix";
+        pStream->Write(Prefix, sizeof(Prefix));
+
+        {
+            Serializer<SerializerMode::Stream> SSer{pStream, BufferSize};
+            WriteData(SSer);
+            EXPECT_TRUE(SSer.Flush());
+            EXPECT_EQ(pStream->GetSize(), sizeof(Prefix) + Data.Size());
+        }
+
+        RefCntAutoPtr<IDataBlob> pStreamData = pStream->DetachData();
+        ASSERT_EQ(pStreamData->GetSize(), sizeof(Prefix) + Data.Size()) << "Buffer size: " << BufferSize;
+        const Uint8* pBytes = pStreamData->GetConstDataPtr<Uint8>();
+        EXPECT_EQ(std::memcmp(pBytes, Prefix, sizeof(Prefix)), 0) << "Buffer size: " << BufferSize;
+        EXPECT_EQ(std::memcmp(pBytes + sizeof(Prefix), Data.Ptr(), Data.Size()), 0) << "Buffer size: " << BufferSize;
+    }
 }
 
 } // namespace
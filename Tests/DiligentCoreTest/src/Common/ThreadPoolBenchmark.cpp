@@ -0,0 +1,182 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ThreadPool.hpp"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Measures the thread pool throughput for 1 to N worker threads
+// with tiny and heavy tasks, and prints the results.
+class ThreadPoolBenchmark
+{
+public:
+    static double Run(THREAD_POOL_SCHEDULER Scheduler, Uint32 NumThreads, Uint32 NumTasks, Uint32 TaskWork)
+    {
+        ThreadPoolCreateInfo PoolCI{NumThreads};
+        PoolCI.Scheduler = Scheduler;
+
+        auto pThreadPool = CreateThreadPool(PoolCI);
+        EXPECT_NE(pThreadPool, nullptr);
+        if (!pThreadPool)
+            return 0;
+
+        std::atomic<Uint32> NumTasksCompleted{0};
+
+        Timer T;
+        for (Uint32 i = 0; i < NumTasks; ++i)
+        {
+            EnqueueAsyncWork(pThreadPool,
+                             [&NumTasksCompleted, TaskWork](Uint32 ThreadId) //
+                             {
+                                 float f = 0.5f;
+                                 for (Uint32 k = 0; k < TaskWork; ++k)
+                                     f = std::sin(f + 1.f);
+                                 // Prevent the compiler from optimizing the loop away
+                                 if (f == 2.f)
+                                     NumTasksCompleted.fetch_add(1);
+                                 NumTasksCompleted.fetch_add(1);
+                                 return ASYNC_TASK_STATUS_COMPLETE;
+                             });
+        }
+        pThreadPool->WaitForAllTasks();
+        const double ElapsedTime = T.GetElapsedTime();
+
+        EXPECT_EQ(NumTasksCompleted.load(), NumTasks);
+
+        return GetRate(NumTasks, ElapsedTime);
+    }
+
+    static void RunScalingTest(const char* Name, Uint32 NumTasks, Uint32 TaskWork)
+    {
+        BenchmarkTable Table{std::string{"Thread pool scaling ("} + Name + " tasks: " + std::to_string(NumTasks) + " tasks x " +
+                                 std::to_string(TaskWork) + " iterations)",
+                             {"Threads", "Priority queue, tasks/s", "Work stealing, tasks/s", "Speedup"}};
+        for (Uint32 NumThreads : GetBenchmarkThreadCounts())
+        {
+            const double PQThroughput = Run(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE, NumThreads, NumTasks, TaskWork);
+            const double WSThroughput = Run(THREAD_POOL_SCHEDULER_WORK_STEALING, NumThreads, NumTasks, TaskWork);
+            Table.AddRow({std::to_string(NumThreads), BenchmarkTable::Number(PQThroughput), BenchmarkTable::Number(WSThroughput),
+                          BenchmarkTable::Ratio(WSThroughput, PQThroughput)});
+        }
+        Table.Print();
+    }
+};
+
+TEST(Common_ThreadPoolBenchmark, DISABLED_TinyTasks)
+{
+    ThreadPoolBenchmark::RunScalingTest("tiny", 50000, 0);
+}
+
+TEST(Common_ThreadPoolBenchmark, DISABLED_HeavyTasks)
+{
+    ThreadPoolBenchmark::RunScalingTest("heavy", 2000, 5000);
+}
+
+
+// Measures the CPU time consumed by threads that wait for tasks to finish.
+// The tasks sleep, so almost all CPU time is consumed by the waiting threads.
+// Note that std::clock() measures the process CPU time on most platforms,
+// but measures the wall-clock time on Windows.
+double MeasureWaitersCPUTime(Uint32 NumWaiters, bool UseYieldLoop)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{1});
+    EXPECT_NE(pThreadPool, nullptr);
+    if (!pThreadPool)
+        return 0;
+
+    constexpr Uint32                    NumTasks = 8;
+    constexpr std::chrono::milliseconds TaskDuration{10};
+
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks(NumTasks);
+    for (auto& pTask : Tasks)
+    {
+        pTask = EnqueueAsyncWork(pThreadPool,
+                                 [TaskDuration](Uint32 ThreadId) //
+                                 {
+                                     std::this_thread::sleep_for(TaskDuration);
+                                     return ASYNC_TASK_STATUS_COMPLETE;
+                                 });
+    }
+
+    const std::clock_t StartTime = std::clock();
+
+    std::vector<std::thread> Waiters(NumWaiters);
+    for (auto& Waiter : Waiters)
+    {
+        Waiter = std::thread{
+            [&Tasks, UseYieldLoop]() {
+                for (auto& pTask : Tasks)
+                {
+                    if (UseYieldLoop)
+                    {
+                        while (!pTask->IsFinished())
+                            std::this_thread::yield();
+                    }
+                    else
+                    {
+                        pTask->WaitForCompletion();
+                    }
+                }
+            }};
+    }
+    for (auto& Waiter : Waiters)
+        Waiter.join();
+
+    const std::clock_t EndTime = std::clock();
+
+    pThreadPool->WaitForAllTasks();
+
+    return static_cast<double>(EndTime - StartTime) / CLOCKS_PER_SEC;
+}
+
+TEST(Common_ThreadPoolBenchmark, DISABLED_WaiterCPUTime)
+{
+    BenchmarkTable Table{"CPU time consumed by threads waiting for 8 tasks x 10 ms", {"Waiters", "Yield loop, ms", "WaitForCompletion, ms"}};
+    for (Uint32 NumWaiters : {1, 4, 16})
+    {
+        const double YieldLoopTime = MeasureWaitersCPUTime(NumWaiters, true);
+        const double BlockingTime  = MeasureWaitersCPUTime(NumWaiters, false);
+        Table.AddRow({std::to_string(NumWaiters), BenchmarkTable::Number(YieldLoopTime * 1000.0, 1), BenchmarkTable::Number(BlockingTime * 1000.0, 1)});
+    }
+    Table.Print();
+}
+
+} // namespace
@@ -0,0 +1,181 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ThreadPoolProfiler.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(Common_ThreadPoolProfiler, DurationHistogram)
+{
+    ThreadPoolDurationHistogram Histogram;
+    Histogram.AddSample(500);         // 0.5 us
+    Histogram.AddSample(1000);        // 1 us
+    Histogram.AddSample(3000);        // 3 us
+    Histogram.AddSample(10000000000); // 10 s
+    Histogram.AddSample(-10);         // Clamped to 0
+
+    EXPECT_EQ(Histogram.NumSamples, Uint64{5});
+    EXPECT_EQ(Histogram.Counts[0], Uint64{2});
+    EXPECT_EQ(Histogram.Counts[1], Uint64{1});
+    EXPECT_EQ(Histogram.Counts[2], Uint64{1});
+    EXPECT_EQ(Histogram.Counts[ThreadPoolDurationHistogram::NumBuckets - 1], Uint64{1});
+    EXPECT_DOUBLE_EQ(Histogram.MinTime, 0);
+    EXPECT_DOUBLE_EQ(Histogram.MaxTime, 10);
+    EXPECT_NEAR(Histogram.GetAverageTime(), (10.0 + 4.5e-6) / 5, 1e-12);
+
+    ThreadPoolDurationHistogram Histogram2;
+    Histogram2.AddSample(2000);
+    Histogram2 += Histogram;
+    EXPECT_EQ(Histogram2.NumSamples, Uint64{6});
+    EXPECT_EQ(Histogram2.Counts[2], Uint64{2});
+    EXPECT_DOUBLE_EQ(Histogram2.MinTime, 0);
+    EXPECT_DOUBLE_EQ(Histogram2.MaxTime, 10);
+}
+
+void TestStatistics(THREAD_POOL_SCHEDULER Scheduler)
+{
+    ThreadPoolProfilerCreateInfo ProfilerCI;
+    ProfilerCI.NumThreadSlots          = 4;
+    ProfilerCI.MaxTraceEventsPerThread = 1024;
+
+    RefCntAutoPtr<ThreadPoolProfiler> pProfiler = CreateThreadPoolProfiler(ProfilerCI);
+
+    ThreadPoolCreateInfo PoolCI;
+    PoolCI.NumThreads = 4;
+    PoolCI.Scheduler  = Scheduler;
+    PoolCI.pProfiler  = pProfiler;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
+
+    // Let the threads go idle
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+
+    constexpr Uint32 NumTasks = 100;
+    for (Uint32 i = 0; i < NumTasks; ++i)
+    {
+        EnqueueAsyncWork(pThreadPool,
+                         [](Uint32 ThreadId) {
+                             std::this_thread::sleep_for(std::chrono::microseconds{100});
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         });
+    }
+
+    // This task asks to be re-run once
+    std::atomic<int> NumRuns{0};
+    EnqueueAsyncWork(pThreadPool,
+                     [&NumRuns](Uint32 ThreadId) {
+                         return NumRuns.fetch_add(1) == 0 ? ASYNC_TASK_STATUS_NOT_STARTED : ASYNC_TASK_STATUS_COMPLETE;
+                     });
+
+    pThreadPool->WaitForAllTasks();
+
+    const Uint64         TotalRuns = NumTasks + 2;
+    ThreadPoolStatistics Stats     = pProfiler->GetStatistics();
+    EXPECT_EQ(Stats.RunTime.NumSamples, TotalRuns);
+    EXPECT_EQ(Stats.QueueLatency.NumSamples, TotalRuns);
+    EXPECT_EQ(Stats.NumTasksReenqueued, Uint64{1});
+    EXPECT_EQ(Stats.NumDroppedTraceEvents, Uint64{0});
+    EXPECT_GE(Stats.RunTime.TotalTime, NumTasks * 100e-6);
+    EXPECT_GT(Stats.ElapsedTime, 0);
+
+    ASSERT_EQ(Stats.Threads.size(), size_t{4});
+    Uint64 NumTasksRun = 0;
+    double BusyTime    = 0;
+    double IdleTime    = 0;
+    for (const ThreadPoolThreadStatistics& ThreadStats : Stats.Threads)
+    {
+        NumTasksRun += ThreadStats.NumTasksRun;
+        BusyTime += ThreadStats.BusyTime;
+        IdleTime += ThreadStats.IdleTime;
+    }
+    EXPECT_EQ(NumTasksRun, TotalRuns);
+    EXPECT_NEAR(BusyTime, Stats.RunTime.TotalTime, 1e-6);
+    EXPECT_GT(IdleTime, 0);
+
+    Uint64 NumBucketSamples = 0;
+    for (Uint64 Count : Stats.RunTime.Counts)
+        NumBucketSamples += Count;
+    EXPECT_EQ(NumBucketSamples, TotalRuns);
+
+    const std::string Trace = pProfiler->GetChromeTrace();
+    EXPECT_EQ(Trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["), size_t{0});
+    size_t NumEvents = 0;
+    for (size_t Pos = Trace.find("\"ph\":\"X\""); Pos != std::string::npos; Pos = Trace.find("\"ph\":\"X\"", Pos + 1))
+        ++NumEvents;
+    EXPECT_EQ(NumEvents, TotalRuns);
+    EXPECT_NE(Trace.find("\"status\":\"reenqueued\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"ph\":\"M\""), std::string::npos);
+
+    pProfiler->Reset();
+    Stats = pProfiler->GetStatistics();
+    EXPECT_EQ(Stats.RunTime.NumSamples, Uint64{0});
+    EXPECT_EQ(Stats.NumTasksReenqueued, Uint64{0});
+    EXPECT_EQ(pProfiler->GetChromeTrace().find("\"ph\":\"X\""), std::string::npos);
+}
+
+TEST(Common_ThreadPoolProfiler, Statistics)
+{
+    TestStatistics(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPoolProfiler, Statistics_WorkStealing)
+{
+    TestStatistics(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+TEST(Common_ThreadPoolProfiler, DroppedTraceEvents)
+{
+    ThreadPoolProfilerCreateInfo ProfilerCI;
+    ProfilerCI.NumThreadSlots          = 1;
+    ProfilerCI.MaxTraceEventsPerThread = 8;
+
+    RefCntAutoPtr<ThreadPoolProfiler> pProfiler = CreateThreadPoolProfiler(ProfilerCI);
+
+    ThreadPoolCreateInfo PoolCI;
+    PoolCI.pProfiler = pProfiler;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
+    for (Uint32 i = 0; i < 20; ++i)
+        EnqueueAsyncWork(pThreadPool, [](Uint32 ThreadId) { return ASYNC_TASK_STATUS_COMPLETE; });
+
+    while (pThreadPool->ProcessTask(0, false) && pThreadPool->GetQueueSize() > 0)
+    {
+    }
+
+    const ThreadPoolStatistics Stats = pProfiler->GetStatistics();
+    EXPECT_EQ(Stats.RunTime.NumSamples, Uint64{20});
+    EXPECT_EQ(Stats.NumDroppedTraceEvents, Uint64{12});
+}
+
+} // namespace
@@ -39,11 +39,19 @@ using namespace Diligent;
 namespace
 {
 
-TEST(Common_ThreadPool, EnqueueTask)
+RefCntAutoPtr<IThreadPool> CreateTestThreadPool(size_t NumThreads, THREAD_POOL_SCHEDULER Scheduler)
+{
+    ThreadPoolCreateInfo PoolCI{NumThreads};
+    PoolCI.Scheduler = Scheduler;
+    return CreateThreadPool(PoolCI);
+}
+
+void TestEnqueueTask(THREAD_POOL_SCHEDULER Scheduler)
 {
     constexpr Uint32     NumThreads = 4;
     constexpr Uint32     NumTasks   = 32;
     ThreadPoolCreateInfo PoolCI{NumThreads};
+    PoolCI.Scheduler = Scheduler;
 
     std::array<std::atomic<bool>, NumThreads> ThreadStarted{};
 
@@ -100,13 +108,23 @@ TEST(Common_ThreadPool, EnqueueTask)
     EXPECT_EQ(NumThreadsFinished.load(), PoolCI.NumThreads);
 }
 
+TEST(Common_ThreadPool, EnqueueTask)
+{
+    TestEnqueueTask(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
 
-TEST(Common_ThreadPool, ProcessTask)
+TEST(Common_ThreadPool, EnqueueTask_WorkStealing)
+{
+    TestEnqueueTask(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+
+void TestProcessTask(THREAD_POOL_SCHEDULER Scheduler)
 {
     constexpr Uint32 NumThreads = 4;
     constexpr Uint32 NumTasks   = 32;
 
-    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{0});
+    auto pThreadPool = CreateTestThreadPool(0, Scheduler);
     ASSERT_NE(pThreadPool, nullptr);
 
     std::vector<std::thread> WorkerThreads(NumThreads);
@@ -164,6 +182,16 @@ TEST(Common_ThreadPool, ProcessTask)
     }
 }
 
+TEST(Common_ThreadPool, ProcessTask)
+{
+    TestProcessTask(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, ProcessTask_WorkStealing)
+{
+    TestProcessTask(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
 class WaitTask : public AsyncTaskBase
 {
 public:
@@ -197,11 +225,11 @@ public:
     }
 };
 
-TEST(Common_ThreadPool, RemoveTask)
+void TestRemoveTask(THREAD_POOL_SCHEDULER Scheduler)
 {
     constexpr Uint32 NumThreads = 4;
 
-    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+    auto pThreadPool = CreateTestThreadPool(NumThreads, Scheduler);
     ASSERT_NE(pThreadPool, nullptr);
 
     Threading::Signal Signal;
@@ -213,6 +241,14 @@ TEST(Common_ThreadPool, RemoveTask)
         pThreadPool->EnqueueTask(Task);
     }
 
+    // Make sure that all threads are blocked before enqueuing other tasks.
+    // The work-stealing scheduler does not preserve the order of tasks
+    // with equal priorities, so a thread may otherwise pick a dummy task.
+    for (auto& Task : WaitTasks)
+    {
+        Task->WaitUntilRunning();
+    }
+
     std::array<RefCntAutoPtr<DummyTask>, 16> DummyTasks;
     for (auto& Task : DummyTasks)
     {
@@ -250,12 +286,22 @@ TEST(Common_ThreadPool, RemoveTask)
     EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
 }
 
+TEST(Common_ThreadPool, RemoveTask)
+{
+    TestRemoveTask(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
 
-TEST(Common_ThreadPool, Reprioritize)
+TEST(Common_ThreadPool, RemoveTask_WorkStealing)
+{
+    TestRemoveTask(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+
+void TestReprioritize(THREAD_POOL_SCHEDULER Scheduler)
 {
     constexpr Uint32 NumThreads = 4;
 
-    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+    auto pThreadPool = CreateTestThreadPool(NumThreads, Scheduler);
     ASSERT_NE(pThreadPool, nullptr);
 
     Threading::Signal Signal;
@@ -267,6 +313,14 @@ TEST(Common_ThreadPool, Reprioritize)
         pThreadPool->EnqueueTask(Task);
     }
 
+    // Make sure that all threads are blocked before enqueuing other tasks.
+    // The work-stealing scheduler does not preserve the order of tasks
+    // with equal priorities, so a thread may otherwise pick a dummy task.
+    for (auto& Task : WaitTasks)
+    {
+        Task->WaitUntilRunning();
+    }
+
     std::array<RefCntAutoPtr<DummyTask>, 16> DummyTasks;
     for (auto& Task : DummyTasks)
     {
@@ -298,6 +352,16 @@ TEST(Common_ThreadPool, Reprioritize)
     pThreadPool->WaitForAllTasks();
 }
 
+TEST(Common_ThreadPool, Reprioritize)
+{
+    TestReprioritize(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, Reprioritize_WorkStealing)
+{
+    TestReprioritize(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
 
 TEST(Common_ThreadPool, Priorities)
 {
@@ -362,11 +426,11 @@ TEST(Common_ThreadPool, Priorities)
 }
 
 
-TEST(Common_ThreadPool, Prerequisites)
+void TestPrerequisites(THREAD_POOL_SCHEDULER Scheduler)
 {
     for (Uint32 NumThreads : {1, 8})
     {
-        auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+        auto pThreadPool = CreateTestThreadPool(NumThreads, Scheduler);
         ASSERT_NE(pThreadPool, nullptr);
 
         constexpr Uint32               NumTasks = 16;
@@ -414,10 +478,242 @@ TEST(Common_ThreadPool, Prerequisites)
     }
 }
 
+TEST(Common_ThreadPool, Prerequisites)
+{
+    TestPrerequisites(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
 
-TEST(Common_ThreadPool, ReRunTasks)
+TEST(Common_ThreadPool, Prerequisites_WorkStealing)
+{
+    TestPrerequisites(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+
+void TestDependencyChain(THREAD_POOL_SCHEDULER Scheduler)
+{
+    // Process tasks manually to count the number of ProcessTask() calls
+    auto pThreadPool = CreateTestThreadPool(0, Scheduler);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    constexpr Uint32 NumTasks = 256;
+
+    std::vector<Uint32>                    RunCounters(NumTasks);
+    std::vector<Uint32>                    CompletionOrder;
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks(NumTasks);
+    for (Uint32 task = 0; task < NumTasks; ++task)
+    {
+        IAsyncTask* pPrereq = task > 0 ? Tasks[task - 1].RawPtr() : nullptr;
+
+        Tasks[task] = EnqueueAsyncWork(
+            pThreadPool, &pPrereq, pPrereq != nullptr ? 1 : 0,
+            [task, &RunCounters, &CompletionOrder](Uint32 ThreadId) //
+            {
+                ++RunCounters[task];
+                CompletionOrder.push_back(task);
+                return ASYNC_TASK_STATUS_COMPLETE;
+            });
+    }
+    // Pending tasks are counted as queued
+    EXPECT_EQ(pThreadPool->GetQueueSize(), NumTasks);
+
+    Uint32 NumProcessTaskCalls = 0;
+    while (pThreadPool->GetQueueSize() > 0 && NumProcessTaskCalls < NumTasks * 4)
+    {
+        pThreadPool->ProcessTask(0, /*WaitForTask = */ false);
+        ++NumProcessTaskCalls;
+    }
+
+    // Every call must run exactly one task: tasks whose prerequisites are not
+    // finished must never be taken from the queue and re-enqueued.
+    EXPECT_EQ(NumProcessTaskCalls, NumTasks);
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+    ASSERT_EQ(CompletionOrder.size(), size_t{NumTasks});
+    for (Uint32 task = 0; task < NumTasks; ++task)
+    {
+        EXPECT_EQ(RunCounters[task], 1u) << "task=" << task;
+        EXPECT_EQ(CompletionOrder[task], task);
+        EXPECT_EQ(Tasks[task]->GetStatus(), ASYNC_TASK_STATUS_COMPLETE);
+    }
+
+    pThreadPool->WaitForAllTasks();
+    pThreadPool->StopThreads();
+}
+
+TEST(Common_ThreadPool, DependencyChain)
 {
-    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    TestDependencyChain(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, DependencyChain_WorkStealing)
+{
+    TestDependencyChain(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+
+void TestWaitForDependentTasks(THREAD_POOL_SCHEDULER Scheduler)
+{
+    auto pThreadPool = CreateTestThreadPool(4, Scheduler);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    // A task that becomes ready when its prerequisite finishes may be run and finished
+    // by another thread right away. WaitForAllTasks() must not miss it.
+    for (Uint32 i = 0; i < 2000; ++i)
+    {
+        RefCntAutoPtr<IAsyncTask> pPrereq = EnqueueAsyncWork(pThreadPool, [](Uint32 ThreadId) { return ASYNC_TASK_STATUS_COMPLETE; });
+
+        IAsyncTask*               ppPrereqs[] = {pPrereq};
+        RefCntAutoPtr<IAsyncTask> pTask       = EnqueueAsyncWork(pThreadPool, ppPrereqs, 1, [](Uint32 ThreadId) { return ASYNC_TASK_STATUS_COMPLETE; });
+
+        pThreadPool->WaitForAllTasks();
+        EXPECT_EQ(pTask->GetStatus(), ASYNC_TASK_STATUS_COMPLETE) << "i=" << i;
+        EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+    }
+
+    pThreadPool->StopThreads();
+}
+
+TEST(Common_ThreadPool, WaitForDependentTasks)
+{
+    TestWaitForDependentTasks(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, WaitForDependentTasks_WorkStealing)
+{
+    TestWaitForDependentTasks(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+
+void TestDependencyGraph(THREAD_POOL_SCHEDULER Scheduler)
+{
+    auto pThreadPool = CreateTestThreadPool(8, Scheduler);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    // Several deep chains, every task also depends on the same-level task of the previous chain
+    constexpr Uint32 NumChains   = 8;
+    constexpr Uint32 ChainLength = 128;
+
+    std::vector<std::atomic<Uint32>>       RunCounters(NumChains * ChainLength);
+    std::vector<std::atomic<bool>>         TaskComplete(NumChains * ChainLength);
+    std::atomic<Uint32>                    NumOrderViolations{0};
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks(NumChains * ChainLength);
+    for (Uint32 level = 0; level < ChainLength; ++level)
+    {
+        for (Uint32 chain = 0; chain < NumChains; ++chain)
+        {
+            const Uint32 TaskIdx = chain * ChainLength + level;
+
+            std::vector<IAsyncTask*> Prerequisites;
+            std::vector<Uint32>      PrereqIndices;
+            if (level > 0)
+                PrereqIndices.push_back(TaskIdx - 1);
+            if (chain > 0)
+                PrereqIndices.push_back(TaskIdx - ChainLength);
+            for (Uint32 PrereqIdx : PrereqIndices)
+                Prerequisites.push_back(Tasks[PrereqIdx]);
+
+            Tasks[TaskIdx] = EnqueueAsyncWork(
+                pThreadPool, Prerequisites.data(), static_cast<Uint32>(Prerequisites.size()),
+                [TaskIdx, PrereqIndices, &RunCounters, &TaskComplete, &NumOrderViolations](Uint32 ThreadId) //
+                {
+                    RunCounters[TaskIdx].fetch_add(1);
+                    for (Uint32 PrereqIdx : PrereqIndices)
+                    {
+                        if (!TaskComplete[PrereqIdx].load())
+                            NumOrderViolations.fetch_add(1);
+                    }
+                    TaskComplete[TaskIdx].store(true);
+                    return ASYNC_TASK_STATUS_COMPLETE;
+                });
+        }
+    }
+
+    pThreadPool->WaitForAllTasks();
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+    EXPECT_EQ(NumOrderViolations.load(), 0u);
+    for (size_t i = 0; i < RunCounters.size(); ++i)
+    {
+        EXPECT_EQ(RunCounters[i].load(), 1u) << "i=" << i;
+    }
+}
+
+TEST(Common_ThreadPool, DependencyGraph)
+{
+    TestDependencyGraph(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, DependencyGraph_WorkStealing)
+{
+    TestDependencyGraph(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+
+void TestPendingTasks(THREAD_POOL_SCHEDULER Scheduler)
+{
+    auto pThreadPool = CreateTestThreadPool(2, Scheduler);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    // Prerequisite that is never enqueued and is released before it is finished
+    RefCntAutoPtr<DummyTask> pReleasedPrereq{MakeNewRCObj<DummyTask>()()};
+    // Prerequisite that blocks a worker thread
+    Threading::Signal       Signal;
+    RefCntAutoPtr<WaitTask> pWaitTask{MakeNewRCObj<WaitTask>()(Signal)};
+    pThreadPool->EnqueueTask(pWaitTask);
+
+    std::atomic<bool> Task1Complete{false};
+    std::atomic<bool> Task2Complete{false};
+
+    IAsyncTask* pPrereq1 = pReleasedPrereq;
+    auto        pTask1   = EnqueueAsyncWork(pThreadPool, &pPrereq1, 1,
+                                   [&Task1Complete](Uint32 ThreadId) //
+                                   {
+                                       Task1Complete.store(true);
+                                       return ASYNC_TASK_STATUS_COMPLETE;
+                                   });
+
+    IAsyncTask* pPrereq2 = pWaitTask;
+    auto        pTask2   = EnqueueAsyncWork(pThreadPool, &pPrereq2, 1,
+                                   [&Task2Complete](Uint32 ThreadId) //
+                                   {
+                                       Task2Complete.store(true);
+                                       return ASYNC_TASK_STATUS_COMPLETE;
+                                   });
+
+    EXPECT_GE(pThreadPool->GetQueueSize(), 2u);
+    EXPECT_FALSE(Task1Complete.load());
+    EXPECT_FALSE(Task2Complete.load());
+
+    // Pending tasks can be reprioritized and removed
+    pTask2->SetPriority(10);
+    EXPECT_TRUE(pThreadPool->ReprioritizeTask(pTask2));
+    EXPECT_TRUE(pThreadPool->RemoveTask(pTask2));
+    EXPECT_FALSE(pThreadPool->RemoveTask(pTask2));
+
+    // Releasing the unfinished prerequisite starts the dependent task
+    pReleasedPrereq.Release();
+    pTask1->WaitForCompletion();
+    EXPECT_TRUE(Task1Complete.load());
+
+    Signal.Trigger(true, 1);
+    pThreadPool->WaitForAllTasks();
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+    EXPECT_FALSE(Task2Complete.load());
+    EXPECT_EQ(pTask2->GetStatus(), ASYNC_TASK_STATUS_NOT_STARTED);
+}
+
+TEST(Common_ThreadPool, PendingTasks)
+{
+    TestPendingTasks(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, PendingTasks_WorkStealing)
+{
+    TestPendingTasks(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+
+void TestReRunTasks(THREAD_POOL_SCHEDULER Scheduler)
+{
+    auto pThreadPool = CreateTestThreadPool(4, Scheduler);
     ASSERT_NE(pThreadPool, nullptr);
 
     constexpr Uint32              NumTasks = 32;
@@ -442,4 +738,347 @@ TEST(Common_ThreadPool, ReRunTasks)
         EXPECT_EQ(ReRunCounters[i], 0) << i;
 }
 
+TEST(Common_ThreadPool, ReRunTasks)
+{
+    TestReRunTasks(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, ReRunTasks_WorkStealing)
+{
+    TestReRunTasks(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
+
+TEST(Common_ThreadPool, PriorityBands_WorkStealing)
+{
+    ThreadPoolCreateInfo PoolCI{1};
+    PoolCI.Scheduler        = THREAD_POOL_SCHEDULER_WORK_STEALING;
+    PoolCI.NumPriorityBands = 4;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    Threading::Signal       Signal;
+    RefCntAutoPtr<WaitTask> pWaitTask{MakeNewRCObj<WaitTask>()(Signal)};
+    pThreadPool->EnqueueTask(pWaitTask);
+    pWaitTask->WaitUntilRunning();
+
+    // Priorities are quantized to bands [0, 3]
+    const std::array<float, 8> Priorities = {-1.f, 0.f, 0.5f, 1.f, 2.5f, 3.f, 100.f, 1.5f};
+    const std::array<int, 8>   Bands      = {0, 0, 0, 1, 2, 3, 3, 1};
+
+    std::vector<int> CompletionOrder;
+    for (size_t i = 0; i < Priorities.size(); ++i)
+    {
+        EnqueueAsyncWork(
+            pThreadPool,
+            [&CompletionOrder, i](Uint32 ThreadId) //
+            {
+                CompletionOrder.push_back(static_cast<int>(i));
+                return ASYNC_TASK_STATUS_COMPLETE;
+            },
+            Priorities[i]);
+    }
+    EXPECT_EQ(pThreadPool->GetQueueSize(), Priorities.size());
+
+    Signal.Trigger(true, 1);
+    pThreadPool->WaitForAllTasks();
+
+    ASSERT_EQ(CompletionOrder.size(), Priorities.size());
+    for (size_t i = 1; i < CompletionOrder.size(); ++i)
+    {
+        EXPECT_GE(Bands[CompletionOrder[i - 1]], Bands[CompletionOrder[i]]) << "i=" << i;
+    }
+}
+
+
+TEST(Common_ThreadPool, NestedTasks_WorkStealing)
+{
+    ThreadPoolCreateInfo PoolCI{4};
+    PoolCI.Scheduler = THREAD_POOL_SCHEDULER_WORK_STEALING;
+
+    auto pThreadPool = CreateThreadPool(PoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    constexpr Uint32 NumRootTasks  = 16;
+    constexpr Uint32 NumChildTasks = 64;
+
+    std::atomic<Uint32> NumTasksCompleted{0};
+    for (Uint32 i = 0; i < NumRootTasks; ++i)
+    {
+        EnqueueAsyncWork(pThreadPool,
+                         [&NumTasksCompleted, pPool = pThreadPool.RawPtr()](Uint32 ThreadId) //
+                         {
+                             // Child tasks are enqueued from the worker thread
+                             for (Uint32 j = 0; j < NumChildTasks; ++j)
+                             {
+                                 EnqueueAsyncWork(pPool,
+                                                  [&NumTasksCompleted](Uint32 ThreadId) //
+                                                  {
+                                                      NumTasksCompleted.fetch_add(1);
+                                                      return ASYNC_TASK_STATUS_COMPLETE;
+                                                  });
+                             }
+                             NumTasksCompleted.fetch_add(1);
+                             return ASYNC_TASK_STATUS_COMPLETE;
+                         });
+    }
+
+    pThreadPool->WaitForAllTasks();
+    EXPECT_EQ(NumTasksCompleted.load(), NumRootTasks * (NumChildTasks + 1));
+    EXPECT_EQ(pThreadPool->GetQueueSize(), 0u);
+    EXPECT_EQ(pThreadPool->GetRunningTaskCount(), 0u);
+}
+
+
+TEST(Common_ThreadPool, WaitForTasks)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    Threading::Signal Signal0;
+    Threading::Signal Signal1;
+
+    RefCntAutoPtr<WaitTask> pTask0{MakeNewRCObj<WaitTask>()(Signal0)};
+    RefCntAutoPtr<WaitTask> pTask1{MakeNewRCObj<WaitTask>()(Signal1)};
+    pThreadPool->EnqueueTask(pTask0);
+    pThreadPool->EnqueueTask(pTask1);
+
+    std::array<IAsyncTask*, 4> ppTasks = {nullptr, pTask0, nullptr, pTask1};
+
+    pTask0->WaitUntilRunning();
+    pTask1->WaitUntilRunning();
+
+    std::thread Trigger1{
+        [&Signal1]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+            Signal1.Trigger(true, 1);
+        }};
+    EXPECT_EQ(WaitForAnyTask(ppTasks.data(), static_cast<Uint32>(ppTasks.size())), 3u);
+    EXPECT_TRUE(pTask1->IsFinished());
+    EXPECT_FALSE(pTask0->IsFinished());
+    Trigger1.join();
+
+    // The finished task is found right away
+    EXPECT_EQ(WaitForAnyTask(ppTasks.data(), static_cast<Uint32>(ppTasks.size())), 3u);
+
+    std::thread Trigger0{
+        [&Signal0]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+            Signal0.Trigger(true, 1);
+        }};
+    WaitForAllTasks(ppTasks.data(), static_cast<Uint32>(ppTasks.size()));
+    EXPECT_TRUE(pTask0->IsFinished());
+    EXPECT_TRUE(pTask1->IsFinished());
+    Trigger0.join();
+
+    // Arrays with no tasks
+    std::array<IAsyncTask*, 2> ppNullTasks = {};
+    EXPECT_EQ(WaitForAnyTask(ppNullTasks.data(), static_cast<Uint32>(ppNullTasks.size())), 2u);
+    EXPECT_EQ(WaitForAnyTask(nullptr, 0), 0u);
+    WaitForAllTasks(ppNullTasks.data(), static_cast<Uint32>(ppNullTasks.size()));
+    WaitForAllTasks(nullptr, 0);
+
+    pThreadPool->WaitForAllTasks();
+}
+
+TEST(Common_ThreadPool, WaitForAnyTaskRemovesCallbacks)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{2});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    Threading::Signal       LongTaskSignal;
+    RefCntAutoPtr<WaitTask> pLongTask{MakeNewRCObj<WaitTask>()(LongTaskSignal)};
+    pThreadPool->EnqueueTask(pLongTask);
+    pLongTask->WaitUntilRunning();
+
+    // Repeatedly wait for the long-running task and a short one that finishes first
+    for (Uint32 i = 0; i < 20; ++i)
+    {
+        Threading::Signal       ShortTaskSignal;
+        RefCntAutoPtr<WaitTask> pShortTask{MakeNewRCObj<WaitTask>()(ShortTaskSignal)};
+        pThreadPool->EnqueueTask(pShortTask);
+
+        std::thread Trigger{
+            [&ShortTaskSignal]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                ShortTaskSignal.Trigger(true, 1);
+            }};
+
+        std::array<IAsyncTask*, 2> ppTasks = {pLongTask, pShortTask};
+        EXPECT_EQ(WaitForAnyTask(ppTasks.data(), static_cast<Uint32>(ppTasks.size())), 1u);
+        Trigger.join();
+
+        // The callback registered for the long-running task must have been removed
+        EXPECT_EQ(pLongTask->GetCompletionCallbackCount(), size_t{0}) << "Iteration " << i;
+    }
+    EXPECT_FALSE(pLongTask->IsFinished());
+
+    LongTaskSignal.Trigger(true, 1);
+    pThreadPool->WaitForAllTasks();
+    EXPECT_EQ(pLongTask->GetCompletionCallbackCount(), size_t{0});
+}
+
+
+TEST(Common_ThreadPool, WaitForCompletion)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{1});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    Threading::Signal       Signal;
+    RefCntAutoPtr<WaitTask> pTask{MakeNewRCObj<WaitTask>()(Signal)};
+    pThreadPool->EnqueueTask(pTask);
+
+    // Several threads block on the same task
+    std::vector<std::thread> Waiters(4);
+    std::atomic<Uint32>      NumWaitersFinished{0};
+    for (auto& Waiter : Waiters)
+    {
+        Waiter = std::thread{
+            [&pTask, &NumWaitersFinished]() {
+                pTask->WaitUntilRunning();
+                pTask->WaitForCompletion();
+                EXPECT_TRUE(pTask->IsFinished());
+                NumWaitersFinished.fetch_add(1);
+            }};
+    }
+
+    pTask->WaitUntilRunning();
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    EXPECT_EQ(NumWaitersFinished.load(), 0u);
+
+    Signal.Trigger(true, 1);
+    for (auto& Waiter : Waiters)
+        Waiter.join();
+    EXPECT_EQ(NumWaitersFinished.load(), Waiters.size());
+
+    pThreadPool->WaitForAllTasks();
+}
+
+
+// Two NUMA nodes, 4 cores per node, 2 threads per core.
+// Processor IDs are above 64 to test large systems.
+ProcessorTopology CreateTestProcessorTopology()
+{
+    ProcessorTopology Topology;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        LogicalProcessorInfo Processor;
+        Processor.Id        = 100 + i;
+        Processor.CoreIndex = i % 8;
+        Processor.SMTIndex  = i / 8;
+        Processor.PackageId = (i % 8) / 4;
+        Processor.NUMANode  = (i % 8) / 4;
+        Topology.LogicalProcessors.push_back(Processor);
+    }
+    Topology.NumCores     = 8;
+    Topology.NumPackages  = 2;
+    Topology.NumNUMANodes = 2;
+    return Topology;
+}
+
+TEST(Common_ThreadPool, WorkerAffinity)
+{
+    const ProcessorTopology Topology = CreateTestProcessorTopology();
+
+    ThreadPoolAffinityInfo Affinity;
+    EXPECT_TRUE(GetThreadPoolWorkerAffinity(Topology, Affinity, 4).empty());
+
+    Affinity.Mode = THREAD_POOL_AFFINITY_MODE_PROCESSOR;
+    {
+        // Physical cores first, then SMT siblings, then wrap around
+        const auto WorkerAffinity = GetThreadPoolWorkerAffinity(Topology, Affinity, 18);
+        ASSERT_EQ(WorkerAffinity.size(), size_t{18});
+        for (size_t i = 0; i < WorkerAffinity.size(); ++i)
+        {
+            ASSERT_EQ(WorkerAffinity[i].size(), size_t{1});
+            EXPECT_EQ(WorkerAffinity[i][0], 100 + i % 16) << "Worker " << i;
+        }
+    }
+
+    Affinity.PreferPhysicalCores = false;
+    {
+        // SMT siblings are assigned to consecutive workers
+        const auto WorkerAffinity = GetThreadPoolWorkerAffinity(Topology, Affinity, 4);
+        ASSERT_EQ(WorkerAffinity.size(), size_t{4});
+        EXPECT_EQ(WorkerAffinity[0], std::vector<Uint32>{100});
+        EXPECT_EQ(WorkerAffinity[1], std::vector<Uint32>{108});
+        EXPECT_EQ(WorkerAffinity[2], std::vector<Uint32>{101});
+        EXPECT_EQ(WorkerAffinity[3], std::vector<Uint32>{109});
+    }
+
+    Affinity.PreferPhysicalCores = true;
+    Affinity.AllowedProcessors   = {105, 113, 106, 1000};
+    {
+        const auto WorkerAffinity = GetThreadPoolWorkerAffinity(Topology, Affinity, 3);
+        ASSERT_EQ(WorkerAffinity.size(), size_t{3});
+        EXPECT_EQ(WorkerAffinity[0], std::vector<Uint32>{105});
+        EXPECT_EQ(WorkerAffinity[1], std::vector<Uint32>{106});
+        EXPECT_EQ(WorkerAffinity[2], std::vector<Uint32>{113});
+    }
+
+    Affinity.AllowedProcessors = {1000};
+    EXPECT_TRUE(GetThreadPoolWorkerAffinity(Topology, Affinity, 4).empty());
+
+    Affinity.Mode = THREAD_POOL_AFFINITY_MODE_NUMA_NODE;
+    Affinity.AllowedProcessors.clear();
+    {
+        const std::vector<Uint32> Node0{100, 101, 102, 103, 108, 109, 110, 111};
+        const std::vector<Uint32> Node1{104, 105, 106, 107, 112, 113, 114, 115};
+
+        const auto WorkerAffinity = GetThreadPoolWorkerAffinity(Topology, Affinity, 5);
+        ASSERT_EQ(WorkerAffinity.size(), size_t{5});
+        EXPECT_EQ(WorkerAffinity[0], Node0);
+        EXPECT_EQ(WorkerAffinity[1], Node0);
+        EXPECT_EQ(WorkerAffinity[2], Node0);
+        EXPECT_EQ(WorkerAffinity[3], Node1);
+        EXPECT_EQ(WorkerAffinity[4], Node1);
+    }
+
+    // Workers are distributed in proportion to the number of allowed processors in each node
+    Affinity.AllowedProcessors = {100, 104, 105, 106};
+    {
+        const auto WorkerAffinity = GetThreadPoolWorkerAffinity(Topology, Affinity, 4);
+        ASSERT_EQ(WorkerAffinity.size(), size_t{4});
+        EXPECT_EQ(WorkerAffinity[0], std::vector<Uint32>{100});
+        for (size_t i = 1; i < WorkerAffinity.size(); ++i)
+            EXPECT_EQ(WorkerAffinity[i], (std::vector<Uint32>{104, 105, 106}));
+    }
+}
+
+void TestAffinity(THREAD_POOL_SCHEDULER Scheduler)
+{
+    for (auto Mode : {THREAD_POOL_AFFINITY_MODE_PROCESSOR, THREAD_POOL_AFFINITY_MODE_NUMA_NODE})
+    {
+        ThreadPoolCreateInfo PoolCI;
+        PoolCI.NumThreads    = 4;
+        PoolCI.Scheduler     = Scheduler;
+        PoolCI.Affinity.Mode = Mode;
+
+        auto pThreadPool = CreateThreadPool(PoolCI);
+
+        std::atomic<int> NumTasksRun{0};
+        for (int i = 0; i < 16; ++i)
+        {
+            EnqueueAsyncWork(pThreadPool,
+                             [&NumTasksRun](Uint32 ThreadId) {
+                                 NumTasksRun.fetch_add(1);
+                                 return ASYNC_TASK_STATUS_COMPLETE;
+                             });
+        }
+        pThreadPool->WaitForAllTasks();
+        EXPECT_EQ(NumTasksRun.load(), 16);
+    }
+}
+
+TEST(Common_ThreadPool, Affinity)
+{
+    TestAffinity(THREAD_POOL_SCHEDULER_PRIORITY_QUEUE);
+}
+
+TEST(Common_ThreadPool, Affinity_WorkStealing)
+{
+    TestAffinity(THREAD_POOL_SCHEDULER_WORK_STEALING);
+}
+
 } // namespace
@@ -27,8 +27,17 @@
 
 #include "PlatformMisc.hpp"
 
+#include <string>
+#include <thread>
+
 #include "gtest/gtest.h"
 
+#if PLATFORM_LINUX
+#    include "FileSystem.hpp"
+#    include "FileWrapper.hpp"
+#    include "TempDirectory.hpp"
+#endif
+
 using namespace Diligent;
 
 namespace
@@ -114,4 +123,162 @@ TEST(Platforms_PlatformMisc, SwapBytes)
     EXPECT_EQ(PlatformMisc::SwapBytes(fswap), f);
 }
 
+void TestProcessorTopology(const ProcessorTopology& Topology)
+{
+    ASSERT_FALSE(Topology.LogicalProcessors.empty());
+    EXPECT_GE(Topology.NumCores, Uint32{1});
+    EXPECT_LE(Topology.NumCores, Topology.LogicalProcessors.size());
+    EXPECT_GE(Topology.NumPackages, Uint32{1});
+    EXPECT_GE(Topology.NumNUMANodes, Uint32{1});
+
+    std::vector<Uint32> NumFirstSiblings(Topology.NumCores);
+    for (size_t i = 0; i < Topology.LogicalProcessors.size(); ++i)
+    {
+        const LogicalProcessorInfo& Processor = Topology.LogicalProcessors[i];
+        if (i > 0)
+        {
+            EXPECT_GT(Processor.Id, Topology.LogicalProcessors[i - 1].Id);
+        }
+        ASSERT_LT(Processor.CoreIndex, Topology.NumCores);
+        if (Processor.SMTIndex == 0)
+            ++NumFirstSiblings[Processor.CoreIndex];
+    }
+    for (Uint32 NumSiblings : NumFirstSiblings)
+        EXPECT_EQ(NumSiblings, Uint32{1});
+}
+
+TEST(Platforms_PlatformMisc, GetProcessorTopology)
+{
+    TestProcessorTopology(PlatformMisc::GetProcessorTopology());
+    TestProcessorTopology(BasicPlatformMisc::GetProcessorTopology());
+}
+
+#if PLATFORM_LINUX
+static void WriteFakeSysFsFile(const std::string& Root, const std::string& Dir, const std::string& Name, const std::string& Contents)
+{
+    const std::string DirPath = Root + "/" + Dir;
+    ASSERT_TRUE(FileSystem::PathExists(DirPath.c_str()) || FileSystem::CreateDirectory(DirPath.c_str()));
+
+    const std::string FilePath = DirPath + "/" + Name;
+    FileWrapper       File{FilePath.c_str(), EFileAccessMode::Overwrite};
+    ASSERT_TRUE(File);
+    EXPECT_TRUE(File->Write(Contents.data(), Contents.size()));
+}
+
+TEST(Platforms_PlatformMisc, ReadProcessorTopology)
+{
+    Testing::TempDirectory TmpDir;
+    const std::string&     Root = TmpDir.Get();
+
+    // Two packages, each with four cores, two threads per core and its own NUMA node.
+    // CPUs 0-7 are the first siblings and CPUs 8-15 are the second ones.
+    // CPU 6 is offline. Core IDs are only unique within a package.
+    WriteFakeSysFsFile(Root, "devices/system/cpu", "online", "0-5,7-15\n");
+    for (Uint32 cpu = 0; cpu < 16; ++cpu)
+    {
+        const std::string TopologyDir = "devices/system/cpu/cpu" + std::to_string(cpu) + "/topology";
+        WriteFakeSysFsFile(Root, TopologyDir, "core_id", std::to_string(cpu % 4) + "\n");
+        WriteFakeSysFsFile(Root, TopologyDir, "physical_package_id", std::to_string((cpu % 8) / 4) + "\n");
+    }
+    WriteFakeSysFsFile(Root, "devices/system/node", "online", "0-1\n");
+    WriteFakeSysFsFile(Root, "devices/system/node/node0", "cpulist", "0-3,8-11\n");
+    WriteFakeSysFsFile(Root, "devices/system/node/node1", "cpulist", "4-7,12-15\n");
+
+    const ProcessorTopology Topology = LinuxMisc::ReadProcessorTopology(Root.c_str());
+    TestProcessorTopology(Topology);
+    ASSERT_EQ(Topology.LogicalProcessors.size(), size_t{15});
+    EXPECT_EQ(Topology.NumCores, Uint32{8});
+    EXPECT_EQ(Topology.NumPackages, Uint32{2});
+    EXPECT_EQ(Topology.NumNUMANodes, Uint32{2});
+
+    for (const LogicalProcessorInfo& Processor : Topology.LogicalProcessors)
+    {
+        const Uint32 cpu = Processor.Id;
+        EXPECT_NE(cpu, Uint32{6});
+        EXPECT_EQ(Processor.PackageId, (cpu % 8) / 4) << "CPU " << cpu;
+        EXPECT_EQ(Processor.NUMANode, (cpu % 8) / 4) << "CPU " << cpu;
+        // CPU 14 is the only thread of its core as its sibling (CPU 6) is offline
+        EXPECT_EQ(Processor.SMTIndex, cpu < 8 || cpu == 14 ? Uint32{0} : Uint32{1}) << "CPU " << cpu;
+    }
+
+    auto FindProcessor = [&](Uint32 Id) {
+        for (const LogicalProcessorInfo& Processor : Topology.LogicalProcessors)
+        {
+            if (Processor.Id == Id)
+                return Processor;
+        }
+        ADD_FAILURE() << "CPU " << Id << " not found";
+        return LogicalProcessorInfo{};
+    };
+    for (Uint32 cpu = 8; cpu < 16; ++cpu)
+    {
+        if (cpu != 14)
+        {
+            EXPECT_EQ(FindProcessor(cpu).CoreIndex, FindProcessor(cpu - 8).CoreIndex) << "CPU " << cpu;
+        }
+    }
+    // Same core ID in different packages
+    EXPECT_NE(FindProcessor(0).CoreIndex, FindProcessor(4).CoreIndex);
+
+    // No NUMA information
+    FileSystem::DeleteDirectory((Root + "/devices/system/node").c_str());
+    const ProcessorTopology Topology2 = LinuxMisc::ReadProcessorTopology(Root.c_str());
+    TestProcessorTopology(Topology2);
+    EXPECT_EQ(Topology2.NumNUMANodes, Uint32{1});
+    EXPECT_EQ(Topology2.NumCores, Uint32{8});
+
+    // No sysfs
+    EXPECT_TRUE(LinuxMisc::ReadProcessorTopology((Root + "/nonexistent").c_str()).LogicalProcessors.empty());
+}
+
+TEST(Platforms_PlatformMisc, SetCurrentThreadProcessorSet)
+{
+    const ProcessorTopology Topology = PlatformMisc::GetProcessorTopology();
+    ASSERT_FALSE(Topology.LogicalProcessors.empty());
+
+    std::vector<Uint32> AllProcessors;
+    for (const LogicalProcessorInfo& Processor : Topology.LogicalProcessors)
+        AllProcessors.push_back(Processor.Id);
+
+    std::thread Thread{[&]() {
+        // The processor the thread is running on is always allowed
+        const Uint32 CurrProcessor = static_cast<Uint32>(sched_getcpu());
+        EXPECT_TRUE(PlatformMisc::SetCurrentThreadProcessorSet(&CurrProcessor, 1));
+        EXPECT_EQ(sched_getcpu(), static_cast<int>(CurrProcessor));
+        EXPECT_TRUE(PlatformMisc::SetCurrentThreadProcessorSet(AllProcessors.data(), AllProcessors.size()));
+    }};
+    Thread.join();
+
+    EXPECT_FALSE(PlatformMisc::SetCurrentThreadProcessorSet(nullptr, 0));
+}
+#endif
+
+TEST(Platforms_PlatformMisc, GetCPUFeatures)
+{
+    const CPUFeatures Features = PlatformMisc::GetCPUFeatures();
+
+    // The features the compiler was allowed to use must be supported
+#if defined(__x86_64__) || defined(_M_X64)
+    EXPECT_TRUE(Features.SSE2);
+#endif
+#if defined(__SSE4_1__)
+    EXPECT_TRUE(Features.SSE41);
+#endif
+#if defined(__AVX2__)
+    EXPECT_TRUE(Features.AVX2);
+#endif
+#if defined(__F16C__)
+    EXPECT_TRUE(Features.F16C);
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64)
+    EXPECT_TRUE(Features.NEON);
+#endif
+
+    // x86 and ARM features are mutually exclusive
+    if (Features.NEON)
+    {
+        EXPECT_FALSE(Features.SSE2 || Features.AVX2);
+    }
+}
+
 } // namespace
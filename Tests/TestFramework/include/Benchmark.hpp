@@ -0,0 +1,102 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Utilities shared by the performance benchmarks.
+///
+/// Benchmarks are regular tests whose names start with DISABLED_, so that they do not run
+/// as part of the test suite. To run them, use
+///
+///     --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+
+#include <algorithm>
+#include <initializer_list>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "BasicTypes.h"
+#include "Timer.hpp"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+/// Runs the function NumRuns times and returns the shortest run time, in seconds.
+template <typename FuncType>
+double MeasureMinTime(Uint32 NumRuns, FuncType&& Func)
+{
+    double MinTime = std::numeric_limits<double>::max();
+    for (Uint32 run = 0; run < NumRuns; ++run)
+    {
+        Timer T;
+        Func();
+        MinTime = std::min(MinTime, T.GetElapsedTime());
+    }
+    return MinTime;
+}
+
+/// Returns the number of operations per second.
+inline double GetRate(double NumOperations, double ElapsedTime)
+{
+    return ElapsedTime > 0 ? NumOperations / ElapsedTime : 0;
+}
+
+/// Returns the thread counts for scaling benchmarks: powers of two that are less
+/// than the number of hardware threads, followed by the number of hardware threads.
+std::vector<Uint32> GetBenchmarkThreadCounts();
+
+/// Collects benchmark results and prints them as a table with aligned columns.
+class BenchmarkTable
+{
+public:
+    BenchmarkTable(std::string Title, std::initializer_list<std::string> Columns);
+
+    /// Adds a row. The number of cells must match the number of columns.
+    void AddRow(std::initializer_list<std::string> Cells);
+
+    /// Prints the table to the log.
+    void Print() const;
+
+    /// Formats the value with the given number of digits after the decimal point.
+    static std::string Number(double Value, int Precision = 0);
+
+    /// Formats the ratio of two values, e.g. "1.25x".
+    static std::string Ratio(double Value, double RefValue, int Precision = 2);
+
+private:
+    std::string                           m_Title;
+    std::vector<std::vector<std::string>> m_Rows;
+};
+
+} // namespace Testing
+
+} // namespace Diligent
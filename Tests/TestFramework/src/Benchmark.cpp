@@ -0,0 +1,102 @@
+/*
+ *  Copyright 2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "Benchmark.hpp"
+
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+std::vector<Uint32> GetBenchmarkThreadCounts()
+{
+    const Uint32        NumCores = std::max(std::thread::hardware_concurrency(), 1u);
+    std::vector<Uint32> ThreadCounts;
+    for (Uint32 NumThreads = 1; NumThreads < NumCores; NumThreads *= 2)
+        ThreadCounts.push_back(NumThreads);
+    ThreadCounts.push_back(NumCores);
+    return ThreadCounts;
+}
+
+BenchmarkTable::BenchmarkTable(std::string Title, std::initializer_list<std::string> Columns) :
+    m_Title{std::move(Title)},
+    m_Rows{Columns}
+{
+}
+
+void BenchmarkTable::AddRow(std::initializer_list<std::string> Cells)
+{
+    VERIFY(Cells.size() == m_Rows[0].size(), "The number of cells (", Cells.size(), ") does not match the number of columns (", m_Rows[0].size(), ")");
+    m_Rows.emplace_back(Cells);
+}
+
+void BenchmarkTable::Print() const
+{
+    std::vector<size_t> Widths(m_Rows[0].size());
+    for (const std::vector<std::string>& Row : m_Rows)
+    {
+        for (size_t i = 0; i < Row.size() && i < Widths.size(); ++i)
+            Widths[i] = std::max(Widths[i], Row[i].length());
+    }
+
+    std::stringstream ss;
+    ss << m_Title;
+    for (const std::vector<std::string>& Row : m_Rows)
+    {
+        ss << '\n';
+        for (size_t i = 0; i < Row.size() && i < Widths.size(); ++i)
+        {
+            if (i > 0)
+                ss << " | ";
+            ss << std::setw(static_cast<int>(Widths[i])) << Row[i];
+        }
+    }
+    LOG_INFO_MESSAGE(ss.str());
+}
+
+std::string BenchmarkTable::Number(double Value, int Precision)
+{
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(Precision) << Value;
+    return ss.str();
+}
+
+std::string BenchmarkTable::Ratio(double Value, double RefValue, int Precision)
+{
+    return Number(RefValue != 0 ? Value / RefValue : 0.0, Precision) + 'x';
+}
+
+} // namespace Testing
+
+} // namespace Diligent